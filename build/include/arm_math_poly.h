@@ -0,0 +1,121 @@
+/*
+ * Public helpers for evaluating polynomials with various schemes.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef _ARM_MATH_POLY_H
+#define _ARM_MATH_POLY_H
+
+/* Evaluation of P(x) = c[0] + c[1] x + ... + c[N] x^N, using the same
+   helpers as the library routines.  Available schemes and orders N are:
+
+     horner_N (x, c)				N = 2 .. 12
+     pw_horner_N (x, x2, c)			N = 4 .. 18
+     estrin_N (x, x2, x4, c)			N = 4 .. 7
+     estrin_N (x, x2, x4, x8, c)		N = 8 .. 15
+     estrin_N (x, x2, x4, x8, x16, c)		N = 16 .. 19
+
+   where x2 = x^2, x4 = x^4, ... are computed by the caller, so that they can
+   be shared between several polynomials.  Horner has the shortest dependency
+   chain in number of operations but the longest latency, Estrin the lowest
+   latency and pairwise Horner is a trade-off between the two.
+
+   Helpers are named as follows:
+   - scalar:  arm_math_[scheme]_[N]_f32 and arm_math_[scheme]_[N]_f64.
+   - AdvSIMD: arm_math_v_[scheme]_[N]_f32 and arm_math_v_[scheme]_[N]_f64,
+     c is an array of vectors.
+   - SVE:     arm_math_sv_[scheme]_[N]_f32_x and
+	      arm_math_sv_[scheme]_[N]_f64_x, take a governing predicate
+	      as first argument, c is an array of scalars and inactive
+	      lanes are undefined.
+   Horner is provided from order 2 and Estrin from order 4 for all types.
+
+   In C11 the scalar and AdvSIMD helpers can be selected by type of x:
+
+     arm_math_poly (estrin, 7, x, x2, x4, c)
+
+   Evaluation is fused (fma) in all cases.  */
+
+#include <math.h>
+
+#define ARM_MATH_POLY_VTYPE float
+#define ARM_MATH_POLY_FMA fmaf
+#define ARM_MATH_POLY_WRAP(f) arm_math_##f##_f32
+#include "arm_math_poly_generic.h"
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_FMA
+#undef ARM_MATH_POLY_VTYPE
+
+#define ARM_MATH_POLY_VTYPE double
+#define ARM_MATH_POLY_FMA fma
+#define ARM_MATH_POLY_WRAP(f) arm_math_##f##_f64
+#include "arm_math_poly_generic.h"
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_FMA
+#undef ARM_MATH_POLY_VTYPE
+
+#if __aarch64__ && defined(__ARM_NEON)
+# include <arm_neon.h>
+
+# define ARM_MATH_POLY_VTYPE float32x4_t
+# define ARM_MATH_POLY_FMA(x, y, z) vfmaq_f32 (z, x, y)
+# define ARM_MATH_POLY_WRAP(f) arm_math_v_##f##_f32
+# include "arm_math_poly_generic.h"
+# undef ARM_MATH_POLY_WRAP
+# undef ARM_MATH_POLY_FMA
+# undef ARM_MATH_POLY_VTYPE
+
+# define ARM_MATH_POLY_VTYPE float64x2_t
+# define ARM_MATH_POLY_FMA(x, y, z) vfmaq_f64 (z, x, y)
+# define ARM_MATH_POLY_WRAP(f) arm_math_v_##f##_f64
+# include "arm_math_poly_generic.h"
+# undef ARM_MATH_POLY_WRAP
+# undef ARM_MATH_POLY_FMA
+# undef ARM_MATH_POLY_VTYPE
+
+# define ARM_MATH_POLY_V(s, n)                                                \
+    , float32x4_t : arm_math_v_##s##_##n##_f32,                               \
+      float64x2_t : arm_math_v_##s##_##n##_f64
+#else
+# define ARM_MATH_POLY_V(s, n)
+#endif
+
+#if __aarch64__ && defined(__ARM_FEATURE_SVE)
+# include <arm_sve.h>
+
+# define ARM_MATH_POLY_PTRUE svptrue_b32 ()
+# define ARM_MATH_POLY_VTYPE svfloat32_t
+# define ARM_MATH_POLY_STYPE float
+# define ARM_MATH_POLY_WRAP(f) arm_math_sv_##f##_f32_x
+# define ARM_MATH_POLY_DUP svdup_f32
+# include "arm_math_sv_poly_generic.h"
+# undef ARM_MATH_POLY_DUP
+# undef ARM_MATH_POLY_WRAP
+# undef ARM_MATH_POLY_STYPE
+# undef ARM_MATH_POLY_VTYPE
+# undef ARM_MATH_POLY_PTRUE
+
+# define ARM_MATH_POLY_PTRUE svptrue_b64 ()
+# define ARM_MATH_POLY_VTYPE svfloat64_t
+# define ARM_MATH_POLY_STYPE double
+# define ARM_MATH_POLY_WRAP(f) arm_math_sv_##f##_f64_x
+# define ARM_MATH_POLY_DUP svdup_f64
+# include "arm_math_sv_poly_generic.h"
+# undef ARM_MATH_POLY_DUP
+# undef ARM_MATH_POLY_WRAP
+# undef ARM_MATH_POLY_STYPE
+# undef ARM_MATH_POLY_VTYPE
+# undef ARM_MATH_POLY_PTRUE
+#endif
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+# define arm_math_poly(scheme, n, x, ...)                                     \
+    _Generic ((x),                                                            \
+	float : arm_math_##scheme##_##n##_f32,                                \
+	double : arm_math_##scheme##_##n##_f64 ARM_MATH_POLY_V (scheme, n))   \
+	(x, __VA_ARGS__)
+#endif
+
+#endif
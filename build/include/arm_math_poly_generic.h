@@ -0,0 +1,418 @@
+/*
+ * Generic helpers for evaluating polynomials with various schemes.
+ *
+ * Copyright (c) 2023-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef ARM_MATH_POLY_VTYPE
+# error Cannot use poly_generic without defining ARM_MATH_POLY_VTYPE
+#endif
+#ifndef ARM_MATH_POLY_WRAP
+# error Cannot use poly_generic without defining ARM_MATH_POLY_WRAP
+#endif
+#ifndef ARM_MATH_POLY_FMA
+# error Cannot use poly_generic without defining ARM_MATH_POLY_FMA
+#endif
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pairwise_poly_3) (ARM_MATH_POLY_VTYPE x,
+				      ARM_MATH_POLY_VTYPE x2,
+				      const ARM_MATH_POLY_VTYPE *poly)
+{
+  /* At order 3, Estrin and Pairwise Horner are identical.  */
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  ARM_MATH_POLY_VTYPE p23 = ARM_MATH_POLY_FMA (poly[3], x, poly[2]);
+  return ARM_MATH_POLY_FMA (p23, x2, p01);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_4) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03 = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly);
+  return ARM_MATH_POLY_FMA (poly[4], x4, p03);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_5) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03 = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly);
+  ARM_MATH_POLY_VTYPE p45 = ARM_MATH_POLY_FMA (poly[5], x, poly[4]);
+  return ARM_MATH_POLY_FMA (p45, x4, p03);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_6) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03 = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly);
+  ARM_MATH_POLY_VTYPE p45 = ARM_MATH_POLY_FMA (poly[5], x, poly[4]);
+  ARM_MATH_POLY_VTYPE p46 = ARM_MATH_POLY_FMA (poly[6], x2, p45);
+  return ARM_MATH_POLY_FMA (p46, x4, p03);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_7) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03 = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly);
+  ARM_MATH_POLY_VTYPE p47
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly + 4);
+  return ARM_MATH_POLY_FMA (p47, x4, p03);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_8) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (poly[8], x8,
+			    ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_9) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+			       ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p89 = ARM_MATH_POLY_FMA (poly[9], x, poly[8]);
+  return ARM_MATH_POLY_FMA (p89, x8,
+			    ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_10) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p89 = ARM_MATH_POLY_FMA (poly[9], x, poly[8]);
+  ARM_MATH_POLY_VTYPE p8_10 = ARM_MATH_POLY_FMA (poly[10], x2, p89);
+  return ARM_MATH_POLY_FMA (p8_10, x8,
+			    ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_11) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p8_11
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly + 8);
+  return ARM_MATH_POLY_FMA (p8_11, x8,
+			    ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_12) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (
+      ARM_MATH_POLY_WRAP (estrin_4) (x, x2, x4, poly + 8), x8,
+      ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_13) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (
+      ARM_MATH_POLY_WRAP (estrin_5) (x, x2, x4, poly + 8), x8,
+      ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_14) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (
+      ARM_MATH_POLY_WRAP (estrin_6) (x, x2, x4, poly + 8), x8,
+      ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_15) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (
+      ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly + 8), x8,
+      ARM_MATH_POLY_WRAP (estrin_7) (x, x2, x4, poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_16) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (poly[16], x16,
+			    ARM_MATH_POLY_WRAP (estrin_15) (x, x2, x4, x8,
+							    poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_17) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p16_17 = ARM_MATH_POLY_FMA (poly[17], x, poly[16]);
+  return ARM_MATH_POLY_FMA (p16_17, x16,
+			    ARM_MATH_POLY_WRAP (estrin_15) (x, x2, x4, x8,
+							    poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_18) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p16_17 = ARM_MATH_POLY_FMA (poly[17], x, poly[16]);
+  ARM_MATH_POLY_VTYPE p16_18 = ARM_MATH_POLY_FMA (poly[18], x2, p16_17);
+  return ARM_MATH_POLY_FMA (p16_18, x16,
+			    ARM_MATH_POLY_WRAP (estrin_15) (x, x2, x4, x8,
+							    poly));
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_19) (ARM_MATH_POLY_VTYPE x, ARM_MATH_POLY_VTYPE x2,
+				ARM_MATH_POLY_VTYPE x4, ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p16_19
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (x, x2, poly + 16);
+  return ARM_MATH_POLY_FMA (p16_19, x16,
+			    ARM_MATH_POLY_WRAP (estrin_15) (x, x2, x4, x8,
+							    poly));
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_2) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p = ARM_MATH_POLY_FMA (poly[2], x, poly[1]);
+  return ARM_MATH_POLY_FMA (x, p, poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_3) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p = ARM_MATH_POLY_FMA (poly[3], x, poly[2]);
+  p = ARM_MATH_POLY_FMA (x, p, poly[1]);
+  p = ARM_MATH_POLY_FMA (x, p, poly[0]);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_4) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p = ARM_MATH_POLY_FMA (poly[4], x, poly[3]);
+  p = ARM_MATH_POLY_FMA (x, p, poly[2]);
+  p = ARM_MATH_POLY_FMA (x, p, poly[1]);
+  p = ARM_MATH_POLY_FMA (x, p, poly[0]);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_5) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_4) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_6) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_5) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_7) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_6) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_8) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_7) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_9) (ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_8) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_10) (ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_9) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_11) (ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_10) (x, poly + 1),
+			    poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_12) (ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_VTYPE *poly)
+{
+  return ARM_MATH_POLY_FMA (x, ARM_MATH_POLY_WRAP (horner_11) (x, poly + 1),
+			    poly[0]);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_4) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  ARM_MATH_POLY_VTYPE p23 = ARM_MATH_POLY_FMA (poly[3], x, poly[2]);
+  ARM_MATH_POLY_VTYPE p;
+  p = ARM_MATH_POLY_FMA (x2, poly[4], p23);
+  p = ARM_MATH_POLY_FMA (x2, p, p01);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_5) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  ARM_MATH_POLY_VTYPE p23 = ARM_MATH_POLY_FMA (poly[3], x, poly[2]);
+  ARM_MATH_POLY_VTYPE p45 = ARM_MATH_POLY_FMA (poly[5], x, poly[4]);
+  ARM_MATH_POLY_VTYPE p;
+  p = ARM_MATH_POLY_FMA (x2, p45, p23);
+  p = ARM_MATH_POLY_FMA (x2, p, p01);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_6) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p26 = ARM_MATH_POLY_WRAP (pw_horner_4) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p26, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_7) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p27 = ARM_MATH_POLY_WRAP (pw_horner_5) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p27, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_8) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p28 = ARM_MATH_POLY_WRAP (pw_horner_6) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p28, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_9) (ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p29 = ARM_MATH_POLY_WRAP (pw_horner_7) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p29, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_10) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_10
+      = ARM_MATH_POLY_WRAP (pw_horner_8) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_10, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_11) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_11
+      = ARM_MATH_POLY_WRAP (pw_horner_9) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_11, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_12) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_12
+      = ARM_MATH_POLY_WRAP (pw_horner_10) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_12, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_13) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_13
+      = ARM_MATH_POLY_WRAP (pw_horner_11) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_13, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_14) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_14
+      = ARM_MATH_POLY_WRAP (pw_horner_12) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_14, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_15) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_15
+      = ARM_MATH_POLY_WRAP (pw_horner_13) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_15, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_16) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_16
+      = ARM_MATH_POLY_WRAP (pw_horner_14) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_16, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_17) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_17
+      = ARM_MATH_POLY_WRAP (pw_horner_15) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_17, p01);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_18) (ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_VTYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_18
+      = ARM_MATH_POLY_WRAP (pw_horner_16) (x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01 = ARM_MATH_POLY_FMA (poly[1], x, poly[0]);
+  return ARM_MATH_POLY_FMA (x2, p2_18, p01);
+}
@@ -0,0 +1,506 @@
+/*
+ * Helpers for evaluating polynomials with various schemes - specific to SVE
+ * but precision-agnostic.
+ *
+ * Copyright (c) 2023-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef ARM_MATH_POLY_PTRUE
+# error Cannot use poly_generic without defining ARM_MATH_POLY_PTRUE
+#endif
+#ifndef ARM_MATH_POLY_VTYPE
+# error Cannot use poly_generic without defining ARM_MATH_POLY_VTYPE
+#endif
+#ifndef ARM_MATH_POLY_STYPE
+# error Cannot use poly_generic without defining ARM_MATH_POLY_STYPE
+#endif
+#ifndef ARM_MATH_POLY_WRAP
+# error Cannot use poly_generic without defining ARM_MATH_POLY_WRAP
+#endif
+#ifndef ARM_MATH_POLY_DUP
+# error Cannot use poly_generic without defining ARM_MATH_POLY_DUP
+#endif
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pairwise_poly_3) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				      ARM_MATH_POLY_VTYPE x2,
+				      const ARM_MATH_POLY_STYPE *poly)
+{
+  /* At order 3, Estrin and Pairwise Horner are identical.  */
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  ARM_MATH_POLY_VTYPE p23
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[2]), x, poly[3]);
+  return svmla_x (pg, p01, p23, x2);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_4) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly);
+  return svmla_x (pg, p03, x4, poly[4]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_5) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly);
+  ARM_MATH_POLY_VTYPE p45
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[4]), x, poly[5]);
+  return svmla_x (pg, p03, p45, x4);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_6) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly);
+  ARM_MATH_POLY_VTYPE p45
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[4]), x, poly[5]);
+  ARM_MATH_POLY_VTYPE p46 = svmla_x (pg, p45, x2, poly[6]);
+  return svmla_x (pg, p03, p46, x4);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_7) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p03
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly);
+  ARM_MATH_POLY_VTYPE p47
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly + 4);
+  return svmla_x (pg, p03, p47, x4);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_8) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       ARM_MATH_POLY_VTYPE x8,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly), x8,
+		  poly[8]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_9) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+			       ARM_MATH_POLY_VTYPE x8,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p89
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[8]), x, poly[9]);
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly), p89,
+		  x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_10) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p89
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[8]), x, poly[9]);
+  ARM_MATH_POLY_VTYPE p8_10 = svmla_x (pg, p89, x2, poly[10]);
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  p8_10, x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_11) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p8_11
+      = ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly + 8);
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  p8_11, x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_12) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  ARM_MATH_POLY_WRAP (estrin_4) (pg, x, x2, x4, poly + 8), x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_13) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  ARM_MATH_POLY_WRAP (estrin_5) (pg, x, x2, x4, poly + 8), x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_14) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  ARM_MATH_POLY_WRAP (estrin_6) (pg, x, x2, x4, poly + 8), x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_15) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly),
+		  ARM_MATH_POLY_WRAP (estrin_7) (pg, x, x2, x4, poly + 8), x8);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_16) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_15) (pg, x, x2, x4, x8, poly),
+		  x16, poly[16]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_17) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p16_17
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[16]), x, poly[17]);
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_15) (pg, x, x2, x4, x8, poly),
+		  p16_17, x16);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_18) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p16_17
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[16]), x, poly[17]);
+  ARM_MATH_POLY_VTYPE p16_18 = svmla_x (pg, p16_17, x2, poly[18]);
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_15) (pg, x, x2, x4, x8, poly),
+		  p16_18, x16);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (estrin_19) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				ARM_MATH_POLY_VTYPE x2, ARM_MATH_POLY_VTYPE x4,
+				ARM_MATH_POLY_VTYPE x8,
+				ARM_MATH_POLY_VTYPE x16,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmla_x (pg, ARM_MATH_POLY_WRAP (estrin_15) (pg, x, x2, x4, x8, poly),
+		  ARM_MATH_POLY_WRAP (pairwise_poly_3) (pg, x, x2, poly + 16),
+		  x16);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_2) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[1]), x, poly[2]);
+  return svmad_x (pg, x, p, poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_3) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[2]), x, poly[3]);
+  p = svmad_x (pg, x, p, poly[1]);
+  p = svmad_x (pg, x, p, poly[0]);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_4) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[3]), x, poly[4]);
+  p = svmad_x (pg, x, p, poly[2]);
+  p = svmad_x (pg, x, p, poly[1]);
+  p = svmad_x (pg, x, p, poly[0]);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_5) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_4) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_6) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_5) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_7) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_6) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_8) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_7) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_9) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+			       const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_8) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_10) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_9) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_11) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_10) (pg, x, poly + 1),
+		  poly[0]);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (horner_12) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				const ARM_MATH_POLY_STYPE *poly)
+{
+  return svmad_x (pg, x, ARM_MATH_POLY_WRAP (horner_11) (pg, x, poly + 1),
+		  poly[0]);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_4) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  ARM_MATH_POLY_VTYPE p23
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[2]), x, poly[3]);
+  ARM_MATH_POLY_VTYPE p;
+  p = svmla_x (pg, p23, x2, poly[4]);
+  p = svmla_x (pg, p01, x2, p);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_5) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  ARM_MATH_POLY_VTYPE p23
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[2]), x, poly[3]);
+  ARM_MATH_POLY_VTYPE p45
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[4]), x, poly[5]);
+  ARM_MATH_POLY_VTYPE p;
+  p = svmla_x (pg, p23, x2, p45);
+  p = svmla_x (pg, p01, x2, p);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_6) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p26
+      = ARM_MATH_POLY_WRAP (pw_horner_4) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p26);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_7) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p27
+      = ARM_MATH_POLY_WRAP (pw_horner_5) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p27);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_8) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p28
+      = ARM_MATH_POLY_WRAP (pw_horner_6) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p28);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_9) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				  ARM_MATH_POLY_VTYPE x2,
+				  const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p29
+      = ARM_MATH_POLY_WRAP (pw_horner_7) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p29);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_10) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_10
+      = ARM_MATH_POLY_WRAP (pw_horner_8) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_10);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_11) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_11
+      = ARM_MATH_POLY_WRAP (pw_horner_9) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_11);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_12) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_12
+      = ARM_MATH_POLY_WRAP (pw_horner_10) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_12);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_13) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_13
+      = ARM_MATH_POLY_WRAP (pw_horner_11) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_13);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_14) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_14
+      = ARM_MATH_POLY_WRAP (pw_horner_12) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_14);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_15) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_15
+      = ARM_MATH_POLY_WRAP (pw_horner_13) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_15);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_16) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_16
+      = ARM_MATH_POLY_WRAP (pw_horner_14) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_16);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_17) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_17
+      = ARM_MATH_POLY_WRAP (pw_horner_15) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_17);
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (pw_horner_18) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				   ARM_MATH_POLY_VTYPE x2,
+				   const ARM_MATH_POLY_STYPE *poly)
+{
+  ARM_MATH_POLY_VTYPE p2_18
+      = ARM_MATH_POLY_WRAP (pw_horner_16) (pg, x, x2, poly + 2);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly[0]), x, poly[1]);
+  return svmla_x (pg, p01, x2, p2_18);
+}
+
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (lw_pw_horner_5) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				     ARM_MATH_POLY_VTYPE x2,
+				     const ARM_MATH_POLY_STYPE *poly_even,
+				     const ARM_MATH_POLY_STYPE *poly_odd)
+{
+  ARM_MATH_POLY_VTYPE c13 = svld1rq (ARM_MATH_POLY_PTRUE, poly_odd);
+
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_lane (ARM_MATH_POLY_DUP (poly_even[0]), x, c13, 0);
+  ARM_MATH_POLY_VTYPE p23
+      = svmla_lane (ARM_MATH_POLY_DUP (poly_even[1]), x, c13, 1);
+  ARM_MATH_POLY_VTYPE p45
+      = svmla_x (pg, ARM_MATH_POLY_DUP (poly_even[2]), x, poly_odd[2]);
+
+  ARM_MATH_POLY_VTYPE p;
+  p = svmla_x (pg, p23, x2, p45);
+  p = svmla_x (pg, p01, x2, p);
+  return p;
+}
+static inline ARM_MATH_POLY_VTYPE
+ARM_MATH_POLY_WRAP (lw_pw_horner_9) (svbool_t pg, ARM_MATH_POLY_VTYPE x,
+				     ARM_MATH_POLY_VTYPE x2,
+				     const ARM_MATH_POLY_STYPE *poly_even,
+				     const ARM_MATH_POLY_STYPE *poly_odd)
+{
+  ARM_MATH_POLY_VTYPE c13 = svld1rq (ARM_MATH_POLY_PTRUE, poly_odd);
+
+  ARM_MATH_POLY_VTYPE p49 = ARM_MATH_POLY_WRAP (lw_pw_horner_5) (pg, x, x2,
+								 poly_even + 2,
+								 poly_odd + 2);
+  ARM_MATH_POLY_VTYPE p23
+      = svmla_lane (ARM_MATH_POLY_DUP (poly_even[1]), x, c13, 1);
+
+  ARM_MATH_POLY_VTYPE p29 = svmla_x (pg, p23, x2, p49);
+  ARM_MATH_POLY_VTYPE p01
+      = svmla_lane (ARM_MATH_POLY_DUP (poly_even[0]), x, c13, 0);
+
+  return svmla_x (pg, p01, x2, p29);
+}
@@ -0,0 +1,14 @@
+_ZSD1 (erf, -6.0, 6.0)
+_ZSD1 (exp, -9.9, 9.9)
+_ZSD1 (exp10, -9.9, 9.9)
+_ZSD1 (exp2, -9.9, 9.9)
+_ZSD1 (log, 0.01, 11.1)
+_ZSD1 (log2, 0.01, 11.1)
+_ZSF1 (cos, -3.1, 3.1)
+_ZSF1 (erf, -6.0, 6.0)
+_ZSF1 (exp, -9.9, 9.9)
+_ZSF1 (exp2, -9.9, 9.9)
+_ZSF1 (log, 0.01, 11.1)
+_ZSF1 (log10, 0.01, 11.1)
+_ZSF1 (log2, 0.01, 11.1)
+_ZSF1 (sin, -3.1, 3.1)
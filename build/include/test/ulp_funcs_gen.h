@@ -0,0 +1,14 @@
+_ZSD1 (erf)
+_ZSD1 (exp)
+_ZSD1 (exp10)
+_ZSD1 (exp2)
+_ZSD1 (log)
+_ZSD1 (log2)
+_ZSF1 (cos)
+_ZSF1 (erf)
+_ZSF1 (exp)
+_ZSF1 (exp2)
+_ZSF1 (log)
+_ZSF1 (log10)
+_ZSF1 (log2)
+_ZSF1 (sin)
@@ -0,0 +1,14 @@
+ZSND1_WRAP (erf)
+ZSND1_WRAP (exp)
+ZSND1_WRAP (exp10)
+ZSND1_WRAP (exp2)
+ZSND1_WRAP (log)
+ZSND1_WRAP (log2)
+ZSNF1_WRAP (cos)
+ZSNF1_WRAP (erf)
+ZSNF1_WRAP (exp)
+ZSNF1_WRAP (exp2)
+ZSNF1_WRAP (log)
+ZSNF1_WRAP (log10)
+ZSNF1_WRAP (log2)
+ZSNF1_WRAP (sin)
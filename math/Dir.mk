@@ -49,6 +49,15 @@ math-test-srcs := \
 	$(math-src-dir)/test/mathtest.c \
 	$(math-src-dir)/test/mathbench.c \
 	$(math-src-dir)/test/ulp.c \
+	$(math-src-dir)/test/polytest.c \
+	$(math-src-dir)/test/randtest.c \
+	$(math-src-dir)/test/ddtest.c \
+
+# LD_PRELOAD interposer capturing the arguments of math calls.
+ifeq ($(OS),Linux)
+math-trace-srcs := $(math-src-dir)/test/mathtrace.c
+math-trace-libs := build/lib/libmathtrace.so
+endif
 
 math-test-host-srcs := $(wildcard $(math-src-dir)/test/rtest/*.[cS])
 
@@ -64,6 +73,9 @@ math-tools := \
 	build/bin/mathbench_libc \
 	build/bin/runulp.sh \
 	build/bin/ulp \
+	build/bin/polytest \
+	build/bin/randtest \
+	build/bin/ddtest \
 
 math-host-tools := \
 	build/bin/rtest \
@@ -72,16 +84,18 @@ math-lib-objs := $(patsubst $(math-src-dir)/%,$(math-build-dir)/%.o,$(basename $
 math-test-objs := $(patsubst $(math-src-dir)/%,$(math-build-dir)/%.o,$(basename $(math-test-srcs)))
 math-host-objs := $(patsubst $(math-src-dir)/%,$(math-build-dir)/%.o,$(basename $(math-test-host-srcs)))
 math-target-objs := $(math-lib-objs) $(math-test-objs)
-math-objs := $(math-target-objs) $(math-target-objs:%.o=%.os) $(math-host-objs)
+math-trace-objs := $(patsubst $(math-src-dir)/%,$(math-build-dir)/%.os,$(basename $(math-trace-srcs)))
+math-objs := $(math-target-objs) $(math-target-objs:%.o=%.os) $(math-host-objs) $(math-trace-objs)
 
 math-files := \
 	$(math-objs) \
 	$(math-libs) \
+	$(math-trace-libs) \
 	$(math-tools) \
 	$(math-host-tools) \
 	$(math-includes)
 
-all-math: $(math-libs) $(math-tools) $(math-includes)
+all-math: $(math-libs) $(math-trace-libs) $(math-tools) $(math-includes)
 
 $(math-objs): $(math-includes)
 $(math-objs): CFLAGS_ALL += $(math-cflags)
@@ -146,6 +160,12 @@ $(math-build-dir)/test/ulp.o: $(math-src-dir)/test/ulp.h $(ulp-funcs-gen) $(ulp-
 build/lib/libmathlib.so: $(math-lib-objs:%.o=%.os)
 	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $^
 
+# The wrappers must not be turned into calls to builtins.
+$(math-trace-objs): CFLAGS_ALL += -fno-builtin
+
+build/lib/libmathtrace.so: $(math-trace-objs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $^ -ldl -lpthread
+
 build/lib/libmathlib.a: $(math-lib-objs)
 	rm -f $@
 	$(AR) rc $@ $^
@@ -164,16 +184,26 @@ build/bin/rtest: $(math-host-objs)
 build/bin/mathtest: $(math-build-dir)/test/mathtest.o build/lib/libmathlib.a
 	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs)
 
+# mathbench -j uses POSIX threads.
 build/bin/mathbench: $(math-build-dir)/test/mathbench.o build/lib/libmathlib.a
-	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs) -lpthread
 
 # This is not ideal, but allows custom symbols in mathbench to get resolved.
 build/bin/mathbench_libc: $(math-build-dir)/test/mathbench.o build/lib/libmathlib.a
-	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $< $(libm-libs) $(libc-libs) build/lib/libmathlib.a $(libm-libs)
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $< $(libm-libs) $(libc-libs) build/lib/libmathlib.a $(libm-libs) -lpthread
 
 build/bin/ulp: $(math-build-dir)/test/ulp.o build/lib/libmathlib.a
 	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(LDLIBS)
 
+build/bin/polytest: $(math-build-dir)/test/polytest.o
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs)
+
+build/bin/randtest: $(math-build-dir)/test/randtest.o build/lib/libmathlib.a
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs)
+
+build/bin/ddtest: $(math-build-dir)/test/ddtest.o build/lib/libmathlib.a
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -o $@ $^ $(libm-libs)
+
 build/include/%.h: $(math-src-dir)/include/%.h
 	cp $< $@
 
@@ -188,6 +218,9 @@ math-rtests := $(wildcard $(math-src-dir)/test/testcases/random/*.tst)
 
 check-math-test: $(math-tools)
 	cat $(math-tests) | $(EMULATOR) build/bin/mathtest $(math-testflags)
+	$(EMULATOR) build/bin/polytest
+	$(EMULATOR) build/bin/randtest
+	$(EMULATOR) build/bin/ddtest
 
 check-math-rtest: $(math-host-tools) $(math-tools)
 	cat $(math-rtests) | build/bin/rtest | $(EMULATOR) build/bin/mathtest $(math-testflags)
@@ -7,16 +7,16 @@
 #include "v_math.h"
 #include "test_sig.h"
 #include "test_defs.h"
-#include "v_log1pf_inline.h"
+#include "arm_math_inline.h"
 
 const static struct data
 {
-  struct v_log1pf_data log1pf_consts;
+  struct arm_math_v_log1pf_data log1pf_consts;
   uint32x4_t one;
   uint16x4_t special_bound_u16;
   float32x4_t inf, nan;
 } data = {
-  .log1pf_consts = V_LOG1PF_CONSTANTS_TABLE,
+  .log1pf_consts = ARM_MATH_V_LOG1PF_DATA_INIT,
   .one = V4 (0x3f800000),
   /* asuint(sqrt(FLT_MAX)) - asuint(1).  */
   .special_bound_u16 = V4 (0x2000),
@@ -35,7 +35,7 @@ inline_acoshf (float32x4_t x, const struct data *d)
 
   float32x4_t y = vaddq_f32 (xm1, vsqrtq_f32 (u));
 
-  return log1pf_inline (y, &d->log1pf_consts);
+  return arm_math_v_log1pf_inline (y, &d->log1pf_consts);
 }
 
 static float32x4_t VPCS_ATTR NOINLINE
@@ -60,7 +60,7 @@ special_case (float32x4_t x, uint16x4_t special_u16, const struct data *d)
 
   /* For large inputs, acosh(x) ≈ log(x) + ln(2).
      We use log1pf-inline log implementation and add ln(2).  */
-  float32x4_t log_xy = log1pf_inline (xy, &d->log1pf_consts);
+  float32x4_t log_xy = arm_math_v_log1pf_inline (xy, &d->log1pf_consts);
 
   /* For acoshf there are three special cases that need considering. Infinity
      and NaNs, which are also returned unchanged and for cases of x < 1 we'll
@@ -87,7 +87,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (acosh) (float32x4_t x)
   const struct data *d = ptr_barrier (&data);
   uint32x4_t ix = vreinterpretq_u32_f32 (x);
   /* Inputs greater than or equal to special_bound will cause the output to
-    overflow. This is because there is a square operation in log1pf_inline.
+    overflow. This is because there is a square operation in log1pf.
     This also captures inf, nan and any input less than or equal to 1.  */
   uint16x4_t special
       = vcge_u16 (vsubhn_u32 (ix, d->one), d->special_bound_u16);
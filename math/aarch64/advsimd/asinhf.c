@@ -8,17 +8,17 @@
 #include "v_math.h"
 #include "test_sig.h"
 #include "test_defs.h"
-#include "v_log1pf_inline.h"
+#include "arm_math_inline.h"
 
 const static struct data
 {
-  struct v_log1pf_data log1pf_consts;
+  struct arm_math_v_log1pf_data log1pf_consts;
   float32x4_t one;
   uint32x4_t square_lim;
   float32x4_t inf, nan;
 } data = {
   .one = V4 (1),
-  .log1pf_consts = V_LOG1PF_CONSTANTS_TABLE,
+  .log1pf_consts = ARM_MATH_V_LOG1PF_DATA_INIT,
   .square_lim = V4 (0x5f800000), /* asuint(sqrt(FLT_MAX)).  */
   .inf = V4 (INFINITY),
   .nan = V4 (NAN),
@@ -33,8 +33,9 @@ inline_asinhf (float32x4_t ax, uint32x4_t sign, const struct data *d)
       = vaddq_f32 (v_f32 (1.0f), vsqrtq_f32 (vfmaq_f32 (d->one, ax, ax)));
   float32x4_t y = vaddq_f32 (ax, vdivq_f32 (vmulq_f32 (ax, ax), t));
 
-  return vreinterpretq_f32_u32 (veorq_u32 (
-      sign, vreinterpretq_u32_f32 (log1pf_inline (y, &d->log1pf_consts))));
+  float32x4_t log1p_y = arm_math_v_log1pf_inline (y, &d->log1pf_consts);
+  return vreinterpretq_f32_u32 (
+      veorq_u32 (sign, vreinterpretq_u32_f32 (log1p_y)));
 }
 
 static float32x4_t VPCS_ATTR NOINLINE
@@ -49,7 +50,7 @@ special_case (float32x4_t ax, uint32x4_t sign, uint32x4_t special,
      1 becomes negligible in sqrt(x^2+1), so we compute
      asinh(x) as ln(x) + ln(2).  */
   float32x4_t xy = vbslq_f32 (special, ax, y);
-  float32x4_t log_xy = log1pf_inline (xy, &d->log1pf_consts);
+  float32x4_t log_xy = arm_math_v_log1pf_inline (xy, &d->log1pf_consts);
 
   /* Infinity and NaNs are the only other special cases that need checking
      before we return the values. 0 is handled by inline_asinhf as it returns
@@ -88,7 +89,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (asinh) (float32x4_t x)
   uint32x4_t sign = veorq_u32 (vreinterpretq_u32_f32 (x), iax);
 
   /* Inputs greater than or equal to square_lim will cause the output to
-    overflow. This is because there is a square operation in the log1pf_inline
+    overflow. This is because there is a square operation in the log1pf
     call. Also captures inf and nan. Does not capture negative numbers as we
     separate the sign bit from the rest of the input.  */
   uint32x4_t special = vcgeq_u32 (iax, d->square_lim);
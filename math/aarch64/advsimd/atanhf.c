@@ -8,17 +8,17 @@
 #include "v_math.h"
 #include "test_sig.h"
 #include "test_defs.h"
-#include "v_log1pf_inline.h"
+#include "arm_math_inline.h"
 
 const static struct data
 {
-  struct v_log1pf_data log1pf_consts;
+  struct arm_math_v_log1pf_data log1pf_consts;
   uint32x4_t abs_mask;
   float32x4_t half;
   uint32x4_t one;
   float32x4_t pinf, minf, nan;
 } data = {
-  .log1pf_consts = V_LOG1PF_CONSTANTS_TABLE,
+  .log1pf_consts = ARM_MATH_V_LOG1PF_DATA_INIT,
   .abs_mask = V4 (0x7fffffff),
   .half = V4 (0.5f),
   .one = V4 (0x3f800000),
@@ -31,7 +31,7 @@ static float32x4_t VPCS_ATTR NOINLINE
 special_case (float32x4_t x, float32x4_t y, float32x4_t halfsign,
 	      uint32x4_t special, const struct data *d)
 {
-  y = log1pf_inline (y, &d->log1pf_consts);
+  y = arm_math_v_log1pf_inline (y, &d->log1pf_consts);
   y = vmulq_f32 (halfsign, y);
 
   float32x4_t float_one = vreinterpretq_f32_u32 (d->one);
@@ -74,7 +74,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (atanh) (float32x4_t x)
   if (unlikely (v_any_u32 (special)))
     return special_case (x, r, halfsign, special, d);
 
-  float32x4_t y = log1pf_inline (r, &d->log1pf_consts);
+  float32x4_t y = arm_math_v_log1pf_inline (r, &d->log1pf_consts);
   return vmulq_f32 (halfsign, y);
 }
 
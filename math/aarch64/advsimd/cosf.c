@@ -75,6 +75,8 @@ special_case (float32x4_t x, float32x4_t y, uint32x4_t odd, uint32x4_t cmp)
 float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (cos) (float32x4_t x)
 {
   const struct data *d = ptr_barrier (&data);
+
+  STATS_CALL (V_NAME_F1 (cos));
   float32x4_t pi_vals = vld1q_f32 (&d->inv_pi);
   uint32x4_t cmp = vcageq_f32 (x, d->range_val);
 
@@ -100,7 +102,10 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (cos) (float32x4_t x)
   y = vfmaq_f32 (r, r3, y);
 
   if (unlikely (v_any_u32 (cmp)))
-    return special_case (x, y, odd, cmp);
+    {
+      STATS_SLOW (V_NAME_F1 (cos));
+      return special_case (x, y, odd, cmp);
+    }
   return vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (y), odd));
 }
 
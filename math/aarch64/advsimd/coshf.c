@@ -12,7 +12,7 @@
 
 static const struct data
 {
-  struct v_expf_data expf_consts;
+  struct arm_math_v_expf_data expf_consts;
   float32x4_t special_bound, inf_bound, cosh_9, nine;
 } data = {
   .expf_consts = V_EXPF_DATA,
@@ -65,6 +65,8 @@ float64x2_t VPCS_ATTR V_NAME_D1 (exp) (float64x2_t x)
 {
   const struct data *d = ptr_barrier (&data);
 
+  STATS_CALL (V_NAME_D1 (exp));
+
   /* n = round(x/(ln2/N)).  */
   float64x2_t z = vfmaq_f64 (d->shift, x, d->inv_ln2);
   uint64x2_t u = vreinterpretq_u64_f64 (z);
@@ -92,7 +94,10 @@ float64x2_t VPCS_ATTR V_NAME_D1 (exp) (float64x2_t x)
   uint64x2_t cmp = vcagtq_f64 (x, d->special_bound);
 
   if (unlikely (v_any_u64 (cmp)))
-    return exp_special (poly, n, scale, d->scale_thresh, &d->special_data);
+    {
+      STATS_SLOW (V_NAME_D1 (exp));
+      return exp_special (poly, n, scale, d->scale_thresh, &d->special_data);
+    }
 
   return vfmaq_f64 (scale, poly, scale);
 }
@@ -132,6 +132,8 @@ float64x2_t VPCS_ATTR V_NAME_D1 (log) (float64x2_t x)
 {
   const struct data *d = ptr_barrier (&data);
 
+  STATS_CALL (V_NAME_D1 (log));
+
   /* To avoid having to mov x out of the way, keep u after offset has been
      applied, and recover x by adding the offset back in the special-case
      handler.  */
@@ -142,7 +144,10 @@ float64x2_t VPCS_ATTR V_NAME_D1 (log) (float64x2_t x)
 				     vget_low_u32 (d->special_bound_u32));
 
   if (unlikely (v_any_u32h (special_u32)))
-    return special_case (u_off, d);
+    {
+      STATS_SLOW (V_NAME_D1 (log));
+      return special_case (u_off, d);
+    }
   return inline_log (u, u_off, d);
 }
 
@@ -8,14 +8,14 @@
 #include "v_math.h"
 #include "test_sig.h"
 #include "test_defs.h"
-#include "v_log1pf_inline.h"
+#include "arm_math_inline.h"
 
 static const struct data
 {
-  struct v_log1pf_data d;
+  struct arm_math_v_log1pf_data d;
   float32x4_t nan, pinf, minf;
 } data = {
-  .d = V_LOG1PF_CONSTANTS_TABLE,
+  .d = ARM_MATH_V_LOG1PF_DATA_INIT,
   .nan = V4 (NAN),
   .pinf = V4 (INFINITY),
   .minf = V4 (-INFINITY),
@@ -24,7 +24,7 @@ static const struct data
 static inline float32x4_t
 special_case (float32x4_t x, uint32x4_t cmp, const struct data *d)
 {
-  float32x4_t y = log1pf_inline (x, ptr_barrier (&d->d));
+  float32x4_t y = arm_math_v_log1pf_inline (x, ptr_barrier (&d->d));
   y = vbslq_f32 (cmp, d->nan, y);
   uint32x4_t ret_pinf = vceqq_f32 (x, d->pinf);
   uint32x4_t ret_minf = vceqq_f32 (x, v_f32 (-1.0));
@@ -51,7 +51,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (log1p) (float32x4_t x)
   if (unlikely (v_any_u32 (special)))
     return special_case (x, special, d);
 
-  return log1pf_inline (x, &d->d);
+  return arm_math_v_log1pf_inline (x, &d->d);
 }
 
 HALF_WIDTH_ALIAS_F1 (log1p)
@@ -98,6 +98,8 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (log) (float32x4_t x)
 {
   const struct data *d = ptr_barrier (&data);
 
+  STATS_CALL (V_NAME_F1 (log));
+
   /* To avoid having to mov x out of the way, keep u after offset has been
      applied, and recover x by adding the offset back in the special-case
      handler.  */
@@ -114,7 +116,11 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (log) (float32x4_t x)
 
   /* Doing the check on the u16 version makes the fast pass faster.  */
   if (unlikely (v_any_u16h (special_u16)))
-    return vbslq_f32 (special, special_case (x, d), inline_logf (u_off, n, d));
+    {
+      STATS_SLOW (V_NAME_F1 (log));
+      return vbslq_f32 (special, special_case (x, d),
+			inline_logf (u_off, n, d));
+    }
   return inline_logf (u_off, n, d);
 }
 
@@ -111,10 +111,15 @@ float64x2_t VPCS_ATTR V_NAME_D2 (pow) (float64x2_t x, float64x2_t y)
 {
   const struct data *d = ptr_barrier (&data);
 
+  STATS_CALL (V_NAME_D2 (pow));
+
   /* Case of x <= 0 is too complicated to be vectorised efficiently here,
      fallback to scalar pow for all lanes if any x < 0 detected.  */
   if (v_any_u64 (vclezq_s64 (vreinterpretq_s64_f64 (x))))
-    return scalar_fallback (x, y);
+    {
+      STATS_SLOW (V_NAME_D2 (pow));
+      return scalar_fallback (x, y);
+    }
 
   uint64x2_t vix = vreinterpretq_u64_f64 (x);
   uint64x2_t viy = vreinterpretq_u64_f64 (y);
@@ -129,12 +134,16 @@ float64x2_t VPCS_ATTR V_NAME_D2 (pow) (float64x2_t x, float64x2_t y)
 
   /* Fallback to scalar on all lanes if any lane is inf or nan.  */
   if (unlikely (v_any_u64 (special)))
-    return scalar_fallback (x, y);
+    {
+      STATS_SLOW (V_NAME_D2 (pow));
+      return scalar_fallback (x, y);
+    }
 
   /* Cases of subnormal x: |x| < 0x1p-1022.  */
   uint64x2_t x_is_subnormal = vcaltq_f64 (x, d->subnormal_bound);
   if (unlikely (v_any_u64 (x_is_subnormal)))
     {
+      STATS_SLOW (V_NAME_D2 (pow));
       /* Normalize subnormal x so exponent becomes negative.  */
       uint64x2_t vix_norm = vreinterpretq_u64_f64 (
 	  vabsq_f64 (vmulq_f64 (x, d->subnormal_scale)));
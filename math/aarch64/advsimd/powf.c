@@ -109,6 +109,8 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F2 (pow) (float32x4_t x, float32x4_t y)
 {
   const struct data *d = ptr_barrier (&data);
 
+  STATS_CALL (V_NAME_F2 (pow));
+
   /* Special cases of x or y: zero, inf and nan.  */
   uint32x4_t ix = vreinterpretq_u32_f32 (x);
   uint32x4_t iy = vreinterpretq_u32_f32 (y);
@@ -120,6 +122,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F2 (pow) (float32x4_t x, float32x4_t y)
   uint32x4_t x_is_neg_or_sub = vcltq_f32 (x, v_f32 (0x1p-126f));
   if (unlikely (v_any_u32 (x_is_neg_or_sub)))
     {
+      STATS_SLOW (V_NAME_F2 (pow));
       float32x4_t ret = v_powf_x_is_neg_or_small (x, y, d);
       if (unlikely (v_any_u32 (cmp)))
 	return special_case (x, y, ret, cmp);
@@ -129,7 +132,10 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F2 (pow) (float32x4_t x, float32x4_t y)
   /* Else evaluate pow(x, y) for normal and positive x only.
      Use the powrf helper routine.  */
   if (unlikely (v_any_u32 (cmp)))
-    return special_case (x, y, v_powrf_core (x, y, d), cmp);
+    {
+      STATS_SLOW (V_NAME_F2 (pow));
+      return special_case (x, y, v_powrf_core (x, y, d), cmp);
+    }
   return v_powrf_core (x, y, d);
 }
 
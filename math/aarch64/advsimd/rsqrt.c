@@ -7,6 +7,7 @@
 
 #include "test_defs.h"
 #include "v_math.h"
+#include "v_rsqrt_inline.h"
 
 static const struct data
 {
@@ -23,35 +24,11 @@ static const struct data
   .scale_down = V2 (0x1p27),
 };
 
-static inline float64x2_t VPCS_ATTR
-inline_rsqrt (float64x2_t x)
-{
-  /* Do estimate instruction.  */
-  float64x2_t estimate = vrsqrteq_f64 (x);
-
-  /* Do first step instruction.  */
-  float64x2_t estimate_squared = vmulq_f64 (estimate, estimate);
-  float64x2_t step = vrsqrtsq_f64 (x, estimate_squared);
-  estimate = vmulq_f64 (estimate, step);
-
-  /* Do second step instruction.  */
-  estimate_squared = vmulq_f64 (estimate, estimate);
-  step = vrsqrtsq_f64 (x, estimate_squared);
-  estimate = vmulq_f64 (estimate, step);
-
-  /* Do third step instruction.
-     This is required to achieve < 3.0 ULP.  */
-  estimate_squared = vmulq_f64 (estimate, estimate);
-  step = vrsqrtsq_f64 (x, estimate_squared);
-  estimate = vmulq_f64 (estimate, step);
-  return estimate;
-}
-
 static float64x2_t NOINLINE
 special_case (float64x2_t x, uint64x2_t special, const struct data *d)
 {
   x = vbslq_f64 (special, vmulq_f64 (x, d->scale_up), x);
-  float64x2_t estimate = inline_rsqrt (x);
+  float64x2_t estimate = v_rsqrt_inline (x);
   return vbslq_f64 (special, vmulq_f64 (estimate, d->scale_down), estimate);
 }
 
@@ -69,7 +46,7 @@ float64x2_t VPCS_ATTR V_NAME_D1 (rsqrt) (float64x2_t x)
     {
       return special_case (x, special, d);
     }
-  return inline_rsqrt (x);
+  return v_rsqrt_inline (x);
 }
 
 #if WANT_C23_TESTS
@@ -7,6 +7,7 @@
 
 #include "test_defs.h"
 #include "v_math.h"
+#include "v_rsqrtf_inline.h"
 
 static const struct data
 {
@@ -24,30 +25,11 @@ static const struct data
   .scale_down = V4 (0x1p11f),
 };
 
-static inline float32x4_t VPCS_ATTR
-inline_rsqrt (float32x4_t x)
-{
-  /* Do estimate instruction.  */
-  float32x4_t estimate = vrsqrteq_f32 (x);
-
-  /* Do first step instruction.  */
-  float32x4_t estimate_squared = vmulq_f32 (estimate, estimate);
-  float32x4_t step = vrsqrtsq_f32 (x, estimate_squared);
-  estimate = vmulq_f32 (estimate, step);
-
-  /* Do second step instruction.
-    This is required to achieve < 3.0 ULP.  */
-  estimate_squared = vmulq_f32 (estimate, estimate);
-  step = vrsqrtsq_f32 (x, estimate_squared);
-  estimate = vmulq_f32 (estimate, step);
-  return estimate;
-}
-
 static float32x4_t NOINLINE
 special_case (float32x4_t x, uint32x4_t special, const struct data *d)
 {
   x = vbslq_f32 (special, vmulq_f32 (x, d->scale_up), x);
-  float32x4_t estimate = inline_rsqrt (x);
+  float32x4_t estimate = v_rsqrtf_inline (x);
   return vbslq_f32 (special, vmulq_f32 (estimate, d->scale_down), estimate);
 }
 
@@ -65,7 +47,7 @@ float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (rsqrt) (float32x4_t x)
     {
       return special_case (x, special, d);
     }
-  return inline_rsqrt (x);
+  return v_rsqrtf_inline (x);
 }
 HALF_WIDTH_ALIAS_F1 (rsqrt);
 
@@ -73,6 +73,8 @@ special_case (float64x2_t x, float64x2_t y, uint64x2_t odd, uint64x2_t cmp)
 float64x2_t VPCS_ATTR V_NAME_D1 (sin) (float64x2_t x)
 {
   const struct data *d = ptr_barrier (&data);
+
+  STATS_CALL (V_NAME_D1 (sin));
   uint64x2_t cmp = vcageq_f64 (x, d->range_val);
 
   float64x2_t invpi_pi_1 = vld1q_f64 (&d->inv_pi);
@@ -106,7 +108,10 @@ float64x2_t VPCS_ATTR V_NAME_D1 (sin) (float64x2_t x)
   float64x2_t y = vfmaq_f64 (r, r3, p06);
 
   if (unlikely (v_any_u64 (cmp)))
-    return special_case (x, y, odd, cmp);
+    {
+      STATS_SLOW (V_NAME_D1 (sin));
+      return special_case (x, y, odd, cmp);
+    }
 
   return vreinterpretq_f64_u64 (veorq_u64 (vreinterpretq_u64_f64 (y), odd));
 }
@@ -95,7 +95,7 @@ v_log_inline (float64x2_t x, const struct v_log_inline_data *d)
   r2 = vmulq_f64 (r, r);
   y = vfmaq_f64 (A (2), A (3), r);
   p = vfmaq_f64 (A (0), A (1), r);
-#if V_LOG_POLY_ORDER == 5
+#if V_LOG_INLINE_POLY_ORDER == 5
   y = vfmaq_f64 (y, A (4), r2);
 #endif
   y = vfmaq_f64 (p, y, r2);
@@ -18,6 +18,7 @@
 #define V_NAME_D1(fun) _ZGVnN2v_##fun
 #define V_NAME_F2(fun) _ZGVnN4vv_##fun##f
 #define V_NAME_D2(fun) _ZGVnN2vv_##fun
+#define V_NAME_D3(fun) _ZGVnN2vvv_##fun
 #define V_NAME_F1_L1(fun) _ZGVnN4vl4_##fun##f
 #define V_NAME_D1_L1(fun) _ZGVnN2vl8_##fun
 
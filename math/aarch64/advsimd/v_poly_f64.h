@@ -13,12 +13,12 @@
 
 /* Wrap AdvSIMD f64 helpers: evaluation of some scheme/order has form:
    v_[scheme]_[order]_f64.  */
-#define VTYPE float64x2_t
-#define FMA(x, y, z) vfmaq_f64 (z, x, y)
-#define VWRAP(f) v_##f##_f64
-#include "poly_generic.h"
-#undef VWRAP
-#undef FMA
-#undef VTYPE
+#define ARM_MATH_POLY_VTYPE float64x2_t
+#define ARM_MATH_POLY_FMA(x, y, z) vfmaq_f64 (z, x, y)
+#define ARM_MATH_POLY_WRAP(f) v_##f##_f64
+#include "arm_math_poly_generic.h"
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_FMA
+#undef ARM_MATH_POLY_VTYPE
 
 #endif
@@ -0,0 +1,40 @@
+/*
+ * Helper for double-precision vector routines which calculate 1/sqrt(x) and do
+ * not need special-case handling
+ *
+ * Copyright (c) 2025-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_RSQRT_INLINE_H
+#define MATH_V_RSQRT_INLINE_H
+
+#include "v_math.h"
+
+/* Only valid for normal positive x large enough for the estimate not to
+   overflow, see the special bound of the corresponding rsqrt routine.  */
+static inline float64x2_t VPCS_ATTR
+v_rsqrt_inline (float64x2_t x)
+{
+  /* Do estimate instruction.  */
+  float64x2_t estimate = vrsqrteq_f64 (x);
+
+  /* Do first step instruction.  */
+  float64x2_t estimate_squared = vmulq_f64 (estimate, estimate);
+  float64x2_t step = vrsqrtsq_f64 (x, estimate_squared);
+  estimate = vmulq_f64 (estimate, step);
+
+  /* Do second step instruction.  */
+  estimate_squared = vmulq_f64 (estimate, estimate);
+  step = vrsqrtsq_f64 (x, estimate_squared);
+  estimate = vmulq_f64 (estimate, step);
+
+  /* Do third step instruction.
+     This is required to achieve < 3.0 ULP.  */
+  estimate_squared = vmulq_f64 (estimate, estimate);
+  step = vrsqrtsq_f64 (x, estimate_squared);
+  estimate = vmulq_f64 (estimate, step);
+  return estimate;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Helper for single-precision vector routines which calculate 1/sqrt(x) and do
+ * not need special-case handling
+ *
+ * Copyright (c) 2025-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_RSQRTF_INLINE_H
+#define MATH_V_RSQRTF_INLINE_H
+
+#include "v_math.h"
+
+/* Only valid for normal positive x large enough for the estimate not to
+   overflow, see the special bound of the corresponding rsqrt routine.  */
+static inline float32x4_t VPCS_ATTR
+v_rsqrtf_inline (float32x4_t x)
+{
+  /* Do estimate instruction.  */
+  float32x4_t estimate = vrsqrteq_f32 (x);
+
+  /* Do first step instruction.  */
+  float32x4_t estimate_squared = vmulq_f32 (estimate, estimate);
+  float32x4_t step = vrsqrtsq_f32 (x, estimate_squared);
+  estimate = vmulq_f32 (estimate, step);
+
+  /* Do second step instruction.
+    This is required to achieve < 3.0 ULP.  */
+  estimate_squared = vmulq_f32 (estimate, estimate);
+  step = vrsqrtsq_f32 (x, estimate_squared);
+  estimate = vmulq_f32 (estimate, step);
+  return estimate;
+}
+
+#endif
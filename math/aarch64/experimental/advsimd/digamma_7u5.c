@@ -0,0 +1,152 @@
+/*
+ * Double-precision vector digamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_polygamma_common.h"
+
+#define V_LOG_INLINE_POLY_ORDER 5
+#include "v_log_inline.h"
+
+static const struct data
+{
+  struct v_polygamma_refl_data refl;
+  float64x2_t num[7], den[6], asym_poly[7];
+  float64x2_t c0_hi, c0_lo;
+  struct v_log_inline_data log_consts;
+} data = {
+  .refl = V_POLYGAMMA_REFL_DATA,
+  /* digamma(1 + w) = (w - c0) N(w) / D(w) for w in [0, 1), with c0 = x0 - 1
+     and x0 the positive zero of digamma.  All coefficients are positive.  */
+  .num = { V2 (0x1.4018e9a62525ep+0), V2 (0x1.deb537e2d6b0bp+0),
+	   V2 (0x1.f2d3b8a179f45p-1), V2 (0x1.bdc097752559bp-3),
+	   V2 (0x1.4a8ba5f0e08d9p-6), V2 (0x1.35db381b40977p-11),
+	   V2 (0x1.2c8f08432442cp-20) },
+  .den = { V2 (0x1.16eb3f1b747f9p+1), V2 (0x1.aab8449d46457p+0),
+	   V2 (0x1.25ac0090cf2abp-1), V2 (0x1.780de5f434abcp-4),
+	   V2 (0x1.94ae8841202e5p-8), V2 (0x1.0142d52c79195p-13) },
+  .c0_hi = V2 (0x1.d8b618d5af8fep-2),
+  .c0_lo = V2 (-0x1.1e563779a1f5bp-56),
+  /* digamma(t) = log(t) - 1/(2t) - z P(z), z = 1/t^2, t >= AsymBound.  */
+  .asym_poly = { V2 (0x1.555555555553ap-4), V2 (-0x1.1111111055cb6p-7),
+		 V2 (0x1.04103dab6c771p-8), V2 (-0x1.110e2d3db4bd7p-8),
+		 V2 (0x1.ef4817bf53638p-8), V2 (-0x1.48b594e7fd2d6p-6),
+		 V2 (0x1.b0e4cf5d0914dp-5) },
+  .log_consts = V_LOG_CONSTANTS,
+};
+
+#define AsymBound 6.0
+#define TinyBound 0x1p-60
+
+/* For |x| < TinyBound, digamma(x) rounds to -1/x, which gives -inf for +0
+   and +inf for -0.  Negative integers and -inf return NaN, +inf returns
+   +inf.  */
+static float64x2_t NOINLINE VPCS_ATTR
+special_case (float64x2_t x, float64x2_t y, uint64x2_t cmp)
+{
+  float64x2_t ys = vbslq_f64 (vcgtzq_f64 (x), x, v_f64 (__builtin_nan ("")));
+  uint64x2_t tiny = vcaltq_f64 (x, v_f64 (TinyBound));
+  ys = vbslq_f64 (tiny, vdivq_f64 (v_f64 (-1.0), x), ys);
+  return vbslq_f64 (cmp, ys, y);
+}
+
+/* digamma(t) for t < AsymBound.  With n = floor(t) - 1 and y = t - n in
+   [1, 2), digamma(t) = digamma(y) + sum_{k=0}^{n-1} 1/(y + k).  For t < 1,
+   n = -1 and digamma(t) = digamma(t + 1) - 1/t.  */
+static inline float64x2_t
+digamma_small (float64x2_t t, const struct data *d)
+{
+  float64x2_t n = vrndmq_f64 (vsubq_f64 (t, v_f64 (1.0)));
+  /* Only lanes in [1, AsymBound) need the sum, this also clears NaN.  */
+  n = vbslq_f64 (vcltq_f64 (t, v_f64 (AsymBound)), n, v_f64 (0));
+  uint64x2_t lt1 = vcltzq_f64 (n);
+  float64x2_t a = vbslq_f64 (lt1, v_f64 (-1.0), v_f64 (0));
+  float64x2_t b = vbslq_f64 (lt1, t, v_f64 (1.0));
+  float64x2x2_t s = v_polygamma_sum (a, b, t, vnegq_f64 (n), n, 0);
+
+  /* w = y - 1 = t - (n + 1) is exact.  */
+  float64x2_t w = vsubq_f64 (t, vaddq_f64 (n, v_f64 (1.0)));
+  float64x2_t dw = vsubq_f64 (vsubq_f64 (w, d->c0_hi), d->c0_lo);
+  float64x2_t p = vmulq_f64 (dw, v_horner_6_f64 (w, d->num));
+  float64x2_t q = vfmaq_f64 (v_f64 (1.0), w, v_horner_5_f64 (w, d->den));
+
+  /* digamma(t) = p/q + a/b, with a single division.  */
+  return vdivq_f64 (vfmaq_f64 (vmulq_f64 (s.val[0], q), p, s.val[1]),
+		    vmulq_f64 (q, s.val[1]));
+}
+
+/* digamma(t) for t >= AsymBound.  */
+static inline float64x2_t
+digamma_asym (float64x2_t t, const struct data *d)
+{
+  float64x2_t r = vdivq_f64 (v_f64 (1.0), t);
+  float64x2_t z = vmulq_f64 (r, r);
+  float64x2_t p = vfmaq_f64 (v_f64 (0.5), r, v_horner_6_f64 (z, d->asym_poly));
+  return vfmsq_f64 (v_log_inline (t, &d->log_consts), r, p);
+}
+
+/* Vector implementation of digamma, the logarithmic derivative of the gamma
+   function.  [1, 2) uses a rational approximation with the positive zero
+   factored out, other t < 6 are brought to [1, 2) with the recurrence
+   digamma(t + 1) = digamma(t) + 1/t and above that the asymptotic expansion
+   is used.  x < 0 uses the reflection formula, see v_polygamma_common.h.
+   Relative error is unbounded around the negative zeros, one per unit
+   interval, because of the cancellation in the reflection formula.  For
+   x > 0, the maximum observed error is 5.14 ULP:
+   _ZGVnN2v_digamma(0x1.829396f757abp+1) got 0x1.dc85184c18201p-1
+					 want 0x1.dc85184c18206p-1
+   and away from the negative zeros by at least 1/16, 7.15 ULP:
+   _ZGVnN2v_digamma(-0x1.8eec440ceb61fp+6) got 0x1.d3329b3f8b1c6p+0
+					   want 0x1.d3329b3f8b1bfp+0.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (digamma) (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint64x2_t neg = vcltzq_f64 (x);
+  float64x2_t t = vbslq_f64 (neg, vsubq_f64 (v_f64 (1.0), x), x);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  uint64x2_t asym = vcgeq_f64 (t, v_f64 (AsymBound));
+  float64x2_t y;
+  if (!v_any_u64 (asym))
+    y = digamma_small (t, d);
+  else
+    {
+      y = digamma_asym (t, d);
+      uint64x2_t small = vcltq_f64 (t, v_f64 (AsymBound));
+      if (v_any_u64 (small))
+	y = vbslq_f64 (small, digamma_small (t, d), y);
+    }
+
+  if (unlikely (v_any_u64 (neg)))
+    y = vbslq_f64 (neg, vsubq_f64 (y, v_polygamma_picot (x, &d->refl)), y);
+
+  /* Tiny x, x = inf and negative integers including -inf.  */
+  uint64x2_t cmp = vorrq_u64 (
+      vcaltq_f64 (x, v_f64 (TinyBound)),
+      vorrq_u64 (vceqq_f64 (x, v_f64 (INFINITY)),
+		 vandq_u64 (neg, vceqq_f64 (x, vrndaq_f64 (x)))));
+  if (unlikely (v_any_u64 (cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_SIG (V, D, 1, digamma, 0.01, 10.0)
+TEST_ULP (V_NAME_D1 (digamma), 6.66)
+TEST_INTERVAL (V_NAME_D1 (digamma), 0, 0x1p-60, 1000)
+TEST_INTERVAL (V_NAME_D1 (digamma), 0x1p-60, 1, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), 1, 6, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), 6, 0x1p1023, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), inf, inf, 1)
+/* Errors are only bounded away from the negative zeros, test in between.  */
+TEST_INTERVAL (V_NAME_D1 (digamma), -0, -0x1p-60, 1000)
+TEST_INTERVAL (V_NAME_D1 (digamma), -0x1p-60, -0.44, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), -0.57, -1.51, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), -1.64, -2.54, 100000)
+TEST_INTERVAL (V_NAME_D1 (digamma), -99.1, -99.74, 10000)
+TEST_INTERVAL (V_NAME_D1 (digamma), -inf, -inf, 1)
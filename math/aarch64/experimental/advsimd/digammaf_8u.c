@@ -0,0 +1,142 @@
+/*
+ * Single-precision vector digamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_polygammaf_common.h"
+#include "v_logf_inline.h"
+
+static const struct data
+{
+  struct v_polygammaf_refl_data refl;
+  float32x4_t num[4], den[3], asym_poly[5];
+  float32x4_t c0_hi, c0_lo;
+  struct v_logf_data logf_consts;
+} data = {
+  .refl = V_POLYGAMMAF_REFL_DATA,
+  /* digamma(1 + w) = (w - c0) N(w) / D(w) for w in [0, 1), with c0 = x0 - 1
+     and x0 the positive zero of digamma.  All coefficients are positive.  */
+  .num = { V4 (0x1.4018eap+0f), V4 (0x1.2182fcp+0f), V4 (0x1.af5756p-3f),
+	   V4 (0x1.486ecap-9f) },
+  .den = { V4 (0x1.9686e2p+0f), V4 (0x1.4de2b2p-1f), V4 (0x1.045e36p-4f) },
+  .c0_hi = V4 (0x1.d8b618p-2f),
+  .c0_lo = V4 (0x1.ab5f2p-27f),
+  /* digamma(t) = log(t) - 1/(2t) - z P(z), z = 1/t^2, t >= AsymBound.  */
+  .asym_poly = { V4 (0x1.555554p-4f), V4 (-0x1.11030cp-7f),
+		 V4 (0x1.0033aap-8f), V4 (-0x1.bb5c2ep-9f),
+		 V4 (0x1.3eafeep-9f) },
+  .logf_consts = V_LOGF_CONSTANTS,
+};
+
+#define AsymBound 2.0f
+#define TinyBound 0x1p-30f
+
+/* For |x| < TinyBound, digamma(x) rounds to -1/x, which gives -inf for +0
+   and +inf for -0.  Negative integers and -inf return NaN, +inf returns
+   +inf.  */
+static float32x4_t NOINLINE VPCS_ATTR
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp)
+{
+  float32x4_t ys
+      = vbslq_f32 (vcgtzq_f32 (x), x, v_f32 (__builtin_nanf ("")));
+  uint32x4_t tiny = vcaltq_f32 (x, v_f32 (TinyBound));
+  ys = vbslq_f32 (tiny, vdivq_f32 (v_f32 (-1.0f), x), ys);
+  return vbslq_f32 (cmp, ys, y);
+}
+
+/* digamma(t) for t < AsymBound.  t in [1, 2) is evaluated directly, t < 1
+   uses digamma(t) = digamma(t + 1) - 1/t.  */
+static inline float32x4_t
+digamma_small (float32x4_t t, const struct data *d)
+{
+  uint32x4_t lt1 = vcltq_f32 (t, v_f32 (1.0f));
+  float32x4_t a = vbslq_f32 (lt1, v_f32 (-1.0f), v_f32 (0));
+  float32x4_t b = vbslq_f32 (lt1, t, v_f32 (1.0f));
+  /* w = t + 1 - 1 or t - 1, both exact in their range.  */
+  float32x4_t w = vbslq_f32 (lt1, t, vsubq_f32 (t, v_f32 (1.0f)));
+
+  float32x4_t dw = vsubq_f32 (vsubq_f32 (w, d->c0_hi), d->c0_lo);
+  float32x4_t p = vmulq_f32 (dw, v_horner_3_f32 (w, d->num));
+  float32x4_t q = vfmaq_f32 (v_f32 (1.0f), w, v_horner_2_f32 (w, d->den));
+
+  /* digamma(t) = p/q + a/b, with a single division.  */
+  return vdivq_f32 (vfmaq_f32 (vmulq_f32 (a, q), p, b), vmulq_f32 (q, b));
+}
+
+/* digamma(t) for t >= AsymBound.  */
+static inline float32x4_t
+digamma_asym (float32x4_t t, const struct data *d)
+{
+  float32x4_t r = vdivq_f32 (v_f32 (1.0f), t);
+  float32x4_t z = vmulq_f32 (r, r);
+  float32x4_t p
+      = vfmaq_f32 (v_f32 (0.5f), r, v_horner_4_f32 (z, d->asym_poly));
+  return vfmsq_f32 (v_logf_inline (t, &d->logf_consts), r, p);
+}
+
+/* Vector implementation of digamma, the logarithmic derivative of the gamma
+   function.  [1, 2) uses a rational approximation with the positive zero
+   factored out, t < 1 is brought to [1, 2) with the recurrence
+   digamma(t + 1) = digamma(t) + 1/t and t >= 2 uses the asymptotic
+   expansion.  x < 0 uses the reflection formula, see
+   v_polygammaf_common.h.  Relative error is unbounded around the negative
+   zeros, one per unit interval, because of the cancellation in the
+   reflection formula.  For x > 0, the maximum observed error is 4.54 ULP:
+   _ZGVnN4v_digammaf(0x1.bbc08ap+0) got 0x1.e0b28cp-3
+				    want 0x1.e0b282p-3
+   and away from the negative zeros by at least 1/16, 7.72 ULP:
+   _ZGVnN4v_digammaf(-0x1.8ee948p+6) got 0x1.e039ep+0
+				     want 0x1.e039dp+0.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (digamma) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32x4_t neg = vcltzq_f32 (x);
+  float32x4_t t = vbslq_f32 (neg, vsubq_f32 (v_f32 (1.0f), x), x);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  uint32x4_t asym = vcgeq_f32 (t, v_f32 (AsymBound));
+  float32x4_t y;
+  if (!v_any_u32 (asym))
+    y = digamma_small (t, d);
+  else
+    {
+      y = digamma_asym (t, d);
+      uint32x4_t small = vcltq_f32 (t, v_f32 (AsymBound));
+      if (v_any_u32 (small))
+	y = vbslq_f32 (small, digamma_small (t, d), y);
+    }
+
+  if (unlikely (v_any_u32 (neg)))
+    y = vbslq_f32 (neg, vsubq_f32 (y, v_polygammaf_picot (x, &d->refl)), y);
+
+  /* Tiny x, x = inf and negative integers including -inf.  */
+  uint32x4_t cmp = vorrq_u32 (
+      vcaltq_f32 (x, v_f32 (TinyBound)),
+      vorrq_u32 (vceqq_f32 (x, v_f32 (INFINITY)),
+		 vandq_u32 (neg, vceqq_f32 (x, vrndaq_f32 (x)))));
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+HALF_WIDTH_ALIAS_F1 (digamma)
+
+TEST_SIG (V, F, 1, digamma, 0.01, 10.0)
+TEST_ULP (V_NAME_F1 (digamma), 7.22)
+TEST_INTERVAL (V_NAME_F1 (digamma), 0, 0x1p-30, 1000)
+TEST_INTERVAL (V_NAME_F1 (digamma), 0x1p-30, 1, 100000)
+TEST_INTERVAL (V_NAME_F1 (digamma), 1, 2, 100000)
+TEST_INTERVAL (V_NAME_F1 (digamma), 2, inf, 100000)
+/* Errors are only bounded away from the negative zeros, test in between.  */
+TEST_INTERVAL (V_NAME_F1 (digamma), -0, -0x1p-30, 1000)
+TEST_INTERVAL (V_NAME_F1 (digamma), -0x1p-30, -0.44, 100000)
+TEST_INTERVAL (V_NAME_F1 (digamma), -0.57, -1.51, 100000)
+TEST_INTERVAL (V_NAME_F1 (digamma), -1.64, -2.54, 100000)
+TEST_INTERVAL (V_NAME_F1 (digamma), -99.1, -99.74, 10000)
+TEST_INTERVAL (V_NAME_F1 (digamma), -inf, -inf, 1)
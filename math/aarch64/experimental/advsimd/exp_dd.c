@@ -0,0 +1,50 @@
+/*
+ * Double-precision vector e^x function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "test_defs.h"
+#include "v_exp_dd_inline.h"
+
+static float64x2x2_t VPCS_ATTR NOINLINE
+special_case (float64x2_t x, float64x2x2_t y, uint64x2_t cmp)
+{
+  double t[2];
+  for (int i = 0; i < 2; i++)
+    if (cmp[i])
+      {
+	y.val[0][i] = arm_math_exp_dd (x[i], &t[i]);
+	y.val[1][i] = t[i];
+      }
+  return y;
+}
+
+/* Vector e^x returning hi in val[0] and the tail in val[1], see
+   arm_math_exp_dd.  Lanes with |x| < 0x1p-54 or |x| >= 512 use the scalar
+   routine.
+   Maximum relative error of hi + tail is 2^-65.2:
+   arm_math_advsimd_exp_dd (0x1.1f89138054aafp+6)
+     got 0x1.a1bfcce549eefp+103 + 0x1.3345p+49
+    want 0x1.a1bfcce549eefp+103 + 0x1.331980926408cp+49.
+   Maximum error of hi alone is 0.501 ULP.  */
+float64x2x2_t VPCS_ATTR
+arm_math_advsimd_exp_dd (float64x2_t x)
+{
+  const struct v_exp_dd_data *d = ptr_barrier (&v_exp_dd_data);
+  uint64x2_t special = v_exp_dd_special (x, d);
+
+  float64x2x2_t y;
+  y.val[0] = v_exp_dd_inline (x, v_f64 (0), &y.val[1], d);
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+TEST_ULP (arm_math_advsimd_exp_dd, 0.01)
+TEST_INTERVAL (arm_math_advsimd_exp_dd, 0, 0xffff000000000000, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_dd, 0x1p-6, 0x1p6, 400000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_dd, 633.3, 733.3, 10000)
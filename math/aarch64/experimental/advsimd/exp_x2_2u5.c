@@ -0,0 +1,118 @@
+/*
+ * Double-precision vector e^x function, 4 lanes per call.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "test_defs.h"
+#include "v_exp_special_case_inline.h"
+
+/* Value of |x| above which scale overflows without special treatment.  */
+#define SpecialBound 0x1.6232bdd76683cp+9 /* ln(2^1022) ~ 708.40.  */
+
+/* Value of n above which scale overflows even with special treatment.  */
+#define ScaleBound 163840.0 /* 1280.0 * N.  */
+
+static const struct data
+{
+  struct v_exp_special_data special_data;
+  float64x2_t inv_ln2, shift;
+  float64x2_t special_bound, scale_thresh, c0;
+  double ln2_hi, ln2_lo;
+  double c1, c2;
+} data = {
+  /* Same algorithm and coefficients as _ZGVnN2v_exp.  */
+  .special_data = V_EXP_SPECIAL_DATA,
+  .c0 = V2 (0x1.ffffffffffd43p-2),
+  .c1 = 0x1.55555c75adbb2p-3,
+  .c2 = 0x1.55555da646206p-5,
+  .scale_thresh = V2 (ScaleBound),
+  .special_bound = V2 (SpecialBound),
+  .inv_ln2 = V2 (0x1.71547652b82fep7), /* N/ln2.  */
+  .ln2_hi = 0x1.62e42fefa39efp-8,      /* ln2/N.  */
+  .ln2_lo = 0x1.abc9e3b39803f3p-63,
+  .shift = V2 (0x1.8p+52),
+};
+
+#define N (1 << V_EXP_TABLE_BITS)
+#define IndexMask (N - 1)
+
+static inline uint64x2_t
+lookup_sbits (uint64x2_t i)
+{
+  return (uint64x2_t){ __v_exp_data[i[0] & IndexMask],
+		       __v_exp_data[i[1] & IndexMask] };
+}
+
+/* Two interleaved exp evaluations, for use from simdlen(4) loops, see
+   arm_math_advsimd_expf_x2.  Each half returns the same result as
+   _ZGVnN2v_exp.
+   Maximum measured error is 1.9 + 0.5ulp.  */
+float64x2x2_t VPCS_ATTR
+arm_math_advsimd_exp_x2 (float64x2x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float64x2_t ln2_hi_lo = vld1q_f64 (&d->ln2_hi);
+  float64x2_t c12 = vld1q_f64 (&d->c1);
+  float64x2_t x0 = x.val[0], x1 = x.val[1];
+
+  /* n = round(x/(ln2/N)).  */
+  float64x2_t z0 = vfmaq_f64 (d->shift, x0, d->inv_ln2);
+  float64x2_t z1 = vfmaq_f64 (d->shift, x1, d->inv_ln2);
+  uint64x2_t u0 = vreinterpretq_u64_f64 (z0);
+  uint64x2_t u1 = vreinterpretq_u64_f64 (z1);
+  float64x2_t n0 = vsubq_f64 (z0, d->shift);
+  float64x2_t n1 = vsubq_f64 (z1, d->shift);
+
+  /* r = x - n*ln2/N.  */
+  float64x2_t r0 = vfmsq_laneq_f64 (x0, n0, ln2_hi_lo, 0);
+  float64x2_t r1 = vfmsq_laneq_f64 (x1, n1, ln2_hi_lo, 0);
+  r0 = vfmsq_laneq_f64 (r0, n0, ln2_hi_lo, 1);
+  r1 = vfmsq_laneq_f64 (r1, n1, ln2_hi_lo, 1);
+
+  uint64x2_t e0 = vshlq_n_u64 (u0, 52 - V_EXP_TABLE_BITS);
+  uint64x2_t e1 = vshlq_n_u64 (u1, 52 - V_EXP_TABLE_BITS);
+
+  /* poly = exp(r) - 1 ~= r + C0 r^2 + C1 r^3 + C2 r^4.  */
+  float64x2_t r2_0 = vmulq_f64 (r0, r0);
+  float64x2_t r2_1 = vmulq_f64 (r1, r1);
+  float64x2_t poly0 = vfmaq_laneq_f64 (d->c0, r0, c12, 0);
+  float64x2_t poly1 = vfmaq_laneq_f64 (d->c0, r1, c12, 0);
+  poly0 = vfmaq_laneq_f64 (poly0, r2_0, c12, 1);
+  poly1 = vfmaq_laneq_f64 (poly1, r2_1, c12, 1);
+  poly0 = vfmaq_f64 (r0, poly0, r2_0);
+  poly1 = vfmaq_f64 (r1, poly1, r2_1);
+
+  /* scale = 2^(n/N).  */
+  float64x2_t scale0
+      = vreinterpretq_f64_u64 (vaddq_u64 (lookup_sbits (u0), e0));
+  float64x2_t scale1
+      = vreinterpretq_f64_u64 (vaddq_u64 (lookup_sbits (u1), e1));
+
+  uint64x2_t cmp0 = vcagtq_f64 (x0, d->special_bound);
+  uint64x2_t cmp1 = vcagtq_f64 (x1, d->special_bound);
+
+  float64x2x2_t y;
+  y.val[0] = vfmaq_f64 (scale0, poly0, scale0);
+  y.val[1] = vfmaq_f64 (scale1, poly1, scale1);
+  if (unlikely (v_any_u64 (vorrq_u64 (cmp0, cmp1))))
+    {
+      if (v_any_u64 (cmp0))
+	y.val[0] = exp_special (poly0, n0, scale0, d->scale_thresh,
+				&d->special_data);
+      if (v_any_u64 (cmp1))
+	y.val[1] = exp_special (poly1, n1, scale1, d->scale_thresh,
+				&d->special_data);
+    }
+  return y;
+}
+
+TEST_ULP (arm_math_advsimd_exp_x2, 1.9)
+TEST_INTERVAL (arm_math_advsimd_exp_x2, 0, 0xffff000000000000, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_x2, 0, 0x1p-23, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_x2, 0x1p-23, SpecialBound, 100000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_x2, SpecialBound, ScaleBound, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_exp_x2, SpecialBound, inf, 10000)
@@ -0,0 +1,41 @@
+/*
+ * Single-precision AdvSIMD e^x over arrays.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "arm_math_inline.h"
+#include "test_defs.h"
+#include "v_array_special.h"
+
+/* asuint (87.0f): above this bound, or for inf and nan, the core is not
+   valid.  */
+#define Thres 0x42ae0000
+
+static inline uint32x4_t
+special (float32x4_t x)
+{
+  uint32x4_t ia = vandq_u32 (vreinterpretq_u32_f32 (x), v_u32 (0x7fffffff));
+  return vcgtq_u32 (ia, v_u32 (Thres));
+}
+
+/* y[i] = exp (x[i]) for 0 <= i < n.
+   Lanes with |x| > 87, inf or nan are recomputed by the scalar expf in a
+   deferred pass over each block instead of a per-vector fallback, see
+   v_array_special.h.  Same accuracy as _ZGVnN4v_expf in the fast path:
+   maximum error is 1.44 + 0.5 ULP.  */
+V_ARRAY_F32 (arm_math_advsimd_expf_array, arm_math_v_expf_inline, special,
+	     expf, &arm_math_v_expf_data)
+
+TEST_ULP (arm_math_advsimd_expf_array, 1.49)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array, 0, 0x1p-23, 50000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array, 0x1p-23, 87, 100000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array, 87, 0x1p7, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array, 0x1p7, inf, 10000)
+/* In place, including special lanes.  */
+TEST_ULP (arm_math_advsimd_expf_array_inplace, 1.49)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array_inplace, 0, 87, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_array_inplace, 87, inf, 10000)
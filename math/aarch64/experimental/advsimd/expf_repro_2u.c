@@ -0,0 +1,71 @@
+/*
+ * Reproducible single-precision vector e^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#include "v_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+#include "aarch64/experimental/expf_repro.h"
+
+static const struct data
+{
+  float32x4_t inv_ln2, shift, c0, c1, c2, c3, c4;
+  float ln2_hi, ln2_lo, null0, null1;
+  uint32x4_t thres;
+} data = {
+  .inv_ln2 = V4 (ExpfReproInvLn2),
+  .shift = V4 (ExpfReproShift),
+  .ln2_hi = ExpfReproLn2hi,
+  .ln2_lo = ExpfReproLn2lo,
+  .c0 = V4 (ExpfReproC0),
+  .c1 = V4 (ExpfReproC1),
+  .c2 = V4 (ExpfReproC2),
+  .c3 = V4 (ExpfReproC3),
+  .c4 = V4 (ExpfReproC4),
+  .thres = V4 (ExpfReproThres),
+};
+
+static float32x4_t VPCS_ATTR NOINLINE
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp)
+{
+  return v_call_f32 (arm_math_expf_repro, x, y, cmp);
+}
+
+/* Reproducible AdvSIMD expf, bit-identical to arm_math_expf_repro in all
+   rounding modes. Every lane follows the evaluation order of the scalar
+   routine (see expf_repro.h), and special lanes are computed by it.
+   Maximum error is 1.45 +0.5 ULP:
+   arm_math_advsimd_expf_repro(-0x1.4cb5fep+2) got 0x1.6a0982p-8
+					      want 0x1.6a0986p-8.  */
+float32x4_t VPCS_ATTR NOINLINE
+arm_math_advsimd_expf_repro (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float32x4_t ln2 = vld1q_f32 (&d->ln2_hi);
+
+  uint32x4_t iax = vandq_u32 (vreinterpretq_u32_f32 (x), v_u32 (0x7fffffff));
+  uint32x4_t cmp = vcgtq_u32 (iax, d->thres);
+
+  float32x4_t z = vfmaq_f32 (d->shift, x, d->inv_ln2);
+  float32x4_t n = vsubq_f32 (z, d->shift);
+  float32x4_t r = vfmsq_laneq_f32 (x, n, ln2, 0);
+  r = vfmsq_laneq_f32 (r, n, ln2, 1);
+  uint32x4_t e = vshlq_n_u32 (vreinterpretq_u32_f32 (z), 23);
+
+  float32x4_t p = vfmaq_f32 (d->c1, d->c0, r);
+  p = vfmaq_f32 (d->c2, p, r);
+  p = vfmaq_f32 (d->c3, p, r);
+  p = vfmaq_f32 (d->c4, p, r);
+  float32x4_t y = vfmaq_f32 (v_f32 (1.0f), p, r);
+  y = vreinterpretq_f32_u32 (vaddq_u32 (vreinterpretq_u32_f32 (y), e));
+
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_ULP (arm_math_advsimd_expf_repro, 1.46)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_repro, 0, 0x1.58p6, 50000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_repro, 0x1.58p6, inf, 50000)
@@ -0,0 +1,101 @@
+/*
+ * Single-precision vector e^x function, 8 lanes per call.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+#include "v_expf_special_inline.h"
+
+/* Value of |x| above which scale overflows without special treatment.  */
+#define SpecialBound 0x1.5ebb83cf2cf96p+6 /* ≈ 87.69.  */
+
+static const struct data
+{
+  struct v_expf_special_data special_data;
+  float32x4_t c1, c3, c4, inv_ln2;
+  float ln2_hi, ln2_lo, c0, c2;
+  uint32x4_t exponent_bias;
+  float32x4_t special_bound;
+} data = {
+  /* Same algorithm and coefficients as _ZGVnN4v_expf.  */
+  .special_data = V_EXPF_SPECIAL_DATA,
+  .c0 = 0x1.0e4020p-7f,
+  .c1 = V4 (0x1.573e2ep-5f),
+  .c2 = 0x1.555e66p-3f,
+  .c3 = V4 (0x1.fffdb6p-2f),
+  .c4 = V4 (0x1.ffffecp-1f),
+  .inv_ln2 = V4 (0x1.715476p+0f),
+  .ln2_hi = 0x1.62e4p-1f,
+  .ln2_lo = 0x1.7f7d1cp-20f,
+  .exponent_bias = V4 (0x3f800000),
+  .special_bound = V4 (SpecialBound),
+};
+
+/* Two interleaved expf evaluations, for use from simdlen(8) loops.  The
+   polynomial of _ZGVnN4v_expf is a serial dependency chain, so on cores with
+   more than two FP pipes a single call leaves most of them idle.  Evaluating
+   two independent chains per call, with constants loaded once, lets them fill
+   up without relying on the caller to unroll across the call boundary.
+   The maximum error is 1.44 +0.5 ULP, as for _ZGVnN4v_expf:
+   arm_math_advsimd_expf_x2(-0x1.86f03cp+5) got 0x1.69e27p-71
+				want 0x1.69e274p-71.  */
+float32x4x2_t VPCS_ATTR
+arm_math_advsimd_expf_x2 (float32x4x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float32x4_t ln2_c02 = vld1q_f32 (&d->ln2_hi);
+  float32x4_t x0 = x.val[0], x1 = x.val[1];
+
+  /* exp(x) = 2^n (1 + poly(r)), with 1 + poly(r) in [1/sqrt(2),sqrt(2)]
+     x = ln2*n + r, with r in [-ln2/2, ln2/2].  */
+  float32x4_t n0 = vrndaq_f32 (vmulq_f32 (x0, d->inv_ln2));
+  float32x4_t n1 = vrndaq_f32 (vmulq_f32 (x1, d->inv_ln2));
+  float32x4_t r0 = vfmsq_laneq_f32 (x0, n0, ln2_c02, 0);
+  float32x4_t r1 = vfmsq_laneq_f32 (x1, n1, ln2_c02, 0);
+  r0 = vfmsq_laneq_f32 (r0, n0, ln2_c02, 1);
+  r1 = vfmsq_laneq_f32 (r1, n1, ln2_c02, 1);
+  uint32x4_t e0 = vshlq_n_u32 (vreinterpretq_u32_s32 (vcvtq_s32_f32 (n0)), 23);
+  uint32x4_t e1 = vshlq_n_u32 (vreinterpretq_u32_s32 (vcvtq_s32_f32 (n1)), 23);
+  float32x4_t scale0
+      = vreinterpretq_f32_u32 (vaddq_u32 (e0, d->exponent_bias));
+  float32x4_t scale1
+      = vreinterpretq_f32_u32 (vaddq_u32 (e1, d->exponent_bias));
+
+  uint32x4_t cmp0 = vcageq_f32 (x0, d->special_bound);
+  uint32x4_t cmp1 = vcageq_f32 (x1, d->special_bound);
+
+  float32x4_t r2_0 = vmulq_f32 (r0, r0);
+  float32x4_t r2_1 = vmulq_f32 (r1, r1);
+  float32x4_t p0 = vfmaq_laneq_f32 (d->c1, r0, ln2_c02, 2);
+  float32x4_t p1 = vfmaq_laneq_f32 (d->c1, r1, ln2_c02, 2);
+  float32x4_t q0 = vfmaq_laneq_f32 (d->c3, r0, ln2_c02, 3);
+  float32x4_t q1 = vfmaq_laneq_f32 (d->c3, r1, ln2_c02, 3);
+  q0 = vfmaq_f32 (q0, p0, r2_0);
+  q1 = vfmaq_f32 (q1, p1, r2_1);
+  p0 = vmulq_f32 (d->c4, r0);
+  p1 = vmulq_f32 (d->c4, r1);
+  float32x4_t poly0 = vfmaq_f32 (p0, q0, r2_0);
+  float32x4_t poly1 = vfmaq_f32 (p1, q1, r2_1);
+
+  float32x4x2_t y;
+  if (unlikely (v_any_u32 (vorrq_u32 (cmp0, cmp1))))
+    {
+      y.val[0] = expf_special (poly0, n0, e0, cmp0, scale0, &d->special_data);
+      y.val[1] = expf_special (poly1, n1, e1, cmp1, scale1, &d->special_data);
+      return y;
+    }
+
+  y.val[0] = vfmaq_f32 (scale0, poly0, scale0);
+  y.val[1] = vfmaq_f32 (scale1, poly1, scale1);
+  return y;
+}
+
+TEST_ULP (arm_math_advsimd_expf_x2, 1.49)
+TEST_INTERVAL (arm_math_advsimd_expf_x2, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_x2, 0, 0x1p-23, 50000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_x2, 0x1p-23, SpecialBound, 50000)
+TEST_SYM_INTERVAL (arm_math_advsimd_expf_x2, SpecialBound, inf, 10000)
@@ -0,0 +1,54 @@
+/*
+ * Double-precision vector regularized upper incomplete gamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_gammainc_common.h"
+
+static float64x2_t NOINLINE VPCS_ATTR
+special_lanes (float64x2_t a, float64x2_t x, float64x2_t y, uint64x2_t cmp)
+{
+  return vbslq_f64 (cmp, v_gammainc_special (a, x, 1), y);
+}
+
+/* Regularized upper incomplete gamma function
+   Q(a, x) = 1/Gamma(a) int_x^inf t^(a-1) e^-t dt = 1 - P(a, x), see
+   v_gammainc_common.h.  Q keeps a small relative error where it is tiny,
+   for x much larger than a, and for a close to 0.  The largest errors are
+   for a < 1 and x close to 1, where the alternating series cancels, the
+   maximum observed error is 24.93 ULP:
+   _ZGVnN2vv_gammaincc(0x1.0a146c88c71dep-16, 0x1.f6de82f54962fp-1)
+     got 0x1.e136f9079c17p-19 want 0x1.e136f9079c157p-19.  */
+float64x2_t VPCS_ATTR V_NAME_D2 (gammaincc) (float64x2_t a, float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  const struct v_gammainc_data *g = ptr_barrier (&gammainc_data);
+  float64x2_t inf = v_f64 (INFINITY);
+  /* Lanes with a or x not positive and finite, including NaN.  */
+  uint64x2_t cmp = vceqzq_u64 (vandq_u64 (
+      vandq_u64 (vcgtzq_f64 (a), vcltq_f64 (a, inf)),
+      vandq_u64 (vcgtzq_f64 (x), vcltq_f64 (x, inf))));
+  if (unlikely (v_any_u64 (cmp)))
+    {
+      float64x2_t y = v_gammainc_inline (vbslq_f64 (cmp, v_f64 (1.0), a),
+					 vbslq_f64 (cmp, v_f64 (1.0), x), 1, d,
+					 g);
+      return special_lanes (a, x, y, cmp);
+    }
+  return v_gammainc_inline (a, x, 1, d, g);
+}
+
+TEST_SIG (V, D, 2, gammaincc, 0.01, 20.0)
+TEST_ULP (V_NAME_D2 (gammaincc), 24.43)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 0x1p-20, 1, 0x1p-20, 1, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 0x1p-20, 1, 1, 40, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 1, 10, 0, 40, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 10, 100, 1, 300, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 100, 1000, 50, 2000, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), 0, inf, inf, inf, 100)
+TEST_INTERVAL2 (V_NAME_D2 (gammaincc), -0.0, -inf, 0, inf, 100)
@@ -0,0 +1,112 @@
+/*
+ * Double-precision vector Bessel function of the first kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_bessel_common.h"
+
+#define NQ 13
+
+static const struct data
+{
+  struct v_bessel_asym_data asym;
+  struct v_bessel_small_data small;
+  double mid[6][16];
+} data = {
+  .asym = V_BESSEL_ASYM0_DATA,
+  .small = V_BESSEL_J0_SMALL_DATA,
+  .mid = {
+	  { 0x1.33d152e971b4p+1, -0x1.0f539d7da258ep-53, -0x1.09cdb3655128p-1,
+	    0x1.ba1deea02949p-4, 0x1.cfae864368a9bp-5, -0x1.1bb1cbe1a3052p-7,
+	    -0x1.1f9925907b4d5p-9, 0x1.15382b9b9d525p-12,
+	    0x1.6ed3b8ec82d7fp-15, -0x1.232c65c3427fep-18,
+	    -0x1.1cccf63794348p-21, 0x1.7fbf97fde8bbbp-25,
+	    0x1.28d11d6b6bd02p-28, -0x1.1933cf375b1f2p-32,
+	    -0x1.1caacb5fe5591p-34, 0 },
+	  { 0x1.33d152e971b4p+1, -0x1.0f539d7da258ep-53, -0x1.09cdb365491b6p-1,
+	    0x1.ba1dee9ccde9p-4, 0x1.cfae866c55e75p-5, -0x1.1bb1ce3d2cf75p-7,
+	    -0x1.1f990e1ad72e4p-9, 0x1.1536dee172279p-12,
+	    0x1.6ee13df9edb66p-15, -0x1.2394ca7161526p-18,
+	    -0x1.1a789f6d3e57cp-21, 0x1.6c6379d3f3951p-25,
+	    0x1.63b49da8cacf7p-28, -0x1.227a7e9eff43cp-31,
+	    0x1.83f67cfaf8c3ep-38, 0 },
+	  { 0x1.6148f5b2c2e45p+2, 0x1.75054cd60a517p-54, 0x1.5c6e60a09641p-2,
+	    -0x1.f8f72e7ba4507p-6, -0x1.b2150cb7c6ba8p-5, 0x1.2f7ffe1de7536p-8,
+	    0x1.27e31d9578b73p-9, -0x1.6f6463a3eb269p-13,
+	    -0x1.8640b15e9f83fp-15, 0x1.ad62541ff58ap-19,
+	    0x1.32aceb3e128d7p-21, -0x1.2f41182e0be4ep-25,
+	    -0x1.44eb14dc94a5dp-28, 0x1.1f35d0a167f07p-32,
+	    0x1.1d226d2fc7829p-35, 0 },
+	  { 0x1.6148f5b2c2e45p+2, 0x1.75054cd60a517p-54, 0x1.5c6e60a097823p-2,
+	    -0x1.f8f72e7a848e3p-6, -0x1.b2150cb41e979p-5, 0x1.2f7ffe9025a99p-8,
+	    0x1.27e31fe9c009ap-9, -0x1.6f641f424fa9p-13,
+	    -0x1.863f48667edc1p-15, 0x1.ad77d902bee9fp-19,
+	    0x1.32e7576f92eddp-21, -0x1.2da52341c1da6p-25,
+	    -0x1.429f8dffb15bp-28, 0x1.1db5af8420a23p-32,
+	    0x1.6c92c21b4ec35p-35, 0 },
+	  { 0x1.6148f5b2c2e45p+2, 0x1.75054cd60a517p-54, 0x1.5c6e60a09480cp-2,
+	    -0x1.f8f72e779f3d7p-6, -0x1.b2150cbe4784bp-5, 0x1.2f7fffe7ea02dp-8,
+	    0x1.27e31846333e5p-9, -0x1.6f632868431f7p-13,
+	    -0x1.8644f92151db5p-15, 0x1.addb3ac91d01cp-19,
+	    0x1.31a60f620e45cp-21, -0x1.21d69315253ddp-25,
+	    -0x1.691fdefae1815p-28, 0x1.cab69590f8ed5p-32,
+	    0x1.3e0a343be4e45p-39, 0 },
+	  { 0x1.14eb56cccdecap+3, -0x1.51970714c7c25p-52,
+	    -0x1.15f7977a69351p-2, 0x1.00f7fcfc4e6b1p-6, 0x1.68b9850ad1a2dp-5,
+	    -0x1.48e62f87a6de3p-9, -0x1.0e0d5164ab018p-9,
+	    0x1.d79908187188ep-14, 0x1.7807dc60f8ca9p-15,
+	    -0x1.32c1854d855c3p-19, -0x1.2fee637dcecabp-21,
+	    0x1.dcdaa3c99b053p-26, 0x1.56055d6c483e5p-28,
+	    -0x1.77a32b0af4b4bp-33, -0x1.f27fb79f041cp-36, 0 },
+  },
+};
+
+/* Vector implementation of J0, the Bessel function of the first kind of order
+   0.  |x| < 2 uses a polynomial in x^2 with the first zero factored out,
+   [2, 8) uses a polynomial per unit interval with the closest zero factored
+   out, above that the phase-amplitude form is evaluated with the sincos core,
+   see v_bessel_common.h.  Relative error is unbounded around the zeros above
+   8 as the phase is only accurate in absolute terms, the error grows like
+   1/|x - zero|.  Away from those zeros by at least 1/16, the maximum observed
+   error is 5.75 ULP:
+   _ZGVnN2v_j0(0x1.fc810ce310362p+21) got 0x1.e933a09fed90bp-13
+				      want 0x1.e933a09fed905p-13.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (j0) (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float64x2_t ax = vabsq_f64 (x);
+
+  /* NaN is not in the asymptotic region, and propagates through the table
+     region approximation.  */
+  uint64x2_t lt_asym = vcltq_f64 (ax, v_f64 (AsymBound));
+  if (!v_any_u64 (lt_asym))
+    return v_bessel_asym (ax, 0, 0, &d->asym);
+
+  float64x2_t y = v_bessel_mid (ax, &d->mid[0][0], NQ);
+  uint64x2_t small = vcltq_f64 (ax, v_f64 (MidBound));
+  if (v_any_u64 (small))
+    y = vbslq_f64 (small,
+		   v_bessel_small (ax, vmulq_f64 (ax, ax), &d->small), y);
+  uint64x2_t asym = vcgeq_f64 (ax, v_f64 (AsymBound));
+  if (v_any_u64 (asym))
+    y = vbslq_f64 (asym, v_bessel_asym (ax, 0, 0, &d->asym), y);
+  return y;
+}
+
+TEST_SIG (V, D, 1, j0, -10.0, 10.0)
+TEST_ULP (V_NAME_D1 (j0), 5.25)
+/* Errors are only bounded away from the zeros of J0 above 8, test in
+   between.  */
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 0, 8.59, 100000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 8.72, 11.72, 100000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 11.86, 14.86, 100000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 4092.78, 4095.78, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 8388601.45, 8388604.45, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 8388610.87, 8388613.88, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), 10000000002.93, 10000000005.94, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j0), inf, inf, 1)
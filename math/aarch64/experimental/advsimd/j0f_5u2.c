@@ -0,0 +1,60 @@
+/*
+ * Single-precision vector Bessel function of the first kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_besself_common.h"
+
+static const struct data
+{
+  struct v_besself_asym_data asym;
+  struct v_besself_small_data small;
+} data = {
+  .asym = V_BESSELF_ASYM0_DATA,
+  .small = V_BESSELF_J0_SMALL_DATA,
+};
+
+/* Vector implementation of J0, the Bessel function of the first kind of order
+   0.  |x| < 2 uses a polynomial in x^2 with the first zero factored out, above
+   that the phase-amplitude form is evaluated with the sincosf core, see
+   v_besself_common.h.  Relative error is unbounded around the other zeros as
+   the phase is only accurate in absolute terms, the error grows like
+   1/|x - zero|.  Away from zeros by at least 1/16, the maximum observed error
+   is 5.19 ULP:
+   _ZGVnN4v_j0f(0x1.7a1d9p+1) got -0x1.f3dc94p-3
+			     want -0x1.f3dc9ep-3.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (j0) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float32x4_t ax = vabsq_f32 (x);
+  uint32x4_t asym = vcgeq_f32 (ax, v_f32 (AsymBound));
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  float32x4_t z = vmulq_f32 (ax, ax);
+  if (!v_any_u32 (asym))
+    return v_besself_small (ax, z, &d->small);
+
+  float32x4_t y = v_besself_asym (ax, 0, &d->asym);
+  if (v_any_u32 (vmvnq_u32 (asym)))
+    return vbslq_f32 (asym, y, v_besself_small (ax, z, &d->small));
+  return y;
+}
+
+HALF_WIDTH_ALIAS_F1 (j0)
+
+TEST_SIG (V, F, 1, j0, -10.0, 10.0)
+TEST_ULP (V_NAME_F1 (j0), 4.69)
+/* Errors are only bounded away from the zeros of J0, test in between.  */
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 0, 2.34, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 2.47, 5.45, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 5.59, 8.59, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 4092.78, 4095.78, 10000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 524287.11, 524290.12, 1000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), 2097150.61, 2097153.61, 1000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j0), inf, inf, 1)
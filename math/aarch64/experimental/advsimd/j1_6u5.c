@@ -0,0 +1,123 @@
+/*
+ * Double-precision vector Bessel function of the first kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_bessel_common.h"
+
+#define NQ 13
+
+static const struct data
+{
+  struct v_bessel_asym_data asym;
+  struct v_bessel_small_data small;
+  double mid[6][16];
+} data = {
+  .asym = V_BESSEL_ASYM1_DATA,
+  .small = V_BESSEL_J1_SMALL_DATA,
+  .mid = {
+	  { 0x1.ea75575af6f09p+1, -0x1.60155a9d1b256p-53,
+	    -0x1.9c6cf582468fap-2, 0x1.ae8a3a208d779p-5, 0x1.b589d2a93f396p-5,
+	    -0x1.53753212be046p-8, -0x1.24b2f7c805571p-9,
+	    0x1.6e527c8632b71p-13, 0x1.83b9fd176e333p-15,
+	    -0x1.9668b27df18eep-19, -0x1.30e80767fc47ap-21,
+	    0x1.27379fe4155b5p-25, 0x1.6709d596ec005p-28, -0x1.6b832d6d243p-33,
+	    -0x1.d7414b03004aap-36, 0 },
+	  { 0x1.ea75575af6f09p+1, -0x1.60155a9d1b256p-53,
+	    -0x1.9c6cf582cbf7fp-2, 0x1.ae8a39f51ad02p-5, 0x1.b589d1da139eep-5,
+	    -0x1.537544c33034ep-8, -0x1.24b340998273bp-9,
+	    0x1.6e4c2d42bbd6fp-13, 0x1.83a06e399aa0ep-15,
+	    -0x1.97998c86648bfp-19, -0x1.337e0bf8bc783p-21,
+	    0x1.178541d3e76adp-25, 0x1.495dd2c3da27ap-28,
+	    -0x1.c7e4921264058p-33, -0x1.a20facd99f392p-36, 0 },
+	  { 0x1.ea75575af6f09p+1, -0x1.60155a9d1b256p-53,
+	    -0x1.9c6cf582cbf6dp-2, 0x1.ae8a39f519caap-5, 0x1.b589d1da20cc4p-5,
+	    -0x1.537544c6548d9p-8, -0x1.24b3407a4299fp-9,
+	    0x1.6e4c26aa5603cp-13, 0x1.83a0af42a4de3p-15,
+	    -0x1.97a102743318ap-19, -0x1.335daff9e3cccp-21,
+	    0x1.14ee920166e71p-25, 0x1.5008e39ba6439p-28,
+	    -0x1.4a1d0864bf9afp-32, -0x1.c5b30acf21da9p-37, 0 },
+	  { 0x1.c0ff5f3b4725p+2, -0x1.b226d9d243827p-54, 0x1.33518b346ad0ep-2,
+	    -0x1.5e70dea6a2fe5p-6, -0x1.80c840922e45fp-5, 0x1.9a4a6ca1e892dp-9,
+	    0x1.13fa88088671dp-9, -0x1.074dbd3c7bab4p-13,
+	    -0x1.79c04ea28ec8dp-15, 0x1.3ed0100c39d39p-19,
+	    0x1.2958821e9df08p-21, -0x1.101d1f737c4dap-25,
+	    -0x1.8c10109bcf052p-28, 0x1.050216a46eea9p-34,
+	    0x1.76c1e8b1436ebp-36, 0 },
+	  { 0x1.c0ff5f3b4725p+2, -0x1.b226d9d243827p-54, 0x1.33518b3874e8ap-2,
+	    -0x1.5e70dc60364e1p-6, -0x1.80c83bdef02b4p-5, 0x1.9a4b292cbe57ap-9,
+	    0x1.13fbc7cb43b21p-9, -0x1.07358f168f81ep-13,
+	    -0x1.796a9eb3114c2p-15, 0x1.42504067e270bp-19,
+	    0x1.30081a25f97bap-21, -0x1.d82b231dc30e2p-26,
+	    -0x1.4ceb037cbb3d3p-28, 0x1.6eeefe3acf9c7p-33,
+	    0x1.afd16c1716255p-36, 0 },
+	  { 0x1.c0ff5f3b4725p+2, -0x1.b226d9d243827p-54, 0x1.33518b3874e8ap-2,
+	    -0x1.5e70dc603632ep-6, -0x1.80c83bdeec8dbp-5, 0x1.9a4b292be82fbp-9,
+	    0x1.13fbc7ed2b727p-9, -0x1.0735939868d77p-13,
+	    -0x1.796a06fc822c9p-15, 0x1.4245d47bb3771p-19,
+	    0x1.30883aeeb1439p-21, -0x1.e0d887b65dcfcp-26,
+	    -0x1.25347e2a8f11fp-28, 0x1.946a0eaf8fc22p-35,
+	    0x1.b5bd0e5118142p-35, 0 },
+  },
+};
+
+static inline float64x2_t
+j1_small (float64x2_t ax, const struct data *d)
+{
+  float64x2_t z = vmulq_f64 (ax, ax);
+  return vmulq_f64 (ax, v_bessel_small (ax, z, &d->small));
+}
+
+/* Vector implementation of J1, the Bessel function of the first kind of order
+   1.  |x| < 2 uses x times a polynomial in x^2 with the first positive zero
+   factored out, [2, 8) uses a polynomial per unit interval with the closest
+   zero factored out, above that the phase-amplitude form is evaluated with
+   the sincos core, see v_bessel_common.h.  Relative error is unbounded around
+   the zeros above 8 as the phase is only accurate in absolute terms, the
+   error grows like 1/|x - zero|.  Away from those zeros by at least 1/16, the
+   maximum observed error is 6.40 ULP:
+   _ZGVnN2v_j1(0x1.ebb9bc7137572p+9) got 0x1.fa2cfc477b9b5p-7
+				     want 0x1.fa2cfc477b9afp-7.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (j1) (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float64x2_t ax = vabsq_f64 (x);
+  uint64x2_t sign = veorq_u64 (vreinterpretq_u64_f64 (x),
+			       vreinterpretq_u64_f64 (ax));
+
+  /* J1 is odd, evaluate on |x| and restore the sign.  NaN is not in the
+     asymptotic region, and propagates through the table region
+     approximation.  */
+  float64x2_t y;
+  uint64x2_t lt_asym = vcltq_f64 (ax, v_f64 (AsymBound));
+  if (!v_any_u64 (lt_asym))
+    y = v_bessel_asym (ax, 1, 3, &d->asym);
+  else
+    {
+      y = v_bessel_mid (ax, &d->mid[0][0], NQ);
+      uint64x2_t small = vcltq_f64 (ax, v_f64 (MidBound));
+      if (v_any_u64 (small))
+	y = vbslq_f64 (small, j1_small (ax, d), y);
+      uint64x2_t asym = vcgeq_f64 (ax, v_f64 (AsymBound));
+      if (v_any_u64 (asym))
+	y = vbslq_f64 (asym, v_bessel_asym (ax, 1, 3, &d->asym), y);
+    }
+  return vreinterpretq_f64_u64 (veorq_u64 (vreinterpretq_u64_f64 (y), sign));
+}
+
+TEST_SIG (V, D, 1, j1, -10.0, 10.0)
+TEST_ULP (V_NAME_D1 (j1), 5.9)
+/* Errors are only bounded away from the zeros of J1 above 8, test in
+   between.  */
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 0, 10.11, 100000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 10.24, 13.26, 100000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 4094.35, 4097.35, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 8388603.02, 8388606.02, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 8388609.3, 8388612.31, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), 10000000001.36, 10000000004.37, 10000)
+TEST_SYM_INTERVAL (V_NAME_D1 (j1), inf, inf, 1)
@@ -0,0 +1,72 @@
+/*
+ * Single-precision vector Bessel function of the first kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_besself_common.h"
+
+static const struct data
+{
+  struct v_besself_asym_data asym;
+  struct v_besself_small_data small;
+} data = {
+  .asym = V_BESSELF_ASYM1_DATA,
+  .small = V_BESSELF_J1_SMALL_DATA,
+};
+
+static inline float32x4_t
+j1_small (float32x4_t ax, const struct data *d)
+{
+  float32x4_t z = vmulq_f32 (ax, ax);
+  return vmulq_f32 (ax, v_besself_small (ax, z, &d->small));
+}
+
+/* Vector implementation of J1, the Bessel function of the first kind of order
+   1.  |x| < 2 uses x times a polynomial in x^2 with the first positive zero
+   factored out, above that the phase-amplitude form is evaluated with the
+   sincosf core, see v_besself_common.h.  Relative error is unbounded around
+   the other zeros as the phase is only accurate in absolute terms, the error
+   grows like 1/|x - zero|.  Away from zeros by at least 1/16, the maximum
+   observed error is 5.79 ULP:
+   _ZGVnN4v_j1f(0x1.e0fa5ep+1) got 0x1.ed1becp-6
+			     want 0x1.ed1bep-6.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (j1) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float32x4_t ax = vabsq_f32 (x);
+  uint32x4_t sign = veorq_u32 (vreinterpretq_u32_f32 (x),
+			       vreinterpretq_u32_f32 (ax));
+  uint32x4_t asym = vcgeq_f32 (ax, v_f32 (AsymBound));
+
+  /* J1 is odd, evaluate on |x| and restore the sign.  NaN is not in the
+     asymptotic region, and propagates through the small region
+     approximation.  */
+  float32x4_t y;
+  if (!v_any_u32 (asym))
+    y = j1_small (ax, d);
+  else
+    {
+      y = v_besself_asym (ax, 3, &d->asym);
+      if (v_any_u32 (vmvnq_u32 (asym)))
+	y = vbslq_f32 (asym, y, j1_small (ax, d));
+    }
+  return vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (y), sign));
+}
+
+HALF_WIDTH_ALIAS_F1 (j1)
+
+TEST_SIG (V, F, 1, j1, -10.0, 10.0)
+TEST_ULP (V_NAME_F1 (j1), 5.29)
+/* Errors are only bounded away from the zeros of J1, test in between.  */
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 0, 3.76, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 3.9, 6.95, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 7.08, 10.11, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 4094.35, 4097.35, 10000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 524288.68, 524291.69, 1000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), 2097152.18, 2097155.18, 1000)
+TEST_SYM_INTERVAL (V_NAME_F1 (j1), inf, inf, 1)
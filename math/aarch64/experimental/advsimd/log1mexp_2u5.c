@@ -0,0 +1,51 @@
+/*
+ * Double-precision vector log1mexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexp_common.h"
+
+static const struct v_logexp_data data = V_LOGEXP_DATA;
+
+static double
+log1mexp_scalar (double x)
+{
+  if (x > -0x1.62e42fefa39efp-1)
+    return log (-expm1 (x));
+  return log1p (-exp (x));
+}
+
+static float64x2_t NOINLINE
+special_case (float64x2_t x, float64x2_t y, uint64x2_t cmp)
+{
+  return v_call_f64 (log1mexp_scalar, x, y, cmp);
+}
+
+/* log(1 - e^x) for x <= 0, see v_logexp_common.h.  The result is NaN for
+   x > 0 and -inf for x = 0.  Maximum observed error is 2.49 ULP:
+   _ZGVnN2v_log1mexp(-0x1.e58616a19999ap-1) got -0x1.f5cf53fca95a4p-2
+					   want -0x1.f5cf53fca95a6p-2.  */
+float64x2_t VPCS_ATTR NOINLINE V_NAME_D1 (log1mexp) (float64x2_t x)
+{
+  const struct v_logexp_data *d = ptr_barrier (&data);
+  /* x close to 0 or positive needs log(0) or a subnormal -expm1.  */
+  uint64x2_t special = vorrq_u64 (v_logexp_special (v_f64 (0), x, d),
+				  vcgeq_f64 (x, v_f64 (-0x1p-1022)));
+  float64x2_t ret = v_log1pmexp_inline (x, v_f64 (0), 1, d);
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (V, D, 1, log1mexp, -10.0, -0.01)
+TEST_ULP (V_NAME_D1 (log1mexp), 1.99)
+TEST_INTERVAL (V_NAME_D1 (log1mexp), -0.0, -0x1p-20, 10000)
+TEST_INTERVAL (V_NAME_D1 (log1mexp), -0x1p-20, -0.7, 100000)
+TEST_INTERVAL (V_NAME_D1 (log1mexp), -0.7, -10, 100000)
+TEST_INTERVAL (V_NAME_D1 (log1mexp), -10, -inf, 10000)
+TEST_INTERVAL (V_NAME_D1 (log1mexp), 0, inf, 1000)
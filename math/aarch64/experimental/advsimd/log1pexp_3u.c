@@ -0,0 +1,50 @@
+/*
+ * Double-precision vector log1pexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexp_common.h"
+
+static const struct v_logexp_data data = V_LOGEXP_DATA;
+
+static double
+log1pexp_scalar (double x)
+{
+  if (x > 0)
+    return x + log1p (exp (-x));
+  return log1p (exp (x));
+}
+
+static float64x2_t NOINLINE
+special_case (float64x2_t x, float64x2_t y, uint64x2_t cmp)
+{
+  return v_call_f64 (log1pexp_scalar, x, y, cmp);
+}
+
+/* log(1 + e^x) = max(x, 0) + log1p(e^-|x|), see v_logexp_common.h.
+   Maximum observed error is 2.76 ULP:
+   _ZGVnN2v_log1pexp(-0x1.5eff2242p+1) got 0x1.ff82e424ac0adp-5
+				      want 0x1.ff82e424ac0bp-5.  */
+float64x2_t VPCS_ATTR NOINLINE V_NAME_D1 (log1pexp) (float64x2_t x)
+{
+  const struct v_logexp_data *d = ptr_barrier (&data);
+  float64x2_t m = vmaxq_f64 (x, v_f64 (0));
+  float64x2_t t = vnegq_f64 (vabsq_f64 (x));
+  uint64x2_t special = v_logexp_special (m, t, d);
+  float64x2_t ret = vaddq_f64 (m, v_log1pmexp_inline (t, v_f64 (0), 0, d));
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (V, D, 1, log1pexp, -10.0, 10.0)
+TEST_ULP (V_NAME_D1 (log1pexp), 2.26)
+TEST_INTERVAL (V_NAME_D1 (log1pexp), 0, 10, 100000)
+TEST_INTERVAL (V_NAME_D1 (log1pexp), 10, inf, 10000)
+TEST_INTERVAL (V_NAME_D1 (log1pexp), -0.0, -10, 100000)
+TEST_INTERVAL (V_NAME_D1 (log1pexp), -10, -inf, 10000)
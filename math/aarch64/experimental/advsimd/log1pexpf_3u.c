@@ -0,0 +1,52 @@
+/*
+ * Single-precision vector log1pexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexpf_common.h"
+
+static const struct v_logexpf_data data = V_LOGEXPF_DATA;
+
+static float
+log1pexpf_scalar (float x)
+{
+  if (x > 0)
+    return x + log1pf (expf (-x));
+  return log1pf (expf (x));
+}
+
+static float32x4_t NOINLINE
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp)
+{
+  return v_call_f32 (log1pexpf_scalar, x, y, cmp);
+}
+
+/* log(1 + e^x) = max(x, 0) + log1p(e^-|x|), see v_logexpf_common.h.
+   Maximum observed error is 2.89 ULP:
+   _ZGVnN4v_log1pexpf(-0x1.04da42p+1) got 0x1.f5b176p-4
+				     want 0x1.f5b17p-4.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (log1pexp) (float32x4_t x)
+{
+  const struct v_logexpf_data *d = ptr_barrier (&data);
+  float32x4_t m = vmaxq_f32 (x, v_f32 (0));
+  float32x4_t t = vnegq_f32 (vabsq_f32 (x));
+  uint32x4_t special = v_logexpf_special (m, t, d);
+  float32x4_t ret = vaddq_f32 (m, v_log1pmexpf_inline (t, v_f32 (0), 0, d));
+  if (unlikely (v_any_u32 (special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+HALF_WIDTH_ALIAS_F1 (log1pexp)
+
+TEST_SIG (V, F, 1, log1pexp, -10.0, 10.0)
+TEST_ULP (V_NAME_F1 (log1pexp), 2.39)
+TEST_INTERVAL (V_NAME_F1 (log1pexp), 0, 10, 100000)
+TEST_INTERVAL (V_NAME_F1 (log1pexp), 10, inf, 10000)
+TEST_INTERVAL (V_NAME_F1 (log1pexp), -0.0, -10, 100000)
+TEST_INTERVAL (V_NAME_F1 (log1pexp), -10, -inf, 10000)
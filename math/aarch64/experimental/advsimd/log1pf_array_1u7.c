@@ -0,0 +1,43 @@
+/*
+ * Single-precision AdvSIMD log(1 + x) over arrays.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "arm_math_inline.h"
+#include "test_defs.h"
+#include "v_array_special.h"
+
+static inline uint32x4_t
+special (float32x4_t x)
+{
+  /* x <= -1, -nan, inf or nan.  Signed comparison so that -1 < x < 0 is not
+     flagged.  -0 is flagged too, as the core returns +0 for it.  */
+  uint32x4_t is_infnan
+      = vcgeq_s32 (vreinterpretq_s32_f32 (x), v_s32 (0x7f800000));
+  uint32x4_t is_mzero
+      = vceqq_u32 (vreinterpretq_u32_f32 (x), v_u32 (0x80000000));
+  return vorrq_u32 (vornq_u32 (is_infnan, vcgtq_f32 (x, v_f32 (-1.0f))),
+		    is_mzero);
+}
+
+/* y[i] = log1p (x[i]) for 0 <= i < n.
+   Special lanes are recomputed by the scalar log1pf in a deferred pass over
+   each block, see v_array_special.h.  Same accuracy as _ZGVnN4v_log1pf in the
+   fast path: maximum error is 1.20 + 0.5 ULP.  */
+V_ARRAY_F32 (arm_math_advsimd_log1pf_array, arm_math_v_log1pf_inline, special,
+	     log1pf, &arm_math_v_log1pf_data)
+
+TEST_ULP (arm_math_advsimd_log1pf_array, 1.20)
+TEST_SYM_INTERVAL (arm_math_advsimd_log1pf_array, 0.0, 0x1p-23, 30000)
+TEST_SYM_INTERVAL (arm_math_advsimd_log1pf_array, 0x1p-23, 1, 50000)
+TEST_INTERVAL (arm_math_advsimd_log1pf_array, 1, inf, 50000)
+TEST_INTERVAL (arm_math_advsimd_log1pf_array, -1.0, -inf, 1000)
+/* In place, including special lanes.  */
+TEST_ULP (arm_math_advsimd_log1pf_array_inplace, 1.20)
+TEST_SYM_INTERVAL (arm_math_advsimd_log1pf_array_inplace, 0.0, 1, 10000)
+TEST_INTERVAL (arm_math_advsimd_log1pf_array_inplace, 1, inf, 10000)
+TEST_INTERVAL (arm_math_advsimd_log1pf_array_inplace, -1.0, -inf, 1000)
@@ -0,0 +1,57 @@
+/*
+ * Double-precision vector log(x) function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "test_defs.h"
+#include "v_pow_inline.h"
+
+#define Min v_u64 (0x0010000000000000)
+#define Thres v_u64 (0x7fe0000000000000) /* asuint64(inf) - Min.  */
+
+static float64x2x2_t VPCS_ATTR NOINLINE
+scalar_fallback (float64x2_t x, float64x2x2_t y, uint64x2_t cmp)
+{
+  double t[2];
+  for (int i = 0; i < 2; i++)
+    if (cmp[i])
+      {
+	y.val[0][i] = arm_math_log_dd (x[i], &t[i]);
+	y.val[1][i] = t[i];
+      }
+  return y;
+}
+
+/* Vector log returning hi in val[0] and the tail in val[1], see
+   arm_math_log_dd.  The core is the log of AdvSIMD pow.  Lanes with x
+   subnormal, negative, 0, inf or nan use the scalar routine.
+   Maximum relative error of hi + tail is 2^-67.6:
+   arm_math_advsimd_log_dd (0x1.fd5b7db73e213p-1)
+     got -0x1.5321620809d21p-8 + 0x1.c788p-64
+    want -0x1.5321620809d21p-8 + 0x1.c7a2c128116efp-64.
+   Maximum error of hi alone is 0.501 ULP.  */
+float64x2x2_t VPCS_ATTR
+arm_math_advsimd_log_dd (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t special = vcgeq_u64 (vsubq_u64 (ix, Min), Thres);
+
+  float64x2x2_t y;
+  y.val[0] = v_log_inline (ix, &y.val[1], d);
+  if (unlikely (v_any_u64 (special)))
+    return scalar_fallback (x, y, special);
+  return y;
+}
+
+TEST_ULP (arm_math_advsimd_log_dd, 0.02)
+TEST_INTERVAL (arm_math_advsimd_log_dd, -0.0, -inf, 1000)
+TEST_INTERVAL (arm_math_advsimd_log_dd, 0, 0x1p-149, 1000)
+TEST_INTERVAL (arm_math_advsimd_log_dd, 0x1p-149, 0x1p-1022, 1000)
+TEST_INTERVAL (arm_math_advsimd_log_dd, 0x1p-1022, 1, 100000)
+TEST_INTERVAL (arm_math_advsimd_log_dd, 1, 100, 100000)
+TEST_INTERVAL (arm_math_advsimd_log_dd, 100, inf, 1000)
@@ -0,0 +1,64 @@
+/*
+ * Single-precision vector logaddexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexpf_common.h"
+
+static const struct v_logexpf_data data = V_LOGEXPF_DATA;
+
+static float
+logaddexpf_scalar (float x, float y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  float m = x > y ? x : y;
+  if (isinf (m))
+    return m;
+  return m + log1pf (expf ((x > y ? y : x) - m));
+}
+
+static float32x4_t NOINLINE
+special_case (float32x4_t x, float32x4_t y, float32x4_t ret, uint32x4_t cmp)
+{
+  return v_call2_f32 (logaddexpf_scalar, x, y, ret, cmp);
+}
+
+/* log(e^x + e^y) = m + log1p(e^(n - m)), m = max(x, y) and n = min(x, y),
+   see v_logexpf_common.h.  The relative error is unbounded around the
+   curve e^x + e^y = 1, where the result is 0 and m cancels with the log1p
+   term in [0, ln2].  The absolute error there is below 0x1p-23, away from
+   it the maximum observed error is 2.56 ULP:
+   _ZGVnN4vv_logaddexpf(-0x1.5b93f6p+0, 0x1.276f68p-7) got 0x1.e388b2p-3
+						       want 0x1.e388b8p-3.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F2 (logaddexp) (float32x4_t x,
+						       float32x4_t y)
+{
+  const struct v_logexpf_data *d = ptr_barrier (&data);
+  float32x4_t m = vmaxq_f32 (x, y);
+  float32x4_t tl, t = v_logexpf_diff (vminq_f32 (x, y), m, &tl);
+  uint32x4_t special = v_logexpf_special (m, t, d);
+  float32x4_t ret = vaddq_f32 (m, v_log1pmexpf_inline (t, tl, 0, d));
+  if (unlikely (v_any_u32 (special)))
+    return special_case (x, y, ret, special);
+  return ret;
+}
+
+HALF_WIDTH_ALIAS_F2 (logaddexp)
+
+TEST_SIG (V, F, 2, logaddexp, -10.0, 10.0)
+TEST_ULP (V_NAME_F2 (logaddexp), 2.06)
+/* Errors are only bounded away from e^x + e^y = 1, test where
+   max(x, y) >= 0 or where both are below -1.2.  */
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), 0, 10, 0, 10, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), 0, 10, -0.0, -10, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), -0.0, -10, 0, 10, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), -1.2, -100, -1.2, -100, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), 10, inf, -0.0, -inf, 1000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), -0.0, -inf, 10, inf, 1000)
+TEST_INTERVAL2 (V_NAME_F2 (logaddexp), -100, -inf, -100, -inf, 1000)
@@ -0,0 +1,62 @@
+/*
+ * Double-precision vector logsubexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexp_common.h"
+
+static const struct v_logexp_data data = V_LOGEXP_DATA;
+
+static double
+logsubexp_scalar (double x, double y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  if (y == -INFINITY)
+    return x;
+  double t = y - x;
+  if (t > -0x1.62e42fefa39efp-1)
+    return x + log (-expm1 (t));
+  return x + log1p (-exp (t));
+}
+
+static float64x2_t NOINLINE
+special_case (float64x2_t x, float64x2_t y, float64x2_t ret, uint64x2_t cmp)
+{
+  return v_call2_f64 (logsubexp_scalar, x, y, ret, cmp);
+}
+
+/* log(e^x - e^y) = x + log(1 - e^(y - x)) for y <= x, see
+   v_logexp_common.h.  The result is NaN for y > x and -inf for y = x.  The
+   relative error is unbounded around the curve e^x - e^y = 1, where the
+   result is 0 and x cancels with the log term.  The absolute error there
+   is a few ULP of x, away from it the maximum observed error is 2.23 ULP:
+   _ZGVnN2vv_logsubexp(-0x1.979b7fp-5, -0x1.168e7accp+0)
+     got -0x1.f273a65925a9p-2 want -0x1.f273a65925a92p-2.  */
+float64x2_t VPCS_ATTR NOINLINE V_NAME_D2 (logsubexp) (float64x2_t x,
+						       float64x2_t y)
+{
+  const struct v_logexp_data *d = ptr_barrier (&data);
+  float64x2_t tl, t = v_logexp_diff (y, x, &tl);
+  /* y - x close to 0 or positive needs log(0) or a subnormal -expm1.  */
+  uint64x2_t special = vorrq_u64 (v_logexp_special (x, t, d),
+				  vcgeq_f64 (t, v_f64 (-0x1p-1022)));
+  float64x2_t ret = vaddq_f64 (x, v_log1pmexp_inline (t, tl, 1, d));
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, y, ret, special);
+  return ret;
+}
+
+TEST_SIG (V, D, 2, logsubexp, -10.0, 0.0)
+TEST_ULP (V_NAME_D2 (logsubexp), 1.73)
+/* Errors are only bounded away from e^x - e^y = 1, test where
+   x <= 0, or x >= 1 and y <= 0.  */
+TEST_INTERVAL2 (V_NAME_D2 (logsubexp), -0.0, -10, -0.0, -20, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (logsubexp), 1, 20, -0.0, -20, 10000)
+TEST_INTERVAL2 (V_NAME_D2 (logsubexp), -10, -inf, -10, -inf, 1000)
+TEST_INTERVAL2 (V_NAME_D2 (logsubexp), 20, inf, -0.0, -inf, 1000)
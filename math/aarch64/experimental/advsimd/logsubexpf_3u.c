@@ -0,0 +1,64 @@
+/*
+ * Single-precision vector logsubexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_logexpf_common.h"
+
+static const struct v_logexpf_data data = V_LOGEXPF_DATA;
+
+static float
+logsubexpf_scalar (float x, float y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  if (y == -INFINITY)
+    return x;
+  float t = y - x;
+  if (t > -0x1.62e43p-1f)
+    return x + logf (-expm1f (t));
+  return x + log1pf (-expf (t));
+}
+
+static float32x4_t NOINLINE
+special_case (float32x4_t x, float32x4_t y, float32x4_t ret, uint32x4_t cmp)
+{
+  return v_call2_f32 (logsubexpf_scalar, x, y, ret, cmp);
+}
+
+/* log(e^x - e^y) = x + log(1 - e^(y - x)) for y <= x, see
+   v_logexpf_common.h.  The result is NaN for y > x and -inf for y = x.  The
+   relative error is unbounded around the curve e^x - e^y = 1, where the
+   result is 0 and x cancels with the log term.  The absolute error there
+   is a few ULP of x, away from it the maximum observed error is 2.89 ULP:
+   _ZGVnN4vv_logsubexpf(-0x1.06f3fap-5, -0x1.0f2066p+0) got -0x1.e6ce24p-2
+						      want -0x1.e6ce1ep-2.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F2 (logsubexp) (float32x4_t x,
+						       float32x4_t y)
+{
+  const struct v_logexpf_data *d = ptr_barrier (&data);
+  float32x4_t tl, t = v_logexpf_diff (y, x, &tl);
+  /* y - x close to 0 or positive needs log(0) or a subnormal -expm1.  */
+  uint32x4_t special = vorrq_u32 (v_logexpf_special (x, t, d),
+				  vcgeq_f32 (t, v_f32 (-0x1p-126f)));
+  float32x4_t ret = vaddq_f32 (x, v_log1pmexpf_inline (t, tl, 1, d));
+  if (unlikely (v_any_u32 (special)))
+    return special_case (x, y, ret, special);
+  return ret;
+}
+
+HALF_WIDTH_ALIAS_F2 (logsubexp)
+
+TEST_SIG (V, F, 2, logsubexp, -10.0, 0.0)
+TEST_ULP (V_NAME_F2 (logsubexp), 2.39)
+/* Errors are only bounded away from e^x - e^y = 1, test where
+   x <= 0, or x >= 1 and y <= 0.  */
+TEST_INTERVAL2 (V_NAME_F2 (logsubexp), -0.0, -10, -0.0, -20, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logsubexp), 1, 20, -0.0, -20, 10000)
+TEST_INTERVAL2 (V_NAME_F2 (logsubexp), -10, -inf, -10, -inf, 1000)
+TEST_INTERVAL2 (V_NAME_F2 (logsubexp), 20, inf, -0.0, -inf, 1000)
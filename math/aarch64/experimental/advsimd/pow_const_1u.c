@@ -0,0 +1,139 @@
+/*
+ * Double-precision AdvSIMD x^y over arrays with a fixed exponent or base.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+#include "v_pow_inline.h"
+
+static inline float64x2_t
+pow_const_exp (float64x2_t x, float64x2_t y, const struct data *d)
+{
+  /* x <= 0, inf or nan are computed by scalar pow.  */
+  uint64x2_t vix = vreinterpretq_u64_f64 (x);
+  uint64x2_t special
+      = vorrq_u64 (vclezq_s64 (vreinterpretq_s64_f64 (x)),
+		   vcgeq_u64 (vandq_u64 (vix, d->inf), d->inf));
+  float64x2_t a = vbslq_f64 (special, v_f64 (2.0), x);
+
+  /* Cases of subnormal x: |x| < 0x1p-1022.  */
+  uint64x2_t x_is_subnormal = vcaltq_f64 (a, d->subnormal_bound);
+  if (unlikely (v_any_u64 (x_is_subnormal)))
+    {
+      /* Normalize subnormal x so exponent becomes negative.  */
+      uint64x2_t vix_norm
+	  = vreinterpretq_u64_f64 (vmulq_f64 (a, d->subnormal_scale));
+      vix_norm = vsubq_u64 (vix_norm, d->subnormal_bias);
+      a = vbslq_f64 (x_is_subnormal, vreinterpretq_f64_u64 (vix_norm), a);
+    }
+
+  float64x2_t ret = v_pow_inline (a, y, d);
+  if (unlikely (v_any_u64 (special)))
+    return v_call2_f64 (pow, x, y, ret, special);
+  return ret;
+}
+
+/* out[i] = pow (x[i], y) for 0 <= i < n.
+   y is checked once rather than once per vector, and lanes with x <= 0, inf
+   or nan are computed by the scalar pow individually instead of sending the
+   whole vector to the scalar fallback as in _ZGVnN2vv_pow. Accuracy is the
+   same as _ZGVnN2vv_pow, maximum measured error is 1.04 ULP.  */
+void
+arm_math_advsimd_pow_const_exp (const double *x, double y, double *out,
+				size_t n)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  /* y is 0, inf or nan: result does not depend on the core computation.  */
+  if (unlikely (zeroinfnan (asuint64 (y))))
+    {
+      for (size_t i = 0; i < n; i++)
+	out[i] = pow (x[i], y);
+      return;
+    }
+
+  float64x2_t vy = vdupq_n_f64 (y);
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    vst1q_f64 (out + i, pow_const_exp (vld1q_f64 (x + i), vy, d));
+  if (i < n)
+    out[i] = vgetq_lane_f64 (
+	pow_const_exp ((float64x2_t){ x[i], 2.0 }, vy, d), 0);
+}
+
+static inline float64x2_t
+pow_const_base (float64x2_t b, float64x2_t x, float64x2_t loghi,
+		float64x2_t loglo, const struct data *d)
+{
+  /* Infinite or nan x are computed by scalar pow.  */
+  uint64x2_t special = vcgeq_u64 (
+      vandq_u64 (vreinterpretq_u64_f64 (x), d->inf), d->inf);
+
+  /* Vector Exp(x_loghi, x_loglo), see v_pow_inline.  */
+  float64x2_t vehi = vmulq_f64 (x, loghi);
+  float64x2_t vemi = vfmsq_f64 (vehi, x, loghi);
+  float64x2_t neg_velo = vfmsq_f64 (vemi, x, loglo);
+  float64x2_t ret = v_exp_inline (vehi, neg_velo, d);
+
+  if (unlikely (v_any_u64 (special)))
+    return v_call2_f64 (pow, b, x, ret, special);
+  return ret;
+}
+
+/* out[i] = pow (b, x[i]) for 0 <= i < n.
+   log(b) is computed once, so only exp is evaluated per element. Special
+   values of b (b <= 0, subnormal, 1, inf or nan) fall back to _ZGVnN2vv_pow.
+   Accuracy is the same as _ZGVnN2vv_pow.  */
+void
+arm_math_advsimd_pow_const_base (double b, const double *x, double *out,
+				 size_t n)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint64_t ib = asuint64 (b);
+  float64x2_t vb = vdupq_n_f64 (b);
+
+  size_t i = 0;
+  if (unlikely (ib - 0x0010000000000000 >= 0x7fe0000000000000
+		|| ib == asuint64 (1.0)))
+    {
+      for (; i + 2 <= n; i += 2)
+	vst1q_f64 (out + i, _ZGVnN2vv_pow (vb, vld1q_f64 (x + i)));
+      if (i < n)
+	out[i] = pow (b, x[i]);
+      return;
+    }
+
+  float64x2_t loglo;
+  float64x2_t loghi = v_log_inline (vdupq_n_u64 (ib), &loglo, d);
+  for (; i + 2 <= n; i += 2)
+    vst1q_f64 (out + i,
+	       pow_const_base (vb, vld1q_f64 (x + i), loghi, loglo, d));
+  if (i < n)
+    out[i] = vgetq_lane_f64 (
+	pow_const_base (vb, vdupq_n_f64 (x[i]), loghi, loglo, d), 0);
+}
+
+TEST_ULP (arm_math_advsimd_pow_const_exp, 0.55)
+TEST_ULP (arm_math_advsimd_pow_const_base, 0.55)
+#define POW_CONST_INTERVAL2(xlo, xhi, ylo, yhi, n)                            \
+  TEST_INTERVAL2 (arm_math_advsimd_pow_const_exp, xlo, xhi, ylo, yhi, n)      \
+  TEST_INTERVAL2 (arm_math_advsimd_pow_const_base, xlo, xhi, ylo, yhi, n)
+POW_CONST_INTERVAL2 (0, 0x1p-1022, 0, inf, 40000)
+POW_CONST_INTERVAL2 (0x1p-1022, 1, 0, inf, 40000)
+POW_CONST_INTERVAL2 (1, inf, 0, inf, 40000)
+POW_CONST_INTERVAL2 (0, inf, -0, -inf, 40000)
+POW_CONST_INTERVAL2 (0x1p-1, 0x1p1, -0x1p10, 0x1p10, 10000)
+POW_CONST_INTERVAL2 (0x1p-500, 0x1p500, 0x1p-1, 0x1p1, 10000)
+POW_CONST_INTERVAL2 (0x1.ep-1, 0x1.1p0, 0x1p8, 0x1p16, 10000)
+POW_CONST_INTERVAL2 (0.01, 11.1, -10.0, 10.0, 10000)
+/* Negative or special x.  */
+POW_CONST_INTERVAL2 (-0.0, -10.0, 0.0, 10.0, 10000)
+POW_CONST_INTERVAL2 (-0.0, -10.0, 3.0, 3.0, 1000)
+POW_CONST_INTERVAL2 (inf, inf, -10.0, 10.0, 1000)
+POW_CONST_INTERVAL2 (nan, nan, -10.0, 10.0, 1000)
+POW_CONST_INTERVAL2 (0.01, 11.1, inf, inf, 1000)
+POW_CONST_INTERVAL2 (0.01, 11.1, nan, nan, 1000)
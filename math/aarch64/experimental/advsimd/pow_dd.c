@@ -0,0 +1,75 @@
+/*
+ * Double-precision vector x^y function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "test_defs.h"
+#include "v_pow_inline.h"
+#include "v_exp_dd_inline.h"
+
+#define MinX v_u64 (0x0010000000000000)
+#define ThresX v_u64 (0x7fe0000000000000) /* asuint64(inf) - MinX.  */
+#define BigY v_f64 (0x1p63)
+
+static float64x2x2_t VPCS_ATTR NOINLINE
+scalar_fallback (float64x2_t x, float64x2_t y, float64x2x2_t r, uint64x2_t cmp)
+{
+  double t[2];
+  for (int i = 0; i < 2; i++)
+    if (cmp[i])
+      {
+	r.val[0][i] = arm_math_pow_dd (x[i], y[i], &t[i]);
+	r.val[1][i] = t[i];
+      }
+  return r;
+}
+
+/* Vector x^y returning hi in val[0] and the tail in val[1], see
+   arm_math_pow_dd.  The log is that of AdvSIMD pow, the exp that of
+   arm_math_advsimd_exp_dd.  Lanes with x subnormal, negative, 0, inf or
+   nan, with |y| >= 2^63 or nan, or where |y log(x)| < 0x1p-54 or >= 512 use
+   the scalar routine.
+   Maximum measured relative error of hi + tail is 2^-58.6, for large
+   |y log(x)|, within the bound of arm_math_pow_dd:
+   arm_math_advsimd_pow_dd (0x1.fd641505bea46p-1, -0x1.e9f683870aa69p+16)
+     got 0x1.663f7177c9e84p+924 + 0x1.01115p+869
+    want 0x1.663f7177c9e84p+924 + 0x1.c85975603db9cp+868.
+   Maximum error of hi alone is 0.502 ULP.  */
+float64x2x2_t VPCS_ATTR
+arm_math_advsimd_pow_dd (float64x2_t x, float64x2_t y)
+{
+  const struct data *d = ptr_barrier (&data);
+  const struct v_exp_dd_data *de = ptr_barrier (&v_exp_dd_data);
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t special = vcgeq_u64 (vsubq_u64 (ix, MinX), ThresX);
+  special = vorrq_u64 (special, vceqzq_u64 (vcaltq_f64 (y, BigY)));
+
+  /* y log(x) = ehi + elo.  */
+  float64x2_t lo;
+  float64x2_t hi = v_log_inline (ix, &lo, d);
+  float64x2_t ehi = vmulq_f64 (y, hi);
+  float64x2_t elo = vfmaq_f64 (vfmaq_f64 (vnegq_f64 (ehi), y, hi), y, lo);
+  special = vorrq_u64 (special, v_exp_dd_special (ehi, de));
+
+  float64x2x2_t r;
+  r.val[0] = v_exp_dd_inline (ehi, elo, &r.val[1], de);
+  if (unlikely (v_any_u64 (special)))
+    return scalar_fallback (x, y, r, special);
+  return r;
+}
+
+TEST_ULP (arm_math_advsimd_pow_dd, 0.02)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, 0, inf, 0, inf, 10000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, -0.0, -inf, -0.0, -inf, 10000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, 0x1p-1, 0x1p1, 0x1p-10, 0x1p10, 40000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, 0x1p-1, 0x1p1, -0x1p-10, -0x1p10,
+		40000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, 0x1p-500, 0x1p500, 0x1p-1, 0x1p1,
+		40000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, 0x1.ep-1, 0x1.1p0, 0x1p8, 0x1p16,
+		40000)
+TEST_INTERVAL2 (arm_math_advsimd_pow_dd, -0x1p-1, -0x1p1, 1, 10, 10000)
@@ -0,0 +1,171 @@
+/*
+ * Single-precision AdvSIMD x^y over arrays with a fixed exponent or base.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+#include "v_powf_inline.h"
+
+/* Properties of the fixed exponent, computed once per call.  */
+struct const_exp
+{
+  float32x4_t y;
+  /* SignBias if y is an odd integer, 0 otherwise.  */
+  uint32x4_t sign_bias;
+  /* All ones if y is not an integer (pow of negative x is nan).  */
+  uint32x4_t not_int;
+};
+
+static inline float32x4_t
+powf_const_exp (float32x4_t x, const struct const_exp *c, const struct data *d)
+{
+  uint32x4_t special = v_zeroinfnan (d, vreinterpretq_u32_f32 (x));
+
+  float32x4_t ret;
+  uint32x4_t x_is_neg_or_sub = vcltq_f32 (x, v_f32 (0x1p-126f));
+  if (unlikely (v_any_u32 (x_is_neg_or_sub)))
+    {
+      uint32x4_t xisneg = vcltzq_f32 (x);
+      uint32x4_t xsmall = vcaltq_f32 (x, v_f32 (0x1p-126f));
+
+      /* Normalize subnormals.  */
+      float32x4_t a = vabsq_f32 (x);
+      uint32x4_t ia_norm = vreinterpretq_u32_f32 (vmulq_f32 (a, d->norm));
+      ia_norm = vsubq_u32 (ia_norm, d->subnormal_bias);
+      a = vbslq_f32 (xsmall, vreinterpretq_f32_u32 (ia_norm), a);
+
+      ret = v_powf_core (a, c->y, vandq_u32 (xisneg, c->sign_bias), d);
+      ret = vbslq_f32 (vandq_u32 (xisneg, c->not_int), d->nan, ret);
+    }
+  else
+    ret = v_powrf_core (x, c->y, d);
+
+  if (unlikely (v_any_u32 (special)))
+    return v_call2_f32 (powf, x, c->y, ret, special);
+  return ret;
+}
+
+/* out[i] = pow (x[i], y) for 0 <= i < n.
+   Classification of y (zero, inf, nan, integer and parity) is done once
+   instead of once per vector as in _ZGVnN4vv_powf. Accuracy is the same as
+   _ZGVnN4vv_powf, maximum measured error is 2.57 ULP.  */
+void
+arm_math_advsimd_powf_const_exp (const float *x, float y, float *out,
+				 size_t n)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32_t iy = asuint (y);
+
+  /* y is 0, inf or nan: result does not depend on the core computation.  */
+  if (unlikely (zeroinfnan (iy)))
+    {
+      for (size_t i = 0; i < n; i++)
+	out[i] = powf (x[i], y);
+      return;
+    }
+
+  int yint = checkint (iy);
+  struct const_exp c = {
+    .y = vdupq_n_f32 (y),
+    .sign_bias = vdupq_n_u32 (yint == 1 ? SignBias : 0),
+    .not_int = vdupq_n_u32 (yint == 0 ? -1 : 0),
+  };
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    vst1q_f32 (out + i, powf_const_exp (vld1q_f32 (x + i), &c, d));
+  if (i < n)
+    {
+      /* Pad the tail with 1.0, which is not a special case.  */
+      float tmp[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+      for (size_t j = 0; i + j < n; j++)
+	tmp[j] = x[i + j];
+      vst1q_f32 (tmp, powf_const_exp (vld1q_f32 (tmp), &c, d));
+      for (size_t j = 0; i + j < n; j++)
+	out[i + j] = tmp[j];
+    }
+}
+
+static inline float32x4_t
+powf_const_base (float32x4_t x, float64x2_t log2b, const struct data *d)
+{
+  /* ylogx = x * log2(b) * N, exact apart from the rounding of log2(b).  */
+  float64x2_t ylogx_lo = vmulq_f64 (vcvt_f64_f32 (vget_low_f32 (x)), log2b);
+  float64x2_t ylogx_hi = vmulq_f64 (vcvt_high_f64_f32 (x), log2b);
+  float32x4_t ret = vcombine_f32 (vcvt_f32_f64 (exp2_core (d, ylogx_lo)),
+				  vcvt_f32_f64 (exp2_core (d, ylogx_hi)));
+
+  /* Handle underflow and overflow. Infinite x is handled here, nan x
+     propagates through the core.  */
+  float32x4_t ylogx
+      = vcombine_f32 (vcvt_f32_f64 (ylogx_lo), vcvt_f32_f64 (ylogx_hi));
+  ret = vbslq_f32 (vcleq_f32 (ylogx, d->uflow_bound), v_f32 (0), ret);
+  ret = vbslq_f32 (vcgtq_f32 (ylogx, d->oflow_bound),
+		   vreinterpretq_f32_u32 (d->inf), ret);
+  return ret;
+}
+
+/* out[i] = pow (b, x[i]) for 0 <= i < n.
+   log2(b) is computed once in double precision, so only exp2 is evaluated per
+   element. Special values of b (b <= 0, subnormal, 1, inf or nan) fall back to
+   _ZGVnN4vv_powf.
+   Maximum measured error is 0.50 ULP:
+   arm_math_advsimd_powf_const_base(0x1.c1beep+30, -0x1.03a9d6p+2)
+     got 0x1.fa7c1p-126
+    want 0x1.fa7c12p-126.  */
+void
+arm_math_advsimd_powf_const_base (float b, const float *x, float *out,
+				  size_t n)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32_t ib = asuint (b);
+
+  size_t i = 0;
+  if (unlikely (ib - 0x00800000 >= 0x7f000000 || ib == 0x3f800000))
+    {
+      float32x4_t vb = vdupq_n_f32 (b);
+      for (; i + 4 <= n; i += 4)
+	vst1q_f32 (out + i, _ZGVnN4vv_powf (vb, vld1q_f32 (x + i)));
+      for (; i < n; i++)
+	out[i] = powf (b, x[i]);
+      return;
+    }
+
+  float64x2_t log2b = vdupq_n_f64 (log2 ((double) b) * Scale);
+  for (; i + 4 <= n; i += 4)
+    vst1q_f32 (out + i, powf_const_base (vld1q_f32 (x + i), log2b, d));
+  if (i < n)
+    {
+      float tmp[4] = { 0 };
+      for (size_t j = 0; i + j < n; j++)
+	tmp[j] = x[i + j];
+      vst1q_f32 (tmp, powf_const_base (vld1q_f32 (tmp), log2b, d));
+      for (size_t j = 0; i + j < n; j++)
+	out[i + j] = tmp[j];
+    }
+}
+
+TEST_ULP (arm_math_advsimd_powf_const_exp, 2.08)
+TEST_ULP (arm_math_advsimd_powf_const_base, 0.01)
+#define POWF_CONST_INTERVAL2(xlo, xhi, ylo, yhi, n)                           \
+  TEST_INTERVAL2 (arm_math_advsimd_powf_const_exp, xlo, xhi, ylo, yhi, n)     \
+  TEST_INTERVAL2 (arm_math_advsimd_powf_const_base, xlo, xhi, ylo, yhi, n)
+POWF_CONST_INTERVAL2 (0, 0x1p-126, 0, inf, 40000)
+POWF_CONST_INTERVAL2 (0x1p-126, 1, 0, inf, 50000)
+POWF_CONST_INTERVAL2 (1, inf, 0, inf, 50000)
+POWF_CONST_INTERVAL2 (0, inf, -0, -inf, 50000)
+POWF_CONST_INTERVAL2 (0x1p-1, 0x1p1, -0x1p7, 0x1p7, 50000)
+POWF_CONST_INTERVAL2 (0x1.ep-1, 0x1.1p0, 0x1p8, 0x1p14, 50000)
+POWF_CONST_INTERVAL2 (0.01, 11.1, -10.0, 10.0, 50000)
+/* Negative or special x.  */
+POWF_CONST_INTERVAL2 (-0.0, -10.0, 0.0, 10.0, 10000)
+POWF_CONST_INTERVAL2 (-0.0, -10.0, 3.0, 3.0, 1000)
+POWF_CONST_INTERVAL2 (-0.0, -10.0, 4.0, 4.0, 1000)
+POWF_CONST_INTERVAL2 (inf, inf, -10.0, 10.0, 1000)
+POWF_CONST_INTERVAL2 (nan, nan, -10.0, 10.0, 1000)
+POWF_CONST_INTERVAL2 (0.01, 11.1, inf, inf, 1000)
+POWF_CONST_INTERVAL2 (0.01, 11.1, nan, nan, 1000)
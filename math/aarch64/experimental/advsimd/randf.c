@@ -0,0 +1,137 @@
+/*
+ * Single-precision AdvSIMD uniform and normal random number generators.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "v_logf_inline.h"
+#include "v_sincosf_common.h"
+
+static const struct data
+{
+  struct v_logf_data log_consts;
+  uint32x4_t iota;
+  uint32_t m0, m1, w0, w1;
+  float inv_2p32, half_inv_2p32, pi_inv_2p23;
+} data = {
+  .log_consts = V_LOGF_CONSTANTS,
+  .iota = { 0, 1, 2, 3 },
+  /* Philox4x32 multipliers and Weyl key increments.  */
+  .m0 = 0xd2511f53,
+  .m1 = 0xcd9e8d57,
+  .w0 = 0x9e3779b9,
+  .w1 = 0xbb67ae85,
+  .inv_2p32 = 0x1p-32f,
+  .half_inv_2p32 = 0x1p-33f,
+  .pi_inv_2p23 = 0x1.921fb6p-22f,
+};
+
+/* High half of the 32x32-bit product of each lane of x with m.  */
+static inline uint32x4_t
+mulhi (uint32x4_t x, uint32_t m)
+{
+  uint64x2_t lo = vmull_n_u32 (vget_low_u32 (x), m);
+  uint64x2_t hi = vmull_high_n_u32 (x, m);
+  return vuzp2q_u32 (vreinterpretq_u32_u64 (lo), vreinterpretq_u32_u64 (hi));
+}
+
+/* Philox4x32-10 (Salmon et al., SC'11) applied to the 4 blocks counter,
+   counter + 1, ... counter + 3: lane i of the result holds the 4 random words
+   of block counter + i.  The 128-bit counter of a block is its 64-bit index
+   with 2 zero words, the 64-bit key is the seed.  */
+static inline uint32x4x4_t
+philox (uint64_t counter, uint64_t seed, const struct data *d)
+{
+  uint32x4_t base = vdupq_n_u32 ((uint32_t) counter);
+  uint32x4_t x0 = vaddq_u32 (base, d->iota);
+  /* Propagate the carry of the low word, the mask is -1 on overflow.  */
+  uint32x4_t x1
+      = vsubq_u32 (vdupq_n_u32 (counter >> 32), vcltq_u32 (x0, base));
+  uint32x4_t x2 = v_u32 (0), x3 = v_u32 (0);
+  uint32_t k0 = seed, k1 = seed >> 32;
+  for (int r = 0; r < 10; r++)
+    {
+      uint32x4_t hi0 = mulhi (x0, d->m0), lo0 = vmulq_n_u32 (x0, d->m0);
+      uint32x4_t hi1 = mulhi (x2, d->m1), lo1 = vmulq_n_u32 (x2, d->m1);
+      x0 = veorq_u32 (veorq_u32 (hi1, x1), vdupq_n_u32 (k0));
+      x2 = veorq_u32 (veorq_u32 (hi0, x3), vdupq_n_u32 (k1));
+      x1 = lo1;
+      x3 = lo0;
+      k0 += d->w0;
+      k1 += d->w1;
+    }
+  return (uint32x4x4_t){ { x0, x1, x2, x3 } };
+}
+
+/* Uniform deviates in [0, 1), from the top 24 bits of each word.  */
+static inline float32x4x4_t
+randu_block (uint64_t counter, uint64_t seed, const struct data *d)
+{
+  uint32x4x4_t w = philox (counter, seed, d);
+  float32x4x4_t u;
+  for (int j = 0; j < 4; j++)
+    u.val[j] = vcvtq_n_f32_u32 (vshrq_n_u32 (w.val[j], 8), 24);
+  return u;
+}
+
+/* Box-Muller transform of the word pair (a, b) into 2 normal deviates,
+   r cos(t) and r sin(t) with r = sqrt(-2 log(u)), u in [2^-33, 1], and
+   t in [-pi, pi).  The magnitude is at most 6.77.  */
+static inline void
+box_muller (uint32x4_t a, uint32x4_t b, float32x4_t *z0, float32x4_t *z1,
+	    const struct data *d)
+{
+  float32x4_t u = vfmaq_f32 (v_f32 (d->half_inv_2p32), vcvtq_f32_u32 (a),
+			     v_f32 (d->inv_2p32));
+  float32x4_t r = vsqrtq_f32 (
+      vmulq_f32 (v_f32 (-2.0f), v_logf_inline (u, &d->log_consts)));
+  float32x4_t t
+      = vmulq_f32 (vcvtq_f32_s32 (vshrq_n_s32 (vreinterpretq_s32_u32 (b), 8)),
+		   v_f32 (d->pi_inv_2p23));
+  float32x4x2_t sc = v_sincosf_inline (t, &v_sincosf_data);
+  *z0 = vmulq_f32 (r, sc.val[1]);
+  *z1 = vmulq_f32 (r, sc.val[0]);
+}
+
+static inline float32x4x4_t
+randn_block (uint64_t counter, uint64_t seed, const struct data *d)
+{
+  uint32x4x4_t w = philox (counter, seed, d);
+  float32x4x4_t z;
+  box_muller (w.val[0], w.val[1], &z.val[0], &z.val[1], d);
+  box_muller (w.val[2], w.val[3], &z.val[2], &z.val[3], d);
+  return z;
+}
+
+/* Fill out[0..n-1] with 4 consecutive blocks per iteration, the 4 deviates of
+   a block are stored contiguously.  A partial last block still consumes a
+   whole counter value.  */
+#define RAND_F32(name, block)                                                 \
+  void name (struct arm_math_rng_state *s, float *out, size_t n)              \
+  {                                                                           \
+    const struct data *d = ptr_barrier (&data);                               \
+    uint64_t counter = s->counter;                                            \
+    size_t i = 0;                                                             \
+    for (; i + 16 <= n; i += 16, counter += 4)                                \
+      vst4q_f32 (out + i, block (counter, s->seed, d));                       \
+    if (i < n)                                                                \
+      {                                                                       \
+	float tmp[16];                                                        \
+	vst4q_f32 (tmp, block (counter, s->seed, d));                         \
+	for (size_t j = 0; i + j < n; j++)                                    \
+	  out[i + j] = tmp[j];                                                \
+	counter += (n - i + 3) / 4;                                           \
+      }                                                                       \
+    s->counter = counter;                                                     \
+  }
+
+/* Uniform deviates in [0, 1) with 24 random bits.  */
+RAND_F32 (arm_math_advsimd_randu_f32, randu_block)
+
+/* Standard normal deviates, by the Box-Muller transform of the uniform
+   words.  log and sincos are the inline cores of logf and sincosf, so the
+   deviates are within a few ULP of the exact transform of the same words.  */
+RAND_F32 (arm_math_advsimd_randn_f32, randn_block)
@@ -0,0 +1,81 @@
+/*
+ * Single-precision vector trigamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_polygammaf_common.h"
+
+static const struct data
+{
+  struct v_polygammaf_refl_data refl;
+  float32x4_t asym_poly[4];
+} data = {
+  .refl = V_POLYGAMMAF_REFL_DATA,
+  /* trigamma(u) = r + r^2/2 + r^3 Q(r^2), r = 1/u, u >= AsymBound.  */
+  .asym_poly = { V4 (0x1.555554p-3f), V4 (-0x1.110a66p-5f),
+		 V4 (0x1.81c0d4p-6f), V4 (-0x1.a92372p-6f) },
+};
+
+#define AsymBound 4.0f
+#define TinyBound 0x1p-14f
+
+/* For |x| < TinyBound, trigamma(x) rounds to 1/x^2.  */
+static float32x4_t NOINLINE VPCS_ATTR
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp)
+{
+  return vbslq_f32 (cmp, vdivq_f32 (v_f32 (1.0f), vmulq_f32 (x, x)), y);
+}
+
+/* Vector implementation of trigamma, the derivative of digamma.  t < 4 is
+   shifted up by n with the recurrence
+   trigamma(t) = sum_{k=0}^{n-1} 1/(t + k)^2 + trigamma(t + n), so that the
+   asymptotic expansion can be used at t + n.  x < 0 uses the reflection
+   formula, see v_polygammaf_common.h.  Poles at negative integers return
+   +inf.  The maximum observed error is 4.29 ULP:
+   _ZGVnN4v_trigammaf(-0x1.27be2ep-2) got 0x1.d813p+3
+				      want 0x1.d812f8p+3.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (trigamma) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32x4_t neg = vcltzq_f32 (x);
+  float32x4_t t = vbslq_f32 (neg, vsubq_f32 (v_f32 (1.0f), x), x);
+
+  /* n = floor(AsymBound - t) + 1 so that t + n >= AsymBound, 0 for larger t
+     and NaN.  */
+  float32x4_t n = vaddq_f32 (
+      vrndmq_f32 (vsubq_f32 (v_f32 (AsymBound), t)), v_f32 (1.0f));
+  n = vbslq_f32 (vcltq_f32 (t, v_f32 (AsymBound)), n, v_f32 (0));
+  float32x4x2_t s
+      = v_polygammaf_sum (v_f32 (0), v_f32 (1.0f), t, v_f32 (0), n, 1);
+
+  float32x4_t r = vdivq_f32 (v_f32 (1.0f), vaddq_f32 (t, n));
+  float32x4_t z = vmulq_f32 (r, r);
+  float32x4_t p
+      = vfmaq_f32 (v_f32 (0.5f), r, v_horner_3_f32 (z, d->asym_poly));
+  float32x4_t y
+      = vaddq_f32 (vdivq_f32 (s.val[0], s.val[1]), vfmaq_f32 (r, z, p));
+
+  /* Integer x < 0 give +inf, -inf gives NaN.  */
+  if (unlikely (v_any_u32 (neg)))
+    y = vbslq_f32 (neg, vsubq_f32 (v_polygammaf_pi2csc2 (x, &d->refl), y),
+		   y);
+
+  uint32x4_t cmp = vcaltq_f32 (x, v_f32 (TinyBound));
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+HALF_WIDTH_ALIAS_F1 (trigamma)
+
+TEST_SIG (V, F, 1, trigamma, 0.01, 10.0)
+TEST_ULP (V_NAME_F1 (trigamma), 3.79)
+TEST_SYM_INTERVAL (V_NAME_F1 (trigamma), 0, 0x1p-14, 1000)
+TEST_SYM_INTERVAL (V_NAME_F1 (trigamma), 0x1p-14, 1, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (trigamma), 1, 4, 100000)
+TEST_SYM_INTERVAL (V_NAME_F1 (trigamma), 4, inf, 100000)
@@ -0,0 +1,83 @@
+/*
+ * Deferred special-case handling for AdvSIMD array routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_ARRAY_SPECIAL_H
+#define MATH_V_ARRAY_SPECIAL_H
+
+#include "v_math.h"
+
+/* Array routines process their input in blocks of V_ARRAY_BLOCK elements.
+   The vector loop over a block is branch-free: it stores the fast-path result
+   for every lane, and records which lanes need special handling as one mask
+   byte per vector.  The inputs of vectors with a flagged lane are saved in a
+   compacted buffer, so that y may alias x.  Flagged lanes are then
+   recomputed by the scalar routine in a single pass over the masks, so the
+   cost of special cases is proportional to their number rather than to the
+   number of vectors that contain one.  */
+#define V_ARRAY_BLOCK 1024
+
+/* Bit i of the result is set if lane i of p is set.  */
+static inline uint32_t
+v_mask_bits_u32 (uint32x4_t p)
+{
+  const uint32x4_t bits = { 1, 2, 4, 8 };
+  return vaddvq_u32 (vandq_u32 (p, bits));
+}
+
+/* Recompute y[4 * i + l] = f (x) for every lane l flagged in mask[i], where
+   xs holds the inputs of the vectors with a flagged lane, in order.  */
+static inline void
+v_array_fixup_f32 (float (*f) (float), const float *xs, float *y,
+		   const uint8_t *mask, size_t nvec)
+{
+  for (size_t i = 0; i < nvec; i++)
+    if (mask[i] != 0)
+      {
+	for (uint32_t m = mask[i]; m != 0; m &= m - 1)
+	  {
+	    uint32_t l = __builtin_ctz (m);
+	    y[4 * i + l] = f (xs[l]);
+	  }
+	xs += 4;
+      }
+}
+
+/* Template for an array routine NAME computing y[i] = f (x[i]), where CORE
+   (x, d) is a branch-free vector core with constant data D, SPECIAL (x) is the
+   mask of lanes outside of the domain of CORE and SCALAR the scalar routine
+   used for those lanes and for the tail.  y may be equal to x, but must not
+   otherwise overlap it.  */
+#define V_ARRAY_F32(name, core, special, scalar, d)                          \
+  void name (const float *x, float *y, size_t n)                              \
+  {                                                                           \
+    uint8_t mask[V_ARRAY_BLOCK / 4];                                          \
+    float xs[V_ARRAY_BLOCK];                                                  \
+    size_t i = 0;                                                             \
+    while (i + 4 <= n)                                                        \
+      {                                                                       \
+	size_t nvec = (n - i) / 4;                                            \
+	if (nvec > V_ARRAY_BLOCK / 4)                                         \
+	  nvec = V_ARRAY_BLOCK / 4;                                           \
+	size_t nspecial = 0;                                                  \
+	for (size_t k = 0; k < nvec; k++)                                     \
+	  {                                                                   \
+	    float32x4_t vx = vld1q_f32 (x + i + 4 * k);                       \
+	    mask[k] = v_mask_bits_u32 (special (vx));                         \
+	    /* Overwritten unless a lane is flagged.  */                      \
+	    vst1q_f32 (xs + 4 * nspecial, vx);                                \
+	    nspecial += mask[k] != 0;                                         \
+	    vst1q_f32 (y + i + 4 * k, core (vx, d));                          \
+	  }                                                                   \
+	if (unlikely (nspecial != 0))                                         \
+	  v_array_fixup_f32 (scalar, xs, y + i, mask, nvec);                  \
+	i += 4 * nvec;                                                        \
+      }                                                                       \
+    for (; i < n; i++)                                                        \
+      y[i] = scalar (x[i]);                                                   \
+  }
+
+#endif
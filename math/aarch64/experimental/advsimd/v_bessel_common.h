@@ -0,0 +1,236 @@
+/*
+ * Helpers for double-precision vector Bessel functions of the first and second
+ * kind of order 0 and 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_BESSEL_COMMON_H
+#define MATH_V_BESSEL_COMMON_H
+
+#include "v_math.h"
+#include "v_poly_f64.h"
+#include "v_rsqrt_inline.h"
+#include "v_sincos_common.h"
+
+/* Bounds of the table-driven region.  */
+#define MidBound 2.0
+#define AsymBound 8.0
+
+/* For x >= AsymBound, Bessel functions of order nu = 0, 1 are written in
+   phase-amplitude form
+     J_nu(x) = M_nu(x) / sqrt(x) * cos(x - (2nu + 1)pi/4 + phi_nu(x)),
+     Y_nu(x) = M_nu(x) / sqrt(x) * sin(x - (2nu + 1)pi/4 + phi_nu(x)),
+   where M_nu(x) = m(v) and phi_nu(x) = h(v)/x are approximated by polynomials
+   in v = 128/x^2 - 1, in [-1, 1) in the asymptotic region.  The phase is
+   computed with a 3-part pi/2 reduction of x + phi into [-pi/4, pi/4], then
+   evaluated with the sincos core.  Coefficients were fitted in the Chebyshev
+   basis with mpmath, see tools/bessel.py.  */
+struct v_bessel_asym_data
+{
+  float64x2_t m[12], h[15];
+  double pio2_1, pio2_2, pio2_3, inv_pio2;
+  float64x2_t range_val;
+};
+
+#define V_BESSEL_ASYM_PIO2                                                    \
+  .pio2_1 = 0x1.921fb54442d18p+0, .pio2_2 = 0x1.1a62633145c06p-54,            \
+  .pio2_3 = 0x1.c1cd129024e09p-107, .inv_pio2 = 0x1.45f306dc9c883p-1,         \
+  .range_val = V2 (0x1p23)
+
+#define V_BESSEL_ASYM0_DATA                                                   \
+  {                                                                           \
+    .m = { V2 (0x1.9851e56f2953bp-1), V2 (-0x1.8e883c79ce76dp-12),            \
+	   V2 (0x1.2e71cc5894d6ap-18), V2 (-0x1.4c1305bb8efb7p-23),           \
+	   V2 (0x1.504f0fb9fc5efp-27), V2 (-0x1.00e966237750fp-30),           \
+	   V2 (0x1.085eb1b997cfbp-33), V2 (-0x1.54e4e753ffca1p-36),           \
+	   V2 (0x1.00493050ab342p-38), V2 (-0x1.c2731cce3c6ecp-41),           \
+	   V2 (0x1.325ba2a803493p-42), V2 (-0x1.5fb1a8960a4f5p-44) },         \
+    .h = { V2 (-0x1.fdf756b3b84fp-4), V2 (0x1.fca9766f0e5fap-12),             \
+	   V2 (-0x1.6c57b2bfdbb43p-17), V2 (0x1.1fbcc34a706d7p-21),           \
+	   V2 (-0x1.74c6ebc327436p-25), V2 (0x1.556c3e28ac817p-28),           \
+	   V2 (-0x1.945cab8278afep-31), V2 (0x1.23f10579ca93ap-33),           \
+	   V2 (-0x1.eda1306067bdfp-36), V2 (0x1.deede53efe30fp-38),           \
+	   V2 (-0x1.00b99715ac5d4p-39), V2 (0x1.fd8febf2479bcp-42),           \
+	   V2 (-0x1.37f34aef187c8p-43), V2 (0x1.c2a52066ff167p-44),           \
+	   V2 (-0x1.5005329418aeap-45) },                                     \
+    V_BESSEL_ASYM_PIO2                                                        \
+  }
+
+#define V_BESSEL_ASYM1_DATA                                                   \
+  {                                                                           \
+    .m = { V2 (0x1.991c527e7f063p-1), V2 (0x1.2dabbdc47f2a3p-10),             \
+	   V2 (-0x1.20f37ac00c488p-17), V2 (0x1.fbf50c2399d9cp-23),           \
+	   V2 (-0x1.cca807b7171f9p-27), V2 (0x1.4b0ebe68b203p-30),            \
+	   V2 (-0x1.47fc1d9454126p-33), V2 (0x1.9c2fff2e41622p-36),           \
+	   V2 (-0x1.309e237d3e0eep-38), V2 (0x1.07e13a52144e3p-40),           \
+	   V2 (-0x1.6023d18496288p-42), V2 (0x1.9184ae7bc29a4p-44) },         \
+    .h = { V2 (0x1.7eb5a9fde20fep-2), V2 (-0x1.44eb77ec8b7fdp-10),            \
+	   V2 (0x1.4c0898f5e1b45p-16), V2 (-0x1.afa09b7645ceap-21),           \
+	   V2 (0x1.f99d287d45b26p-25), V2 (-0x1.b5786b09c37e2p-28),           \
+	   V2 (0x1.f3dec166ef31dp-31), V2 (-0x1.6035cd44c1c83p-33),           \
+	   V2 (0x1.25c75b83c0d48p-35), V2 (-0x1.17291815f917ap-37),           \
+	   V2 (0x1.0b3524da952cep-39), V2 (-0x1.2d8306d1dc591p-41),           \
+	   V2 (0x1.59d037d18339cp-42), V2 (-0x1.e66e1b4315862p-44) },         \
+    V_BESSEL_ASYM_PIO2                                                        \
+  }
+
+/* For |x| < MidBound, J0 and J1 are approximated with their first positive
+   zero z factored out, to keep the relative error small around it:
+     J0(x) = (x^2 - z^2) * P(x^2),
+     J1(x) = (x^2 - z^2) * x * P(x^2).
+   z^2 is stored as the unevaluated sum z2_hi + z2_lo.  */
+struct v_bessel_small_data
+{
+  float64x2_t poly[10];
+  float64x2_t z2_hi, z2_lo;
+};
+
+#define V_BESSEL_J0_SMALL_DATA                                                \
+  {                                                                           \
+    .poly = { V2 (-0x1.62214bb3c7121p-3), V2 (0x1.b4c4fb6b81b8cp-7),          \
+	      V2 (-0x1.a04594c03628p-12), V2 (0x1.add15693722bep-18),         \
+	      V2 (-0x1.17e92e9d26fbcp-24), V2 (0x1.f6e066f2b308bp-32),        \
+	      V2 (-0x1.4ab3e7f7ea077p-39), V2 (0x1.4eb4af24ffcd8p-47),        \
+	      V2 (-0x1.56f813df4e791p-55), V2 (0x1.3560d7d7d1e2cp-61) },      \
+    .z2_hi = V2 (0x1.721fb80462bbbp+2), .z2_lo = V2 (0x1.db60c816c15d3p-52),  \
+  }
+
+#define V_BESSEL_J1_SMALL_DATA                                                \
+  {                                                                           \
+    .poly = { V2 (-0x1.16fb4ba6b9f63p-5), V2 (0x1.fbdfb0a3d1727p-10),         \
+	      V2 (-0x1.7cf8005bbfa3fp-15), V2 (0x1.43316b385b82cp-21),        \
+	      V2 (-0x1.648982ef7a90fp-28), V2 (0x1.1572ba1dcc9f6p-35),        \
+	      V2 (-0x1.416f4abda6a09p-43), V2 (0x1.16b4b9a1f5f81p-51),        \
+	      V2 (0x1.c82a743cb47d6p-61), V2 (-0x1.06ce4d957babp-63) },       \
+    .z2_hi = V2 (0x1.d5d2b4189822cp+3), .z2_lo = V2 (-0x1.c6a0d245172bap-54), \
+  }
+
+/* Return (x^2 - z^2) * P(z), with z = x^2.  */
+static inline float64x2_t
+v_bessel_small (float64x2_t x, float64x2_t z,
+		const struct v_bessel_small_data *d)
+{
+  float64x2_t dz
+      = vsubq_f64 (vfmaq_f64 (vnegq_f64 (d->z2_hi), x, x), d->z2_lo);
+  return vmulq_f64 (dz, v_horner_9_f64 (z, d->poly));
+}
+
+/* In [MidBound, AsymBound), each interval [k, k + 1) has its own polynomial
+   with the zero z closest to it factored out, F(x) = t * Q(t) with
+   t = x - z.  Rows of tab are { z_hi, z_lo, q_0, ..., q_(nq - 1) }, padded to
+   an even length so that pairs of coefficients can be loaded together.
+   Lanes outside the interval are clamped to the first or last row.  */
+static inline float64x2_t
+v_bessel_mid (float64x2_t x, const double *tab, int nq)
+{
+  int stride = (nq + 3) & ~1;
+  uint64x2_t k = vcvtq_u64_f64 (
+      vminq_f64 (vsubq_f64 (x, v_f64 (MidBound)), v_f64 (AsymBound - 3)));
+  const double *row0 = tab + vgetq_lane_u64 (k, 0) * stride;
+  const double *row1 = tab + vgetq_lane_u64 (k, 1) * stride;
+
+  float64x2_t e0 = vld1q_f64 (row0);
+  float64x2_t e1 = vld1q_f64 (row1);
+  float64x2_t t = vsubq_f64 (vsubq_f64 (x, vzip1q_f64 (e0, e1)),
+			     vzip2q_f64 (e0, e1));
+
+  /* Horner evaluation of Q, loading coefficients in pairs from the top.  */
+  int j = stride - 2;
+  e0 = vld1q_f64 (row0 + j);
+  e1 = vld1q_f64 (row1 + j);
+  float64x2_t q = vzip1q_f64 (e0, e1);
+  if (!(nq & 1))
+    q = vfmaq_f64 (q, vzip2q_f64 (e0, e1), t);
+  for (j -= 2; j >= 2; j -= 2)
+    {
+      e0 = vld1q_f64 (row0 + j);
+      e1 = vld1q_f64 (row1 + j);
+      q = vfmaq_f64 (vzip2q_f64 (e0, e1), q, t);
+      q = vfmaq_f64 (vzip1q_f64 (e0, e1), q, t);
+    }
+  return vmulq_f64 (t, q);
+}
+
+/* Return cos(t + q * pi/2), given sin(t) and cos(t).  */
+static inline float64x2_t
+v_bessel_quadrant (float64x2_t s, float64x2_t c, uint64x2_t q)
+{
+  float64x2_t t = vbslq_f64 (vtstq_u64 (q, v_u64 (1)), s, c);
+  uint64x2_t sign
+      = vshlq_n_u64 (vandq_u64 (vaddq_u64 (q, v_u64 (1)), v_u64 (2)), 62);
+  return vreinterpretq_f64_u64 (veorq_u64 (vreinterpretq_u64_f64 (t), sign));
+}
+
+/* For |x| >= 2^23, use the large range reduction of sincos, which gives
+   x = k * pi/128 + r.  The phase correction is added to r, and the phase
+   shift to k, so that x - pi/4 + phi + quad * pi/2 = k' * pi/128 + r', and
+   the cosine is reconstructed from the table of cos(k pi/128) and
+   sin(k pi/128) as in v_sincos_fallback.  Infinity returns 0.  */
+static float64x2_t VPCS_ATTR NOINLINE
+v_bessel_special (float64x2_t x, float64x2_t phi, float64x2_t scale,
+		  float64x2_t y, uint64x2_t special, int quad)
+{
+  const struct reduction_data *d = ptr_barrier (&reduction_data);
+  struct reduction_result_t red = v_large_range_reduction (x, d);
+  float64x2_t r = vaddq_f64 (red.remainder, phi);
+  uint64x2_t k = vaddq_u64 (red.quadrant, v_u64 (64 * quad - 32));
+  float64x2x2_t eval = v_sincos_eval (r, d);
+  float64x2x2_t lookup = v_sincos_lookup (k);
+
+  /* cos(k + r) = cos(k)*cosm1(r) - sin(k)*sin(r) + cos(k).  */
+  float64x2_t t = vfmaq_f64 (lookup.val[1], eval.val[1], lookup.val[1]);
+  t = vfmsq_f64 (t, lookup.val[0], eval.val[0]);
+  float64x2_t large = vmulq_f64 (scale, t);
+  large = vbslq_f64 (vceqq_f64 (x, v_f64 (INFINITY)), v_f64 (0), large);
+  return vbslq_f64 (special, large, y);
+}
+
+/* Phase-amplitude approximation of the Bessel function of order nu selected
+   by quad, for x >= AsymBound.  quad is the number of quarter periods to add
+   to the phase x - pi/4 + phi_nu(x): 0 for J0, 3 for Y0 and J1, 2 for Y1.
+   Other lanes are not valid and need to be overwritten, except that NaN lanes
+   propagate NaN.  */
+static inline float64x2_t
+v_bessel_asym (float64x2_t x, int nu, int quad,
+	       const struct v_bessel_asym_data *d)
+{
+  float64x2_t pio2_12 = vld1q_f64 (&d->pio2_1);
+  float64x2_t pio2_3_inv = vld1q_f64 (&d->pio2_3);
+
+  float64x2_t rs = v_rsqrt_inline (x);
+  float64x2_t ix = vmulq_f64 (rs, rs);
+  float64x2_t v = vfmaq_f64 (v_f64 (-1.0), vmulq_f64 (ix, v_f64 (128.0)), ix);
+  float64x2_t v2 = vmulq_f64 (v, v);
+  float64x2_t m = v_horner_11_f64 (v, d->m);
+  float64x2_t h = nu ? v_pw_horner_13_f64 (v, v2, d->h)
+		     : v_pw_horner_14_f64 (v, v2, d->h);
+  float64x2_t phi = vdivq_f64 (h, x);
+
+  /* x + phi = (n + 1/2) * pi/2 + r, r in [-pi/4, pi/4], rounding n with
+     phi included so that r stays small.  phi is added to r after the first
+     two terms of the reduction, which are exact.  */
+  float64x2_t n = vrndnq_f64 (
+      vfmaq_laneq_f64 (v_f64 (-0.5), vaddq_f64 (x, phi), pio2_3_inv, 1));
+  float64x2_t n5 = vaddq_f64 (n, v_f64 (0.5));
+  float64x2_t r = vfmsq_laneq_f64 (x, n5, pio2_12, 0);
+  r = vfmsq_laneq_f64 (r, n5, pio2_12, 1);
+  r = vaddq_f64 (r, phi);
+  r = vfmsq_laneq_f64 (r, n5, pio2_3_inv, 0);
+
+  /* x - pi/4 + phi = n * pi/2 + r.  */
+  float64x2x2_t sc = v_sincos_inline (r, &v_sincos_data);
+  uint64x2_t q = vreinterpretq_u64_s64 (
+      vaddq_s64 (vcvtq_s64_f64 (n), v_s64 (quad)));
+  float64x2_t scale = vmulq_f64 (m, rs);
+  float64x2_t t = v_bessel_quadrant (sc.val[0], sc.val[1], q);
+  float64x2_t y = vmulq_f64 (scale, t);
+
+  uint64x2_t special = vcageq_f64 (x, d->range_val);
+  if (unlikely (v_any_u64 (special)))
+    return v_bessel_special (x, phi, scale, y, special, quad);
+  return y;
+}
+
+#endif
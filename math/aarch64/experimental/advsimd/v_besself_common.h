@@ -0,0 +1,190 @@
+/*
+ * Helpers for single-precision vector Bessel functions of the first and second
+ * kind of order 0 and 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_BESSELF_COMMON_H
+#define MATH_V_BESSELF_COMMON_H
+
+#include "v_math.h"
+#include "v_poly_f32.h"
+#include "v_rsqrtf_inline.h"
+#include "v_sincosf_common.h"
+
+/* Lower bound of the asymptotic region.  */
+#define AsymBound 2.0f
+
+/* For x >= AsymBound, Bessel functions of order nu = 0, 1 are written in
+   phase-amplitude form
+     J_nu(x) = M_nu(x) / sqrt(x) * cos(x - (2nu + 1)pi/4 + phi_nu(x)),
+     Y_nu(x) = M_nu(x) / sqrt(x) * sin(x - (2nu + 1)pi/4 + phi_nu(x)),
+   where M_nu(x) = m(v) and phi_nu(x) = h(v)/x are approximated by polynomials
+   in v = 8/x^2 - 1, in [-1, 1) in the asymptotic region.  As x -> inf,
+   m -> sqrt(2/pi) and h -> (4nu^2 - 1)/8.  The phase is computed with a 3-part
+   pi/2 reduction of x + phi into [-pi/4, pi/4], then evaluated with the
+   sincosf core.  Coefficients were fitted in the Chebyshev basis with
+   mpmath, see tools/bessel.py.  */
+struct v_besself_asym_data
+{
+  float32x4_t m[11], h[13];
+  float inv_pio2, pio2_1, pio2_2, pio2_3;
+  float32x4_t range_val;
+};
+
+#define V_BESSELF_ASYM_PIO2                                                   \
+  .inv_pio2 = 0x1.45f306p-1f, .pio2_1 = 0x1.921fb6p+0f,                       \
+  .pio2_2 = -0x1.777a5cp-25f, .pio2_3 = -0x1.ee59dap-50f,                     \
+  .range_val = V4 (0x1p20f)
+
+#define V_BESSELF_ASYM0_DATA                                                  \
+  {                                                                           \
+    .m = { V4 (0x1.95c4dcp-1f),	 V4 (-0x1.36b414p-8f), V4 (0x1.f3e23ep-12f), \
+	   V4 (-0x1.a0ade2p-14f), V4 (0x1.e93b8ap-16f), V4 (-0x1.8cfa2ep-17f),\
+	   V4 (0x1.931a0cp-18f),  V4 (-0x1.1a8332p-22f),                      \
+	   V4 (-0x1.f0cf7ep-21f), V4 (-0x1.15d2a6p-19f),                      \
+	   V4 (0x1.a875b2p-20f) },                                            \
+    .h = { V4 (-0x1.e672cep-4f),  V4 (0x1.49077cp-8f),                        \
+	   V4 (-0x1.b7d694p-11f), V4 (0x1.e074a2p-13f),                       \
+	   V4 (-0x1.57edb6p-14f), V4 (0x1.0a018p-15f),                        \
+	   V4 (-0x1.8358c6p-17f), V4 (0x1.e89a96p-17f),                       \
+	   V4 (-0x1.ca9a1ap-17f), V4 (-0x1.c60696p-18f),                      \
+	   V4 (0x1.29747p-17f),	  V4 (0x1.a07326p-18f),                       \
+	   V4 (-0x1.70f9b8p-18f) },                                           \
+    V_BESSELF_ASYM_PIO2                                                       \
+  }
+
+#define V_BESSELF_ASYM1_DATA                                                  \
+  {                                                                           \
+    .m = { V4 (0x1.a13342p-1f),	 V4 (0x1.ffe21cp-7f),  V4 (-0x1.19aee4p-10f),\
+	   V4 (0x1.829782p-13f),  V4 (-0x1.8b89dep-15f),                      \
+	   V4 (0x1.2edf18p-16f),  V4 (-0x1.8b67a2p-17f),                      \
+	   V4 (0x1.626b82p-21f),  V4 (0x1.1ccd04p-18f),                       \
+	   V4 (0x1.6b7778p-19f),  V4 (-0x1.adaf6p-19f) },                     \
+    .h = { V4 (0x1.6ec11ap-2f),	  V4 (-0x1.d4c2c4p-7f),                       \
+	   V4 (0x1.e99dd2p-10f),  V4 (-0x1.c1f504p-12f),                      \
+	   V4 (0x1.1ae5e4p-13f),  V4 (-0x1.a711cep-15f),                      \
+	   V4 (0x1.cc1ce4p-16f),  V4 (-0x1.4ba7cep-16f),                      \
+	   V4 (0x1.57ad22p-19f),  V4 (0x1.12bbeap-17f),                       \
+	   V4 (0x1.4a86d6p-20f),  V4 (-0x1.08c01ep-17f),                      \
+	   V4 (0x1.ab4308p-19f) },                                            \
+    V_BESSELF_ASYM_PIO2                                                       \
+  }
+
+/* For |x| < AsymBound, J0 and J1 are approximated with their first positive
+   zero z factored out, to keep the relative error small around it:
+     J0(x) = (x^2 - z^2) * P(x^2),
+     J1(x) = (x^2 - z^2) * x * P(x^2).
+   z^2 is stored as the unevaluated sum z2_hi + z2_lo.  */
+struct v_besself_small_data
+{
+  float32x4_t poly[6];
+  float32x4_t z2_hi, z2_lo;
+};
+
+#define V_BESSELF_J0_SMALL_DATA                                               \
+  {                                                                           \
+    .poly = { V4 (-0x1.62214cp-3f),  V4 (0x1.b4c514p-7f),                     \
+	      V4 (-0x1.a049eap-12f), V4 (0x1.ae6f12p-18f),                    \
+	      V4 (-0x1.2190dep-24f), V4 (0x1.633c5ap-31f) },                  \
+    .z2_hi = V4 (0x1.721fb8p+2f), .z2_lo = V4 (0x1.18aeeep-28f),              \
+  }
+
+#define V_BESSELF_J1_SMALL_DATA                                               \
+  {                                                                           \
+    .poly = { V4 (-0x1.16fb4cp-5f),  V4 (0x1.fbdfe8p-10f),                    \
+	      V4 (-0x1.7d01a6p-15f), V4 (0x1.4490c6p-21f),                    \
+	      V4 (-0x1.902c8p-28f),  V4 (0x1.841c52p-34f) },                  \
+    .z2_hi = V4 (0x1.d5d2b4p+3f), .z2_lo = V4 (0x1.89822cp-25f),              \
+  }
+
+/* Return (x^2 - z^2) * P(z), with z = x^2.  */
+static inline float32x4_t
+v_besself_small (float32x4_t x, float32x4_t z,
+		 const struct v_besself_small_data *d)
+{
+  float32x4_t dz
+      = vsubq_f32 (vfmaq_f32 (vnegq_f32 (d->z2_hi), x, x), d->z2_lo);
+  return vmulq_f32 (dz, v_horner_5_f32 (z, d->poly));
+}
+
+/* Return cos(t + quad * pi/2), given sin(t) and cos(t).  */
+static inline float32x4_t
+v_besself_quadrant (float32x4_t s, float32x4_t c, int32x4_t q)
+{
+  uint32x4_t uq = vreinterpretq_u32_s32 (q);
+  float32x4_t t = vbslq_f32 (vtstq_u32 (uq, v_u32 (1)), s, c);
+  uint32x4_t sign
+      = vshlq_n_u32 (vandq_u32 (vaddq_u32 (uq, v_u32 (1)), v_u32 (2)), 30);
+  return vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (t), sign));
+}
+
+/* For |x| >= 2^20, use the large range reduction of sincosf, which gives
+   x = (k + y) * pi/4 with y in double-single precision.  The phase correction
+   is added to y in units of pi/4, so that
+   x - pi/4 + phi + quad * pi/2 = (k - 1 + 2 quad) * pi/4 + r, and the cosine
+   is reconstructed from the table of cos(k pi/4) and sin(k pi/4) as in
+   sincos_fallback.  Infinity returns 0.  */
+static float32x4_t VPCS_ATTR NOINLINE
+v_besself_special (float32x4_t x, float32x4_t phi, float32x4_t scale,
+		   float32x4_t y, uint32x4_t special, int quad)
+{
+  struct reduction_result_t red = large_range_reduction (x);
+  red.remainder.val[1]
+      = vfmaq_f32 (red.remainder.val[1], phi, v_f32 (0x1.45f306p+0f));
+  uint32x4_t k = vaddq_u32 (red.octant, v_u32 (2 * quad - 1));
+  float32x4x2_t lookup = sin_cos_lookup (k);
+  float32x4x2_t eval = sincos_eval (red.remainder);
+
+  /* cos(k + r) = cos(k)*cosm1(r) - sin(k)*sin(r) + cos(k).  */
+  float32x4_t t = vfmsq_f32 (vmulq_f32 (lookup.val[1], eval.val[1]),
+			     lookup.val[0], eval.val[0]);
+  t = vaddq_f32 (t, lookup.val[1]);
+  float32x4_t large = vmulq_f32 (scale, t);
+  large = vbslq_f32 (vceqq_f32 (x, v_f32 (INFINITY)), v_f32 (0), large);
+  return vbslq_f32 (special, large, y);
+}
+
+/* Phase-amplitude approximation of the Bessel function selected by quad, for
+   x >= AsymBound.  quad is the number of quarter periods to add to the phase
+   x - pi/4 + phi_nu(x): 0 for J0, 3 for Y0 and J1, 2 for Y1.
+   Other lanes, including NaN, are not valid and need to be overwritten,
+   except that NaN lanes propagate NaN.  */
+static inline float32x4_t
+v_besself_asym (float32x4_t x, int quad, const struct v_besself_asym_data *d)
+{
+  float32x4_t pio2_vals = vld1q_f32 (&d->inv_pio2);
+  float32x4_t rs = v_rsqrtf_inline (x);
+  float32x4_t ix = vmulq_f32 (rs, rs);
+  float32x4_t v = vfmaq_f32 (v_f32 (-1.0f), vmulq_n_f32 (ix, 8.0f), ix);
+  float32x4_t m = v_horner_10_f32 (v, d->m);
+  float32x4_t h = v_horner_12_f32 (v, d->h);
+  float32x4_t phi = vdivq_f32 (h, x);
+
+  /* x + phi = (n + 1/2) * pi/2 + r, r in [-pi/4, pi/4], rounding n with
+     phi included so that r stays small.  phi is added to r after the first
+     two terms of the reduction, which are exact.  */
+  float32x4_t n = vrndnq_f32 (
+      vfmaq_laneq_f32 (v_f32 (-0.5f), vaddq_f32 (x, phi), pio2_vals, 0));
+  float32x4_t n5 = vaddq_f32 (n, v_f32 (0.5f));
+  float32x4_t r = vfmsq_laneq_f32 (x, n5, pio2_vals, 1);
+  r = vfmsq_laneq_f32 (r, n5, pio2_vals, 2);
+  r = vaddq_f32 (r, phi);
+  r = vfmsq_laneq_f32 (r, n5, pio2_vals, 3);
+
+  /* x - pi/4 + phi = n * pi/2 + r.  */
+  float32x4x2_t sc = v_sincosf_inline (r, &v_sincosf_data);
+  int32x4_t q = vaddq_s32 (vcvtq_s32_f32 (n), v_s32 (quad));
+  float32x4_t scale = vmulq_f32 (m, rs);
+  float32x4_t t = v_besself_quadrant (sc.val[0], sc.val[1], q);
+  float32x4_t y = vmulq_f32 (scale, t);
+
+  uint32x4_t special = vcageq_f32 (x, d->range_val);
+  if (unlikely (v_any_u32 (special)))
+    return v_besself_special (x, phi, scale, y, special, quad);
+  return y;
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Helper for double-precision vector exp with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_EXP_DD_INLINE_H
+#define MATH_V_EXP_DD_INLINE_H
+
+#include "v_math.h"
+
+/* Same algorithm, coefficients and table as the scalar exp_dd_inline, see
+   dd_inline.h.  The table of exp.c stores the tail of 2^(k/N) next to its
+   rounded value, so both are loaded with one access per lane.  */
+static const struct v_exp_dd_data
+{
+  float64x2_t inv_ln2_n, c2, c4;
+  double neg_ln2_hi_n, neg_ln2_lo_n;
+  double c3, c5;
+  uint64x2_t small_exp, thres_exp;
+} v_exp_dd_data = {
+  .inv_ln2_n = V2 (0x1.71547652b82fep7), /* N/ln2.  */
+  .neg_ln2_hi_n = -0x1.62e42fefa0000p-8,
+  .neg_ln2_lo_n = -0x1.cf79abc9e3b3ap-47,
+  /* abs error: 1.555*2^-66 if |x| < ln2/256+eps.  */
+  .c2 = V2 (0x1.ffffffffffdbdp-2),
+  .c3 = 0x1.555555555543cp-3,
+  .c4 = V2 (0x1.55555cf172b91p-5),
+  .c5 = 0x1.1111167a4d017p-7,
+  .small_exp = V2 (0x3c90000000000000), /* asuint64(0x1p-54).  */
+  .thres_exp = V2 (0x03f0000000000000), /* asuint64(512) - small_exp.  */
+};
+
+#define N (1 << EXP_TABLE_BITS)
+
+/* Lanes where |x| < 0x1p-54 or |x| >= 512 or x is nan, which need the
+   scalar routine.  */
+static inline uint64x2_t
+v_exp_dd_special (float64x2_t x, const struct v_exp_dd_data *d)
+{
+  return vcgeq_u64 (
+      vsubq_u64 (vreinterpretq_u64_f64 (vabsq_f64 (x)), d->small_exp),
+      d->thres_exp);
+}
+
+/* Return hi and set *tail such that hi + *tail ~= exp(x + xtail), where
+   |xtail| < 2^-8/N and |xtail| <= |x|, for lanes that are not special.
+   x = k ln2/N + rhi + rlo with rhi exact, and 1 + rhi is added exactly, so
+   the relative error is below 2^-65.  */
+static inline float64x2_t
+v_exp_dd_inline (float64x2_t x, float64x2_t xtail, float64x2_t *tail,
+		 const struct v_exp_dd_data *d)
+{
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  float64x2_t z = vmulq_f64 (x, d->inv_ln2_n);
+  float64x2_t kd = vrndnq_f64 (z);
+  int64x2_t ki = vcvtnq_s64_f64 (z);
+  float64x2_t neg_ln2_n = vld1q_f64 (&d->neg_ln2_hi_n);
+  float64x2_t rhi = vfmaq_laneq_f64 (x, kd, neg_ln2_n, 0);
+  float64x2_t rlo = vfmaq_laneq_f64 (xtail, kd, neg_ln2_n, 1);
+  float64x2_t r = vaddq_f64 (rhi, rlo);
+
+  /* 2^(k/N) ~= scale * (1 + t).  */
+  uint64x2_t i = vandq_u64 (vreinterpretq_u64_s64 (ki), v_u64 (N - 1));
+  uint64x2_t e0 = vld1q_u64 (&__exp_data.tab[2 * i[0]]);
+  uint64x2_t e1 = vld1q_u64 (&__exp_data.tab[2 * i[1]]);
+  float64x2_t t = vreinterpretq_f64_u64 (vzip1q_u64 (e0, e1));
+  uint64x2_t top
+      = vshlq_n_u64 (vreinterpretq_u64_s64 (ki), 52 - EXP_TABLE_BITS);
+  float64x2_t scale
+      = vreinterpretq_f64_u64 (vaddq_u64 (vzip2q_u64 (e0, e1), top));
+
+  /* tmp = t (1 + r) + rlo + exp(r) - 1 - r.  */
+  float64x2_t c35 = vld1q_f64 (&d->c3);
+  float64x2_t r2 = vmulq_f64 (r, r);
+  float64x2_t p23 = vfmaq_laneq_f64 (d->c2, r, c35, 0);
+  float64x2_t p45 = vfmaq_laneq_f64 (d->c4, r, c35, 1);
+  float64x2_t p = vfmaq_f64 (p23, r2, p45);
+  float64x2_t tmp = vaddq_f64 (vfmaq_f64 (t, t, r), rlo);
+  tmp = vfmaq_f64 (tmp, r2, p);
+
+  /* exp(x) ~= scale * (1 + rhi + tmp).  */
+  float64x2_t one_r = vaddq_f64 (v_f64 (1.0), rhi);
+  float64x2_t one_r_lo = vaddq_f64 (vsubq_f64 (v_f64 (1.0), one_r), rhi);
+  one_r_lo = vaddq_f64 (one_r_lo, tmp);
+  float64x2_t hi = vmulq_f64 (scale, one_r);
+  float64x2_t lo = vfmaq_f64 (vnegq_f64 (hi), scale, one_r);
+  lo = vfmaq_f64 (lo, scale, one_r_lo);
+  float64x2_t y = vaddq_f64 (hi, lo);
+  *tail = vaddq_f64 (vsubq_f64 (hi, y), lo);
+  return y;
+}
+
+#undef N
+
+#endif
@@ -0,0 +1,471 @@
+/*
+ * Helpers for double-precision vector incomplete gamma and beta functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_GAMMAINC_COMMON_H
+#define MATH_V_GAMMAINC_COMMON_H
+
+#include "v_math.h"
+#include "mathlib.h"
+#include "v_poly_f64.h"
+#include "v_expm1_inline.h"
+/* Defines data, and the log and exp cores with extra precision.  */
+#include "v_pow_inline.h"
+
+static const struct v_gammainc_data
+{
+  struct v_expm1_data expm1;
+  float64x2_t stirling_poly[8];
+  float64x2_t psi1p_poly[3];
+  float64x2_t hl2pi_hi, hl2pi_lo;
+} gammainc_data = {
+  .expm1 = V_EXPM1_DATA,
+  /* lgamma(t) - ((t - 1/2) log(t) - t + log(2 pi)/2) = r P(r^2), r = 1/t,
+     with the Stirling coefficients B_2k / (2k (2k - 1)).  The truncation
+     error is below 2^-54 for t >= StirlingBound.  */
+  .stirling_poly = { V2 (0x1.5555555555555p-4), V2 (-0x1.6c16c16c16c17p-9),
+		     V2 (0x1.a01a01a01a01ap-11), V2 (-0x1.3813813813814p-11),
+		     V2 (0x1.b951e2b18ff23p-11), V2 (-0x1.f6ab0d9993c7dp-10),
+		     V2 (0x1.a41a41a41a41ap-8), V2 (-0x1.e4286cb0f5398p-6) },
+  /* psi(1 + t) ~ -euler_gamma + pi^2/6 t - zeta(3) t^2.  */
+  .psi1p_poly = { V2 (-0x1.2788cfc6fb619p-1), V2 (0x1.a51a6625307d3p+0),
+		  V2 (-0x1.33ba004f00621p+0) },
+  .hl2pi_hi = V2 (0x1.d67f1c864beb5p-1),
+  .hl2pi_lo = V2 (-0x1.65b5a1b7ff5dfp-55),
+};
+
+#define StirlingBound 10.0
+#define Eps 0x1p-53
+#define SeriesEps 0x1p-56
+#define MaxIter 1000
+/* Above LargeA the series is also used for a <= x < a + sqrt(a)/2, where
+   Q = 1 - P >= 0.3.  */
+#define LargeA 20.0
+/* Terms of the alternating series for a, x < 1, the remainder is below
+   1/21! < 2^-65.  */
+#define SmallTerms 20
+
+/* Return a + b rounded, and its exact rounding error in *err.  */
+static inline float64x2_t
+v_two_sum (float64x2_t a, float64x2_t b, float64x2_t *err)
+{
+  float64x2_t s = vaddq_f64 (a, b);
+  float64x2_t bb = vsubq_f64 (s, a);
+  *err = vaddq_f64 (vsubq_f64 (a, vsubq_f64 (s, bb)), vsubq_f64 (b, bb));
+  return s;
+}
+
+/* Add x to the double-double hi + lo.  */
+static inline void
+v_dd_add (float64x2_t *hi, float64x2_t *lo, float64x2_t x)
+{
+  float64x2_t err;
+  *hi = v_two_sum (*hi, x, &err);
+  *lo = vaddq_f64 (*lo, err);
+}
+
+/* Add t (l + ltail) to the double-double hi + lo, the rounding error of t l
+   is recovered with an fma.  */
+static inline void
+v_dd_mla (float64x2_t *hi, float64x2_t *lo, float64x2_t t, float64x2_t l,
+	  float64x2_t ltail)
+{
+  float64x2_t p = vmulq_f64 (t, l);
+  float64x2_t e = vfmaq_f64 (vnegq_f64 (p), t, l);
+  v_dd_add (hi, lo, p);
+  *lo = vaddq_f64 (*lo, vfmaq_f64 (e, t, ltail));
+}
+
+/* Return log(x) + *tail for positive finite x, subnormal x are normalised
+   as in pow.  */
+static inline float64x2_t
+v_gammainc_log (float64x2_t x, float64x2_t *tail, const struct data *d)
+{
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t sub = vcltq_f64 (x, d->subnormal_bound);
+  if (unlikely (v_any_u64 (sub)))
+    {
+      uint64x2_t norm
+	  = vreinterpretq_u64_f64 (vmulq_f64 (x, d->subnormal_scale));
+      ix = vbslq_u64 (sub, vsubq_u64 (norm, d->subnormal_bias), ix);
+    }
+  return v_log_inline (ix, tail, d);
+}
+
+/* Return log(hi + lo) + *tail, hi + lo need not be normalised.  */
+static inline float64x2_t
+v_gammainc_log_dd (float64x2_t hi, float64x2_t lo, float64x2_t *tail,
+		   const struct data *d)
+{
+  float64x2_t err;
+  hi = v_two_sum (hi, lo, &err);
+  float64x2_t y = v_gammainc_log (hi, tail, d);
+  *tail = vaddq_f64 (*tail, vdivq_f64 (err, hi));
+  return y;
+}
+
+/* Return lgamma(1 + t + ttail) for 0 < t < 1 with a small relative error:
+   the rounding error du of 1 + t is corrected with du psi(1 + t), so that
+   the result stays accurate as t, and lgamma(1 + t), tend to 0.  */
+static inline float64x2_t
+v_lgamma1p (float64x2_t t, float64x2_t ttail, const struct v_gammainc_data *g)
+{
+  float64x2_t u = vaddq_f64 (t, v_f64 (1.0));
+  float64x2_t du
+      = vaddq_f64 (vsubq_f64 (t, vsubq_f64 (u, v_f64 (1.0))), ttail);
+  float64x2_t psi = v_horner_2_f64 (t, g->psi1p_poly);
+  return vfmaq_f64 (_ZGVnN2v_lgamma (u), du, psi);
+}
+
+/* Add s lgamma(t + ttail) to the double-double hi + lo, for t > 0 and
+   s = +-1, with an absolute error of a few 2^-53 independently of the
+   magnitude of lgamma.  log(t + ttail) = lt + lttail.
+   - t >= StirlingBound uses the Stirling series in double-double.
+   - 1 <= t < StirlingBound is shifted up with
+     lgamma(t) = lgamma(t + n) - log(t (t + 1) ... (t + n - 1)), where the
+     product is computed in double-double.
+   - t < 1 uses lgamma(t) = lgamma(1 + t) - log(t), only those lanes call
+     the vector lgamma.  */
+static inline void
+v_gammainc_add_lgamma (float64x2_t *hi, float64x2_t *lo, float64x2_t s,
+		       float64x2_t t, float64x2_t ttail, float64x2_t lt,
+		       float64x2_t lttail, const struct data *d,
+		       const struct v_gammainc_data *g)
+{
+  uint64x2_t small = vcltq_f64 (t, v_f64 (1.0));
+  uint64x2_t shift
+      = vbicq_u64 (vcltq_f64 (t, v_f64 (StirlingBound)), small);
+  float64x2_t u = t, utail = ttail, lu = lt, lutail = lttail;
+
+  if (v_any_u64 (shift))
+    {
+      float64x2_t n = vrndpq_f64 (vsubq_f64 (v_f64 (StirlingBound), t));
+      n = vbslq_f64 (shift, n, v_f64 (0));
+      float64x2_t ph = v_f64 (1.0), pl = v_f64 (0);
+      int m = vmaxvq_f64 (n);
+      for (int k = 0; k < m; k++)
+	{
+	  uint64x2_t active = vcgtq_f64 (n, v_f64 (k));
+	  float64x2_t cl, c = v_two_sum (t, v_f64 (k), &cl);
+	  c = vbslq_f64 (active, c, v_f64 (1.0));
+	  cl = vbslq_f64 (active, vaddq_f64 (cl, ttail), v_f64 (0));
+	  float64x2_t h = vmulq_f64 (ph, c);
+	  float64x2_t e = vfmaq_f64 (vnegq_f64 (h), ph, c);
+	  pl = vaddq_f64 (e, vfmaq_f64 (vmulq_f64 (ph, cl), pl, c));
+	  ph = h;
+	}
+      float64x2_t lptail, lp = v_gammainc_log_dd (ph, pl, &lptail, d);
+      float64x2_t sp = vbslq_f64 (shift, vnegq_f64 (s), v_f64 (0));
+      v_dd_mla (hi, lo, sp, lp, lptail);
+
+      u = v_two_sum (t, n, &utail);
+      utail = vaddq_f64 (utail, ttail);
+      float64x2_t l = v_gammainc_log (u, &lutail, d);
+      lutail = vaddq_f64 (lutail, vdivq_f64 (utail, u));
+      lu = vbslq_f64 (shift, l, lt);
+      lutail = vbslq_f64 (shift, lutail, lttail);
+    }
+
+  /* Stirling series at u, lanes with t < 1 use u = 1 and s = 0 so that they
+     add exactly 0.  */
+  float64x2_t ss = vbslq_f64 (small, v_f64 (0), s);
+  u = vbslq_f64 (small, v_f64 (1.0), u);
+  utail = vbslq_f64 (small, v_f64 (0), utail);
+  lu = vbslq_f64 (small, v_f64 (0), lu);
+  lutail = vbslq_f64 (small, v_f64 (0), lutail);
+  float64x2_t r = vdivq_f64 (v_f64 (1.0), u);
+  float64x2_t corr = vmulq_f64 (r, v_horner_7_f64 (vmulq_f64 (r, r),
+						   g->stirling_poly));
+  v_dd_mla (hi, lo, vmulq_f64 (ss, vsubq_f64 (u, v_f64 (0.5))), lu, lutail);
+  v_dd_add (hi, lo, vmulq_f64 (ss, vnegq_f64 (u)));
+  v_dd_add (hi, lo, vmulq_f64 (ss, g->hl2pi_hi));
+  float64x2_t tail = vfmaq_f64 (vsubq_f64 (corr, utail), utail, lu);
+  tail = vaddq_f64 (tail, g->hl2pi_lo);
+  *lo = vfmaq_f64 (*lo, ss, tail);
+
+  if (unlikely (v_any_u64 (small)))
+    {
+      float64x2_t ts = vbslq_f64 (small, t, v_f64 (0.5));
+      float64x2_t lg = v_lgamma1p (ts, vbslq_f64 (small, ttail, v_f64 (0)),
+				   g);
+      float64x2_t sl = vbslq_f64 (small, s, v_f64 (0));
+      v_dd_add (hi, lo, vmulq_f64 (sl, lg));
+      v_dd_mla (hi, lo, vnegq_f64 (sl), lt, lttail);
+    }
+}
+
+/* Return exp(hi + lo).  */
+static inline float64x2_t
+v_gammainc_exp (float64x2_t hi, float64x2_t lo, const struct data *d)
+{
+  float64x2_t tail, y = v_two_sum (hi, lo, &tail);
+  return v_exp_inline (y, vnegq_f64 (tail), d);
+}
+
+/* Regularized incomplete gamma function P(a, x), or Q(a, x) = 1 - P(a, x)
+   if upper is set, for finite a > 0 and x > 0.  The prefactor
+   x^a e^-x / Gamma(a) is evaluated as the exponential of a double-double
+   exponent, see v_gammainc_add_lgamma, so that its error does not grow with
+   a or x.  Lanes pick one of three methods, and converge independently:
+   - a < 1 and x < 1: P = x^a / Gamma(1 + a) (1 - T) and
+     Q = x^a / Gamma(1 + a) T - expm1(a log(x) - lgamma(1 + a)), where
+     T = a sum_{n>=1} (-1)^(n+1) x^n / (n! (a + n)).  Unlike 1 - P, Q keeps
+     a small relative error when a is small.
+   - x < a, or x < a + sqrt(a)/2 for a > LargeA: the power series
+     P = x^a e^-x / Gamma(a + 1) sum_{n>=0} x^n / ((a + 1) ... (a + n)),
+     summed in double-double.
+   - Otherwise: Legendre's continued fraction for Q, evaluated with Steed's
+     algorithm as a sum of decreasing terms.  This accumulates less rounding
+     error than Lentz's product of ratios, which loses up to 60 ULP close to
+     x = 1.  Its error still grows to about 25 ULP close to x = a for large
+     a, hence the wider series region.
+   The other function is 1 - P or 1 - Q, which is at least about 0.3 in
+   the last two regions.  */
+static inline float64x2_t
+v_gammainc_inline (float64x2_t a, float64x2_t x, int upper,
+		   const struct data *d, const struct v_gammainc_data *g)
+{
+  float64x2_t lat, la = v_gammainc_log (a, &lat, d);
+  float64x2_t lxt, lx = v_gammainc_log (x, &lxt, d);
+  uint64x2_t small
+      = vandq_u64 (vcltq_f64 (a, v_f64 (1.0)), vcltq_f64 (x, v_f64 (1.0)));
+  float64x2_t xs = vbslq_f64 (vcgtq_f64 (a, v_f64 (LargeA)),
+			      vfmaq_f64 (a, v_f64 (0.5), vsqrtq_f64 (a)), a);
+  uint64x2_t series = vbicq_u64 (vcltq_f64 (x, xs), small);
+  uint64x2_t cf = vceqzq_u64 (vorrq_u64 (small, series));
+
+  /* Exponent a log(x) - x - lgamma(a), without -x in the small region and
+     with -log(a) outside the continued fraction region.  */
+  float64x2_t hi = v_f64 (0), lo = v_f64 (0);
+  v_dd_mla (&hi, &lo, a, lx, lxt);
+  v_dd_add (&hi, &lo, vbslq_f64 (small, v_f64 (0), vnegq_f64 (x)));
+  v_gammainc_add_lgamma (&hi, &lo, v_f64 (-1.0), a, v_f64 (0), la, lat, d,
+			 g);
+  v_dd_mla (&hi, &lo, vbslq_f64 (cf, v_f64 (0), v_f64 (-1.0)), la, lat);
+  float64x2_t pre = v_gammainc_exp (hi, lo, d);
+
+  float64x2_t sum = v_f64 (1.0);
+  if (v_any_u64 (series))
+    {
+      /* Close to x = a the sum has about 9 sqrt(a) terms.  The terms, the
+	 ratios x / (a + n) and the sum are kept in double-double so that
+	 their rounding errors do not accumulate.  */
+      float64x2_t th = vbslq_f64 (series, v_f64 (1.0), v_f64 (0));
+      float64x2_t tl = v_f64 (0), sl = v_f64 (0);
+      uint64x2_t active = series;
+      for (int n = 1; n < MaxIter && v_any_u64 (active); n++)
+	{
+	  float64x2_t cl, c = v_two_sum (a, v_f64 (n), &cl);
+	  float64x2_t rh = vdivq_f64 (x, c);
+	  float64x2_t rl = vfmsq_f64 (vfmsq_f64 (x, rh, c), rh, cl);
+	  rl = vdivq_f64 (rl, c);
+	  float64x2_t h = vmulq_f64 (th, rh);
+	  float64x2_t e = vfmaq_f64 (vnegq_f64 (h), th, rh);
+	  tl = vfmaq_f64 (vfmaq_f64 (e, th, rl), tl, rh);
+	  th = h;
+	  v_dd_add (&sum, &sl, th);
+	  sl = vaddq_f64 (sl, tl);
+	  active = vandq_u64 (
+	      active, vcgeq_f64 (th, vmulq_f64 (sum, v_f64 (SeriesEps))));
+	  th = vreinterpretq_f64_u64 (
+	      vandq_u64 (active, vreinterpretq_u64_f64 (th)));
+	  tl = vreinterpretq_f64_u64 (
+	      vandq_u64 (active, vreinterpretq_u64_f64 (tl)));
+	}
+      sum = vaddq_f64 (sum, sl);
+    }
+
+  float64x2_t h = v_f64 (0);
+  if (v_any_u64 (cf))
+    {
+      /* Q = pre / (b_1 + a_1 / (b_2 + a_2 / (b_3 + ...))), with
+	 a_i = -i (i - a) and b_i = x - a + 2i - 1.  Steed's algorithm:
+	 D_1 = 1 / b_1, D_i+1 = 1 / (b_i+1 + a_i D_i),
+	 del_i+1 = -a_i D_i D_i+1 del_i and h = sum del_i.  */
+      float64x2_t b = vsubq_f64 (vaddq_f64 (x, v_f64 (1.0)), a);
+      b = vbslq_f64 (cf, b, v_f64 (1.0));
+      float64x2_t dd = vdivq_f64 (v_f64 (1.0), b);
+      float64x2_t del = vreinterpretq_f64_u64 (
+	  vandq_u64 (cf, vreinterpretq_u64_f64 (dd)));
+      uint64x2_t active = cf;
+      h = del;
+      for (int i = 1; i < MaxIter && v_any_u64 (active); i++)
+	{
+	  float64x2_t an = vmulq_f64 (v_f64 (i), vsubq_f64 (a, v_f64 (i)));
+	  b = vaddq_f64 (b, v_f64 (2.0));
+	  float64x2_t dn = vdivq_f64 (v_f64 (1.0), vfmaq_f64 (b, an, dd));
+	  del = vmulq_f64 (del,
+			   vmulq_f64 (vnegq_f64 (an), vmulq_f64 (dd, dn)));
+	  dd = dn;
+	  h = vaddq_f64 (h, del);
+	  active = vandq_u64 (
+	      active, vcageq_f64 (del, vmulq_f64 (h, v_f64 (Eps))));
+	  del = vreinterpretq_f64_u64 (
+	      vandq_u64 (active, vreinterpretq_u64_f64 (del)));
+	}
+    }
+
+  float64x2_t p = vmulq_f64 (pre, sum);
+  float64x2_t q = vmulq_f64 (pre, h);
+  float64x2_t y = upper ? vbslq_f64 (series, vsubq_f64 (v_f64 (1.0), p), q)
+			: vbslq_f64 (series, p, vsubq_f64 (v_f64 (1.0), q));
+
+  if (v_any_u64 (small))
+    {
+      /* T = -a sum_{n=1}^{SmallTerms} u_n / (a + n), u_n = (-x)^n / n!.  */
+      float64x2_t un = v_f64 (1.0), tsum = v_f64 (0);
+      for (int n = 1; n <= SmallTerms; n++)
+	{
+	  un = vmulq_f64 (un, vdivq_f64 (vnegq_f64 (x), v_f64 (n)));
+	  tsum = vaddq_f64 (tsum, vdivq_f64 (un, vaddq_f64 (a, v_f64 (n))));
+	}
+      float64x2_t t = vnegq_f64 (vmulq_f64 (a, tsum));
+      if (upper)
+	{
+	  /* expm1 of the exponent, only needed accurately for small
+	     exponents.  */
+	  float64x2_t e = vaddq_f64 (hi, lo);
+	  uint64x2_t near0 = vcaltq_f64 (e, v_f64 (1.0));
+	  float64x2_t em1 = expm1_inline (vbslq_f64 (near0, e, v_f64 (0)),
+					  &g->expm1);
+	  em1 = vbslq_f64 (near0, em1, vsubq_f64 (pre, v_f64 (1.0)));
+	  t = vfmsq_f64 (vnegq_f64 (em1), vnegq_f64 (pre), t);
+	}
+      else
+	t = vfmsq_f64 (pre, pre, t);
+      y = vbslq_f64 (small, t, y);
+    }
+  return y;
+}
+
+/* Regularized incomplete beta function I_x(a, b) for finite a, b > 0 and
+   0 < x < 1.  The prefactor x^a (1 - x)^b / B(a, b) uses the same
+   double-double exponent as gammainc, with log(1 - x) corrected for the
+   rounding of 1 - x.  Lanes with x > (a + 1) / (a + b + 2) use
+   I_x(a, b) = 1 - I_1-x(b, a), so that the continued fraction for
+   I_y(p, q) converges quickly.  The even part of the usual fraction is
+   used,
+     I_y(p, q) = y^p (1 - y)^q / B(p, q) / (b_0 + a_1 / (b_1 + ...)),
+     a_n = (p + n - 1) (p + q + n - 1) n (q - n) y^2 / (p + 2n - 1)^2,
+     b_n = n + n (q - n) y / (p + 2n - 1)
+	   + (p + n) (c + n (2 - y)) / (p + 2n + 1),
+   with c = p + 1 - (p + q) y, as all its terms are positive for n < q,
+   while the odd terms of the usual fraction tend to -1 close to the switch
+   point and cancel in Steed's algorithm.  c is computed in double-double
+   since it vanishes at the switch point as p + q grows.  The complement
+   loses relative accuracy when I_x(a, b) is tiny on the swapped side, which
+   is why the documented domain is a, b >= 0.5.  */
+static inline float64x2_t
+v_betainc_inline (float64x2_t a, float64x2_t b, float64x2_t x,
+		  const struct data *d, const struct v_gammainc_data *g)
+{
+  float64x2_t h1 = vsubq_f64 (v_f64 (1.0), x);
+  float64x2_t e1 = vsubq_f64 (vsubq_f64 (v_f64 (1.0), h1), x);
+  float64x2_t sl, s = v_two_sum (a, b, &sl);
+
+  float64x2_t lxt, lx = v_gammainc_log (x, &lxt, d);
+  float64x2_t l1t, l1 = v_gammainc_log (h1, &l1t, d);
+  l1t = vaddq_f64 (l1t, vdivq_f64 (e1, h1));
+  float64x2_t lst, ls = v_gammainc_log (s, &lst, d);
+  lst = vaddq_f64 (lst, vdivq_f64 (sl, s));
+  float64x2_t lat, la = v_gammainc_log (a, &lat, d);
+  float64x2_t lbt, lb = v_gammainc_log (b, &lbt, d);
+
+  float64x2_t hi = v_f64 (0), lo = v_f64 (0);
+  v_dd_mla (&hi, &lo, a, lx, lxt);
+  v_dd_mla (&hi, &lo, b, l1, l1t);
+  v_gammainc_add_lgamma (&hi, &lo, v_f64 (-1.0), a, v_f64 (0), la, lat, d,
+			 g);
+  v_gammainc_add_lgamma (&hi, &lo, v_f64 (-1.0), b, v_f64 (0), lb, lbt, d,
+			 g);
+  v_gammainc_add_lgamma (&hi, &lo, v_f64 (1.0), s, sl, ls, lst, d, g);
+  float64x2_t pre = v_gammainc_exp (hi, lo, d);
+
+  float64x2_t bound = vdivq_f64 (vaddq_f64 (a, v_f64 (1.0)),
+				 vaddq_f64 (s, v_f64 (2.0)));
+  uint64x2_t swap = vcgtq_f64 (x, bound);
+  float64x2_t p = vbslq_f64 (swap, b, a);
+  float64x2_t q = vbslq_f64 (swap, a, b);
+  float64x2_t y = vbslq_f64 (swap, h1, x);
+  float64x2_t yl = vbslq_f64 (swap, e1, v_f64 (0));
+
+  /* c = (p + 1) - (p + q) y, where p1 - ph is exact.  */
+  float64x2_t ph = vmulq_f64 (s, y);
+  float64x2_t pl = vfmaq_f64 (vnegq_f64 (ph), s, y);
+  pl = vfmaq_f64 (vfmaq_f64 (pl, sl, y), s, yl);
+  float64x2_t p1l, p1 = v_two_sum (p, v_f64 (1.0), &p1l);
+  float64x2_t c = vaddq_f64 (vsubq_f64 (p1, ph), vsubq_f64 (p1l, pl));
+  float64x2_t y2 = vmulq_f64 (y, y);
+  float64x2_t two_y = vsubq_f64 (v_f64 (2.0), y);
+
+  /* Steed's algorithm: D_1 = 1 / b_1, D_n = 1 / (b_n + a_n D_n-1),
+     del_n = -a_n D_n-1 D_n del_n-1 and f = b_0 + sum del_n.  */
+  float64x2_t f = vdivq_f64 (vmulq_f64 (p, c), p1);
+  float64x2_t dd = v_f64 (0), del = v_f64 (1.0);
+  uint64x2_t active = v_u64 (-1);
+  for (int n = 1; n < MaxIter && v_any_u64 (active); n++)
+    {
+      float64x2_t nf = v_f64 (n);
+      float64x2_t pn = vaddq_f64 (p, nf);
+      float64x2_t nqn = vmulq_f64 (nf, vsubq_f64 (q, nf));
+      float64x2_t nm1 = vsubq_f64 (nf, v_f64 (1.0));
+      float64x2_t an = vmulq_f64 (vmulq_f64 (vaddq_f64 (p, nm1),
+					     vaddq_f64 (s, nm1)),
+				  vmulq_f64 (nqn, y2));
+      float64x2_t p2n1 = vaddq_f64 (pn, nm1);
+      an = vdivq_f64 (an, vmulq_f64 (p2n1, p2n1));
+      float64x2_t bn = vfmaq_f64 (nf, nqn, vdivq_f64 (y, p2n1));
+      bn = vfmaq_f64 (bn, pn,
+		      vdivq_f64 (vfmaq_f64 (c, nf, two_y),
+				 vaddq_f64 (p2n1, v_f64 (2.0))));
+      float64x2_t dn = vdivq_f64 (v_f64 (1.0), vfmaq_f64 (bn, an, dd));
+      del = n == 1 ? vmulq_f64 (an, dn)
+		   : vmulq_f64 (del, vmulq_f64 (vnegq_f64 (an),
+						vmulq_f64 (dd, dn)));
+      dd = dn;
+      f = vaddq_f64 (f, del);
+      active = vandq_u64 (active,
+			  vcageq_f64 (del, vmulq_f64 (f, v_f64 (Eps))));
+      del = vreinterpretq_f64_u64 (
+	  vandq_u64 (active, vreinterpretq_u64_f64 (del)));
+    }
+
+  float64x2_t r = vdivq_f64 (pre, f);
+  return vbslq_f64 (swap, vsubq_f64 (v_f64 (1.0), r), r);
+}
+
+/* Values of P(a, x), or Q(a, x) if upper is set, for lanes where a or x is
+   not finite and positive.  P(a, 0) = 0, P(a, inf) = 1 and P(inf, x) = 0
+   for a > 0 and finite x >= 0.  Other cases are NaN.  */
+static inline float64x2_t
+v_gammainc_special (float64x2_t a, float64x2_t x, int upper)
+{
+  float64x2_t inf = v_f64 (INFINITY);
+  uint64x2_t xinf = vceqq_f64 (x, inf);
+  uint64x2_t valid = vandq_u64 (vcgtzq_f64 (a), vcgezq_f64 (x));
+  valid = vbicq_u64 (valid, vandq_u64 (xinf, vceqq_f64 (a, inf)));
+  float64x2_t p = vbslq_f64 (xinf, v_f64 (1.0), v_f64 (0));
+  if (upper)
+    p = vsubq_f64 (v_f64 (1.0), p);
+  return vbslq_f64 (valid, p, v_f64 (NAN));
+}
+
+/* Values of I_x(a, b) for lanes where a or b is not finite and positive or
+   x is not in (0, 1).  I_0(a, b) = 0 and I_1(a, b) = 1 for finite a, b > 0,
+   other cases are NaN.  */
+static inline float64x2_t
+v_betainc_special (float64x2_t a, float64x2_t b, float64x2_t x)
+{
+  float64x2_t inf = v_f64 (INFINITY);
+  uint64x2_t valid = vandq_u64 (vcgtzq_f64 (a), vcgtzq_f64 (b));
+  valid = vandq_u64 (valid, vcltq_f64 (vmaxq_f64 (a, b), inf));
+  uint64x2_t x1 = vceqq_f64 (x, v_f64 (1.0));
+  valid = vandq_u64 (valid, vorrq_u64 (vceqzq_f64 (x), x1));
+  float64x2_t y = vbslq_f64 (x1, v_f64 (1.0), v_f64 (0));
+  return vbslq_f64 (valid, y, v_f64 (NAN));
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * Helpers for double-precision vector log-domain functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_LOGEXP_COMMON_H
+#define MATH_V_LOGEXP_COMMON_H
+
+#include "v_math.h"
+#include "v_expm1_inline.h"
+#define WANT_V_LOG1P_K0_SHORTCUT 0
+#include "v_log1p_inline.h"
+
+/* Same scheme as v_logexpf_common.h: below -Bound e^d is subnormal, so
+   lanes with d < -Bound are only computed if |m| >= Tiny, where the rounded
+   result is m.  */
+struct v_logexp_data
+{
+  struct v_expm1_data expm1_consts;
+  struct v_log1p_data log1p_consts;
+  float64x2_t bound, neg_ln2, tiny;
+};
+
+#define V_LOGEXP_DATA                                                         \
+  {                                                                           \
+    .expm1_consts = V_EXPM1_DATA, .log1p_consts = V_LOG1P_CONSTANTS_TABLE,    \
+    .bound = V2 (-0x1.62p+9), .neg_ln2 = V2 (-0x1.62e42fefa39efp-1),          \
+    .tiny = V2 (0x1p-960),                                                    \
+  }
+
+/* Lanes where m + log(1 +- e^d) needs the scalar fallback: e^d is subnormal
+   and m is tiny, or m or d is not finite.  */
+static inline uint64x2_t
+v_logexp_special (float64x2_t m, float64x2_t d,
+		  const struct v_logexp_data *dat)
+{
+  float64x2_t am = vabsq_f64 (m);
+  uint64x2_t m_ok = vandq_u64 (vcgeq_f64 (am, dat->tiny),
+			       vcltq_f64 (am, v_f64 (INFINITY)));
+  return vbicq_u64 (vceqzq_u64 (vcgeq_f64 (d, dat->bound)), m_ok);
+}
+
+/* Return x - y, with the rounding error in *lo.  */
+static inline float64x2_t
+v_logexp_diff (float64x2_t x, float64x2_t y, float64x2_t *lo)
+{
+  float64x2_t s = vsubq_f64 (x, y);
+  float64x2_t xv = vaddq_f64 (s, y);
+  float64x2_t yv = vsubq_f64 (xv, s);
+  *lo = vaddq_f64 (vsubq_f64 (x, xv), vsubq_f64 (yv, y));
+  return s;
+}
+
+/* log(1 + e^(d + dl)) if SUB is 0 and log(1 - e^(d + dl)) otherwise, for
+   d <= 0 (and d < -0x1p-1022 if SUB) and |dl| <= ulp(d).  d is clamped to
+   -Bound.  The reduction of expm1 gives both e^d and e^d - 1, then the
+   reduction of log1p is applied to the exact head of 1 +- e^d, with the
+   tail as correction term, see v_logexpf_common.h.  */
+static inline float64x2_t
+v_log1pmexp_inline (float64x2_t d, float64x2_t dl, int sub,
+		    const struct v_logexp_data *dat)
+{
+  dl = vreinterpretq_f64_u64 (
+      vandq_u64 (vreinterpretq_u64_f64 (dl), vcgeq_f64 (d, dat->bound)));
+  d = vmaxq_f64 (d, dat->bound);
+
+  const struct v_expm1_data *de = &dat->expm1_consts;
+  float64x2_t ln2 = vld1q_f64 (&de->ln2[0]);
+  float64x2_t n = vrndaq_f64 (vmulq_f64 (d, de->invln2));
+  int64x2_t i = vcvtq_s64_f64 (n);
+  float64x2_t f = vfmsq_laneq_f64 (d, n, ln2, 0);
+  f = vaddq_f64 (vfmsq_laneq_f64 (f, n, ln2, 1), dl);
+
+  float64x2_t f2 = vmulq_f64 (f, f);
+  float64x2_t f4 = vmulq_f64 (f2, f2);
+  float64x2_t lane_consts_13 = vld1q_f64 (&de->c1);
+  float64x2_t lane_consts_57 = vld1q_f64 (&de->c5);
+  float64x2_t lane_consts_910 = vld1q_f64 (&de->c9);
+  float64x2_t p01 = vfmaq_laneq_f64 (v_f64 (0.5), f, lane_consts_13, 0);
+  float64x2_t p23 = vfmaq_laneq_f64 (de->c2, f, lane_consts_13, 1);
+  float64x2_t p45 = vfmaq_laneq_f64 (de->c4, f, lane_consts_57, 0);
+  float64x2_t p67 = vfmaq_laneq_f64 (de->c6, f, lane_consts_57, 1);
+  float64x2_t p03 = vfmaq_f64 (p01, f2, p23);
+  float64x2_t p47 = vfmaq_f64 (p45, f2, p67);
+  float64x2_t p89 = vfmaq_laneq_f64 (de->c8, f, lane_consts_910, 0);
+  float64x2_t p = vfmaq_laneq_f64 (p89, f2, lane_consts_910, 1);
+  p = vfmaq_f64 (p47, f4, p);
+  p = vfmaq_f64 (p03, f4, p);
+  p = vfmaq_f64 (f, f2, p);
+
+  float64x2_t s = vreinterpretq_f64_s64 (
+      vaddq_s64 (vshlq_n_s64 (i, 52), de->exponent_bias));
+  float64x2_t e = vfmaq_f64 (s, p, s);
+
+  float64x2_t uh, ul;
+  if (sub)
+    {
+      uh = vsubq_f64 (v_f64 (1.0), e);
+      ul = vsubq_f64 (vsubq_f64 (v_f64 (1.0), uh), e);
+      float64x2_t em = vfmaq_f64 (vsubq_f64 (s, v_f64 (1.0)), p, s);
+      uint64x2_t near0 = vcgtq_f64 (d, dat->neg_ln2);
+      uh = vbslq_f64 (near0, vnegq_f64 (em), uh);
+      ul = vreinterpretq_f64_u64 (
+	  vbicq_u64 (vreinterpretq_u64_f64 (ul), near0));
+    }
+  else
+    {
+      uh = vaddq_f64 (v_f64 (1.0), e);
+      ul = vaddq_f64 (vsubq_f64 (v_f64 (1.0), uh), e);
+    }
+
+  /* Reduction of log1p applied to the exact uh, g in
+     [sqrt(2)/2 - 1, sqrt(2) - 1] is exact.  */
+  const struct v_log1p_data *dlp = &dat->log1p_consts;
+  uint64x2_t mi = vreinterpretq_u64_f64 (uh);
+  uint64x2_t u = vaddq_u64 (mi, dlp->one_m_hf_rt2_top);
+  float64x2_t k = vcvtq_f64_s64 (
+      vsubq_s64 (vreinterpretq_s64_u64 (vshrq_n_u64 (u, 52)), dlp->one_top));
+  uint64x2_t utop = vaddq_u64 (vandq_u64 (u, dlp->umask), dlp->hf_rt2_top);
+  uint64x2_t u_red = vorrq_u64 (utop, vandq_u64 (mi, BottomMask));
+  float64x2_t g = vsubq_f64 (vreinterpretq_f64_u64 (u_red), v_f64 (1.0));
+
+  float64x2_t g2 = vmulq_f64 (g, g);
+  float64x2_t q = eval_poly (g, g2, dlp);
+  float64x2_t ln2l = vld1q_f64 (&dlp->ln2[0]);
+  float64x2_t ylo = vfmaq_laneq_f64 (vdivq_f64 (ul, uh), k, ln2l, 1);
+  float64x2_t yhi = vfmaq_laneq_f64 (g, k, ln2l, 0);
+  return vfmaq_f64 (vaddq_f64 (ylo, yhi), g2, q);
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Helpers for single-precision vector log-domain functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_LOGEXPF_COMMON_H
+#define MATH_V_LOGEXPF_COMMON_H
+
+#include "v_math.h"
+#include "v_expm1f_inline.h"
+#include "arm_math_inline.h"
+
+/* logaddexp, logsubexp, log1pexp and log1mexp are all m + log(1 +- e^d) with
+   d <= 0, so e^d never overflows.  Below -Bound e^d is subnormal, so lanes
+   with d < -Bound are only computed if |m| >= Tiny, where the rounded result
+   is m.  */
+struct v_logexpf_data
+{
+  struct v_expm1f_data expm1f_consts;
+  struct arm_math_v_log1pf_data log1pf_consts;
+  float32x4_t bound, neg_ln2, tiny;
+};
+
+#define V_LOGEXPF_DATA                                                        \
+  {                                                                           \
+    .expm1f_consts = V_EXPM1F_DATA,                                           \
+    .log1pf_consts = ARM_MATH_V_LOG1PF_DATA_INIT,                             \
+    .bound = V4 (-0x1.5cp+6f), .neg_ln2 = V4 (-0x1.62e43p-1f),                \
+    .tiny = V4 (0x1p-100f),                                                   \
+  }
+
+/* Lanes where m + log(1 +- e^d) needs the scalar fallback: e^d is subnormal
+   and m is tiny, or m or d is not finite.  */
+static inline uint32x4_t
+v_logexpf_special (float32x4_t m, float32x4_t d,
+		   const struct v_logexpf_data *dat)
+{
+  float32x4_t am = vabsq_f32 (m);
+  uint32x4_t m_ok = vandq_u32 (vcgeq_f32 (am, dat->tiny),
+			       vcltq_f32 (am, v_f32 (INFINITY)));
+  return vbicq_u32 (vmvnq_u32 (vcgeq_f32 (d, dat->bound)), m_ok);
+}
+
+/* Return x - y, with the rounding error in *lo.  The error of the reduced
+   argument matters when |y| is much smaller than |x|.  */
+static inline float32x4_t
+v_logexpf_diff (float32x4_t x, float32x4_t y, float32x4_t *lo)
+{
+  float32x4_t s = vsubq_f32 (x, y);
+  float32x4_t xv = vaddq_f32 (s, y);
+  float32x4_t yv = vsubq_f32 (xv, s);
+  *lo = vaddq_f32 (vsubq_f32 (x, xv), vsubq_f32 (yv, y));
+  return s;
+}
+
+/* log(1 + e^(d + dl)) if SUB is 0 and log(1 - e^(d + dl)) otherwise, for
+   d <= 0 (and d < -0x1p-126 if SUB) and |dl| <= ulp(d).  d is clamped to
+   -Bound.
+
+   The reduction d = i ln2 + f of expm1f gives both
+     e^d = 2^i + 2^i P(f) and e^d - 1 = (2^i - 1) + 2^i P(f).
+   1 +- e^d is split exactly into uh + ul, then
+     log(uh + ul) = k ln2 + log1p(uh 2^-k - 1) + ul / uh,
+   where uh 2^-k - 1 in [-1/4, 1/2] is exact and log1p is the polynomial of
+   log1pf.  Above -ln2, 1 - e^d cancels, so uh = -(e^d - 1) instead.  */
+static inline float32x4_t
+v_log1pmexpf_inline (float32x4_t d, float32x4_t dl, int sub,
+		     const struct v_logexpf_data *dat)
+{
+  dl = vreinterpretq_f32_u32 (vandq_u32 (vreinterpretq_u32_f32 (dl),
+					 vcgeq_f32 (d, dat->bound)));
+  d = vmaxq_f32 (d, dat->bound);
+
+  const struct v_expm1f_data *de = &dat->expm1f_consts;
+  float32x2_t ln2 = vld1_f32 (&de->ln2_hi);
+  float32x4_t lane_consts = vld1q_f32 (&de->c1);
+
+  float32x4_t j = vrndaq_f32 (vmulq_laneq_f32 (d, lane_consts, 2));
+  int32x4_t i = vcvtq_s32_f32 (j);
+  float32x4_t f = vfmsq_lane_f32 (d, j, ln2, 0);
+  f = vaddq_f32 (vfmsq_lane_f32 (f, j, ln2, 1), dl);
+
+  float32x4_t f2 = vmulq_f32 (f, f);
+  float32x4_t f4 = vmulq_f32 (f2, f2);
+  float32x4_t p01 = vfmaq_laneq_f32 (de->c0, f, lane_consts, 0);
+  float32x4_t p23 = vfmaq_laneq_f32 (de->c2, f, lane_consts, 1);
+  float32x4_t p = vfmaq_f32 (p01, f2, p23);
+  p = vfmaq_laneq_f32 (p, f4, lane_consts, 3);
+  p = vfmaq_f32 (f, f2, p);
+
+  float32x4_t s = vreinterpretq_f32_s32 (
+      vaddq_s32 (vshlq_n_s32 (i, 23), de->exponent_bias));
+  float32x4_t e = vfmaq_f32 (s, p, s);
+
+  float32x4_t uh, ul;
+  if (sub)
+    {
+      uh = vsubq_f32 (v_f32 (1.0f), e);
+      ul = vsubq_f32 (vsubq_f32 (v_f32 (1.0f), uh), e);
+      float32x4_t em = vfmaq_f32 (vsubq_f32 (s, v_f32 (1.0f)), p, s);
+      uint32x4_t near0 = vcgtq_f32 (d, dat->neg_ln2);
+      uh = vbslq_f32 (near0, vnegq_f32 (em), uh);
+      ul = vreinterpretq_f32_u32 (
+	  vbicq_u32 (vreinterpretq_u32_f32 (ul), near0));
+    }
+  else
+    {
+      uh = vaddq_f32 (v_f32 (1.0f), e);
+      ul = vaddq_f32 (vsubq_f32 (v_f32 (1.0f), uh), e);
+    }
+
+  /* Reduction of log1pf applied to the exact uh.  */
+  const struct arm_math_v_log1pf_data *dlp = &dat->log1pf_consts;
+  int32x4_t k
+      = vandq_s32 (vsubq_s32 (vreinterpretq_s32_f32 (uh), dlp->three_quarters),
+		   v_s32 (0xff800000));
+  float32x4_t r = vsubq_f32 (
+      vreinterpretq_f32_s32 (vsubq_s32 (vreinterpretq_s32_f32 (uh), k)),
+      v_f32 (1.0f));
+  float32x4_t y
+      = vaddq_f32 (arm_math_v_log1pf_poly (r, dlp), vdivq_f32 (ul, uh));
+  float32x4_t kf = vmulq_f32 (vcvtq_f32_s32 (k), v_f32 (0x1p-23f));
+  return vfmaq_f32 (y, kf, dlp->ln2);
+}
+
+#endif
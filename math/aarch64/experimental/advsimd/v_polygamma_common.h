@@ -0,0 +1,94 @@
+/*
+ * Helpers for double-precision vector digamma and trigamma.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_POLYGAMMA_COMMON_H
+#define MATH_V_POLYGAMMA_COMMON_H
+
+#include "v_math.h"
+#include "v_poly_f64.h"
+
+/* Negative x are reduced to t = 1 - x > 1 with the reflection formulas
+     digamma(x) = digamma(t) - pi cot(pi x),
+     trigamma(x) = -trigamma(t) + pi^2 / sin^2(pi x).
+   sin(pi r) / pi is approximated by r + r^3 S(r^2), r = x - rint(x) in
+   [-1/2, 1/2], so that neither term needs a rounded factor of pi.  */
+struct v_polygamma_refl_data
+{
+  float64x2_t sinpi_poly[8];
+  float64x2_t pi_hi, pi_lo;
+};
+
+#define V_POLYGAMMA_REFL_DATA                                                 \
+  {                                                                           \
+    .sinpi_poly = { V2 (-0x1.a51a6625307d3p+0), V2 (0x1.9f9cb402bc45dp-1),    \
+		    V2 (-0x1.86a8e4720c74dp-3), V2 (0x1.ac6805cdf33d8p-6),    \
+		    V2 (-0x1.33816a063390cp-9), V2 (0x1.3746c58004fp-13),     \
+		    V2 (-0x1.d3f28f5ca4278p-18),                              \
+		    V2 (0x1.080d9d95e8992p-22) },                             \
+    .pi_hi = V2 (0x1.921fb54442d18p+1), .pi_lo = V2 (0x1.1a62633145c07p-53),  \
+  }
+
+/* Return sin(pi r) / pi, for |r| <= 1/2.  */
+static inline float64x2_t
+v_polygamma_sinpi (float64x2_t r, const struct v_polygamma_refl_data *d)
+{
+  float64x2_t z = vmulq_f64 (r, r);
+  float64x2_t p = vmulq_f64 (z, v_horner_7_f64 (z, d->sinpi_poly));
+  return vfmaq_f64 (r, r, p);
+}
+
+/* Return pi cot(pi x), the reflection term of digamma.  Infinite for
+   integer x.  */
+static inline float64x2_t
+v_polygamma_picot (float64x2_t x, const struct v_polygamma_refl_data *d)
+{
+  float64x2_t r = vsubq_f64 (x, vrndaq_f64 (x));
+  float64x2_t s = v_polygamma_sinpi (r, d);
+  /* cos(pi r) = sin(pi (1/2 - |r|)), the subtraction is exact.  */
+  float64x2_t c
+      = v_polygamma_sinpi (vsubq_f64 (v_f64 (0.5), vabsq_f64 (r)), d);
+  c = vfmaq_f64 (vmulq_f64 (c, d->pi_lo), c, d->pi_hi);
+  return vdivq_f64 (c, s);
+}
+
+/* Return pi^2 / sin^2(pi x), the reflection term of trigamma.  Infinite for
+   integer x.  */
+static inline float64x2_t
+v_polygamma_pi2csc2 (float64x2_t x, const struct v_polygamma_refl_data *d)
+{
+  float64x2_t s = v_polygamma_sinpi (vsubq_f64 (x, vrndaq_f64 (x)), d);
+  return vdivq_f64 (v_f64 (1.0), vmulq_f64 (s, s));
+}
+
+/* Add sum_{k=0}^{n-1} 1/c_k^p to the fraction a/b, with c_k = t + off + k,
+   p = 2 if square is set and 1 otherwise.  Lanes can have different n, lanes
+   with n <= 0 or NaN are left unchanged.  Each step rounds both a and b,
+   the terms are accumulated from the smallest one so that the largest term
+   1/c_0^p only sees the rounding of the last step.  t + off + k must be
+   exact for digamma, as 1/c_k is subtracted from larger terms.  */
+static inline float64x2x2_t
+v_polygamma_sum (float64x2_t a, float64x2_t b, float64x2_t t,
+		 float64x2_t off, float64x2_t n, int square)
+{
+  int m = vmaxnmvq_f64 (vmaxnmq_f64 (n, v_f64 (0)));
+  for (int k = m - 1; k >= 0; k--)
+    {
+      float64x2_t kf = v_f64 (k);
+      uint64x2_t active = vcgtq_f64 (n, kf);
+      float64x2_t c = vaddq_f64 (t, vaddq_f64 (off, kf));
+      c = vbslq_f64 (active, c, v_f64 (1.0));
+      if (square)
+	c = vmulq_f64 (c, c);
+      float64x2_t bk = vreinterpretq_f64_u64 (
+	  vandq_u64 (active, vreinterpretq_u64_f64 (b)));
+      a = vfmaq_f64 (bk, a, c);
+      b = vmulq_f64 (b, c);
+    }
+  return (float64x2x2_t){ { a, b } };
+}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Helpers for single-precision vector digamma and trigamma.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_V_POLYGAMMAF_COMMON_H
+#define MATH_V_POLYGAMMAF_COMMON_H
+
+#include "v_math.h"
+#include "v_poly_f32.h"
+
+/* Negative x are reduced to t = 1 - x > 1 with the reflection formulas
+     digamma(x) = digamma(t) - pi cot(pi x),
+     trigamma(x) = -trigamma(t) + pi^2 / sin^2(pi x).
+   sin(pi r) / pi is approximated by r + r^3 S(r^2), r = x - rint(x) in
+   [-1/2, 1/2], so that neither term needs a rounded factor of pi.  */
+struct v_polygammaf_refl_data
+{
+  float32x4_t sinpi_poly[5];
+  float32x4_t pi_hi, pi_lo;
+};
+
+#define V_POLYGAMMAF_REFL_DATA                                                \
+  {                                                                           \
+    .sinpi_poly = { V4 (-0x1.a51a66p+0f), V4 (0x1.9f9cb2p-1f),                \
+		    V4 (-0x1.86a7f8p-3f), V4 (0x1.ac1514p-6f),                \
+		    V4 (-0x1.27943cp-9f) },                                   \
+    .pi_hi = V4 (0x1.921fb6p+1f), .pi_lo = V4 (-0x1.777a5cp-24f),             \
+  }
+
+/* Return sin(pi r) / pi, for |r| <= 1/2.  */
+static inline float32x4_t
+v_polygammaf_sinpi (float32x4_t r, const struct v_polygammaf_refl_data *d)
+{
+  float32x4_t z = vmulq_f32 (r, r);
+  float32x4_t p = vmulq_f32 (z, v_horner_4_f32 (z, d->sinpi_poly));
+  return vfmaq_f32 (r, r, p);
+}
+
+/* Return pi cot(pi x), the reflection term of digamma.  Infinite for
+   integer x.  */
+static inline float32x4_t
+v_polygammaf_picot (float32x4_t x, const struct v_polygammaf_refl_data *d)
+{
+  float32x4_t r = vsubq_f32 (x, vrndaq_f32 (x));
+  float32x4_t s = v_polygammaf_sinpi (r, d);
+  /* cos(pi r) = sin(pi (1/2 - |r|)), the subtraction is exact.  */
+  float32x4_t c
+      = v_polygammaf_sinpi (vsubq_f32 (v_f32 (0.5f), vabsq_f32 (r)), d);
+  c = vfmaq_f32 (vmulq_f32 (c, d->pi_lo), c, d->pi_hi);
+  return vdivq_f32 (c, s);
+}
+
+/* Return pi^2 / sin^2(pi x), the reflection term of trigamma.  Infinite for
+   integer x.  */
+static inline float32x4_t
+v_polygammaf_pi2csc2 (float32x4_t x, const struct v_polygammaf_refl_data *d)
+{
+  float32x4_t s = v_polygammaf_sinpi (vsubq_f32 (x, vrndaq_f32 (x)), d);
+  return vdivq_f32 (v_f32 (1.0f), vmulq_f32 (s, s));
+}
+
+/* Add sum_{k=0}^{n-1} 1/c_k^p to the fraction a/b, with c_k = t + off + k,
+   p = 2 if square is set and 1 otherwise.  Lanes can have different n, lanes
+   with n <= 0 or NaN are left unchanged.  Each step rounds both a and b,
+   the terms are accumulated from the smallest one so that the largest term
+   1/c_0^p only sees the rounding of the last step.  t + off + k must be
+   exact for digamma, as 1/c_k is subtracted from larger terms.  */
+static inline float32x4x2_t
+v_polygammaf_sum (float32x4_t a, float32x4_t b, float32x4_t t,
+		 float32x4_t off, float32x4_t n, int square)
+{
+  int m = vmaxnmvq_f32 (vmaxnmq_f32 (n, v_f32 (0)));
+  for (int k = m - 1; k >= 0; k--)
+    {
+      float32x4_t kf = v_f32 (k);
+      uint32x4_t active = vcgtq_f32 (n, kf);
+      float32x4_t c = vaddq_f32 (t, vaddq_f32 (off, kf));
+      c = vbslq_f32 (active, c, v_f32 (1.0f));
+      if (square)
+	c = vmulq_f32 (c, c);
+      float32x4_t bk = vreinterpretq_f32_u32 (
+	  vandq_u32 (active, vreinterpretq_u32_f32 (b)));
+      a = vfmaq_f32 (bk, a, c);
+      b = vmulq_f32 (b, c);
+    }
+  return (float32x4x2_t){ { a, b } };
+}
+
+#endif
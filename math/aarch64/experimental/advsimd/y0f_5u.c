@@ -0,0 +1,130 @@
+/*
+ * Single-precision vector Bessel function of the second kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_besself_common.h"
+#include "v_logf_inline.h"
+
+static const struct data
+{
+  struct v_besself_asym_data asym;
+  struct v_besself_small_data j0;
+  float32x4_t poly[8], local_poly[9];
+  float32x4_t y01_hi, y01_lo, local_lo, local_hi;
+  float32x4_t tpi, ln2_23;
+  struct v_logf_data logf_consts;
+} data = {
+  .asym = V_BESSELF_ASYM0_DATA,
+  .j0 = V_BESSELF_J0_SMALL_DATA,
+  /* U(x^2) = Y0(x) - 2/pi log(x) J0(x), even and analytic.  */
+  .poly = { V4 (-0x1.2e4d6ap-4f), V4 (0x1.6bbcb6p-3f), V4 (-0x1.075b46p-6f),
+	    V4 (0x1.1a684ep-11f), V4 (-0x1.3f8dfcp-17f), V4 (0x1.e4b5fp-24f),
+	    V4 (-0x1.3d0eeep-29f), V4 (0x1.d2963cp-34f) },
+  /* Y0(x) = t G(t) in [0.625, 1.125), with t = x - y01 and y01 the first zero
+     of Y0.  */
+  .local_poly = { V4 (0x1.c24372p-1f), V4 (-0x1.f7e384p-2f),
+		  V4 (0x1.c3af0cp-3f), V4 (-0x1.cf237cp-3f),
+		  V4 (0x1.c10b64p-3f), V4 (-0x1.a11bdep-3f),
+		  V4 (0x1.8200e2p-3f), V4 (-0x1.c4deep-3f),
+		  V4 (0x1.256c96p-2f) },
+  .y01_hi = V4 (0x1.c982ecp-1f),
+  .y01_lo = V4 (-0x1.cafa06p-27f),
+  .local_lo = V4 (0.625f),
+  .local_hi = V4 (1.125f),
+  .tpi = V4 (0x1.45f306p-1f),
+  .ln2_23 = V4 (0x1.fe2804p+3f), /* 23 * ln2.  */
+  .logf_consts = V_LOGF_CONSTANTS,
+};
+
+#define TinyBound 0x1p-126f
+
+/* Handle x <= 0, which returns -inf for 0 and NaN otherwise, and subnormal x
+   for which log is computed on x * 2^23.  */
+static float32x4_t NOINLINE VPCS_ATTR
+special_case (float32x4_t x, float32x4_t y, float32x4_t j0, float32x4_t u,
+	      uint32x4_t cmp, const struct data *d)
+{
+  uint32x4_t tiny = vcltq_f32 (x, v_f32 (TinyBound));
+  float32x4_t xs = vbslq_f32 (tiny, vmulq_f32 (x, v_f32 (0x1p23f)), x);
+  float32x4_t logx = v_logf_inline (xs, &d->logf_consts);
+  logx = vbslq_f32 (tiny, vsubq_f32 (logx, d->ln2_23), logx);
+  float32x4_t ys = vfmaq_f32 (u, vmulq_f32 (d->tpi, logx), j0);
+  float32x4_t yneg = vbslq_f32 (vceqzq_f32 (x), v_f32 (-INFINITY),
+				v_f32 (__builtin_nanf ("")));
+  ys = vbslq_f32 (vclezq_f32 (x), yneg, ys);
+  return vbslq_f32 (cmp, ys, y);
+}
+
+/* Y0(x) = 2/pi log(x) J0(x) + U(x^2).  */
+static inline float32x4_t
+y0_small (float32x4_t x, const struct data *d)
+{
+  float32x4_t z = vmulq_f32 (x, x);
+  float32x4_t j0 = v_besself_small (x, z, &d->j0);
+  float32x4_t u = v_horner_7_f32 (z, d->poly);
+  float32x4_t logx = v_logf_inline (x, &d->logf_consts);
+  float32x4_t y = vfmaq_f32 (u, vmulq_f32 (d->tpi, logx), j0);
+
+  /* Around the first zero, the absolute error of the sum above is too large
+     relative to Y0(x).  */
+  uint32x4_t local
+      = vandq_u32 (vcgeq_f32 (x, d->local_lo), vcltq_f32 (x, d->local_hi));
+  if (unlikely (v_any_u32 (local)))
+    {
+      float32x4_t t = vsubq_f32 (vsubq_f32 (x, d->y01_hi), d->y01_lo);
+      float32x4_t g = vmulq_f32 (t, v_horner_8_f32 (t, d->local_poly));
+      y = vbslq_f32 (local, g, y);
+    }
+
+  uint32x4_t cmp = vcltq_f32 (x, v_f32 (TinyBound));
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, j0, u, cmp, d);
+  return y;
+}
+
+/* Vector implementation of Y0, the Bessel function of the second kind of
+   order 0.  x < 2 uses a log-decomposition with polynomials in x^2, and a
+   polynomial in x - y01 around the first zero y01, above that the
+   phase-amplitude form is evaluated with the sincosf core, see
+   v_besself_common.h.  Relative error is unbounded around the other zeros as
+   the phase is only accurate in absolute terms, the error grows like
+   1/|x - zero|.  Away from zeros by at least 1/16, the maximum observed error
+   is 4.76 ULP:
+   _ZGVnN4v_y0f(0x1.e7b9dap+1) got 0x1.ed49ap-5
+			      want 0x1.ed49aap-5.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (y0) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32x4_t asym = vcgeq_f32 (x, v_f32 (AsymBound));
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  if (!v_any_u32 (asym))
+    return y0_small (x, d);
+
+  float32x4_t y = v_besself_asym (x, 3, &d->asym);
+  if (v_any_u32 (vmvnq_u32 (asym)))
+    return vbslq_f32 (asym, y, y0_small (x, d));
+  return y;
+}
+
+HALF_WIDTH_ALIAS_F1 (y0)
+
+TEST_SIG (V, F, 1, y0, 0.01, 10.0)
+TEST_ULP (V_NAME_F1 (y0), 4.26)
+/* Errors are only bounded away from the zeros of Y0 above the first one, test
+   in between.  */
+TEST_INTERVAL (V_NAME_F1 (y0), 0, 0x1p-126, 1000)
+TEST_INTERVAL (V_NAME_F1 (y0), 0x1p-126, 3.89, 100000)
+TEST_INTERVAL (V_NAME_F1 (y0), 4.03, 7.02, 100000)
+TEST_INTERVAL (V_NAME_F1 (y0), 4091.21, 4094.21, 10000)
+TEST_INTERVAL (V_NAME_F1 (y0), 524285.54, 524288.55, 1000)
+TEST_INTERVAL (V_NAME_F1 (y0), 2097149.04, 2097152.04, 1000)
+TEST_INTERVAL (V_NAME_F1 (y0), inf, inf, 1)
+TEST_INTERVAL (V_NAME_F1 (y0), -0, -inf, 1000)
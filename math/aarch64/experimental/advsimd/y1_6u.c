@@ -0,0 +1,182 @@
+/*
+ * Double-precision vector Bessel function of the second kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_bessel_common.h"
+
+#define V_LOG_INLINE_POLY_ORDER 5
+#include "v_log_inline.h"
+
+#define NQ 17
+
+static const struct data
+{
+  struct v_bessel_asym_data asym;
+  struct v_bessel_small_data j1;
+  float64x2_t poly[11], local_poly[12];
+  float64x2_t y11_hi, y11_lo, local_lo;
+  float64x2_t tpi;
+  struct v_log_inline_data log_consts;
+  double mid[6][20];
+} data = {
+  .asym = V_BESSEL_ASYM1_DATA,
+  .j1 = V_BESSEL_J1_SMALL_DATA,
+  /* x U(x^2) = Y1(x) - 2/pi (log(x) J1(x) - 1/x), odd and analytic.  */
+  .poly = { V2 (-0x1.91866143cbc8ap-3), V2 (0x1.bd3975c75b493p-5),
+	    V2 (-0x1.835b97894b79cp-9), V2 (0x1.2c7dbffcbd507p-14),
+	    V2 (-0x1.0a780abc2af89p-20), V2 (0x1.32e5a040d5ce5p-27),
+	    V2 (-0x1.f0cbd7dcf0418p-35), V2 (0x1.29ec3f9b249b9p-42),
+	    V2 (-0x1.010aa3a64d6ep-50), V2 (-0x1.5c320fe1ea9b2p-58),
+	    V2 (0x1.9cddf494e19b2p-62) },
+  /* Y1(x) = t G(t) in [1.75, 2), with t = x - y11 and y11 the first zero of
+     Y1.  */
+  .local_poly = { V2 (0x1.0aa48442791a8p-1), V2 (-0x1.e56f82b60fe2p-4),
+		  V2 (-0x1.0d2b09f64a65dp-5), V2 (-0x1.3a7513e9dd49ep-8),
+		  V2 (0x1.e63dd788a6e7dp-8), V2 (-0x1.563b62c39d47cp-9),
+		  V2 (0x1.08834874d42adp-10), V2 (-0x1.5b5835dfa77a4p-11),
+		  V2 (-0x1.b5e9a24845ef5p-15), V2 (-0x1.f7e162006dcb6p-12),
+		  V2 (-0x1.0d4f3a4c0d216p-12), V2 (-0x1.41dcbbb3d052fp-13) },
+  .y11_hi = V2 (0x1.193bed4dff243p+1),
+  .y11_lo = V2 (-0x1.bd1e50d219bfdp-55),
+  .local_lo = V2 (1.75),
+  .tpi = V2 (0x1.45f306dc9c883p-1),
+  .log_consts = V_LOG_CONSTANTS,
+  .mid = {
+	  { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x1.0aa48442f014bp-1,
+	    -0x1.e56f82217b8fp-4, -0x1.0d2af4e932759p-5, -0x1.3a6dec3726cf8p-8,
+	    0x1.e671c7d1e376bp-8, -0x1.5429dc5f7ffabp-9, 0x1.17ab4a7fa85f6p-10,
+	    -0x1.0b2d81d5c28f1p-11, 0x1.eea7d9210df73p-13,
+	    -0x1.c3ff0b0437dfap-14, 0x1.9d2b712f624dap-15,
+	    -0x1.791dfbd3516b7p-16, 0x1.541e49298e1b8p-17,
+	    -0x1.22d90ac54d045p-18, 0x1.aae45a5cdd188p-20,
+	    -0x1.c262ea61763d5p-22, 0x1.e3f92661c9d83p-25, 0 },
+	  { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x1.0aa4834f718fep-1,
+	    -0x1.e56f1fc925d04p-4, -0x1.0d2f9829b0969p-5,
+	    -0x1.39e2ea365fffcp-8, 0x1.e5074b1cc33b1p-8, -0x1.4eb2dd42ac832p-9,
+	    0x1.0774f3c69e207p-10, -0x1.ca71d58db6482p-12,
+	    0x1.5f792659db7e7p-13, -0x1.cc3eaf87df10ap-15,
+	    0x1.f14c821d3b8f6p-17, -0x1.a27e3321f6c29p-19,
+	    0x1.fc1ad7b960cd4p-22, -0x1.88f54373b9cf1p-25,
+	    0x1.215bf4873c83ap-29, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556ee3531p-2,
+	    0x1.00b9f86c02831p-5, 0x1.a15d937b49505p-5, -0x1.10a31437dbe77p-8,
+	    -0x1.1be65a3b4a996p-9, 0x1.338d87ec405ap-13, 0x1.86216b4fb659ap-15,
+	    -0x1.7916f612889acp-19, -0x1.0d8516a1ddd12p-21,
+	    0x1.ba93b9f9afbefp-25, 0x1.13f08e96ed368p-26,
+	    0x1.36bb76abcf229p-29, 0x1.74d60e31a7166p-32, 0x0p+0, 0x0p+0,
+	    0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556f0c19ap-2,
+	    0x1.00b9f8571ca2p-5, 0x1.a15d92dfe3f7bp-5, -0x1.10a329e2c2addp-8,
+	    -0x1.1be6db9948c9ep-9, 0x1.337c7e15bca7ep-13,
+	    0x1.85b941560865fp-15, -0x1.80619969b6336p-19,
+	    -0x1.255ef3bc87f48p-21, 0x1.b6465ed916796p-26,
+	    0x1.812adb1b2a16fp-28, -0x1.b707df9252db6p-32,
+	    0x1.ef39b4c10c93dp-39, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556f03e32p-2,
+	    0x1.00b9f8539af26p-5, 0x1.a15d92f5bbd13p-5, -0x1.10a32c73a1194p-8,
+	    -0x1.1be6ce9e62bcep-9, 0x1.337b093869d55p-13,
+	    0x1.85c0e15773144p-15, -0x1.80d726dcd9b1dp-19,
+	    -0x1.2412ca82a0654p-21, 0x1.a155189629649p-26,
+	    0x1.9cb0d1b1e8959p-28, -0x1.f9dd4d390b8c7p-32,
+	    0x1.0325f10d3af04p-40, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.13127ae6169b4p+3, 0x1.479cc068d9046p-52, 0x1.15f993fce48efp-2,
+	    -0x1.02b3934203a53p-6, -0x1.6395dff3d986p-5, 0x1.3ced26bbdbf56p-9,
+	    0x1.07a67070f4ce3p-9, -0x1.b50f4db66d597p-14,
+	    -0x1.6f80370badb8ep-15, 0x1.172b751c1feacp-19,
+	    0x1.2b39122741bfdp-21, -0x1.ae2b43b0eda05p-26,
+	    -0x1.4f3fb6d20dc6bp-28, 0x1.55ede1f0e9825p-33,
+	    0x1.ec22bcc4859fbp-36, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+  },
+};
+
+#define TinyBound 0x1p-1022
+
+/* For x < TinyBound, Y1(x) rounds to -2/(pi x), which overflows to -inf only
+   when Y1 does, and gives -inf for -0 and 0.  x < 0 returns NaN.  */
+static float64x2_t NOINLINE VPCS_ATTR
+special_case (float64x2_t x, float64x2_t y, uint64x2_t cmp,
+	      const struct data *d)
+{
+  float64x2_t ytiny = vdivq_f64 (vnegq_f64 (d->tpi), vabsq_f64 (x));
+  ytiny = vbslq_f64 (vcltzq_f64 (x), v_f64 (__builtin_nan ("")), ytiny);
+  return vbslq_f64 (cmp, ytiny, y);
+}
+
+/* Y1(x) = 2/pi (log(x) J1(x) - 1/x) + x U(x^2).  */
+static inline float64x2_t
+y1_small (float64x2_t x, const struct data *d)
+{
+  float64x2_t z = vmulq_f64 (x, x);
+  float64x2_t j1 = vmulq_f64 (x, v_bessel_small (x, z, &d->j1));
+  float64x2_t u = vmulq_f64 (x, v_horner_10_f64 (z, d->poly));
+  float64x2_t logx = v_log_inline (x, &d->log_consts);
+  float64x2_t a
+      = vfmaq_f64 (vnegq_f64 (vdivq_f64 (v_f64 (1.0), x)), j1, logx);
+  float64x2_t y = vfmaq_f64 (u, d->tpi, a);
+
+  /* Up to the first zero, the absolute error of the sum above is too large
+     relative to Y1(x).  */
+  uint64x2_t local = vcgeq_f64 (x, d->local_lo);
+  if (unlikely (v_any_u64 (local)))
+    {
+      float64x2_t t = vsubq_f64 (vsubq_f64 (x, d->y11_hi), d->y11_lo);
+      float64x2_t g = vmulq_f64 (t, v_horner_11_f64 (t, d->local_poly));
+      y = vbslq_f64 (local, g, y);
+    }
+
+  uint64x2_t cmp = vcltq_f64 (x, v_f64 (TinyBound));
+  if (unlikely (v_any_u64 (cmp)))
+    return special_case (x, y, cmp, d);
+  return y;
+}
+
+/* Vector implementation of Y1, the Bessel function of the second kind of
+   order 1.  x < 2 uses a log-decomposition with polynomials in x^2, and a
+   polynomial in x - y11 below the first zero y11, [2, 8) uses a polynomial
+   per unit interval with the closest zero factored out, above that the
+   phase-amplitude form is evaluated with the sincos core, see
+   v_bessel_common.h.  Relative error is unbounded around the zeros above 8 as
+   the phase is only accurate in absolute terms, the error grows like
+   1/|x - zero|.  Away from those zeros by at least 1/16, the maximum observed
+   error is 5.59 ULP:
+   _ZGVnN2v_y1(0x1.73bc231351dc3p+3) got 0x1.f9ceb8dfe901cp-6
+				     want 0x1.f9ceb8dfe9016p-6.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (y1) (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  /* NaN is not in the asymptotic region, and propagates through the table
+     region approximation.  */
+  uint64x2_t lt_asym = vcltq_f64 (x, v_f64 (AsymBound));
+  if (!v_any_u64 (lt_asym))
+    return v_bessel_asym (x, 1, 2, &d->asym);
+
+  float64x2_t y = v_bessel_mid (x, &d->mid[0][0], NQ);
+  uint64x2_t small = vcltq_f64 (x, v_f64 (MidBound));
+  if (v_any_u64 (small))
+    y = vbslq_f64 (small, y1_small (x, d), y);
+  uint64x2_t asym = vcgeq_f64 (x, v_f64 (AsymBound));
+  if (v_any_u64 (asym))
+    y = vbslq_f64 (asym, v_bessel_asym (x, 1, 2, &d->asym), y);
+  return y;
+}
+
+TEST_SIG (V, D, 1, y1, 0.01, 10.0)
+TEST_ULP (V_NAME_D1 (y1), 5.09)
+/* Errors are only bounded away from the zeros of Y1 above 8, test in
+   between.  */
+TEST_INTERVAL (V_NAME_D1 (y1), 0, 0x1p-1022, 1000)
+TEST_INTERVAL (V_NAME_D1 (y1), 0x1p-1022, 8.53, 100000)
+TEST_INTERVAL (V_NAME_D1 (y1), 8.66, 11.68, 100000)
+TEST_INTERVAL (V_NAME_D1 (y1), 4092.78, 4095.78, 10000)
+TEST_INTERVAL (V_NAME_D1 (y1), 8388601.45, 8388604.45, 10000)
+TEST_INTERVAL (V_NAME_D1 (y1), 8388610.87, 8388613.88, 10000)
+TEST_INTERVAL (V_NAME_D1 (y1), 10000000002.93, 10000000005.94, 10000)
+TEST_INTERVAL (V_NAME_D1 (y1), inf, inf, 1)
+TEST_INTERVAL (V_NAME_D1 (y1), -0, -inf, 1000)
@@ -0,0 +1,121 @@
+/*
+ * Single-precision vector Bessel function of the second kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "v_besself_common.h"
+#include "v_logf_inline.h"
+
+static const struct data
+{
+  struct v_besself_asym_data asym;
+  struct v_besself_small_data j1;
+  float32x4_t poly[8], local_poly[6];
+  float32x4_t y11_hi, y11_lo, local_lo;
+  float32x4_t tpi;
+  struct v_logf_data logf_consts;
+} data = {
+  .asym = V_BESSELF_ASYM1_DATA,
+  .j1 = V_BESSELF_J1_SMALL_DATA,
+  /* x U(x^2) = Y1(x) - 2/pi (log(x) J1(x) - 1/x), odd and analytic.  */
+  .poly = { V4 (-0x1.918662p-3f), V4 (0x1.bd3992p-5f), V4 (-0x1.83606ap-9f),
+	    V4 (0x1.2d36c4p-14f), V4 (-0x1.26ddd2p-20f), V4 (0x1.7717f8p-25f),
+	    V4 (-0x1.92aaa6p-28f), V4 (0x1.aa7256p-32f) },
+  /* Y1(x) = t G(t) in [1.75, 2), with t = x - y11 and y11 the first zero of
+     Y1.  */
+  .local_poly = { V4 (0x1.0aa43p-1f), V4 (-0x1.e5a39p-4f),
+		  V4 (-0x1.106d94p-5f), V4 (-0x1.a63396p-8f),
+		  V4 (0x1.f0c238p-9f), V4 (-0x1.a6b44ep-8f) },
+  .y11_hi = V4 (0x1.193beep+1f),
+  .y11_lo = V4 (-0x1.6401b8p-24f),
+  .local_lo = V4 (1.75f),
+  .tpi = V4 (0x1.45f306p-1f),
+  .logf_consts = V_LOGF_CONSTANTS,
+};
+
+#define TinyBound 0x1p-126f
+
+/* For x < TinyBound, Y1(x) rounds to -2/(pi x), which overflows to -inf only
+   when Y1 does, and gives -inf for -0 and 0.  x < 0 returns NaN.  */
+static float32x4_t NOINLINE VPCS_ATTR
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp,
+	      const struct data *d)
+{
+  float32x4_t ytiny = vdivq_f32 (vnegq_f32 (d->tpi), vabsq_f32 (x));
+  ytiny = vbslq_f32 (vcltzq_f32 (x), v_f32 (__builtin_nanf ("")), ytiny);
+  return vbslq_f32 (cmp, ytiny, y);
+}
+
+/* Y1(x) = 2/pi (log(x) J1(x) - 1/x) + x U(x^2).  */
+static inline float32x4_t
+y1_small (float32x4_t x, const struct data *d)
+{
+  float32x4_t z = vmulq_f32 (x, x);
+  float32x4_t j1 = vmulq_f32 (x, v_besself_small (x, z, &d->j1));
+  float32x4_t u = vmulq_f32 (x, v_horner_7_f32 (z, d->poly));
+  float32x4_t logx = v_logf_inline (x, &d->logf_consts);
+  float32x4_t a
+      = vfmaq_f32 (vnegq_f32 (vdivq_f32 (v_f32 (1.0f), x)), j1, logx);
+  float32x4_t y = vfmaq_f32 (u, d->tpi, a);
+
+  /* Up to the first zero, the absolute error of the sum above is too large
+     relative to Y1(x).  */
+  uint32x4_t local = vcgeq_f32 (x, d->local_lo);
+  if (unlikely (v_any_u32 (local)))
+    {
+      float32x4_t t = vsubq_f32 (vsubq_f32 (x, d->y11_hi), d->y11_lo);
+      float32x4_t g = vmulq_f32 (t, v_horner_5_f32 (t, d->local_poly));
+      y = vbslq_f32 (local, g, y);
+    }
+
+  uint32x4_t cmp = vcltq_f32 (x, v_f32 (TinyBound));
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, cmp, d);
+  return y;
+}
+
+/* Vector implementation of Y1, the Bessel function of the second kind of
+   order 1.  x < 2 uses a log-decomposition with polynomials in x^2, and a
+   polynomial in x - y11 below the first zero y11, above that the
+   phase-amplitude form is evaluated with the sincosf core, see
+   v_besself_common.h.  Relative error is unbounded around the other zeros as
+   the phase is only accurate in absolute terms, the error grows like
+   1/|x - zero|.  Away from zeros by at least 1/16, the maximum observed error
+   is 5.66 ULP:
+   _ZGVnN4v_y1f(0x1.0c9b84p+1) got -0x1.ae0ae4p-5
+			      want -0x1.ae0ad8p-5.  */
+float32x4_t VPCS_ATTR NOINLINE V_NAME_F1 (y1) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint32x4_t asym = vcgeq_f32 (x, v_f32 (AsymBound));
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  if (!v_any_u32 (asym))
+    return y1_small (x, d);
+
+  float32x4_t y = v_besself_asym (x, 2, &d->asym);
+  if (v_any_u32 (vmvnq_u32 (asym)))
+    return vbslq_f32 (asym, y, y1_small (x, d));
+  return y;
+}
+
+HALF_WIDTH_ALIAS_F1 (y1)
+
+TEST_SIG (V, F, 1, y1, 0.01, 10.0)
+TEST_ULP (V_NAME_F1 (y1), 5.17)
+/* Errors are only bounded away from the zeros of Y1, test in between.  */
+TEST_INTERVAL (V_NAME_F1 (y1), 0, 0x1p-126, 1000)
+TEST_INTERVAL (V_NAME_F1 (y1), 0x1p-126, 2.13, 100000)
+TEST_INTERVAL (V_NAME_F1 (y1), 2.27, 5.36, 100000)
+TEST_INTERVAL (V_NAME_F1 (y1), 5.5, 8.53, 100000)
+TEST_INTERVAL (V_NAME_F1 (y1), 4092.78, 4095.78, 10000)
+TEST_INTERVAL (V_NAME_F1 (y1), 524287.11, 524290.12, 1000)
+TEST_INTERVAL (V_NAME_F1 (y1), 2097150.61, 2097153.61, 1000)
+TEST_INTERVAL (V_NAME_F1 (y1), inf, inf, 1)
+TEST_INTERVAL (V_NAME_F1 (y1), -0, -inf, 1000)
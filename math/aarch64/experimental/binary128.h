@@ -0,0 +1,122 @@
+/*
+ * Helpers for binary128 long double routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef PL_MATH_BINARY128_H
+#define PL_MATH_BINARY128_H
+
+#include <errno.h>
+#include <float.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#if LDBL_MANT_DIG == 113
+
+/* Arithmetic on binary128 is done in software, so the routines using these
+   helpers keep the number of long double operations low and do integer
+   operations on the representation wherever possible.  */
+
+static inline unsigned __int128
+asuint128 (long double f)
+{
+  union
+  {
+    long double f;
+    unsigned __int128 i;
+  } u = { f };
+  return u.i;
+}
+
+static inline long double
+asldouble (unsigned __int128 i)
+{
+  union
+  {
+    unsigned __int128 i;
+    long double f;
+  } u = { i };
+  return u.f;
+}
+
+/* Top 64 bits of the representation: sign, 15-bit exponent and the top 48
+   bits of the significand.  */
+static inline uint64_t
+top64l (long double x)
+{
+  return asuint128 (x) >> 64;
+}
+
+/* 2^e for -16382 <= e <= 16383.  */
+static inline long double
+exp2il (int64_t e)
+{
+  return asldouble ((unsigned __int128) (e + 0x3fff) << 112);
+}
+
+# if __aarch64__ && __GNUC__
+static inline long double
+opt_barrier_ldouble (long double x)
+{
+  __asm__ __volatile__ ("" : "+w" (x));
+  return x;
+}
+# else
+static inline long double
+opt_barrier_ldouble (long double x)
+{
+  volatile long double y = x;
+  return y;
+}
+# endif
+
+/* Overflow and underflow results with the sign of SIGN, see __math_oflow and
+   __math_uflow.  */
+static inline long double
+math_xflowl (uint32_t sign, long double y)
+{
+  y = opt_barrier_ldouble (sign ? -y : y) * y;
+# if WANT_ERRNO
+  errno = ERANGE;
+# endif
+  return y;
+}
+
+static inline long double
+math_oflowl (uint32_t sign)
+{
+  return math_xflowl (sign, 0x1p16383L);
+}
+
+static inline long double
+math_uflowl (uint32_t sign)
+{
+  return math_xflowl (sign, 0x1p-16382L);
+}
+
+static inline long double
+math_divzerol (uint32_t sign)
+{
+  long double y = opt_barrier_ldouble (sign ? -1.0L : 1.0L) / 0.0L;
+# if WANT_ERRNO
+  errno = ERANGE;
+# endif
+  return y;
+}
+
+static inline long double
+math_invalidl (long double x)
+{
+  long double y = (x - x) / (x - x);
+# if WANT_ERRNO
+  if (!isnan (x))
+    errno = EDOM;
+# endif
+  return y;
+}
+
+#endif /* LDBL_MANT_DIG == 113.  */
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * Helpers for double-precision exp, log and pow with double-double results.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef PL_MATH_DD_INLINE_H
+#define PL_MATH_DD_INLINE_H
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "pow_common.h"
+
+/* The log core is the one of pow, see pow.c.  */
+#define LogT __pow_log_data.tab
+#define A __pow_log_data.poly
+#define Ln2hi __pow_log_data.ln2hi
+#define Ln2lo __pow_log_data.ln2lo
+#define LogN (1 << POW_LOG_TABLE_BITS)
+#define LogOff 0x3fe6955500000000
+
+/* The exp core is the one of exp, see exp.c.  */
+#define ExpN (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define ExpT __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+#define C6 __exp_data.poly[9 - EXP_POLY_ORDER]
+
+#define SIGN_BIAS (0x800 << EXP_TABLE_BITS)
+
+/* Compute y+TAIL = log(x) where the rounded result is y and TAIL has about
+   additional 15 bits precision.  IX is the bit representation of x, but
+   normalized in the subnormal range using the sign bit for the exponent.
+   Relative error of y+TAIL is below 1.3 * 2^-68.  */
+static inline double
+log_dd_inline (uint64_t ix, double *tail)
+{
+  double z, r, y, invc, logc, logctail, kd, hi, t1, t2, lo, lo1, lo2, p;
+  uint64_t iz, tmp;
+  int k, i;
+
+  /* x = 2^k z; where z is in range [LogOff,2*LogOff) and exact.
+     The range is split into N subintervals.
+     The ith subinterval contains z and c is near its center.  */
+  tmp = ix - LogOff;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) % LogN;
+  k = (int64_t) tmp >> 52; /* arithmetic shift.  */
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = asdouble (iz);
+  kd = (double) k;
+
+  /* log(x) = k*Ln2 + log(c) + log1p(z/c-1).  */
+  invc = LogT[i].invc;
+  logc = LogT[i].logc;
+  logctail = LogT[i].logctail;
+
+  /* Note: 1/c is j/N or j/N/2 where j is an integer in [N,2N) and
+     |z/c - 1| < 1/N, so r = z/c - 1 is exactly representible.  */
+  r = fma (z, invc, -1.0);
+
+  /* k*Ln2 + log(c) + r.  */
+  t1 = kd * Ln2hi + logc;
+  t2 = t1 + r;
+  lo1 = kd * Ln2lo + logctail;
+  lo2 = t1 - t2 + r;
+
+  /* Evaluation is optimized assuming superscalar pipelined execution.  */
+  double ar, ar2, ar3, lo3, lo4;
+  ar = A[0] * r; /* A[0] = -0.5.  */
+  ar2 = r * ar;
+  ar3 = r * ar2;
+  /* k*Ln2 + log(c) + r + A[0]*r*r.  */
+  hi = t2 + ar2;
+  lo3 = fma (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+  /* p = log1p(r) - r - A[0]*r*r.  */
+  p = (ar3
+       * (A[1] + r * A[2]
+	  + ar2 * (A[3] + r * A[4] + ar2 * (A[5] + r * A[6]))));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+/* Return SCALE * (1 + RHI + TMP) rounded, with the rounding error in *TAIL,
+   for |RHI| < 2^-8 and |TMP| < 2^-16.  1 + RHI is computed exactly, so the
+   error of the sum is that of TMP, about 2^-69.  */
+static inline double
+exp_dd_scale (double scale, double rhi, double tmp, double *tail)
+{
+  double one_r = 1.0 + rhi;
+  double one_r_lo = 1.0 - one_r + rhi + tmp;
+  double hi = scale * one_r;
+  double lo = fma (scale, one_r, -hi) + scale * one_r_lo;
+  double y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+/* Handle cases that may overflow or underflow when computing the result that
+   is scale*(1+RHI+TMP), see specialcase in pow.c.  The tail is scaled with the
+   result, so it loses precision if the result is below 2^-969, and is 0 if the
+   result is subnormal, infinite or zero.  */
+static inline double
+exp_dd_specialcase (double rhi, double tmp, uint64_t sbits, uint64_t ki,
+		    double *tail)
+{
+  double scale, y, lo;
+
+  if ((ki & 0x80000000) == 0)
+    {
+      /* k > 0, the exponent of scale might have overflowed by <= 460.  */
+      sbits -= 1009ull << 52;
+      scale = asdouble (sbits);
+      y = exp_dd_scale (scale, rhi, tmp, &lo);
+      y = check_oflow (eval_as_double (y * 0x1p1009));
+      *tail = isinf (y) ? 0.0 : lo * 0x1p1009;
+      return y;
+    }
+  /* k < 0, need special care in the subnormal range.  */
+  sbits += 1022ull << 52;
+  /* Note: sbits is signed scale.  */
+  scale = asdouble (sbits);
+  y = exp_dd_scale (scale, rhi, tmp, &lo);
+  if (fabs (y) < 1.0)
+    {
+      /* Round y to the right precision before scaling it into the subnormal
+	 range to avoid double rounding, the tail is below the subnormal
+	 precision.  */
+      double hi, one = 1.0;
+      if (y < 0.0)
+	one = -1.0;
+      hi = one + y;
+      lo = one - hi + y + lo;
+      y = eval_as_double (hi + lo) - one;
+      /* Fix the sign of 0.  */
+      if (y == 0.0)
+	y = asdouble (sbits & 0x8000000000000000);
+      /* The underflow exception needs to be signaled explicitly.  */
+      force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+      *tail = 0.0;
+    }
+  else
+    *tail = 0x1p-1022 * lo;
+  y = 0x1p-1022 * y;
+  return check_uflow (eval_as_double (y));
+}
+
+/* Computes sign*exp(x+xtail) as y + *TAIL where |xtail| < 2^-8/N and
+   |xtail| <= |x|.  The sign_bias argument is SIGN_BIAS or 0 and sets the sign
+   to -1 or 1.  Unlike exp_inline in pow.c, x - k ln2hi/N is kept exact and
+   added to 1 without rounding, so the relative error of y + *TAIL is that of
+   the polynomial and the remaining rounding errors, below 2^-65.  */
+static inline double
+exp_dd_inline (double x, double xtail, uint32_t sign_bias, double *tail)
+{
+  uint32_t abstop;
+  uint64_t ki, idx, top, sbits;
+  double kd, z, r, rhi, rlo, r2, scale, t, tmp;
+
+  abstop = top12 (x) & 0x7ff;
+  if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
+    {
+      if (abstop - top12 (0x1p-54) >= 0x80000000)
+	{
+	  /* exp(x+xtail) = 1 + x + xtail with error below 2^-108.  */
+	  /* Note: 0 is common input.  */
+	  double one = WANT_ROUNDING ? 1.0 + x : 1.0;
+	  double lo = 1.0 - one + x + xtail;
+	  *tail = sign_bias ? -lo : lo;
+	  return sign_bias ? -one : one;
+	}
+      *tail = 0.0;
+      if (abstop >= top12 (1024.0))
+	{
+	  if (asuint64 (x) == asuint64 (-INFINITY))
+	    return 0.0;
+	  if (abstop >= top12 (INFINITY))
+	    return 1.0 + x;
+	  if (asuint64 (x) >> 63)
+	    return __math_uflow (sign_bias);
+	  else
+	    return __math_oflow (sign_bias);
+	}
+      /* Large x is special cased below.  */
+      abstop = 0;
+    }
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  /* x = ln2/N*k + r, with int k and r in [-ln2/2N, ln2/2N].  */
+  z = InvLn2N * x;
+#if TOINT_INTRINSICS
+  kd = roundtoint (z);
+  ki = converttoint (z);
+#elif EXP_USE_TOINT_NARROW
+  /* z - kd is in [-0.5-2^-16, 0.5] in all rounding modes.  */
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd) >> 16;
+  kd = (double) (int32_t) ki;
+#else
+  /* z - kd is in [-1, 1] in non-nearest rounding modes.  */
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+#endif
+  /* r = rhi + rlo, rhi is exact since kd*NegLn2hiN is exact and close to
+     -x.  */
+  rhi = fma (kd, NegLn2hiN, x);
+  rlo = kd * NegLn2loN + xtail;
+  r = rhi + rlo;
+  /* 2^(k/N) ~= scale * (1 + t).  */
+  idx = 2 * (ki % ExpN);
+  top = (ki + sign_bias) << (52 - EXP_TABLE_BITS);
+  t = asdouble (ExpT[idx]);
+  /* This is only a valid scale when -1023*N < k < 1024*N.  */
+  sbits = ExpT[idx + 1] + top;
+  /* exp(x) = 2^(k/N) * exp(r) ~= scale * (1 + rhi + tmp), where
+     tmp = t (1 + r) + rlo + exp(r) - 1 - r.  */
+  r2 = r * r;
+#if EXP_POLY_ORDER == 4
+  tmp = t + t * r + rlo + r2 * C2 + r * r2 * (C3 + r * C4);
+#elif EXP_POLY_ORDER == 5
+  tmp = t + t * r + rlo + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+#elif EXP_POLY_ORDER == 6
+  tmp = t + t * r + rlo + r2 * (0.5 + r * C3)
+	+ r2 * r2 * (C4 + r * C5 + r2 * C6);
+#endif
+  if (unlikely (abstop == 0))
+    return exp_dd_specialcase (rhi, tmp, sbits, ki, tail);
+  scale = asdouble (sbits);
+  return exp_dd_scale (scale, rhi, tmp, tail);
+}
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Double-precision e^x function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "test_defs.h"
+#include "dd_inline.h"
+
+/* Return y and set *tail such that y + *tail approximates e^x, y is e^x
+   rounded as by exp and *tail is the rounding error, |*tail| <= ulp(y)/2.
+   The cost is about that of exp: the tail of 2^(k/N) in the table and the
+   low part of the reduced argument are kept instead of being rounded into
+   the result.
+   Maximum relative error of y + *tail is 2^-65.2 for results above 2^-969,
+   below that the tail loses precision and it is 0 for subnormal results:
+   arm_math_exp_dd (0x1.cf6b21405582ep+4)
+     got 0x1.b95508bad43d8p+41 + 0x1.6279p-13
+    want 0x1.b95508bad43d8p+41 + 0x1.624a9dfe99997p-13.
+   Maximum error of y alone is 0.501 ULP.  */
+double
+arm_math_exp_dd (double x, double *tail)
+{
+  return exp_dd_inline (x, 0, 0, tail);
+}
+
+TEST_ULP (arm_math_exp_dd, 0.01)
+TEST_ULP_NONNEAREST (arm_math_exp_dd, 0.5)
+TEST_INTERVAL (arm_math_exp_dd, 0, 0xffff000000000000, 10000)
+TEST_SYM_INTERVAL (arm_math_exp_dd, 0x1p-6, 0x1p6, 400000)
+TEST_SYM_INTERVAL (arm_math_exp_dd, 633.3, 733.3, 10000)
@@ -0,0 +1,38 @@
+/*
+ * Constants shared by the reproducible single-precision e^x routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_EXPF_REPRO_H
+#define MATH_EXPF_REPRO_H
+
+/* The scalar, AdvSIMD and SVE variants of expf_repro are bit-identical in all
+   rounding modes. They only use correctly-rounded operations (add, fma,
+   integer arithmetic), in the same order and with the same constants. Do not
+   change one without the others: runulp.sh checks the vector variants against
+   the scalar one with zero tolerance.
+
+   exp(x) = 2^n * (1 + poly(r)), with x = n*ln2 + r and |r| <= ln2/2.
+   n = round(x/ln2) is obtained from z = x*InvLn2 + Shift, whose low mantissa
+   bits also hold n, so that 2^n can be applied by adding asuint(z) << 23 to
+   the result.
+   poly is evaluated with Horner's scheme, highest-order coefficient first:
+   1 + poly(r) = 1 + r*(C4 + r*(C3 + r*(C2 + r*(C1 + r*C0)))).  */
+#define ExpfReproInvLn2 0x1.715476p+0f
+#define ExpfReproShift 0x1.8p23f
+#define ExpfReproLn2hi 0x1.62e4p-1f
+#define ExpfReproLn2lo 0x1.7f7d1cp-20f
+#define ExpfReproC0 0x1.0e4020p-7f
+#define ExpfReproC1 0x1.573e2ep-5f
+#define ExpfReproC2 0x1.555e66p-3f
+#define ExpfReproC3 0x1.fffdb6p-2f
+#define ExpfReproC4 0x1.ffffecp-1f
+
+/* asuint(86.0f). Inputs with larger absolute value (including inf and nan)
+   are handled by the scalar routine. The vector variants must select exactly
+   these lanes, or the 2^n scaling by integer addition may overflow.  */
+#define ExpfReproThres 0x42ac0000
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Reproducible single-precision e^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "math_config.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "aarch64/experimental/expf_repro.h"
+
+/* 1 + poly(r), see expf_repro.h. Sets *z such that asuint(*z) << 23 is the
+   exponent of the scale 2^n.  */
+static inline float
+expf_repro_core (float x, float *z)
+{
+  *z = fmaf (x, ExpfReproInvLn2, ExpfReproShift);
+  float n = *z - ExpfReproShift;
+  float r = fmaf (-n, ExpfReproLn2hi, x);
+  r = fmaf (-n, ExpfReproLn2lo, r);
+  float p = fmaf (ExpfReproC0, r, ExpfReproC1);
+  p = fmaf (p, r, ExpfReproC2);
+  p = fmaf (p, r, ExpfReproC3);
+  p = fmaf (p, r, ExpfReproC4);
+  return fmaf (p, r, 1.0f);
+}
+
+static NOINLINE float
+specialcase (float x)
+{
+  if ((asuint (x) & 0x7fffffff) >= 0x7f800000)
+    return x == -INFINITY ? 0.0f : x + x;
+  if (x > 0x1.62e42ep6f)
+    return __math_oflowf (0);
+  if (x < -0x1.9fe368p6f)
+    return __math_uflowf (0);
+
+  /* 2^n overflows or is subnormal, scale in double precision: the product is
+     exact so the result is only rounded once.  */
+  float z;
+  float y = expf_repro_core (x, &z);
+  int32_t n = (int32_t) (z - ExpfReproShift);
+  return (double) y * asdouble ((uint64_t) (0x3ff + n) << 52);
+}
+
+/* Single-precision exp, bit-identical to arm_math_advsimd_expf_repro and
+   arm_math_sve_expf_repro. Evaluation order and constants are fixed by
+   expf_repro.h, no table or FEXPA is used.
+   Maximum error is 1.45 +0.5 ULP:
+   arm_math_expf_repro(-0x1.4cb5fep+2) got 0x1.6a0982p-8
+				      want 0x1.6a0986p-8.  */
+float
+arm_math_expf_repro (float x)
+{
+  if (unlikely ((asuint (x) & 0x7fffffff) > ExpfReproThres))
+    return specialcase (x);
+
+  float z;
+  float y = expf_repro_core (x, &z);
+  return asfloat (asuint (y) + (asuint (z) << 23));
+}
+
+TEST_ULP (arm_math_expf_repro, 1.46)
+TEST_SYM_INTERVAL (arm_math_expf_repro, 0, 0x1.58p6, 50000)
+TEST_SYM_INTERVAL (arm_math_expf_repro, 0x1.58p6, inf, 50000)
@@ -0,0 +1,293 @@
+/*
+ * Data for binary128 e^x and e^x - 1 functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <float.h>
+#include "math_config.h"
+
+#if LDBL_MANT_DIG == 113
+
+const struct expl_data __expl_data = {
+  .invln2N = 0x1.71547652b82fep+8,
+  .shift = 0x1.8p52,
+  /* ln2/N split so that k ln2hiN is exact for |k| < 2^23.  */
+  .ln2hiN = 0x1.62e42fefa39ef35793c767p-9L,
+  .ln2loN = 0x1.803f2f6af40f3p-100,
+  /* Taylor coefficients 1/n!.  Up to order 10 the truncation error is below
+     2^-128 for |r| < ln2/2N, and up to order 13 it is below 2^-127 for
+     |r| < 2^-7.  */
+  .poly = { 0x1p-1L, 0x1.5555555555555555555555555555p-3L,
+	    0x1.5555555555555555555555555555p-5L,
+	    0x1.1111111111111111111111111111p-7L,
+	    0x1.6c16c16c16c16c16c16c16c16c16p-10L,
+	    0x1.a01a01a01a01a01a01a01a01a01ap-13L,
+	    0x1.a01a01a01a01a01a01a01a01a01ap-16L },
+  .dpoly = { 0x1.6c16c16c16c17p-10, 0x1.a01a01a01a01ap-13,
+	     0x1.a01a01a01a01ap-16, 0x1.71de3a556c734p-19,
+	     0x1.27e4fb7789f5cp-22, 0x1.ae64567f544e4p-26,
+	     0x1.1eed8eff8d898p-29, 0x1.6124613a86d09p-33 },
+  /* 2^(i/N) split into hi + lo, for i in [0, N), lo is rounded to 53 bits.  */
+  .tab = {
+    { 0x1p+0L, 0x0p+0L },
+    { 0x1.00b1afa5abcbed6129ab13ec11ddp+0L, -0x1.aaeea91f9e03dp-114L },
+    { 0x1.0163da9fb33356d84a66ae336dcep+0L, -0x1.6fff04fecf27dp-118L },
+    { 0x1.02168143b0280da819de0756294dp+0L, -0x1.ab05636003d36p-115L },
+    { 0x1.02c9a3e778060ee6f7caca4f7a2ap+0L, -0x1.085b0a3d74d51p-114L },
+    { 0x1.037d42e11bbcc0ab408f756f08d2p+0L, 0x1.313d5abd77e8ep-115L },
+    { 0x1.04315e86e7f84bd738f9a20da47ep+0L, 0x1.bb4102ed2ff01p-114L },
+    { 0x1.04e5f72f654b12986f27541a119p+0L, 0x1.8fb35235407ap-115L },
+    { 0x1.059b0d31585743ae7c548eb68ca4p+0L, 0x1.7fe53e3495f7ep-116L },
+    { 0x1.0650a0e3c1f88a8d212a198f1a54p+0L, -0x1.f520193b36787p-116L },
+    { 0x1.0706b29ddf6ddc6dc403a9d87b28p+0L, -0x1.2f83474f6d539p-116L },
+    { 0x1.07bd42b72a836264668a88b0dffdp+0L, -0x1.2b8d5099366e5p-115L },
+    { 0x1.0874518759bc808c35f25d9427fap+0L, 0x1.5820d96b414ecp-115L },
+    { 0x1.092bdf66607dfa5fe71ffd700bc3p+0L, -0x1.f3b00394e084p-114L },
+    { 0x1.09e3ecac6f3834521e060c584d6bp+0L, 0x1.d2e8b808f69ccp-114L },
+    { 0x1.0a9c79b1f39192ba2d90e7a3a6f2p+0L, -0x1.f1b2ee0447b98p-114L },
+    { 0x1.0b5586cf9890f6298b92b71842aap+0L, -0x1.f26f5bafdd30cp-114L },
+    { 0x1.0c0f145e46c8553e6241b4873bc2p+0L, 0x1.ceb8e2091bc7p-114L },
+    { 0x1.0cc922b7247f7407b705b893dc5fp+0L, -0x1.d54ea6c640744p-114L },
+    { 0x1.0d83b23395deb90fac86f033a57ap+0L, 0x1.69413ed1c7638p-114L },
+    { 0x1.0e3ec32d3d1a2020742e4f8af6a5p+0L, 0x1.4ab12cd62c44ap-114L },
+    { 0x1.0efa55fdfa9c4ad89190eaff7923p+0L, -0x1.2b55c40fc7f01p-114L },
+    { 0x1.0fb66affed31af232091dd8a1426p+0L, 0x1.45382d89ef69ap-114L },
+    { 0x1.1073028d7233e3a8dd62d25fbaa8p+0L, -0x1.51fd496f14b05p-115L },
+    { 0x1.11301d0125b50a4ebbf1aed9318dp+0L, -0x1.53a33b854e991p-116L },
+    { 0x1.11edbab5e2ab58d6eac23f012381p+0L, 0x1.a2a590d812c3cp-115L },
+    { 0x1.12abdc06c31cbfb92bad324d68e3p+0L, -0x1.1b1e84106240dp-117L },
+    { 0x1.136a814f204aaf477b822db91884p+0L, -0x1.b2d8e58b71aafp-114L },
+    { 0x1.1429aaea92ddfb34101943b2586dp+0L, 0x1.844b389bea7afp-120L },
+    { 0x1.14e95934f312dc8dc2f8c8176a94p+0L, 0x1.10094b646e731p-116L },
+    { 0x1.15a98c8a58e512480d573dd5613cp+0L, -0x1.b575279c47393p-118L },
+    { 0x1.166a45471c3c2063c8ee0ba868cap+0L, -0x1.89c84d0305c01p-115L },
+    { 0x1.172b83c7d517adcdf7c8c50eb14ap+0L, 0x1.e480d5427fdf6p-114L },
+    { 0x1.17ed48695bbc0109e3fe2ac5a642p+0L, 0x1.f299d93924209p-116L },
+    { 0x1.18af9388c8de9bbbf70b9a3c2506p+0L, -0x1.b41ff7e8d076fp-115L },
+    { 0x1.1972658375d2f52ab7617c5f820bp+0L, 0x1.4b3c51851cc73p-116L },
+    { 0x1.1a35beb6fcb753cb698f692d1c83p+0L, 0x1.69b0c1c93573fp-114L },
+    { 0x1.1af99f8138a1c5efe1692da49ffbp+0L, -0x1.c2c423bf7bd05p-114L },
+    { 0x1.1bbe084045cd39ab1e72b4427e36p+0L, -0x1.94d2a06e31babp-118L },
+    { 0x1.1c82f95281c6b4025de0043e323ap+0L, -0x1.d6e20725399c7p-116L },
+    { 0x1.1d4873168b9aa7805b8028990f08p+0L, -0x1.59d2f77e46e7ap-114L },
+    { 0x1.1e0e75eb44026a4089fddcd2487p+0L, -0x1.167e059a1c17fp-114L },
+    { 0x1.1ed5022fcd91cb8819ff61121d1ep+0L, 0x1.4134db11d1d32p-114L },
+    { 0x1.1f9c18438ce4c902b6d7da1428f4p+0L, 0x1.e4a201f3e790bp-115L },
+    { 0x1.2063b88628cd63b8eeb02950929dp+0L, 0x1.f890fa4385708p-117L },
+    { 0x1.212be3578a8194d64b4b3f2ab23ap+0L, 0x1.9b4bfdf637561p-114L },
+    { 0x1.21f49917ddc962552fd29294bdb5p+0L, -0x1.2785676e20d58p-114L },
+    { 0x1.22bdda27912d13a69f6aaefad3d9p+0L, 0x1.e37ab5ef3e21p-116L },
+    { 0x1.2387a6e75623866c1fadb1c15cb6p+0L, -0x1.b13f35ea65bf5p-114L },
+    { 0x1.2451ffb82140a359f992239532c6p+0L, 0x1.18ed44f1c001cp-116L },
+    { 0x1.251ce4fb2a63f3582ab7de9e9481p+0L, 0x1.a9c8afdcf7969p-116L },
+    { 0x1.25e85711ece754f86892b0c6cb16p+0L, -0x1.164627ddd0cbap-114L },
+    { 0x1.26b4565e27cdd257a673281d3b25p+0L, -0x1.88c6c5b9e488bp-114L },
+    { 0x1.2780e341ddf297819f017e79dae4p+0L, 0x1.5a4188dd63abp-115L },
+    { 0x1.284dfe1f5638096cf15cf03ca096p+0L, 0x1.ff6a8b94b5f2p-114L },
+    { 0x1.291ba7591bb6fda671baf7fc686p+0L, 0x1.7a3902d46e4c4p-114L },
+    { 0x1.29e9df51fdee12c25d15f5a24aa4p+0L, -0x1.0d5dbd4fdcb7fp-114L },
+    { 0x1.2ab8a66d10f129aa2f39ba5bd631p+0L, 0x1.0c940c6240517p-116L },
+    { 0x1.2b87fd0dad98ffddea46538fcab9p+0L, -0x1.eef408f0d2487p-114L },
+    { 0x1.2c57e39771b2eabfae96452bb6e2p+0L, -0x1.22e212e5fea12p-115L },
+    { 0x1.2d285a6e4030b40091d536d07538p+0L, 0x1.162707346cf9p-114L },
+    { 0x1.2df961f641589745b3feef38660dp+0L, 0x1.5b8cf4b9ef007p-114L },
+    { 0x1.2ecafa93e2f5611ca0f45d523834p+0L, -0x1.427b908c976b1p-114L },
+    { 0x1.2f9d24abd886af561d5566a12b6ap+0L, 0x1.43044e3a104c4p-114L },
+    { 0x1.306fe0a31b7152de8d5a46305c86p+0L, -0x1.21343d8cbc9d6p-116L },
+    { 0x1.31432edeeb2fd32b347e7e7f9a13p+0L, 0x1.c629f1c8fc95p-114L },
+    { 0x1.32170fc4cd8313539cf1c3008f87p+0L, -0x1.10e6efa8f43p-115L },
+    { 0x1.32eb83ba8ea318ee85f0d2c339e5p+0L, -0x1.e31ce82262e44p-114L },
+    { 0x1.33c08b26416ff4c9c8610d96696cp+0L, -0x1.a8ba9b3f1ab19p-118L },
+    { 0x1.3496266e3fa2cd94b14d9eefcb7dp+0L, 0x1.c5284ac2499b5p-114L },
+    { 0x1.356c55f929ff0c94623476373af4p+0L, -0x1.ca49ca41abe4ep-114L },
+    { 0x1.36431a2de883ac79d76bf268f45p+0L, -0x1.d13efb71fda6dp-115L },
+    { 0x1.371a7373aa9caa7145502f454798p+0L, 0x1.f8f84945afe72p-114L },
+    { 0x1.37f26231e75499828d584c537103p+0L, -0x1.45cb0940f683dp-114L },
+    { 0x1.38cae6d05d86585a9cb0d9bed0c8p+0L, 0x1.4ef4c2809e425p-114L },
+    { 0x1.39a401b7140ee9959680dc75b2eep+0L, 0x1.c01d45bbd218p-114L },
+    { 0x1.3a7db34e59ff6ea1bc9299e0a1d3p+0L, 0x1.b0b1ff17c2967p-115L },
+    { 0x1.3b57fbfec6cf455319b89bffc61dp+0L, 0x1.a3e2cb8efa004p-114L },
+    { 0x1.3c32dc313a8e484001f228b58f37p+0L, 0x1.d781aad98d4cp-114L },
+    { 0x1.3d0e544ede1731fe8d08c284c71p+0L, 0x1.1ba164ea65915p-115L },
+    { 0x1.3dea64c12342235b41223e13d774p+0L, -0x1.174d1f51f6ef6p-118L },
+    { 0x1.3ec70df1c5174ca133908e6c86bdp+0L, -0x1.bcdef349ba263p-115L },
+    { 0x1.3fa4504ac801ba0bf701aa41833p+0L, -0x1.1cf8dc908034fp-114L },
+    { 0x1.40822c367a02437bbf16de9a0909p+0L, 0x1.1638ea892b9e9p-114L },
+    { 0x1.4160a21f72e29f84325b8f3db62p+0L, -0x1.32b43eafc6518p-114L },
+    { 0x1.423fb270946899ee748fd33ac8aep+0L, 0x1.a93438000c04p-115L },
+    { 0x1.431f5d950a896dc704439410ccedp+0L, -0x1.f876d3cd4022ap-114L },
+    { 0x1.43ffa3f84b9d431017d2e0980053p+0L, 0x1.6d326b6d4e42fp-114L },
+    { 0x1.44e086061892d03136f409df01ap+0L, -0x1.0ac312de3d922p-114L },
+    { 0x1.45c2042a7d231f3cdf33e827038ep+0L, 0x1.e97186e9694dep-114L },
+    { 0x1.46a41ed1d005772512f459229d98p+0L, -0x1.05fd806f0631fp-115L },
+    { 0x1.4786d668b32368f7c3c4aeea3339p+0L, -0x1.6d5f447a76102p-115L },
+    { 0x1.486a2b5c13cd013c1a3b69062f04p+0L, -0x1.e114518bc5404p-115L },
+    { 0x1.494e1e192aed1d89aed436cc2c1p+0L, -0x1.47f489b91ab3p-114L },
+    { 0x1.4a32af0d7d3de672d8bcf46f9586p+0L, 0x1.1876c761e2c74p-114L },
+    { 0x1.4b17dea6db7d6ddb48f01aed0206p+0L, 0x1.2203508f71644p-117L },
+    { 0x1.4bfdad5362a271d4397afec42e21p+0L, -0x1.fc9c45d1ea63bp-116L },
+    { 0x1.4ce41b817c1144178a5a42af5732p+0L, 0x1.a22f79e21e63dp-115L },
+    { 0x1.4dcb299fddd0d63b36ef1a9e0cc5p+0L, -0x1.ed3696aa64bd1p-114L },
+    { 0x1.4eb2d81d8abfeab6a0b468a16b71p+0L, -0x1.dc3968476c86p-115L },
+    { 0x1.4f9b2769d2ca6ad33d8b69aa073fp+0L, -0x1.aa1fd7b685cd6p-116L },
+    { 0x1.508417f4531ee1a249b49b7465ecp+0L, 0x1.7b2541ebdc104p-116L },
+    { 0x1.516daa2cf6641c112f52c84d8222p+0L, -0x1.bc639f767a20ap-114L },
+    { 0x1.5257de83f4eeee36672bc10108ecp+0L, -0x1.2e942ceba3d1p-115L },
+    { 0x1.5342b569d4f81df0a83c49d86a64p+0L, -0x1.6331ab837acffp-117L },
+    { 0x1.542e2f4f6ad272f24da325abefbcp+0L, -0x1.26782ea06ba9cp-114L },
+    { 0x1.551a4ca5d920ec52ec6202434ca6p+0L, 0x1.c991771b04936p-114L },
+    { 0x1.56070dde910d1bc1247a5c450419p+0L, 0x1.129ae575c7165p-116L },
+    { 0x1.56f4736b527da66ecb004764eb3cp+0L, 0x1.e5eb567b003bp-121L },
+    { 0x1.57e27dbe2c4cebd19cdd6a118ee3p+0L, -0x1.cc48fa7d5100bp-115L },
+    { 0x1.58d12d497c7fd252bc2b7343bcf3p+0L, -0x1.36c9568f2633ep-116L },
+    { 0x1.59c0827ff07cba074c46e6067c4fp+0L, -0x1.e711a1c887b59p-114L },
+    { 0x1.5ab07dd48542958c93015191eb34p+0L, 0x1.76235f204a038p-114L },
+    { 0x1.5ba11fba87a0292217acf7307994p+0L, 0x1.db7ec62107ff2p-114L },
+    { 0x1.5c9268a5946b701c4b1b816986a2p+0L, 0x1.ec2735254978cp-119L },
+    { 0x1.5d84590998b928ca5615d2ea6f52p+0L, 0x1.b73fb346dfebdp-114L },
+    { 0x1.5e76f15ad21486e9be4c20399767p+0L, -0x1.7e6add7e9f586p-114L },
+    { 0x1.5f6a320dceb70cc2a44386460dc8p+0L, 0x1.c34df78ee8f1p-114L },
+    { 0x1.605e1b976dc08b076f592a486e3bp+0L, 0x1.a7568da3b4efcp-115L },
+    { 0x1.6152ae6cdf6f4792cf92ae1309bdp+0L, 0x1.2e1acde6d29c1p-114L },
+    { 0x1.6247eb03a5584b1f0fa06fd2da43p+0L, -0x1.138c541823376p-114L },
+    { 0x1.633dd1d1929fd611c42fae593957p+0L, 0x1.710a885eedafbp-115L },
+    { 0x1.6434634ccc31fc76f8714c4ed9a5p+0L, -0x1.befffcf8efc5ep-116L },
+    { 0x1.652b9febc8fb69470a8d96307dd4p+0L, -0x1.2cbabc61f2c55p-119L },
+    { 0x1.66238825522249127d9e29b8f315p+0L, -0x1.73202c8fd7148p-114L },
+    { 0x1.671c1c70833f5c2f19b4f273d99p+0L, -0x1.4c2fe5764bb6ap-114L },
+    { 0x1.68155d44ca973081c57227b9f327p+0L, 0x1.aff93989f6027p-118L },
+    { 0x1.690f4b19e953830097b35d688b94p+0L, -0x1.f1d59179d755p-114L },
+    { 0x1.6a09e667f3bcc908b2fb1366ea95p+0L, 0x1.f4f8eb7b05d45p-114L },
+    { 0x1.6b052fa75173e1a38f52c9a9d0e3p+0L, 0x1.6bba59626d17cp-115L },
+    { 0x1.6c012750bdabeed76a99800f4f34p+0L, -0x1.0a3a78993e778p-119L },
+    { 0x1.6cfdcddd4764571eaa6dbc5cc23dp+0L, -0x1.01964fd2fb3c6p-116L },
+    { 0x1.6dfb23c651a2ef220e2cbe1bbaa8p+0L, 0x1.a59f88abbe778p-115L },
+    { 0x1.6ef9298593ae4bd1a2d8794dd379p+0L, 0x1.724c35d52e707p-114L },
+    { 0x1.6ff7df9519483cf87e1b4f3e213cp+0L, -0x1.923f4a956e21p-122L },
+    { 0x1.70f7466f42e870675913516a997bp+0L, 0x1.31abb85c2eafbp-116L },
+    { 0x1.71f75e8ec5f73dd2370f2ef0acd7p+0L, -0x1.a5e5a54e930bbp-115L },
+    { 0x1.72f8286ead089b7d57f4ca74e374p+0L, -0x1.1bf6fc175f0ddp-114L },
+    { 0x1.73f9a48a58173bd5c9a4e68ab118p+0L, 0x1.5710bf9d3b40cp-115L },
+    { 0x1.74fbd35d7cbfd411ff58629b871bp+0L, 0x1.080cfeb6e411bp-114L },
+    { 0x1.75feb564267c8bf6e9aa33a48b27p+0L, 0x1.c601798685ee5p-118L },
+    { 0x1.77024b1ab6e096de1dc5a451fdfep+0L, 0x1.463a2e184e6cap-116L },
+    { 0x1.780694fde5d3f619ae0280858b2cp+0L, -0x1.3508c1e4cbdc7p-114L },
+    { 0x1.790b938ac1cf64d26a18aab74f7cp+0L, -0x1.6213ac9f7abd4p-115L },
+    { 0x1.7a11473eb0186d7d51023f6cda1fp+0L, 0x1.7bd0ad9a5de58p-114L },
+    { 0x1.7b17b0976cfda905129ee5c8ddf6p+0L, 0x1.f91569e87f268p-114L },
+    { 0x1.7c1ed0130c1327c4933445937563p+0L, -0x1.348db30aec0dfp-114L },
+    { 0x1.7d26a62ff86f046f76fedcae2ce6p+0L, 0x1.2d0a4b5c839d8p-115L },
+    { 0x1.7e2f336cf4e62105d02ba15797e1p+0L, 0x1.c28509fe3f37dp-114L },
+    { 0x1.7f3878491c490df01dc60d9dca49p+0L, -0x1.83d325e92002ap-115L },
+    { 0x1.80427543e1a11b60de67649a354fp+0L, -0x1.63e51c6c9d23ap-114L },
+    { 0x1.814d2add106d95190dc34547535cp+0L, 0x1.a535958749da1p-114L },
+    { 0x1.82589994cce128acf88afab34a01p+0L, 0x1.ed5acb977581fp-117L },
+    { 0x1.8364c1eb941f7666e68c77caf54fp+0L, 0x1.4402ac14822adp-115L },
+    { 0x1.8471a4623c7acce52f6b97c64095p+0L, 0x1.b87a8fa440bc9p-115L },
+    { 0x1.857f4179f5b20f9162dc1d37a4c2p+0L, -0x1.69c64634445bep-114L },
+    { 0x1.868d99b4492ec80e41d90ac2517p+0L, 0x1.d2135cfc4dbedp-114L },
+    { 0x1.879cad931a4362ba5afa5b68f79ap+0L, 0x1.a618f9855b83p-116L },
+    { 0x1.88ac7d98a669966530bcdf2d4e9dp+0L, 0x1.84a0fbce17786p-114L },
+    { 0x1.89bd0a478580f754e5511d480aap+0L, 0x1.38b6e3ff8601cp-119L },
+    { 0x1.8ace5422aa0db5ba7c55a192c9bbp+0L, 0x1.f376b0f939998p-115L },
+    { 0x1.8be05bad617787b2d7bf10d11b9ep+0L, 0x1.3bc6d3d1f9813p-114L },
+    { 0x1.8cf3216b5448bef2aa1cd161c55ep+0L, -0x1.ed59edc1ceeb1p-114L },
+    { 0x1.8e06a5e0866d8a3bad640d934692p+0L, -0x1.74ea8e5c1ae47p-115L },
+    { 0x1.8f1ae991577362b982745c72ed8p+0L, 0x1.3bf26d2b85163p-114L },
+    { 0x1.902fed0282c8a564b2a17f8ff49ap+0L, -0x1.544d67d6fe17dp-114L },
+    { 0x1.9145b0b91ffc588a61b469f6b70ep+0L, 0x1.c2a90229a4c43p-120L },
+    { 0x1.925c353aa2fe1d97540b38c49013p+0L, -0x1.26aac882d0dbp-119L },
+    { 0x1.93737b0cdc5e4f4501c3f2540a23p+0L, -0x1.681da853f24e1p-115L },
+    { 0x1.948b82b5f98e4c478530d05a4cd6p+0L, -0x1.4d05daa0fc168p-114L },
+    { 0x1.95a44cbc8520ee9b483695a0fc6fp+0L, 0x1.f1f586cace88bp-114L },
+    { 0x1.96bdd9a7670b2f9169a60398ddaap+0L, -0x1.dbe60eaff76bcp-115L },
+    { 0x1.97d829fde4e4f8b9e920f91e8bd8p+0L, -0x1.24628ebb49098p-116L },
+    { 0x1.98f33e47a22a21cabdaa24c78ec8p+0L, 0x1.a27a6f1079dc9p-115L },
+    { 0x1.9a0f170ca07b9ba3109b8c46737cp+0L, -0x1.4e61e152597dap-116L },
+    { 0x1.9b2bb4d53fe0c889ec6c824aba08p+0L, -0x1.303603cf699eap-115L },
+    { 0x1.9c49182a3f0901c7c46b071f2be6p+0L, -0x1.c89486bcf7a3ap-114L },
+    { 0x1.9d674194bb8d4aba5057089f733bp+0L, -0x1.19baeb91c697ep-114L },
+    { 0x1.9e86319e323231824ca78e64c6ep+0L, 0x1.0f92c082bbaep-116L },
+    { 0x1.9fa5e8d07f29dd6ac62aa1c0a64ap+0L, 0x1.e1cdf910f0b97p-114L },
+    { 0x1.a0c667b5de564b29ada8b8cab34ap+0L, -0x1.57ef755c960afp-114L },
+    { 0x1.a1e7aed8eb8bb719863ba2f9c39bp+0L, 0x1.fcbedcb5e3016p-114L },
+    { 0x1.a309bec4a2d3358c171f770daad5p+0L, 0x1.1fe88b09b45a4p-114L },
+    { 0x1.a42c980460ad79561fe9d813b7e3p+0L, -0x1.ba790762460cep-114L },
+    { 0x1.a5503b23e255c8b424491caf87bdp+0L, -0x1.febd6feb1fa3fp-114L },
+    { 0x1.a674a8af460520a87ab183381b32p+0L, -0x1.1e5a446b7ee2cp-114L },
+    { 0x1.a799e1330b3586f2dfb2b158f1aap+0L, -0x1.e1a4c5dbdd45fp-114L },
+    { 0x1.a8bfe53c12e58ac1e613517a95dp+0L, 0x1.f0d566ba175f8p-116L },
+    { 0x1.a9e6b5579fdbf43eb243bdff4c4cp+0L, 0x1.62d5c73d1972cp-114L },
+    { 0x1.ab0e521356eba313863b5d28a899p+0L, 0x1.0bc46f0f268eap-114L },
+    { 0x1.ac36bbfd3f379c0db966a31265fcp+0L, 0x1.cf9201c4b483ep-114L },
+    { 0x1.ad5ff3a3c27745fbceedac6e392dp+0L, -0x1.a55d12f2b8459p-116L },
+    { 0x1.ae89f995ad3ad5e8734d1773205ap+0L, 0x1.fef0eb99d7a91p-114L },
+    { 0x1.afb4ce622f2fead340fc33a84cd2p+0L, 0x1.4b4a9a4cbcbecp-114L },
+    { 0x1.b0e07298db66590842acdfc6f6cap+0L, 0x1.cbb95c555fff5p-117L },
+    { 0x1.b20ce6c9a8952537409281d5b2e7p+0L, 0x1.f09425b5cd885p-114L },
+    { 0x1.b33a2b84f15faf6bfd0e7bd947c2p+0L, 0x1.5d5e076ed26c5p-114L },
+    { 0x1.b468415b749b0e089c21620836fep+0L, -0x1.f2a00e79fab77p-114L },
+    { 0x1.b59728de559398e388111164873cp+0L, 0x1.c5c7fbf104106p-114L },
+    { 0x1.b6c6e29f1c52a4aa3cd4a20fdb8cp+0L, -0x1.78459d599e763p-115L },
+    { 0x1.b7f76f2fb5e46eaa7b081ab53c53p+0L, 0x1.532240f0d5b93p-114L },
+    { 0x1.b928cf22749e39237a6acd268e8bp+0L, -0x1.ddc24d9db7323p-114L },
+    { 0x1.ba5b030a10649840cb3c6af5b47fp+0L, 0x1.4b901babf0e63p-115L },
+    { 0x1.bb8e0b79a6f1efe0ad2e36969dfbp+0L, -0x1.1b499b8052088p-115L },
+    { 0x1.bcc1e904bc1d2247ba0f45b3d08dp+0L, -0x1.7a6febc7b6a15p-115L },
+    { 0x1.bdf69c3f3a206fe3d9dc9f15a4aep+0L, -0x1.b2ab8c26584ffp-114L },
+    { 0x1.bf2c25bd71e088408d702518e345p+0L, -0x1.817e3132a6265p-114L },
+    { 0x1.c06286141b33cc4eb4abc086b97ap+0L, 0x1.02a2f020b96aap-114L },
+    { 0x1.c199bdd85529c2220cb12a091ba6p+0L, 0x1.9e51125928d9ap-114L },
+    { 0x1.c2d1cd9fa652ba46ba7a0dd68a3bp+0L, -0x1.af0e37eae5ddap-114L },
+    { 0x1.c40ab5fffd07a6d14df820f1828ap+0L, 0x1.4d9bf4e1e9ef7p-114L },
+    { 0x1.c544778fafb2244bc1c924ed6bccp+0L, -0x1.39637614f8a88p-114L },
+    { 0x1.c67f12e57d14b4a2137fd20f2b3p+0L, 0x1.dd9e6b151a6d2p-116L },
+    { 0x1.c7ba88988c932c3128883b5554dbp+0L, 0x1.c67ba78a4b002p-114L },
+    { 0x1.c8f6d9406e7b511acbc48805c443p+0L, -0x1.12553eff47067p-115L },
+    { 0x1.ca3405751c4dad01a825de5ee16p+0L, 0x1.45233cc94585ap-114L },
+    { 0x1.cb720dcef90691503cbd1e949db7p+0L, 0x1.8765566b032dbp-114L },
+    { 0x1.ccb0f2e6d1674e2ddf079ff6f6d8p+0L, -0x1.fbdb188c4c4cep-114L },
+    { 0x1.cdf0b555dc3f9c44f8958fac51bep+0L, 0x1.457e3162f7edcp-114L },
+    { 0x1.cf3155b5bab7397dc591e4802a3ap+0L, 0x1.7803528b24129p-115L },
+    { 0x1.d072d4a07897b8d0f22f21a158e2p+0L, -0x1.c1100e7683d83p-114L },
+    { 0x1.d1b532b08c9685558d88668dbb67p+0L, -0x1.b39b184735cb9p-114L },
+    { 0x1.d2f87080d89f18ade123989ea202p+0L, 0x1.6d315954fd738p-114L },
+    { 0x1.d43c8eacaa1d64f6d4efd6858514p+0L, 0x1.05e883d2b7b57p-115L },
+    { 0x1.d5818dcfba48725da05aeb66e0ddp+0L, -0x1.5829d82a98fdep-114L },
+    { 0x1.d6c76e862e6d307fa1e92a05968p+0L, 0x1.b1701f59c75ffp-114L },
+    { 0x1.d80e316c98397bb84f9d048805f8p+0L, 0x1.2fb1853789a64p-114L },
+    { 0x1.d955d71ff60756814b6ee6bdaf93p+0L, 0x1.b8a4c92402794p-117L },
+    { 0x1.da9e603db3285708c01a5b6d4c98p+0L, -0x1.3b721e273d627p-117L },
+    { 0x1.dbe7cd63a8314922439b651d06efp+0L, 0x1.f1c3b8667b4bap-114L },
+    { 0x1.dd321f301b4604b695de3c0630a4p+0L, -0x1.b37ab59873cacp-114L },
+    { 0x1.de7d5641c06578d6ab5c61915c4ap+0L, 0x1.f3fb0456bdc16p-114L },
+    { 0x1.dfc97337b9b5eb968cac39ed291bp+0L, 0x1.c896a513bf56fp-114L },
+    { 0x1.e11676b197d16ed4ad642a380bc5p+0L, -0x1.e73d8d6be3571p-116L },
+    { 0x1.e264614f5a128a12761fa17ada64p+0L, 0x1.9f9dfdcefd978p-114L },
+    { 0x1.e3b333b16ee11982d6f3808e5d59p+0L, -0x1.1e49b984e1f14p-114L },
+    { 0x1.e502ee78b3ff6273d130153991e9p+0L, -0x1.6d34c3d2d883dp-117L },
+    { 0x1.e653924676d75d3800f15ba91964p+0L, 0x1.bdfc8db5a7181p-114L },
+    { 0x1.e7a51fbc74c834b548b283237867p+0L, 0x1.62a13d2558d52p-114L },
+    { 0x1.e8f7977cdb73fbbddadfd3ead3cap+0L, -0x1.f2a34ff8906a4p-114L },
+    { 0x1.ea4afa2a490d9858f73a18f5db3p+0L, 0x1.f86dea20610cfp-116L },
+    { 0x1.eb9f4867cca6e520cbc8a4f93c67p+0L, -0x1.f8804a397d0ddp-117L },
+    { 0x1.ecf482d8e67f08db0312fb949cefp+0L, 0x1.188042ed2f134p-114L },
+    { 0x1.ee4aaa2188510471a36921d5a345p+0L, -0x1.c6e495f103b78p-115L },
+    { 0x1.efa1bee615a27771fd21a92dac1fp+0L, 0x1.b75748a7fda39p-114L },
+    { 0x1.f0f9c1cb64129b377fe6b9f8aeacp+0L, 0x1.fbaf5b13e9551p-118L },
+    { 0x1.f252b376bba974e8696fc36390d5p+0L, -0x1.ca955c4a574e8p-115L },
+    { 0x1.f3ac948dd7273e6a5a5c127c8221p+0L, 0x1.02860ff93303ep-114L },
+    { 0x1.f50765b6e4540674f84b762862bbp+0L, -0x1.9bffc80ef2b51p-122L },
+    { 0x1.f6632798844f87e8decd4e4d0f8cp+0L, -0x1.b2b74b66c3d94p-114L },
+    { 0x1.f7bfdad9cbe138913b4bfe72bd96p+0L, -0x1.d18c6bf82d96ep-115L },
+    { 0x1.f91d802243c88f768abac4304bb5p+0L, -0x1.26497f87dead7p-116L },
+    { 0x1.fa7c1819e90d82e90a7e74b263c2p+0L, -0x1.1fcf9e4844d7ap-115L },
+    { 0x1.fbdba3692d513e6988ceaf6714a7p+0L, -0x1.e6565aeacb9b7p-115L },
+    { 0x1.fd3c22b8f71f10975ba4b32bcf3ap+0L, 0x1.784b49a762b5fp-114L },
+    { 0x1.fe9d96b2a23d914a6037442fde32p+0L, -0x1.141e85fb3d435p-114L },
+  },
+};
+
+#endif
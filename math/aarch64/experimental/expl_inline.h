@@ -0,0 +1,80 @@
+/*
+ * Shared helpers for binary128 e^x and e^x - 1 functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef PL_MATH_EXPL_INLINE_H
+#define PL_MATH_EXPL_INLINE_H
+
+#include "binary128.h"
+
+#if LDBL_MANT_DIG == 113
+
+# define N (1 << EXPL_TABLE_BITS)
+# define InvLn2N __expl_data.invln2N
+# define Ln2hiN __expl_data.ln2hiN
+# define Ln2loN __expl_data.ln2loN
+# define Shift __expl_data.shift
+# define T __expl_data.tab
+# define C(i) __expl_data.poly[(i) - 2]
+# define D(i) __expl_data.dpoly[(i) - 6]
+
+/* Return r and set *k such that x = k ln2/N + r.  k is computed from x
+   rounded to double, so |r| is only slightly above ln2/2N.  The product
+   k ln2hiN is exact and x - k ln2hiN is exact by Sterbenz lemma for k != 0,
+   the low part of the reduction is small enough to be computed in
+   double.  */
+static inline long double
+expl_reduce (long double x, int64_t *k)
+{
+  double z = InvLn2N * (double) x;
+  double kd = eval_as_double (z + Shift);
+  kd -= Shift;
+  *k = kd;
+  return (x - (long double) kd * Ln2hiN) - (long double) (kd * Ln2loN);
+}
+
+/* (e^r - 1 - r) / r^2 for |r| <= ln2/2N.  Terms of order 6 and above of
+   e^r - 1 are below 2^-66, so they are computed in double.  */
+static inline long double
+expl_poly (long double r)
+{
+  double rd = r;
+  double q = D (6) + rd * (D (7) + rd * (D (8) + rd * (D (9) + rd * D (10))));
+  long double p = C (5) + r * q;
+  p = C (4) + r * p;
+  p = C (3) + r * p;
+  return C (2) + r * p;
+}
+
+/* Same as expl_poly with terms up to order 7 in binary128, for e^x - 1 where
+   the result can be much smaller than 1.  */
+static inline long double
+expm1l_poly (long double r)
+{
+  double rd = r;
+  double q = D (8) + rd * (D (9) + rd * D (10));
+  long double p = C (7) + r * q;
+  p = C (6) + r * p;
+  p = C (5) + r * p;
+  p = C (4) + r * p;
+  p = C (3) + r * p;
+  return C (2) + r * p;
+}
+
+/* 2^e y where the result may overflow or be subnormal, for
+   -16495 <= e <= 16384 and y in [0.99, 2.01].  Subnormal results are
+   rounded twice.  */
+static inline long double
+expl_specialcase (long double y, int64_t e)
+{
+  if (e > 0)
+    return y * exp2il (e - 2) * 4.0L;
+  return y * exp2il (e + 200) * 0x1p-200L;
+}
+
+#endif /* LDBL_MANT_DIG == 113.  */
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Binary128 log(1+x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "logl_inline.h"
+
+#if LDBL_MANT_DIG == 113
+
+/* top64(0x1p-113).  */
+# define TinyTop 0x3f8e000000000000
+/* top64(0x1p-9).  */
+# define SmallTop 0x3ff6000000000000
+/* top64(1.0).  */
+# define OneTop 0x3fff000000000000
+
+/* Binary128 log(1+x), using the reduction of arm_math_logl.  For
+   |x| >= 2^-9, 1 + x = u + ul exactly and
+     log(1+x) = log(u) + log(1 + ul/u) ~ log(u) + ul/u,
+   where ul/u is small enough to be computed in double.  In total 15
+   binary128 additions and multiplications are needed near 0 and 30
+   otherwise.
+   Maximum measured error: 0.74 ULP.
+   arm_math_log1pl(-0x1.feb1277a125fda3e481dccaddb78p-9)
+     got -0x1.ffb082eacfae3481686795084189p-9
+    want -0x1.ffb082eacfae348168679508418ap-9.  */
+long double
+arm_math_log1pl (long double x)
+{
+  uint64_t ix = top64l (x);
+  uint64_t ax = ix & 0x7fffffffffffffff;
+  if (ax < SmallTop)
+    {
+      if (ax < TinyTop)
+	/* |x| < 2^-113.  */
+	return x;
+      return x + x * x * logl_poly (x);
+    }
+  if (unlikely (ix >= 0xbfff000000000000 || ax >= 0x7fff000000000000))
+    {
+      if (x == -1.0L)
+	return math_divzerol (1);
+      if (x == INFINITY)
+	return x;
+      /* x < -1, -Inf or NaN.  */
+      return math_invalidl (x);
+    }
+  long double u = 1.0L + x;
+  long double ul = ax < OneTop ? (1.0L - u) + x : (x - u) + 1.0L;
+  return logl_inline (asuint128 (u), (double) ul / (double) u);
+}
+
+#endif
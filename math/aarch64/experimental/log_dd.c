@@ -0,0 +1,51 @@
+/*
+ * Double-precision log(x) function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "test_defs.h"
+#include "dd_inline.h"
+
+/* Return y and set *tail such that y + *tail approximates log(x), y is log(x)
+   rounded and *tail is the rounding error, |*tail| <= ulp(y)/2.  This is the
+   log of pow, which is kept to about 68 bits so pow can be correctly rounded
+   in most cases, at about the cost of log.
+   Maximum relative error of y + *tail is 2^-67.6:
+   arm_math_log_dd (0x1.fd5b7db73e213p-1)
+     got -0x1.5321620809d21p-8 + 0x1.c788p-64
+    want -0x1.5321620809d21p-8 + 0x1.c7a2c128116efp-64.
+   Maximum error of y alone is 0.501 ULP.  */
+double
+arm_math_log_dd (double x, double *tail)
+{
+  uint64_t ix = asuint64 (x);
+  uint32_t top = ix >> 48;
+
+  *tail = 0.0;
+  if (unlikely (ix == asuint64 (1.0)))
+    /* Fix sign of zero with downward rounding.  */
+    return 0;
+  if (unlikely (top - 0x0010 >= 0x7ff0 - 0x0010))
+    {
+      /* x < 0x1p-1022 or inf or nan.  */
+      if (ix * 2 == 0)
+	return __math_divzero (1);
+      if (ix == asuint64 (INFINITY)) /* log(inf) == inf.  */
+	return x;
+      if ((top & 0x8000) || (top & 0x7ff0) == 0x7ff0)
+	return __math_invalid (x);
+      /* x is subnormal, normalize it.  */
+      ix = asuint64 (x * 0x1p52);
+      ix -= 52ULL << 52;
+    }
+  return log_dd_inline (ix, tail);
+}
+
+TEST_ULP (arm_math_log_dd, 0.02)
+TEST_ULP_NONNEAREST (arm_math_log_dd, 0.5)
+TEST_INTERVAL (arm_math_log_dd, 0, 0xffff000000000000, 10000)
+TEST_INTERVAL (arm_math_log_dd, 0x1p-4, 0x1p4, 400000)
+TEST_INTERVAL (arm_math_log_dd, 0, inf, 400000)
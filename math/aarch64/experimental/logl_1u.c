@@ -0,0 +1,51 @@
+/*
+ * Binary128 natural logarithm.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "logl_inline.h"
+
+#if LDBL_MANT_DIG == 113
+
+/* Binary128 natural logarithm, for targets where long double is binary128
+   but arithmetic on it is done in software.  Away from 1 a table of
+   N = 256 entries reduces x to 1 + r with |r| < 0x1.1p-9, see logl_inline,
+   and near 1 log(1+r) is evaluated directly for r = x - 1.  In total 16
+   binary128 additions and multiplications are needed near 1 and 27
+   otherwise.
+   Maximum measured error: 0.75 ULP.
+   arm_math_logl(0x1.fe01467f0b401bc23a9bac922741p-1)
+     got -0x1.ffb8e4c1ea6dbd585f8085325a32p-9
+    want -0x1.ffb8e4c1ea6dbd585f8085325a33p-9.  */
+long double
+arm_math_logl (long double x)
+{
+  unsigned __int128 ix = asuint128 (x);
+  uint64_t top = ix >> 64;
+  if (unlikely (top - NearOneLo < NearOneHi - NearOneLo))
+    {
+      /* |x - 1| < 2^-9, r is exact.  */
+      if (x == 1.0L)
+	return 0.0L;
+      long double r = x - 1.0L;
+      return r + r * r * logl_poly (r);
+    }
+  if (unlikely (top - 0x0001000000000000 >= 0x7ffe000000000000))
+    {
+      /* x < 0x1p-16382 or inf or nan.  */
+      if ((ix << 1) == 0)
+	return math_divzerol (1);
+      if (x == INFINITY)
+	return x;
+      if ((top >> 63) || (top >> 48) == 0x7fff)
+	return math_invalidl (x);
+      /* Subnormal, normalize x.  */
+      ix = asuint128 (x * 0x1p113L);
+      ix -= (unsigned __int128) 113 << 112;
+    }
+  return logl_inline (ix, 0.0);
+}
+
+#endif
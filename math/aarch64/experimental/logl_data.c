@@ -0,0 +1,308 @@
+/*
+ * Data for binary128 log and log(1+x) functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <float.h>
+#include "math_config.h"
+
+#if LDBL_MANT_DIG == 113
+
+const struct logl_data __logl_data = {
+  /* ln2 split so that k ln2hi is exact for |k| < 2^15.  */
+  .ln2hi = 0x1.62e42fefa39ef35793c7673p-1L,
+  .ln2lo = 0x1.f97b57a079a19p-103,
+  /* Taylor coefficients (-1)^(n+1)/n, the truncation error is below 2^-128
+     for |r| < 0x1.1p-9.  */
+  .poly = { -0x1p-1L, 0x1.5555555555555555555555555555p-2L, -0x1p-2L,
+	    0x1.9999999999999999999999999999p-3L,
+	    -0x1.5555555555555555555555555555p-3L,
+	    0x1.2492492492492492492492492492p-3L },
+  .dpoly = { -0x1p-3, 0x1.c71c71c71c71cp-4, -0x1.999999999999ap-4,
+	     0x1.745d1745d1746p-4, -0x1.5555555555555p-4,
+	     0x1.3b13b13b13b14p-4 },
+  /* Subinterval i covers [0x1.6p-1 + i 2^-9, 0x1.6p-1 + (i + 1) 2^-9) below 1
+     and [1 + (i - 160) 2^-8, 1 + (i - 159) 2^-8) above 1.  invc is 1/c for
+     the centre c of the subinterval rounded to 12 bits so that z invc - 1 is
+     exact when z is split into 101 and 12 bits, and logc + logctail is
+     -log(invc) with logc rounded to a multiple of 2^-99 so that
+     k ln2hi + logc is exact.  Subintervals 159 and 160 contain the
+     neighbourhood of 1, which is handled without table lookup, so their
+     entries are only for x >= 1 + 2^-9.  */
+  .tab = {
+    { -0x1.7e5769e88d438893babac22ap-2L, 0x1.73ep+0, -0x1.d85fbf9d6de4ep-101 },
+    { -0x1.7b3d2bc9f48d52bd3f2087d98p-2L, 0x1.72cp+0, 0x1.e6fda13cab3a9p-105 },
+    { -0x1.787926d6b723e935ecefba1e8p-2L,
+      0x1.71cp+0, -0x1.379ec1035ca3ap-101 },
+    { -0x1.75b3370527a7694bbe3f27acp-2L, 0x1.70cp+0, 0x1.891bc43361f49p-101 },
+    { -0x1.72923b29aa9a9a275007e1ba8p-2L,
+      0x1.6fap+0, -0x1.77554eb9fdd8fp-102 },
+    { -0x1.6fc82f5eaac843d48f39b03d8p-2L, 0x1.6eap+0, 0x1.6fa64d51a1f45p-102 },
+    { -0x1.6cfc304dfe9e96f0a84e31898p-2L,
+      0x1.6dap+0, -0x1.ad2099ed770cbp-101 },
+    { -0x1.6a2e3b3b89d7c4aba9f15ceap-2L, 0x1.6cap+0, -0x1.059c8a8101c46p-102 },
+    { -0x1.675e4d656b86e6e062425223p-2L, 0x1.6bap+0, -0x1.727ebef6a027p-101 },
+    { -0x1.648c6403edd3e0a0117e564d8p-2L, 0x1.6aap+0, -0x1.f911faa53f19p-101 },
+    { -0x1.61b87c49757dbfcc8c19328c8p-2L, 0x1.69ap+0, 0x1.572d2512cbc1ep-101 },
+    { -0x1.5ee293627122ab3355d531f28p-2L,
+      0x1.68ap+0, -0x1.74e888ccf2619p-102 },
+    { -0x1.5c0aa675484c63db55edb4078p-2L,
+      0x1.67ap+0, -0x1.d62cd59554c15p-101 },
+    { -0x1.5930b2a24a405b5abf1f07578p-2L, 0x1.66ap+0, 0x1.e14f12e477089p-102 },
+    { -0x1.5654b5039c925c12f6dd90c2p-2L, 0x1.65ap+0, -0x1.9092b480f89a8p-102 },
+    { -0x1.5376aaad2978bb1bfa1b82c4p-2L, 0x1.64ap+0, -0x1.74121f78e2768p-101 },
+    { -0x1.50f2b0e1e0682502311ee35f8p-2L,
+      0x1.63cp+0, -0x1.0f4ea17368655p-104 },
+    { -0x1.4e10c6bc8a060a0fc58dbc18p-2L, 0x1.62cp+0, -0x1.f1f26544d50a2p-101 },
+    { -0x1.4b2cc755559fc0d0e1d016d58p-2L,
+      0x1.61cp+0, -0x1.2b8695b6f97f7p-103 },
+    { -0x1.48a3900b8e0c2958ef2b7e948p-2L, 0x1.60ep+0, 0x1.31d2ace076765p-101 },
+    { -0x1.45bba0a07571b62c9d1b18748p-2L,
+      0x1.5fep+0, -0x1.e0619c5cae74ep-103 },
+    { -0x1.42d193339888c0e552b2abf3p-2L, 0x1.5eep+0, -0x1.1d712524adfcfp-101 },
+    { -0x1.404308686a7e3bd0c127df4c8p-2L, 0x1.5ep+0, 0x1.b59ea6f9f6099p-102 },
+    { -0x1.3d54fa5c1f70f873668e578d8p-2L, 0x1.5dp+0, -0x1.cc914f3172295p-102 },
+    { -0x1.3ac2ea349541ae9e8b4ba63f8p-2L, 0x1.5c2p+0, 0x1.5199bb06fa2ap-102 },
+    { -0x1.382f3216c4ef9e2de2e580938p-2L, 0x1.5b4p+0, 0x1.238918ae28a63p-101 },
+    { -0x1.353b31376decce50193d92648p-2L,
+      0x1.5a4p+0, -0x1.a0b435e7b4718p-101 },
+    { -0x1.32a3e562ad88bdf54619d503p-2L, 0x1.596p+0, -0x1.66212e8c2bb5ap-101 },
+    { -0x1.300aead06350bd5a2dd7f2ae8p-2L,
+      0x1.588p+0, -0x1.fc53568de52c1p-101 },
+    { -0x1.2d703f4fb24879782381876dp-2L, 0x1.57ap+0, -0x1.a2823be7c31dap-101 },
+    { -0x1.2a7441c8bf99f29ef12f835ep-2L, 0x1.56ap+0, -0x1.d856c1ba0ef6ep-102 },
+    { -0x1.27d5ef1db5f36e45c39a9b06p-2L, 0x1.55cp+0, -0x1.8067d16755609p-102 },
+    { -0x1.2535e4856ccfc641d7f556da8p-2L, 0x1.54ep+0, 0x1.391380ab47228p-105 },
+    { -0x1.22941fbcf7965a242853da76p-2L, 0x1.54p+0, 0x1.5e685a2caa591p-101 },
+    { -0x1.1ff09e7ceffa752544fab3048p-2L,
+      0x1.532p+0, -0x1.96902803d8adcp-101 },
+    { -0x1.1d4b5e796a2454b7a32f75848p-2L, 0x1.524p+0, 0x1.cdf30fc42b369p-102 },
+    { -0x1.1aa45d61e8b2ee072a2b0cb98p-2L,
+      0x1.516p+0, -0x1.49fd1ec8eb103p-103 },
+    { -0x1.17fb98e15095d5d162d765ee8p-2L,
+      0x1.508p+0, -0x1.3a0e94439cb12p-101 },
+    { -0x1.15510e9ddcbeab271b7631058p-2L, 0x1.4fap+0, 0x1.3d158d221c12fp-103 },
+    { -0x1.12a4bc3911a962be7ae3369d8p-2L, 0x1.4ecp+0, 0x1.7ff2da9d6a00ap-103 },
+    { -0x1.1058bf9ae4ad5189fa0ab4cbp-2L, 0x1.4ep+0, -0x1.8e7c299cb1738p-101 },
+    { -0x1.0da917c36ff3465279a09c268p-2L, 0x1.4d2p+0, 0x1.c0b0447528ff4p-102 },
+    { -0x1.0af7a0eb6c2799f2928b5b5a8p-2L, 0x1.4c4p+0, 0x1.8ba5d51e5df68p-102 },
+    { -0x1.084458a1b87b306fdf9818f18p-2L, 0x1.4b6p+0, 0x1.5a7a3c16b15b6p-104 },
+    { -0x1.05f25d350793fa4e50bca8928p-2L, 0x1.4aap+0, 0x1.40f9b0ef72cf4p-102 },
+    { -0x1.033badfa740e185e0a42deff8p-2L,
+      0x1.49cp+0, -0x1.7d73eb881692bp-102 },
+    { -0x1.008326389b70c3fbe3cdfaa9p-2L, 0x1.48ep+0, 0x1.00f470701244dp-102 },
+    { -0x1.fc594b23e32c435c6262def1p-3L, 0x1.482p+0, 0x1.41b4d5dc888fep-101 },
+    { -0x1.f6e15321531b2b4429d89c5cp-3L, 0x1.474p+0, -0x1.a98528cf7076ep-104 },
+    { -0x1.f22e5e72f105d5875f40df06p-3L, 0x1.468p+0, -0x1.323e036f68218p-102 },
+    { -0x1.ecaf6c50e779e84d55885fe5p-3L, 0x1.45ap+0, 0x1.d1264276ada3p-101 },
+    { -0x1.e7f675089b55a6f5880eab4dp-3L, 0x1.44ep+0, 0x1.f46c92a632694p-104 },
+    { -0x1.e27076e2af2e5e9ea87ffe2p-3L, 0x1.44p+0, 0x1.61eaa246b143cp-103 },
+    { -0x1.ddb16d8ce9c2210d1df68e88p-3L, 0x1.434p+0, -0x1.bd1df0520544ap-102 },
+    { -0x1.d8ef91af31d5df40793670f9p-3L, 0x1.428p+0, 0x1.651c4bc25f74ap-103 },
+    { -0x1.d35f2626d50b5a2e22022bbbp-3L, 0x1.41ap+0, 0x1.826d8c5205708p-101 },
+    { -0x1.ce97213a60ce13b4334333f8p-3L, 0x1.40ep+0, -0x1.7998ca0d81d6fp-101 },
+    { -0x1.c9cc3f09b481343f378276c1p-3L, 0x1.402p+0, -0x1.83caacd2e9234p-101 },
+    { -0x1.c4313e754e93cdf3a656bebp-3L, 0x1.3f4p+0, 0x1.4a081755adb8fp-101 },
+    { -0x1.bf601bb0e44e1aa51f0de2d5p-3L, 0x1.3e8p+0, -0x1.0baaaccee9242p-101 },
+    { -0x1.ba8c10ae46d19714f774ec26p-3L, 0x1.3dcp+0, 0x1.4f5d6f180477bp-103 },
+    { -0x1.b5b519e8fb5a46e89ff70678p-3L, 0x1.3dp+0, -0x1.a04f73c1b89fp-101 },
+    { -0x1.b0db33d620ff70a1c755c832p-3L, 0x1.3c4p+0, 0x1.7a5e0b946f931p-103 },
+    { -0x1.abfe5ae46124b8563507631cp-3L, 0x1.3b8p+0, 0x1.dfde03413443dp-102 },
+    { -0x1.a71e8b7bdfbbd4d6443eb374p-3L, 0x1.3acp+0, -0x1.37b307065e8p-101 },
+    { -0x1.a23bc1fe2b563193711b07aap-3L, 0x1.3ap+0, 0x1.9cf607039264ap-101 },
+    { -0x1.9d55fac62d05ccb01e2521ecp-3L, 0x1.394p+0, 0x1.4000b3af9bf2p-102 },
+    { -0x1.986d3228180c9dab26ea2p-3L, 0x1.388p+0, 0x1.89791608d6e65p-102 },
+    { -0x1.938164715959ce14ae2e313bp-3L, 0x1.37cp+0, 0x1.9702a377bab81p-101 },
+    { -0x1.8e928de886d40aa589eb96a6p-3L, 0x1.37p+0, -0x1.201c0d0e377c6p-102 },
+    { -0x1.89a0aacd4e702fef6a3d69c8p-3L, 0x1.364p+0, 0x1.425ac7b800ed5p-102 },
+    { -0x1.84abb758651392a9058ea173p-3L, 0x1.358p+0, 0x1.c7f68c2f98104p-102 },
+    { -0x1.7fb3afbb75412056dcfb1546p-3L, 0x1.34cp+0, 0x1.cc1be4e7f3f9cp-101 },
+    { -0x1.7ab890210d9091be36b2d6ap-3L, 0x1.34p+0, -0x1.820191ff85253p-101 },
+    { -0x1.768f9603f56b5787b58aeb98p-3L, 0x1.336p+0, -0x1.228e6f0defd24p-102 },
+    { -0x1.718ec0614c65b1685e849197p-3L, 0x1.32ap+0, 0x1.e6c3db1040549p-101 },
+    { -0x1.6c8ac7bd32dcc8c520404a29p-3L, 0x1.31ep+0, 0x1.b7c20d866c94ep-102 },
+    { -0x1.6783a82650b9a3ae08e9b9a4p-3L, 0x1.312p+0, 0x1.16d7e69f73539p-102 },
+    { -0x1.6350a28aaa757b02ae058ebap-3L, 0x1.308p+0, -0x1.cccf34fa1f3a9p-101 },
+    { -0x1.5e43b135bd5e2a5988931e78p-3L, 0x1.2fcp+0, 0x1.7ec055e273b82p-102 },
+    { -0x1.59338d9982085d345baaaea5p-3L, 0x1.2fp+0, -0x1.8ac1c3e21b65p-105 },
+    { -0x1.54f8fbecdfed45e815e13471p-3L, 0x1.2e6p+0, 0x1.89d33ae98334fp-104 },
+    { -0x1.4fe2f194f05ecb5e715af842p-3L, 0x1.2dap+0, -0x1.d26e8277cb2f6p-101 },
+    { -0x1.4ba36f39a55e55a2606f30dap-3L, 0x1.2dp+0, 0x1.540412ffbda2dp-102 },
+    { -0x1.468770542f13f5d03957bc1p-3L, 0x1.2c4p+0, 0x1.9795e7c5c949cp-102 },
+    { -0x1.4242f1b1d263a13358c718ebp-3L, 0x1.2bap+0, -0x1.a25df7ead3c5cp-103 },
+    { -0x1.3d20f03c3e7b11eb8d51dd2bp-3L, 0x1.2aep+0, 0x1.d4cdce5f87b0cp-102 },
+    { -0x1.38d769916430894b3c7376e1p-3L, 0x1.2a4p+0, 0x1.29f235b901882p-102 },
+    { -0x1.33af575770e4f66517f39524p-3L, 0x1.298p+0, -0x1.e9f72ce481279p-101 },
+    { -0x1.2f60bcb8e7a7bf700788d142p-3L, 0x1.28ep+0, 0x1.a8d9788ab2884p-103 },
+    { -0x1.2b0fcf3b1a2ef947c614b3d5p-3L, 0x1.284p+0, 0x1.297295725673fp-101 },
+    { -0x1.25ded0abc6ad1c2a78bb2246p-3L, 0x1.278p+0, 0x1.9c20621409bf5p-102 },
+    { -0x1.2188bd9806262f06b02452a1p-3L, 0x1.26ep+0, -0x1.d5982d73d7p-101 },
+    { -0x1.1d304f8c352c95d905d77dedp-3L, 0x1.264p+0, -0x1.4bf317f5ec4cfp-102 },
+    { -0x1.17f6458fca610feb424f237p-3L, 0x1.258p+0, -0x1.0032ddab0043p-102 },
+    { -0x1.13989fef47111bc250897c71p-3L, 0x1.24ep+0, -0x1.38ece929cc587p-101 },
+    { -0x1.0f3897134b12e530bb6149cfp-3L, 0x1.244p+0, -0x1.adb7615bb9e84p-102 },
+    { -0x1.0ad6285dd98610c0c0dd9963p-3L, 0x1.23ap+0, 0x1.68aab8553fe8bp-102 },
+    { -0x1.0671512ca596e2a18c8fd70dp-3L, 0x1.23p+0, 0x1.b39e98f4812abp-101 },
+    { -0x1.012850a6dfcaf3cd6ff480d9p-3L, 0x1.224p+0, 0x1.cfb3e7c96b0bcp-103 },
+    { -0x1.f97c47ae59b3cb7f50961f6ap-4L, 0x1.21ap+0, 0x1.77906c4d1c856p-101 },
+    { -0x1.f0a30c01162a6617cc9716eep-4L, 0x1.21p+0, -0x1.665e2634d1d35p-101 },
+    { -0x1.e7c4e8dc5061250194661caap-4L, 0x1.206p+0, -0x1.d5c97f11fe7e5p-101 },
+    { -0x1.dee1d8cd5ed725f8d6100774p-4L, 0x1.1fcp+0, 0x1.8abfee0dff7ddp-101 },
+    { -0x1.d5f9d6587f0e41fcbb1d0806p-4L, 0x1.1f2p+0, -0x1.6b011dd0fc561p-103 },
+    { -0x1.cd0cdbf8c13e14db50dd743p-4L, 0x1.1e8p+0, -0x1.38ad8fa2f780fp-101 },
+    { -0x1.c41ae41ff3ce453fca982c18p-4L, 0x1.1dep+0, -0x1.86cbc8e18c187p-102 },
+    { -0x1.bb23e9368e974e7caa624752p-4L, 0x1.1d4p+0, -0x1.54e4c5c5ccb17p-101 },
+    { -0x1.b227e59b9de90a5d7c27b024p-4L, 0x1.1cap+0, 0x1.e4f5a79b7b2a3p-103 },
+    { -0x1.a926d3a4ad563650bd22a9c4p-4L, 0x1.1cp+0, 0x1.56ce195826077p-102 },
+    { -0x1.a020ad9db2442c3205bc15fep-4L, 0x1.1b6p+0, 0x1.5619f03987794p-101 },
+    { -0x1.97156dc8f63e03e65024684ap-4L, 0x1.1acp+0, -0x1.01f8ed5acee8fp-102 },
+    { -0x1.8e050e5f010a4fd7fcf6ba34p-4L, 0x1.1a2p+0, -0x1.7701792548eacp-101 },
+    { -0x1.86c10dcacaa4608ef84758ecp-4L, 0x1.19ap+0, -0x1.4f374fdf39546p-101 },
+    { -0x1.7da766d7b12cc844480c89bp-4L, 0x1.19p+0, 0x1.3097ba8ba1667p-102 },
+    { -0x1.74888fec3505ce005a0ed9d2p-4L, 0x1.186p+0, 0x1.f6b9b20d88369p-105 },
+    { -0x1.6b64831afe40cf5ec88216ep-4L, 0x1.17cp+0, 0x1.1b1b6ccc7aa34p-102 },
+    { -0x1.623b3a6c8688989a977b6e74p-4L, 0x1.172p+0, 0x1.14fc07395a064p-104 },
+    { -0x1.5ae3378a8436e1293d8e75dcp-4L, 0x1.16ap+0, 0x1.63e2ff1d1531bp-101 },
+    { -0x1.51b073f06183f69278e686a2p-4L, 0x1.16p+0, -0x1.f22b097938fc1p-101 },
+    { -0x1.4878638cfa25120ace85cd62p-4L, 0x1.156p+0, -0x1.d15df5a5c83f3p-102 },
+    { -0x1.411481711dcfa0a161d3affap-4L, 0x1.14ep+0, 0x1.007b18a5e65dfp-101 },
+    { -0x1.37d2d762831cfaab2400751ep-4L, 0x1.144p+0, -0x1.3c48dd2f92c2fp-102 },
+    { -0x1.2e8bcf4c09539c9680b35d64p-4L, 0x1.13ap+0, 0x1.ad15b36d9269fp-101 },
+    { -0x1.271be755733412d0033efb1cp-4L, 0x1.132p+0, -0x1.cc0f1545e0d5dp-101 },
+    { -0x1.1dcb263db19444f5e9e89816p-4L, 0x1.128p+0, 0x1.cf57f18c197a8p-103 },
+    { -0x1.1474f58ac2e0eef48027409p-4L, 0x1.11ep+0, -0x1.5484963687b5fp-101 },
+    { -0x1.0cf8e05ad6a67dccfea25cbp-4L, 0x1.116p+0, 0x1.b40c23e5f983bp-102 },
+    { -0x1.0398d6b62254eb2034033002p-4L, 0x1.10cp+0, -0x1.ac92cb3d86535p-104 },
+    { -0x1.f829b0e7833004cf8fc13c7cp-5L, 0x1.104p+0, 0x1.bac0a2a20a3d6p-104 },
+    { -0x1.e555c203269a34787e8219ccp-5L, 0x1.0fap+0, -0x1.6c347452bc236p-102 },
+    { -0x1.d63dd1c4f2d502369024ea2cp-5L, 0x1.0f2p+0, -0x1.6ed15945fa078p-101 },
+    { -0x1.c355dd0921f2ccc9abf83884p-5L, 0x1.0e8p+0, 0x1.d38b87ba927e5p-103 },
+    { -0x1.b42dd711971bec28d14c7dap-5L, 0x1.0ep+0, 0x1.2645ad50c7673p-102 },
+    { -0x1.a131b1ba816af5e2a726bf4p-5L, 0x1.0d6p+0, -0x1.47cd9424967f5p-102 },
+    { -0x1.91f9739c93afe312b1d9e5ecp-5L, 0x1.0cep+0, 0x1.dd9d3326ac53p-102 },
+    { -0x1.82b9f4ee6a483f81f2933194p-5L, 0x1.0c6p+0, 0x1.ed5b8815d6e07p-101 },
+    { -0x1.6fa0593c7b682bc83ac6941p-5L, 0x1.0bcp+0, -0x1.cf5145e2be41dp-101 },
+    { -0x1.60506fe98da8b7efcd63f93cp-5L, 0x1.0b4p+0, -0x1.2f9bccbe28294p-102 },
+    { -0x1.4d2238cb20903752f34b0ed4p-5L, 0x1.0aap+0, 0x1.44187c741959bp-101 },
+    { -0x1.3dc1c153c612c0b2d3ffbfc8p-5L, 0x1.0a2p+0, -0x1.9f104a4b336fp-107 },
+    { -0x1.2e59e2bacfd471baf237da3p-5L, 0x1.09ap+0, 0x1.fff60aa2ef46dp-101 },
+    { -0x1.1b0d98923d97fc2ca2eec8a8p-5L, 0x1.09p+0, 0x1.205f6acb80732p-102 },
+    { -0x1.0b94f7c1961767690fdd87d4p-5L, 0x1.088p+0, 0x1.1dcad6614c49ep-102 },
+    { -0x1.f829b0e7833004cf8fc13c78p-6L, 0x1.08p+0, -0x1.e453f5d5df5c3p-101 },
+    { -0x1.d91a66c543cc3e2cb19f734p-6L, 0x1.078p+0, -0x1.2aa5350c5cc33p-101 },
+    { -0x1.b2320b99305be3bf1b799718p-6L, 0x1.06ep+0, -0x1.964531669f525p-101 },
+    { -0x1.9300b1e9340f554f2aca4b28p-6L, 0x1.066p+0, -0x1.fbb5896c0e81p-103 },
+    { -0x1.73c01cd777f497832c5e959p-6L, 0x1.05ep+0, 0x1.2051e1d25c4bcp-102 },
+    { -0x1.54703d7c6fd79a9e50edd2e8p-6L, 0x1.056p+0, 0x1.b5b1fed81958fp-103 },
+    { -0x1.351104daa4849645f466abap-6L, 0x1.04ep+0, -0x1.2aa507196b3a4p-105 },
+    { -0x1.15a263de88b92a7475d855fp-6L, 0x1.046p+0, -0x1.6852e8e67c955p-102 },
+    { -0x1.dc84b19123814a83c74b661p-7L, 0x1.03cp+0, 0x1.820d4577c0ff1p-101 },
+    { -0x1.9d61aadc6bd8cb193da12b7p-7L, 0x1.034p+0, 0x1.946994ffc74c8p-101 },
+    { -0x1.5e1f703ecbe504fac2ed0dap-7L, 0x1.02cp+0, -0x1.3b891de3b44e3p-101 },
+    { -0x1.1ebde2d1997e5f002dc8f27p-7L, 0x1.024p+0, 0x1.d901e7242f95cp-101 },
+    { -0x1.be79c70058ec8f9a6c04044p-8L, 0x1.01cp+0, 0x1.5b13879ec3a1cp-105 },
+    { -0x1.3f38a60f064895a4f24dd26p-8L, 0x1.014p+0, 0x1.fdd0a9fcd95e3p-101 },
+    { -0x1.7f7047d7983da689d68648p-9L, 0x1.00cp+0, -0x1.39ffb5b1aad1cp-101 },
+    { 0x0p+0L, 0x1p+0, 0x0p+0 },
+    { 0x1.80904828985c0696a70c0c4p-9L, 0x1.fe8p-1, 0x1.fdb2284ae282p-102 },
+    { 0x1.8121214586b540e0a5cfc9cp-8L, 0x1.fdp-1, -0x1.0bc592992b56ap-102 },
+    { 0x1.41929f96832ef8eaba026d1p-7L, 0x1.fbp-1, -0x1.115292c45ca7fp-104 },
+    { 0x1.bafb16b74919b0c03bea97ep-7L, 0x1.f92p-1, -0x1.2d2bc6720e1fdp-101 },
+    { 0x1.1e7d80b1fbf411041a1af668p-6L, 0x1.f72p-1, -0x1.3d1d17ed45692p-102 },
+    { 0x1.5ba9a5d9ac0397709c11af18p-6L, 0x1.f54p-1, -0x1.451b5ae450d14p-101 },
+    { 0x1.99107b63b81e1308db2e2e68p-6L, 0x1.f36p-1, -0x1.6f7a7f1fec763p-104 },
+    { 0x1.dad06ca02682f7cac548fd6p-6L, 0x1.f16p-1, 0x1.f89a3127310f7p-103 },
+    { 0x1.0c58fa19dfaa98ba9d3a1bb4p-5L, 0x1.ef8p-1, 0x1.f532a5d4c482p-104 },
+    { 0x1.2b67c571a29d28cb15d67698p-5L, 0x1.edap-1, -0x1.41fafff106223p-101 },
+    { 0x1.487fceb8b26edb3ac49814e8p-5L, 0x1.ebep-1, 0x1.9ccd1e1cce37p-103 },
+    { 0x1.67c94f2d4bb584104f994178p-5L, 0x1.eap-1, 0x1.80d85f24bc417p-101 },
+    { 0x1.873184bc09591f488e8d891cp-5L, 0x1.e82p-1, -0x1.fc89762629eb9p-102 },
+    { 0x1.a49da08d3ffa39fa09002e8p-5L, 0x1.e66p-1, -0x1.0155d0c32c712p-102 },
+    { 0x1.c441e06f72a9e3e930a1a2a8p-5L, 0x1.e48p-1, 0x1.5930426365d06p-101 },
+    { 0x1.e1e6713606d069e5bd8a0ed8p-5L, 0x1.e2cp-1, -0x1.fe6c4332666dcp-101 },
+    { 0x1.ffa6911ab93008c98381a8f4p-5L, 0x1.e1p-1, 0x1.136457f04c927p-103 },
+    { 0x1.0ec139c5da60091f953af5ccp-4L, 0x1.df4p-1, 0x1.2cf2760d6374ap-101 },
+    { 0x1.1dbd2643d190b24d977c494p-4L, 0x1.dd8p-1, -0x1.fc0ac318803c9p-102 },
+    { 0x1.2cc7284fe5f1c5e86599513ep-4L, 0x1.dbcp-1, 0x1.e209b5b97607fp-104 },
+    { 0x1.3bdf5a7d1ee642f52eda76b6p-4L, 0x1.dap-1, 0x1.17db282b43314p-101 },
+    { 0x1.49f054cd1871fd984609ef64p-4L, 0x1.d86p-1, -0x1.642bbd7f5564bp-102 },
+    { 0x1.59242ff043d36afd64e62f4cp-4L, 0x1.d6ap-1, 0x1.a4d185dd44e97p-104 },
+    { 0x1.674f089365a79994c9d3301cp-4L, 0x1.d5p-1, 0x1.21db15b559f2cp-105 },
+    { 0x1.769ef2c6b568d7631ceda954p-4L, 0x1.d34p-1, -0x1.af579cd7b8389p-103 },
+    { 0x1.84e40992a480a839755ad0fap-4L, 0x1.d1ap-1, 0x1.469f80df8049dp-103 },
+    { 0x1.9335e5d594988ae1d5ea3eccp-4L, 0x1.dp-1, 0x1.a4a112e6b066p-101 },
+    { 0x1.a1949e80500830ea2c9c2bb4p-4L, 0x1.ce6p-1, -0x1.e331245334afdp-101 },
+    { 0x1.b0004ac1a86abe5c0dfcacd2p-4L, 0x1.cccp-1, 0x1.93c09a2979bc3p-101 },
+    { 0x1.be790207570866629bedec36p-4L, 0x1.cb2p-1, 0x1.d0ea2e22991edp-101 },
+    { 0x1.ccfedbfee13a8232fe71255ap-4L, 0x1.c98p-1, 0x1.5cfc54f37b829p-102 },
+    { 0x1.db91f09680dfe0b0815b5e26p-4L, 0x1.c7ep-1, -0x1.88d0b1e191205p-101 },
+    { 0x1.e911d663ba273c1c6799398ep-4L, 0x1.c66p-1, 0x1.83ff3f7551297p-101 },
+    { 0x1.f7be9fedbfde5f45a9a98874p-4L, 0x1.c4cp-1, -0x1.7eb518fb3362bp-103 },
+    { 0x1.02ab352ff25f398d755a6cacp-3L, 0x1.c34p-1, -0x1.e73c062571bf3p-109 },
+    { 0x1.0a0ea2164af00d4b61feb252p-3L, 0x1.c1ap-1, 0x1.814c97e5c22d1p-101 },
+    { 0x1.10e6a437247b6acfc7b6653dp-3L, 0x1.c02p-1, 0x1.2976c7aa0d8c3p-101 },
+    { 0x1.17c4862a78dfc874e0a5fde2p-3L, 0x1.beap-1, -0x1.4b772112b3ap-101 },
+    { 0x1.1ea8520e8e6ab05d9195dd4cp-3L, 0x1.bd2p-1, -0x1.826f6f6e94d0dp-101 },
+    { 0x1.2625d1e6ddf56b4e87b0e13fp-3L, 0x1.bb8p-1, 0x1.4e9598db6ae2ep-104 },
+    { 0x1.2c81d0a59878ea65d94436e5p-3L, 0x1.ba2p-1, 0x1.238a7af6d7ef9p-101 },
+    { 0x1.33779819ae5e902c2e786b31p-3L, 0x1.b8ap-1, -0x1.13daba6a071ap-101 },
+    { 0x1.3a73730182cdfcb6df69c6fap-3L, 0x1.b72p-1, -0x1.e13aa70029c04p-102 },
+    { 0x1.41756c0220c81c8d9706a941p-3L, 0x1.b5ap-1, -0x1.1a73951efc595p-101 },
+    { 0x1.487d8ddca50664c5e63b8166p-3L, 0x1.b42p-1, 0x1.4cbcd411663d4p-102 },
+    { 0x1.4ef51f6466de41e90e466a99p-3L, 0x1.b2cp-1, 0x1.6a1c695fbdeeap-102 },
+    { 0x1.56092e02ba5161401a26765fp-3L, 0x1.b14p-1, -0x1.f7afca69f9d44p-102 },
+    { 0x1.5c8bc079d828a6addc7ca93bp-3L, 0x1.afep-1, 0x1.8c6c275b6b455p-103 },
+    { 0x1.6313a37335d7641561bc2b26p-3L, 0x1.ae8p-1, -0x1.3e1fa205e205dp-104 },
+    { 0x1.6a399dabbd383658ccaf52cdp-3L, 0x1.adp-1, 0x1.f1f4165ace953p-105 },
+    { 0x1.70ccb9927bcf731755cb0fb2p-3L, 0x1.abap-1, 0x1.b4aec472a905ap-101 },
+    { 0x1.77654128f61274badf268e7cp-3L, 0x1.aa4p-1, -0x1.090f4d88de985p-104 },
+    { 0x1.7e033d66cd24d054a8b78d99p-3L, 0x1.a8ep-1, 0x1.ed28befc1a8ddp-102 },
+    { 0x1.84a6b759f512ebfea903cfb8p-3L, 0x1.a78p-1, 0x1.857671f47f3d3p-102 },
+    { 0x1.8b4fb826ff293121a7c2fb62p-3L, 0x1.a62p-1, 0x1.64bc904985cb7p-102 },
+    { 0x1.91fe49096581b4e79850e18dp-3L, 0x1.a4cp-1, -0x1.08d3cf5f37f58p-103 },
+    { 0x1.98b27353d7ce6fcee1806a2ep-3L, 0x1.a36p-1, -0x1.62131fa4f7c35p-101 },
+    { 0x1.9ecf7d8f3142d27e30cf4479p-3L, 0x1.a22p-1, 0x1.0e96d0bc4f08ap-102 },
+    { 0x1.a58e729348f433ea822a8d85p-3L, 0x1.a0cp-1, 0x1.9e0732abcff4fp-104 },
+    { 0x1.abb55c31693acd29a875993fp-3L, 0x1.9f8p-1, -0x1.5cfd8e164d6bcp-101 },
+    { 0x1.b27f3ee67421b926afe713f5p-3L, 0x1.9e2p-1, 0x1.72f88740296a4p-102 },
+    { 0x1.b8b027fe249de35a2ce21394p-3L, 0x1.9cep-1, -0x1.fc55a31065c98p-101 },
+    { 0x1.bf851c067555ef8d9fbd5a9cp-3L, 0x1.9b8p-1, -0x1.06a1359aa3d27p-101 },
+    { 0x1.c5c0254bf23a5eaae7b42c76p-3L, 0x1.9a4p-1, -0x1.44d77eee520eap-103 },
+    { 0x1.cc000c9db3c5254f4550a00ep-3L, 0x1.99p-1, 0x1.4ee8e692c249dp-101 },
+    { 0x1.d244d99c85673ec032241dbfp-3L, 0x1.97cp-1, -0x1.a00d93e04f7ecp-101 },
+    { 0x1.d92fd2b1383b651cb53b864p-3L, 0x1.966p-1, -0x1.1d9c4d1d4a8c6p-101 },
+    { 0x1.df7f018ce771ffde4497ec89p-3L, 0x1.952p-1, -0x1.fbc5ad935eba8p-101 },
+    { 0x1.e5d32e2e9ce86a84e09c94fdp-3L, 0x1.93ep-1, 0x1.23e45f4629aaep-101 },
+    { 0x1.ec2c60824fbe8803304e5948p-3L, 0x1.92ap-1, 0x1.08a51a50f6b07p-101 },
+    { 0x1.f1e75fadf9bde753689f024cp-3L, 0x1.918p-1, 0x1.991941f02e242p-101 },
+    { 0x1.f84a32ead7c3578e99ecf1b6p-3L, 0x1.904p-1, -0x1.12ff9bd99e07fp-102 },
+    { 0x1.feb2233ea07cd06378024e2dp-3L, 0x1.8fp-1, 0x1.87ff9cd94672dp-102 },
+    { 0x1.028f9c7035c1c28c2c199ep-2L, 0x1.8dcp-1, -0x1.4dd9bac650667p-101 },
+    { 0x1.05761cbf25f1f6e18e73c95cp-2L, 0x1.8cap-1, -0x1.590c134f3e998p-101 },
+    { 0x1.08b196753a1234bf9b4adcc3p-2L, 0x1.8b6p-1, -0x1.da97724976b4ep-103 },
+    { 0x1.0b9c8e32d191127449047cap-2L, 0x1.8a4p-1, 0x1.7a9e248b61201p-104 },
+    { 0x1.0edd060b78080cda96c21afa8p-2L, 0x1.89p-1, 0x1.ee9a4d5c038e3p-102 },
+    { 0x1.11cc830ebd9b3abd60c172c78p-2L, 0x1.87ep-1, -0x1.9d4c7241593f8p-101 },
+    { 0x1.1512088e66668a786558c6c8p-2L, 0x1.86ap-1, 0x1.54b2ce339d1e4p-101 },
+    { 0x1.180618ef18adf400de4b1c6a8p-2L, 0x1.858p-1, -0x1.fe84d7f5305d2p-102 },
+    { 0x1.1afc59297024b6beb3387ff9p-2L, 0x1.846p-1, -0x1.39fb8379f3b98p-101 },
+    { 0x1.1df4cc7cf242d0fc1157df8e8p-2L, 0x1.834p-1, -0x1.69536da909c0fp-101 },
+    { 0x1.20ef7630666d1f0cd14a96e68p-2L, 0x1.822p-1, 0x1.3a8585def6aabp-101 },
+    { 0x1.23ec5991eba4906edd746b78p-2L, 0x1.81p-1, -0x1.e4169da0a6f44p-102 },
+    { 0x1.26eb79f70e869657b93144c98p-2L, 0x1.7fep-1, -0x1.46579d13616e7p-101 },
+    { 0x1.29ecdabcdfa039d9dee1121ap-2L, 0x1.7ecp-1, -0x1.775ca0b3ebccfp-103 },
+    { 0x1.2cf07f480a154f582bb47b9e8p-2L, 0x1.7dap-1, 0x1.1c2773253bbe3p-101 },
+    { 0x1.2ff66b04ea9d44b6af864747p-2L, 0x1.7c8p-1, 0x1.28e7a01c1b6c1p-101 },
+    { 0x1.32fea167a6d70fa02c16a34e8p-2L, 0x1.7b6p-1, -0x1.d294510f7a057p-101 },
+    { 0x1.360925ec44f5c94f9a25de878p-2L, 0x1.7a4p-1, 0x1.49ad3641e2a33p-103 },
+    { 0x1.3915fc16c3c78d9676362f938p-2L, 0x1.792p-1, 0x1.1120cabafe825p-108 },
+    { 0x1.3bce0507acee8c3764674c128p-2L, 0x1.782p-1, -0x1.efe828b966642p-102 },
+    { 0x1.3edf463c1683e60f5a034f04p-2L, 0x1.77p-1, 0x1.087332d5d278ep-101 },
+    { 0x1.419b423d5e8c721b7648704e8p-2L, 0x1.76p-1, -0x1.b9c9208290976p-103 },
+    { 0x1.44b0fb5af4f42fa1cff0fa52p-2L, 0x1.74ep-1, 0x1.d2661d51053e9p-101 },
+  },
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Shared helpers for binary128 log and log(1+x) functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef PL_MATH_LOGL_INLINE_H
+#define PL_MATH_LOGL_INLINE_H
+
+#include "binary128.h"
+
+#if LDBL_MANT_DIG == 113
+
+# define N (1 << LOGL_TABLE_BITS)
+# define Ln2hi __logl_data.ln2hi
+# define Ln2lo __logl_data.ln2lo
+# define T __logl_data.tab
+# define C(i) __logl_data.poly[(i) - 2]
+# define D(i) __logl_data.dpoly[(i) - 8]
+/* top64(0x1.6p-1), the subintervals cover [Off, 2 Off).  */
+# define Off 0x3ffe600000000000
+/* top64(1 - 0x1p-9) and top64(1 + 0x1p-9).  */
+# define NearOneLo 0x3ffeff0000000000
+# define NearOneHi 0x3fff008000000000
+
+/* (log(1+r) - r) / r^2 for |r| < 0x1.1p-9.  Terms of order 8 and above of
+   log(1+r) are below 2^-71, so they are computed in double.  */
+static inline long double
+logl_poly (long double r)
+{
+  double rd = r;
+  double q = D (8)
+	     + rd * (D (9)
+		     + rd * (D (10)
+			     + rd * (D (11) + rd * (D (12) + rd * D (13)))));
+  long double p = C (7) + r * q;
+  p = C (6) + r * p;
+  p = C (5) + r * p;
+  p = C (4) + r * p;
+  p = C (3) + r * p;
+  return C (2) + r * p;
+}
+
+/* log(x + x tail) for |tail| < 2^-112, where ix is the representation of a
+   positive x with |x - 1| >= 2^-9.  Subnormal x can be passed as
+   asuint128 (x * 0x1p113L) - (113 << 112).  With x = 2^k z, z in
+   [Off, 2 Off),
+     log(x) = k ln2 - log(invc) + log(1 + r),  r = z invc - 1,
+   where invc has 12 significant bits, so r is exact when computed from the
+   high 101 and low 12 bits of z separately.  */
+static inline long double
+logl_inline (unsigned __int128 ix, double tail)
+{
+  uint64_t tmp = (ix >> 64) - Off;
+  int i = (tmp >> (48 - LOGL_TABLE_BITS)) % N;
+  int64_t k = (int64_t) tmp >> 48;
+  unsigned __int128 iz
+      = ix - ((unsigned __int128) (tmp & 0xffff000000000000) << 64);
+  long double z = asldouble (iz);
+  long double zhi = asldouble (iz & ~(unsigned __int128) 0xfff);
+  long double invc = T[i].invc;
+  long double r = (zhi * invc - 1.0L) + (z - zhi) * invc;
+
+  /* k ln2hi + logc is exact and |r| < |logc| for k = 0.  */
+  long double w = (long double) k * Ln2hi + T[i].logc;
+  long double hi = w + r;
+  long double lo = (w - hi) + r;
+  lo += (long double) (k * Ln2lo + T[i].logctail + tail);
+  return hi + (lo + r * r * logl_poly (r));
+}
+
+#endif /* LDBL_MANT_DIG == 113.  */
+
+#endif
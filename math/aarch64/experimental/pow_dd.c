@@ -0,0 +1,120 @@
+/*
+ * Double-precision x^y function with a double-double result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "test_defs.h"
+#include "dd_inline.h"
+
+/* Return r and set *tail such that r + *tail approximates x^y, r is x^y
+   rounded and *tail is the rounding error, |*tail| <= ulp(r)/2.  The
+   algorithm is the one of pow, with the final exp returning a double-double
+   result, see exp_dd_inline.  The error of the log is amplified by |y log(x)|
+   so the relative error of r + *tail is about 2^-68 |y log(x)| + 2^-65.
+   This is at most 2^-58.5 for normal results.  Maximum measured relative
+   error of r + *tail is 2^-58.6, for large |y log(x)|:
+   arm_math_pow_dd (0x1.fd641505bea46p-1, -0x1.e9f683870aa69p+16)
+     got 0x1.663f7177c9e84p+924 + 0x1.01115p+869
+    want 0x1.663f7177c9e84p+924 + 0x1.c85975603db9cp+868.
+   Maximum error of r alone is 0.502 ULP.  */
+double
+arm_math_pow_dd (double x, double y, double *tail)
+{
+  uint32_t sign_bias = 0;
+  uint64_t ix, iy;
+  uint32_t topx, topy;
+
+  ix = asuint64 (x);
+  iy = asuint64 (y);
+  topx = top12 (x);
+  topy = top12 (y);
+  *tail = 0.0;
+  if (unlikely (topx - 0x001 >= 0x7ff - 0x001
+		|| (topy & 0x7ff) - 0x3be >= 0x43e - 0x3be))
+    {
+      /* Special cases: (x < 0x1p-126 or inf or nan) or
+	 (|y| < 0x1p-65 or |y| >= 0x1p63 or nan).  */
+      if (unlikely (zeroinfnan (iy)))
+	{
+	  if (2 * iy == 0)
+	    return issignaling_inline (x) ? x + y : 1.0;
+	  if (ix == asuint64 (1.0))
+	    return issignaling_inline (y) ? x + y : 1.0;
+	  if (2 * ix > 2 * asuint64 (INFINITY)
+	      || 2 * iy > 2 * asuint64 (INFINITY))
+	    return x + y;
+	  if (2 * ix == 2 * asuint64 (1.0))
+	    return 1.0;
+	  if ((2 * ix < 2 * asuint64 (1.0)) == !(iy >> 63))
+	    return 0.0; /* |x|<1 && y==inf or |x|>1 && y==-inf.  */
+	  return y * y;
+	}
+      if (unlikely (zeroinfnan (ix)))
+	{
+	  double x2 = x * x;
+	  if (ix >> 63 && checkint (iy) == 1)
+	    {
+	      x2 = -x2;
+	      sign_bias = 1;
+	    }
+	  if (WANT_ERRNO && 2 * ix == 0 && iy >> 63)
+	    return __math_divzero (sign_bias);
+	  /* Without the barrier some versions of clang hoist the 1/x2 and
+	     thus division by zero exception can be signaled spuriously.  */
+	  return iy >> 63 ? opt_barrier_double (1 / x2) : x2;
+	}
+      /* Here x and y are non-zero finite.  */
+      if (ix >> 63)
+	{
+	  /* Finite x < 0.  */
+	  int yint = checkint (iy);
+	  if (yint == 0)
+	    return __math_invalid (x);
+	  if (yint == 1)
+	    sign_bias = SIGN_BIAS;
+	  ix &= 0x7fffffffffffffff;
+	  topx &= 0x7ff;
+	}
+      /* Note: if |y| > 1075 * ln2 * 2^53 ~= 0x1.749p62 then pow(x,y) = inf/0.
+	 Unlike pow, |y| < 2^-65 is not special cased: the result is then
+	 1 + y log(x) and that is computed by exp_dd_inline.  */
+      if ((topy & 0x7ff) >= 0x43e)
+	{
+	  /* Note: sign_bias == 0 here because y is not odd.  */
+	  if (ix == asuint64 (1.0))
+	    return 1.0;
+	  return (ix > asuint64 (1.0)) == (topy < 0x800) ? __math_oflow (0)
+							 : __math_uflow (0);
+	}
+      if (topx == 0)
+	{
+	  /* Normalize subnormal x so exponent becomes negative.  */
+	  /* Without the barrier some versions of clang evalutate the mul
+	     unconditionally causing spurious overflow exceptions.  */
+	  ix = asuint64 (opt_barrier_double (x) * 0x1p52);
+	  ix &= 0x7fffffffffffffff;
+	  ix -= 52ULL << 52;
+	}
+    }
+
+  double lo;
+  double hi = log_dd_inline (ix, &lo);
+  double ehi = y * hi;
+  double elo = y * lo + fma (y, hi, -ehi);
+  return exp_dd_inline (ehi, elo, sign_bias, tail);
+}
+
+TEST_ULP (arm_math_pow_dd, 0.02)
+TEST_ULP_NONNEAREST (arm_math_pow_dd, 0.5)
+TEST_INTERVAL2 (arm_math_pow_dd, 0.5, 2.0, 0, inf, 20000)
+TEST_INTERVAL2 (arm_math_pow_dd, -0.5, -2.0, 0, inf, 20000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0.5, 2.0, 0x1p-10, 0x1p10, 40000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0, inf, 0.5, 2.0, 80000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0, inf, -0.5, -2.0, 80000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0x1.fp-1, 0x1.08p0, 0x1p8, 0x1p17, 80000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0, 0x1p-1000, 0, 1.0, 50000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0x1p1000, inf, 0, 1.0, 50000)
+TEST_INTERVAL2 (arm_math_pow_dd, 0x1p-100, 0x1p100, 0x1p-80, 0x1p-60, 50000)
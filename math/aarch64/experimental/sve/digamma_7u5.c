@@ -0,0 +1,148 @@
+/*
+ * Double-precision SVE digamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_polygamma_common.h"
+
+#define SV_LOG_INLINE_POLY_ORDER 5
+#include "sv_log_inline.h"
+
+static const struct data
+{
+  struct sv_polygamma_refl_data refl;
+  double num[7], den[6], asym_poly[7];
+  double c0_hi, c0_lo;
+  struct sv_log_inline_data log_consts;
+} data = {
+  .refl = SV_POLYGAMMA_REFL_DATA,
+  /* digamma(1 + w) = (w - c0) N(w) / D(w) for w in [0, 1), with c0 = x0 - 1
+     and x0 the positive zero of digamma.  */
+  .num = { 0x1.4018e9a62525ep+0, 0x1.deb537e2d6b0bp+0, 0x1.f2d3b8a179f45p-1,
+	   0x1.bdc097752559bp-3, 0x1.4a8ba5f0e08d9p-6, 0x1.35db381b40977p-11,
+	   0x1.2c8f08432442cp-20 },
+  .den = { 0x1.16eb3f1b747f9p+1, 0x1.aab8449d46457p+0, 0x1.25ac0090cf2abp-1,
+	   0x1.780de5f434abcp-4, 0x1.94ae8841202e5p-8, 0x1.0142d52c79195p-13 },
+  .c0_hi = 0x1.d8b618d5af8fep-2,
+  .c0_lo = -0x1.1e563779a1f5bp-56,
+  /* digamma(t) = log(t) - 1/(2t) - z P(z), z = 1/t^2, t >= AsymBound.  */
+  .asym_poly = { 0x1.555555555553ap-4, -0x1.1111111055cb6p-7,
+		 0x1.04103dab6c771p-8, -0x1.110e2d3db4bd7p-8,
+		 0x1.ef4817bf53638p-8, -0x1.48b594e7fd2d6p-6,
+		 0x1.b0e4cf5d0914dp-5 },
+  .log_consts = SV_LOG_CONSTANTS,
+};
+
+#define AsymBound 6.0
+#define TinyBound 0x1p-60
+
+/* For |x| < TinyBound, digamma(x) rounds to -1/x, which gives -inf for +0
+   and +inf for -0.  Negative integers and -inf return NaN, +inf returns
+   +inf.  */
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t cmp)
+{
+  svfloat64_t ys
+      = svsel (svcmpgt (cmp, x, 0.0), x, sv_f64 (__builtin_nan ("")));
+  svbool_t tiny = svaclt (cmp, x, TinyBound);
+  ys = svsel (tiny, svdivr_x (cmp, x, -1.0), ys);
+  return svsel (cmp, ys, y);
+}
+
+/* digamma(t) for t < AsymBound, see _ZGVnN2v_digamma.  */
+static inline svfloat64_t
+digamma_small (svbool_t pg, svfloat64_t t, const struct data *d)
+{
+  svfloat64_t n = svrintm_x (pg, svsub_x (pg, t, 1.0));
+  /* Only lanes in [1, AsymBound) need the sum, this also clears NaN.  */
+  n = svsel (svcmplt (pg, t, AsymBound), n, sv_f64 (0));
+  svbool_t lt1 = svcmplt (pg, n, 0.0);
+  svfloat64_t a = svsel (lt1, sv_f64 (-1.0), sv_f64 (0));
+  svfloat64_t b = svsel (lt1, t, sv_f64 (1.0));
+  svfloat64x2_t s = sv_polygamma_sum (pg, a, b, t, svneg_x (pg, n), n, 0);
+  a = svget2 (s, 0);
+  b = svget2 (s, 1);
+
+  /* w = y - 1 = t - (n + 1) is exact.  */
+  svfloat64_t w = svsub_x (pg, t, svadd_x (pg, n, 1.0));
+  svfloat64_t dw = svsub_x (pg, svsub_x (pg, w, d->c0_hi), d->c0_lo);
+  svfloat64_t p = svmul_x (pg, dw, sv_horner_6_f64_x (pg, w, d->num));
+  svfloat64_t q = svmad_x (pg, w, sv_horner_5_f64_x (pg, w, d->den), 1.0);
+
+  /* digamma(t) = p/q + a/b, with a single division.  */
+  return svdiv_x (pg, svmla_x (pg, svmul_x (pg, a, q), p, b),
+		  svmul_x (pg, q, b));
+}
+
+/* digamma(t) for t >= AsymBound.  */
+static inline svfloat64_t
+digamma_asym (svbool_t pg, svfloat64_t t, const struct data *d)
+{
+  svfloat64_t r = svdivr_x (pg, t, 1.0);
+  svfloat64_t z = svmul_x (pg, r, r);
+  svfloat64_t p
+      = svmad_x (pg, sv_horner_6_f64_x (pg, z, d->asym_poly), r, 0.5);
+  return svmls_x (pg, sv_log_inline (pg, t, &d->log_consts), r, p);
+}
+
+/* SVE implementation of digamma, see _ZGVnN2v_digamma.  Relative error is
+   unbounded around the negative zeros.  For x > 0, the maximum observed error
+   is 5.14 ULP:
+   _ZGVsMxv_digamma(0x1.829396f757abp+1) got 0x1.dc85184c18201p-1
+					 want 0x1.dc85184c18206p-1
+   and away from the negative zeros by at least 1/16, 7.15 ULP:
+   _ZGVsMxv_digamma(-0x1.8eec440ceb61fp+6) got 0x1.d3329b3f8b1c6p+0
+					   want 0x1.d3329b3f8b1bfp+0.  */
+svfloat64_t SV_NAME_D1 (digamma) (svfloat64_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t neg = svcmplt (pg, x, 0.0);
+  svfloat64_t t = svsel (neg, svsubr_x (pg, x, 1.0), x);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  svbool_t asym = svcmpge (pg, t, AsymBound);
+  svfloat64_t y;
+  if (!svptest_any (pg, asym))
+    y = digamma_small (pg, t, d);
+  else
+    {
+      y = digamma_asym (pg, t, d);
+      svbool_t small = svcmplt (pg, t, AsymBound);
+      if (svptest_any (pg, small))
+	y = svsel (small, digamma_small (pg, t, d), y);
+    }
+
+  if (unlikely (svptest_any (pg, neg)))
+    y = svsel (neg, svsub_x (pg, y, sv_polygamma_picot (pg, x, &d->refl)),
+	       y);
+
+  /* Tiny x, x = inf and negative integers including -inf.  */
+  svbool_t cmp = svorr_z (pg, svaclt (pg, x, TinyBound),
+			  svcmpeq (pg, x, INFINITY));
+  cmp = svorr_z (pg, cmp, svcmpeq (neg, x, svrinta_x (pg, x)));
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_SIG (SV, D, 1, digamma, 0.01, 10.0)
+TEST_ULP (SV_NAME_D1 (digamma), 6.66)
+TEST_INTERVAL (SV_NAME_D1 (digamma), 0, 0x1p-60, 1000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), 0x1p-60, 1, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), 1, 6, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), 6, 0x1p1023, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), inf, inf, 1)
+/* Errors are only bounded away from the negative zeros, test in between.  */
+TEST_INTERVAL (SV_NAME_D1 (digamma), -0, -0x1p-60, 1000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), -0x1p-60, -0.44, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), -0.57, -1.51, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), -1.64, -2.54, 100000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), -99.1, -99.74, 10000)
+TEST_INTERVAL (SV_NAME_D1 (digamma), -inf, -inf, 1)
+CLOSE_SVE_ATTR
@@ -0,0 +1,134 @@
+/*
+ * Single-precision SVE digamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_polygammaf_common.h"
+#include "sv_logf_inline.h"
+
+static const struct data
+{
+  struct sv_polygammaf_refl_data refl;
+  float num[4], den[3], asym_poly[5];
+  float c0_hi, c0_lo;
+  struct sv_logf_data logf_consts;
+} data = {
+  .refl = SV_POLYGAMMAF_REFL_DATA,
+  /* digamma(1 + w) = (w - c0) N(w) / D(w) for w in [0, 1), with c0 = x0 - 1
+     and x0 the positive zero of digamma.  */
+  .num = { 0x1.4018eap+0f, 0x1.2182fcp+0f, 0x1.af5756p-3f, 0x1.486ecap-9f },
+  .den = { 0x1.9686e2p+0f, 0x1.4de2b2p-1f, 0x1.045e36p-4f },
+  .c0_hi = 0x1.d8b618p-2f,
+  .c0_lo = 0x1.ab5f2p-27f,
+  /* digamma(t) = log(t) - 1/(2t) - z P(z), z = 1/t^2, t >= AsymBound.  */
+  .asym_poly = { 0x1.555554p-4f, -0x1.11030cp-7f, 0x1.0033aap-8f,
+		 -0x1.bb5c2ep-9f, 0x1.3eafeep-9f },
+  .logf_consts = SV_LOGF_CONSTANTS,
+};
+
+#define AsymBound 2.0f
+#define TinyBound 0x1p-30f
+
+/* For |x| < TinyBound, digamma(x) rounds to -1/x, which gives -inf for +0
+   and +inf for -0.  Negative integers and -inf return NaN, +inf returns
+   +inf.  */
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp)
+{
+  svfloat32_t ys
+      = svsel (svcmpgt (cmp, x, 0.0f), x, sv_f32 (__builtin_nanf ("")));
+  svbool_t tiny = svaclt (cmp, x, TinyBound);
+  ys = svsel (tiny, svdivr_x (cmp, x, -1.0f), ys);
+  return svsel (cmp, ys, y);
+}
+
+/* digamma(t) for t < AsymBound, see _ZGVnN4v_digammaf.  */
+static inline svfloat32_t
+digamma_small (svbool_t pg, svfloat32_t t, const struct data *d)
+{
+  svbool_t lt1 = svcmplt (pg, t, 1.0f);
+  svfloat32_t a = svsel (lt1, sv_f32 (-1.0f), sv_f32 (0));
+  svfloat32_t b = svsel (lt1, t, sv_f32 (1.0f));
+  /* w = t + 1 - 1 or t - 1, both exact in their range.  */
+  svfloat32_t w = svsel (lt1, t, svsub_x (pg, t, 1.0f));
+
+  svfloat32_t dw = svsub_x (pg, svsub_x (pg, w, d->c0_hi), d->c0_lo);
+  svfloat32_t p = svmul_x (pg, dw, sv_horner_3_f32_x (pg, w, d->num));
+  svfloat32_t q = svmad_x (pg, w, sv_horner_2_f32_x (pg, w, d->den), 1.0f);
+
+  /* digamma(t) = p/q + a/b, with a single division.  */
+  return svdiv_x (pg, svmla_x (pg, svmul_x (pg, a, q), p, b),
+		  svmul_x (pg, q, b));
+}
+
+/* digamma(t) for t >= AsymBound.  */
+static inline svfloat32_t
+digamma_asym (svbool_t pg, svfloat32_t t, const struct data *d)
+{
+  svfloat32_t r = svdivr_x (pg, t, 1.0f);
+  svfloat32_t z = svmul_x (pg, r, r);
+  svfloat32_t p
+      = svmad_x (pg, sv_horner_4_f32_x (pg, z, d->asym_poly), r, 0.5f);
+  return svmls_x (pg, sv_logf_inline (pg, t, &d->logf_consts), r, p);
+}
+
+/* SVE implementation of digamma, see _ZGVnN4v_digammaf.  Relative error is
+   unbounded around the negative zeros.  For x > 0, the maximum observed error
+   is 4.54 ULP:
+   _ZGVsMxv_digammaf(0x1.bbc08ap+0) got 0x1.e0b28cp-3
+				    want 0x1.e0b282p-3
+   and away from the negative zeros by at least 1/16, 7.72 ULP:
+   _ZGVsMxv_digammaf(-0x1.8ee948p+6) got 0x1.e039ep+0
+				     want 0x1.e039dp+0.  */
+svfloat32_t SV_NAME_F1 (digamma) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t neg = svcmplt (pg, x, 0.0f);
+  svfloat32_t t = svsel (neg, svsubr_x (pg, x, 1.0f), x);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  svbool_t asym = svcmpge (pg, t, AsymBound);
+  svfloat32_t y;
+  if (!svptest_any (pg, asym))
+    y = digamma_small (pg, t, d);
+  else
+    {
+      y = digamma_asym (pg, t, d);
+      svbool_t small = svcmplt (pg, t, AsymBound);
+      if (svptest_any (pg, small))
+	y = svsel (small, digamma_small (pg, t, d), y);
+    }
+
+  if (unlikely (svptest_any (pg, neg)))
+    y = svsel (neg, svsub_x (pg, y, sv_polygammaf_picot (pg, x, &d->refl)),
+	       y);
+
+  /* Tiny x, x = inf and negative integers including -inf.  */
+  svbool_t cmp = svorr_z (pg, svaclt (pg, x, TinyBound),
+			  svcmpeq (pg, x, INFINITY));
+  cmp = svorr_z (pg, cmp, svcmpeq (neg, x, svrinta_x (pg, x)));
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_SIG (SV, F, 1, digamma, 0.01, 10.0)
+TEST_ULP (SV_NAME_F1 (digamma), 7.22)
+TEST_INTERVAL (SV_NAME_F1 (digamma), 0, 0x1p-30, 1000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), 0x1p-30, 1, 100000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), 1, 2, 100000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), 2, inf, 100000)
+/* Errors are only bounded away from the negative zeros, test in between.  */
+TEST_INTERVAL (SV_NAME_F1 (digamma), -0, -0x1p-30, 1000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), -0x1p-30, -0.44, 100000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), -0.57, -1.51, 100000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), -1.64, -2.54, 100000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), -99.1, -99.74, 10000)
+TEST_INTERVAL (SV_NAME_F1 (digamma), -inf, -inf, 1)
+CLOSE_SVE_ATTR
@@ -0,0 +1,74 @@
+/*
+ * Reproducible single-precision vector e^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+#include "aarch64/experimental/expf_repro.h"
+
+static const struct data
+{
+  float ln2_hi, ln2_lo, c0, null;
+  float inv_ln2, shift, c1, c2, c3, c4;
+  uint32_t thres;
+} data = {
+  .ln2_hi = ExpfReproLn2hi,
+  .ln2_lo = ExpfReproLn2lo,
+  .inv_ln2 = ExpfReproInvLn2,
+  .shift = ExpfReproShift,
+  .c0 = ExpfReproC0,
+  .c1 = ExpfReproC1,
+  .c2 = ExpfReproC2,
+  .c3 = ExpfReproC3,
+  .c4 = ExpfReproC4,
+  .thres = ExpfReproThres,
+};
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t special)
+{
+  return sv_call_f32 (arm_math_expf_repro, x, y, special);
+}
+
+/* Reproducible SVE expf, bit-identical to arm_math_expf_repro in all rounding
+   modes. Unlike _ZGVsMxv_expf it does not use FEXPA, every lane follows the
+   evaluation order of the scalar routine (see expf_repro.h), and special lanes
+   are computed by it.
+   Maximum error is 1.45 +0.5 ULP:
+   arm_math_sve_expf_repro(-0x1.4cb5fep+2) got 0x1.6a0982p-8
+					  want 0x1.6a0986p-8.  */
+svfloat32_t
+arm_math_sve_expf_repro (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svfloat32_t lane_consts = svld1rq (svptrue_b32 (), &d->ln2_hi);
+
+  svuint32_t iax = svand_x (pg, svreinterpret_u32 (x), 0x7fffffff);
+  svbool_t special = svcmpgt (pg, iax, d->thres);
+
+  svfloat32_t z = svmla_x (pg, sv_f32 (d->shift), x, d->inv_ln2);
+  svfloat32_t n = svsub_x (pg, z, d->shift);
+  svfloat32_t r = svmls_lane (x, n, lane_consts, 0);
+  r = svmls_lane (r, n, lane_consts, 1);
+  svuint32_t e = svlsl_x (pg, svreinterpret_u32 (z), 23);
+
+  svfloat32_t p = svmla_lane (sv_f32 (d->c1), r, lane_consts, 2);
+  p = svmad_x (pg, p, r, d->c2);
+  p = svmad_x (pg, p, r, d->c3);
+  p = svmad_x (pg, p, r, d->c4);
+  svfloat32_t y = svmad_x (pg, p, r, 1.0f);
+  y = svreinterpret_f32 (svadd_x (pg, svreinterpret_u32 (y), e));
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+TEST_ULP (arm_math_sve_expf_repro, 1.46)
+TEST_SYM_INTERVAL (arm_math_sve_expf_repro, 0, 0x1.58p6, 50000)
+TEST_SYM_INTERVAL (arm_math_sve_expf_repro, 0x1.58p6, inf, 50000)
+CLOSE_SVE_ATTR
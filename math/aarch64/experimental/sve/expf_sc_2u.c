@@ -0,0 +1,102 @@
+/*
+ * Streaming-compatible single-precision SVE e^x function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+
+#if __ARM_FEATURE_SME
+
+/* Value of |x| above which scale overflows without special treatment.  */
+# define SpecialBound 0x1.5ebb83cf2cf96p+6 /* ≈ 87.69.  */
+
+static const struct data
+{
+  float ln2_hi, ln2_lo, c0, c2;
+  float c1, c3, c4, inv_ln2, special_bound, scale_bound;
+  uint32_t exponent_bias, special_offset, special_bias;
+} data = {
+  /* Coefficients and reduction are those of _ZGVnN4v_expf.  */
+  .c0 = 0x1.0e4020p-7f,
+  .c1 = 0x1.573e2ep-5f,
+  .c2 = 0x1.555e66p-3f,
+  .c3 = 0x1.fffdb6p-2f,
+  .c4 = 0x1.ffffecp-1f,
+  .inv_ln2 = 0x1.715476p+0f,
+  .ln2_hi = 0x1.62e4p-1f,
+  .ln2_lo = 0x1.7f7d1cp-20f,
+  .exponent_bias = 0x3f800000,
+  .special_bound = SpecialBound,
+  .special_offset = 0x82000000,
+  .special_bias = 0x7f000000,
+  /* Value of n above which scale overflows even with special treatment.  */
+  .scale_bound = 0x1.8p+7, /* 192.0f.  */
+};
+
+static inline svfloat32_t
+special_case (svfloat32_t poly, svfloat32_t n, svuint32_t e, svbool_t cmp1,
+	      svfloat32_t scale, const struct data *d) SC_ATTR
+{
+  /* 2^n may overflow, break it up into s1*s2.  */
+  svbool_t ptrue = svptrue_b32 ();
+  svuint32_t b = svsel (svcmple (ptrue, n, 0.0f),
+			svdup_u32 (d->special_offset), svdup_u32 (0));
+  svfloat32_t s1 = svreinterpret_f32 (svadd_x (ptrue, b, d->special_bias));
+  svfloat32_t s2 = svreinterpret_f32 (svsub_x (ptrue, e, b));
+  svbool_t cmp2 = svacgt (ptrue, n, d->scale_bound);
+  svfloat32_t r2 = svmul_x (ptrue, s1, s1);
+  svfloat32_t r1 = svmul_x (ptrue, svmla_x (ptrue, s2, poly, s2), s1);
+  /* Similar to r1 but avoids double rounding in the subnormal range.  */
+  svfloat32_t r0 = svmla_x (ptrue, scale, poly, scale);
+  svfloat32_t r = svsel (cmp1, r1, r0);
+  return svsel (cmp2, r2, r);
+}
+
+/* Streaming-compatible SVE expf, safe to call with PSTATE.SM set.
+   _ZGVsMxv_expf relies on FEXPA, which is illegal in streaming mode, and
+   falls back to scalar calls for special lanes.  This variant uses the
+   shift-based reconstruction of the AdvSIMD routine instead, and handles
+   special lanes entirely in vector registers.
+   The maximum error is 1.44 +0.5 ULP:
+   arm_math_sve_sc_expf(-0x1.86f03cp+5) got 0x1.69e27p-71
+				       want 0x1.69e274p-71.  */
+svfloat32_t
+arm_math_sve_sc_expf (svfloat32_t x, const svbool_t pg) SC_ATTR
+{
+  const struct data *d = ptr_barrier (&data);
+  svfloat32_t lane_consts = svld1rq (svptrue_b32 (), &d->ln2_hi);
+
+  /* exp(x) = 2^n (1 + poly(r)), with 1 + poly(r) in [1/sqrt(2),sqrt(2)]
+     x = ln2*n + r, with r in [-ln2/2, ln2/2].  */
+  svfloat32_t n = svrinta_x (pg, svmul_x (pg, x, d->inv_ln2));
+  svfloat32_t r = svmls_lane (x, n, lane_consts, 0);
+  r = svmls_lane (r, n, lane_consts, 1);
+  svuint32_t e = svlsl_x (pg, svreinterpret_u32 (svcvt_s32_x (pg, n)), 23);
+  svfloat32_t scale = svreinterpret_f32 (svadd_x (pg, e, d->exponent_bias));
+
+  svbool_t cmp = svacge (pg, x, d->special_bound);
+
+  svfloat32_t r2 = svmul_x (pg, r, r);
+  svfloat32_t p = svmla_lane (svdup_f32 (d->c1), r, lane_consts, 2);
+  svfloat32_t q = svmla_lane (svdup_f32 (d->c3), r, lane_consts, 3);
+  q = svmla_x (pg, q, p, r2);
+  p = svmul_x (pg, r, d->c4);
+  svfloat32_t poly = svmla_x (pg, p, q, r2);
+
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (poly, n, e, cmp, scale, d);
+
+  return svmla_x (pg, scale, poly, scale);
+}
+
+TEST_ULP (arm_math_sve_sc_expf, 1.49)
+TEST_INTERVAL (arm_math_sve_sc_expf, 0, 0xffff0000, 10000)
+TEST_SYM_INTERVAL (arm_math_sve_sc_expf, 0, 0x1p-23, 50000)
+TEST_SYM_INTERVAL (arm_math_sve_sc_expf, 0x1p-23, SpecialBound, 50000)
+TEST_SYM_INTERVAL (arm_math_sve_sc_expf, SpecialBound, inf, 10000)
+#endif
+CLOSE_SVE_ATTR
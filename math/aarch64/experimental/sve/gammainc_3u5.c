@@ -0,0 +1,52 @@
+/*
+ * Double-precision SVE regularized lower incomplete gamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_gammainc_common.h"
+
+static svfloat64_t NOINLINE
+special_lanes (svfloat64_t a, svfloat64_t x, svfloat64_t y, svbool_t cmp)
+{
+  return svsel (cmp, sv_gammainc_special (cmp, a, x, 0), y);
+}
+
+/* SVE implementation of P(a, x), see _ZGVnN2vv_gammainc.  The maximum
+   observed error is 3.24 ULP:
+   _ZGVsMxvv_gammainc(0x1.e5d8295951711p-1, 0x1.477a952a5b838p-1)
+     got 0x1.fdc38aa544679p-2 want 0x1.fdc38aa544676p-2.  */
+svfloat64_t SV_NAME_D2 (gammainc) (svfloat64_t a, svfloat64_t x,
+				   const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  const struct sv_gammainc_data *g = ptr_barrier (&sv_gammainc_data);
+  /* Lanes with a or x not positive and finite, including NaN.  */
+  svbool_t ok = svand_z (pg, svcmpgt (pg, a, 0.0), svcmplt (pg, a, INFINITY));
+  ok = svand_z (pg, ok, svcmpgt (pg, x, 0.0));
+  ok = svand_z (pg, ok, svcmplt (pg, x, INFINITY));
+  svbool_t cmp = svbic_z (pg, pg, ok);
+  if (unlikely (svptest_any (pg, cmp)))
+    {
+      svfloat64_t y = sv_gammainc_inline (pg, svsel (ok, a, sv_f64 (1.0)),
+					  svsel (ok, x, sv_f64 (1.0)), 0, d,
+					  g);
+      return special_lanes (a, x, y, cmp);
+    }
+  return sv_gammainc_inline (pg, a, x, 0, d, g);
+}
+
+TEST_SIG (SV, D, 2, gammainc, 0.01, 20.0)
+TEST_ULP (SV_NAME_D2 (gammainc), 2.74)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 0x1p-20, 1, 0x1p-20, 1, 10000)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 0x1p-20, 1, 1, 40, 10000)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 1, 10, 0, 40, 10000)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 10, 100, 1, 300, 10000)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 100, 1000, 50, 2000, 10000)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), 0, inf, inf, inf, 100)
+TEST_INTERVAL2 (SV_NAME_D2 (gammainc), -0.0, -inf, 0, inf, 100)
+CLOSE_SVE_ATTR
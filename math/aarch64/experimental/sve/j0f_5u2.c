@@ -0,0 +1,57 @@
+/*
+ * Single-precision SVE Bessel function of the first kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_besself_common.h"
+
+static const struct data
+{
+  struct sv_besself_asym_data asym;
+  struct sv_besself_small_data small;
+} data = {
+  .asym = SV_BESSELF_ASYM0_DATA,
+  .small = SV_BESSELF_J0_SMALL_DATA,
+};
+
+/* SVE implementation of J0, the Bessel function of the first kind of order 0,
+   see _ZGVnN4v_j0f.  Relative error is unbounded around the zeros above the
+   first one, the error grows like 1/|x - zero|.  Away from zeros by at least
+   1/16, the maximum observed error is 5.19 ULP:
+   _ZGVsMxv_j0f(0x1.7a1d9p+1) got -0x1.f3dc94p-3
+			     want -0x1.f3dc9ep-3.  */
+svfloat32_t SV_NAME_F1 (j0) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svfloat32_t ax = svabs_x (pg, x);
+  svbool_t asym = svcmpge (pg, ax, AsymBound);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  svfloat32_t z = svmul_x (pg, ax, ax);
+  if (!svptest_any (pg, asym))
+    return sv_besself_small (pg, ax, z, &d->small);
+
+  svfloat32_t y = sv_besself_asym (pg, ax, 0, &d->asym);
+  svbool_t small = svnot_z (pg, asym);
+  if (svptest_any (pg, small))
+    return svsel (small, sv_besself_small (pg, ax, z, &d->small), y);
+  return y;
+}
+
+TEST_SIG (SV, F, 1, j0, -10.0, 10.0)
+TEST_ULP (SV_NAME_F1 (j0), 4.69)
+/* Errors are only bounded away from the zeros of J0, test in between.  */
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 0, 2.34, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 2.47, 5.45, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 5.59, 8.59, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 4092.78, 4095.78, 10000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 524287.11, 524290.12, 1000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), 2097150.61, 2097153.61, 1000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j0), inf, inf, 1)
+CLOSE_SVE_ATTR
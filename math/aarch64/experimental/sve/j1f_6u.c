@@ -0,0 +1,69 @@
+/*
+ * Single-precision SVE Bessel function of the first kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_besself_common.h"
+
+static const struct data
+{
+  struct sv_besself_asym_data asym;
+  struct sv_besself_small_data small;
+} data = {
+  .asym = SV_BESSELF_ASYM1_DATA,
+  .small = SV_BESSELF_J1_SMALL_DATA,
+};
+
+static inline svfloat32_t
+j1_small (svbool_t pg, svfloat32_t ax, const struct data *d)
+{
+  svfloat32_t z = svmul_x (pg, ax, ax);
+  return svmul_x (pg, ax, sv_besself_small (pg, ax, z, &d->small));
+}
+
+/* SVE implementation of J1, the Bessel function of the first kind of order 1,
+   see _ZGVnN4v_j1f.  Relative error is unbounded around the zeros above 0, the
+   error grows like 1/|x - zero|.  Away from zeros by at least 1/16, the
+   maximum observed error is 5.79 ULP:
+   _ZGVsMxv_j1f(0x1.e0fa5ep+1) got 0x1.ed1becp-6
+			     want 0x1.ed1bep-6.  */
+svfloat32_t SV_NAME_F1 (j1) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svfloat32_t ax = svabs_x (pg, x);
+  svuint32_t sign
+      = sveor_x (pg, svreinterpret_u32 (x), svreinterpret_u32 (ax));
+  svbool_t asym = svcmpge (pg, ax, AsymBound);
+
+  /* J1 is odd, evaluate on |x| and restore the sign.  NaN is not in the
+     asymptotic region, and propagates through the small region
+     approximation.  */
+  svfloat32_t y;
+  if (!svptest_any (pg, asym))
+    y = j1_small (pg, ax, d);
+  else
+    {
+      y = sv_besself_asym (pg, ax, 3, &d->asym);
+      svbool_t small = svnot_z (pg, asym);
+      if (svptest_any (pg, small))
+	y = svsel (small, j1_small (pg, ax, d), y);
+    }
+  return svreinterpret_f32 (sveor_x (pg, svreinterpret_u32 (y), sign));
+}
+
+TEST_SIG (SV, F, 1, j1, -10.0, 10.0)
+TEST_ULP (SV_NAME_F1 (j1), 5.29)
+/* Errors are only bounded away from the zeros of J1, test in between.  */
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 0, 3.76, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 3.9, 6.95, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 7.08, 10.11, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 4094.35, 4097.35, 10000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 524288.68, 524291.69, 1000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), 2097152.18, 2097155.18, 1000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (j1), inf, inf, 1)
+CLOSE_SVE_ATTR
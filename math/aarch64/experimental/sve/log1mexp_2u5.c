@@ -0,0 +1,48 @@
+/*
+ * Double-precision SVE log1mexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_logexp_common.h"
+
+static double
+log1mexp_scalar (double x)
+{
+  if (x > -0x1.62e42fefa39efp-1)
+    return log (-expm1 (x));
+  return log1p (-exp (x));
+}
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t cmp)
+{
+  return sv_call_f64 (log1mexp_scalar, x, y, cmp);
+}
+
+/* Same algorithm as the AdvSIMD routine, the maximum observed error is
+   2.49 ULP.  */
+svfloat64_t SV_NAME_D1 (log1mexp) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_logexp_data *d = ptr_barrier (&sv_logexp_data);
+  /* x close to 0 or positive needs log(0) or a subnormal -expm1.  */
+  svbool_t special = svorr_z (pg, sv_logexp_special (pg, sv_f64 (0), x, d),
+			      svcmpge (pg, x, -0x1p-1022));
+  svfloat64_t ret = sv_log1pmexp_inline (pg, x, sv_f64 (0), 1, d);
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (SV, D, 1, log1mexp, -10.0, -0.01)
+TEST_ULP (SV_NAME_D1 (log1mexp), 1.99)
+TEST_INTERVAL (SV_NAME_D1 (log1mexp), -0.0, -0x1p-20, 10000)
+TEST_INTERVAL (SV_NAME_D1 (log1mexp), -0x1p-20, -0.7, 100000)
+TEST_INTERVAL (SV_NAME_D1 (log1mexp), -0.7, -10, 100000)
+TEST_INTERVAL (SV_NAME_D1 (log1mexp), -10, -inf, 10000)
+TEST_INTERVAL (SV_NAME_D1 (log1mexp), 0, inf, 1000)
+CLOSE_SVE_ATTR
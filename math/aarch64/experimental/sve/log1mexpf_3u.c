@@ -0,0 +1,48 @@
+/*
+ * Single-precision SVE log1mexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_logexpf_common.h"
+
+static float
+log1mexpf_scalar (float x)
+{
+  if (x > -0x1.62e43p-1f)
+    return logf (-expm1f (x));
+  return log1pf (-expf (x));
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp)
+{
+  return sv_call_f32 (log1mexpf_scalar, x, y, cmp);
+}
+
+/* Same algorithm as the AdvSIMD routine, the maximum observed error is
+   2.51 ULP.  */
+svfloat32_t SV_NAME_F1 (log1mexp) (svfloat32_t x, const svbool_t pg)
+{
+  const struct sv_logexpf_data *d = ptr_barrier (&sv_logexpf_data);
+  /* x close to 0 or positive needs log(0) or a subnormal -expm1.  */
+  svbool_t special = svorr_z (pg, sv_logexpf_special (pg, sv_f32 (0), x, d),
+			      svcmpge (pg, x, -0x1p-126f));
+  svfloat32_t ret = sv_log1pmexpf_inline (pg, x, sv_f32 (0), 1, d);
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (SV, F, 1, log1mexp, -10.0, -0.01)
+TEST_ULP (SV_NAME_F1 (log1mexp), 2.01)
+TEST_INTERVAL (SV_NAME_F1 (log1mexp), -0.0, -0x1p-20, 10000)
+TEST_INTERVAL (SV_NAME_F1 (log1mexp), -0x1p-20, -0.7, 100000)
+TEST_INTERVAL (SV_NAME_F1 (log1mexp), -0.7, -10, 100000)
+TEST_INTERVAL (SV_NAME_F1 (log1mexp), -10, -inf, 10000)
+TEST_INTERVAL (SV_NAME_F1 (log1mexp), 0, inf, 1000)
+CLOSE_SVE_ATTR
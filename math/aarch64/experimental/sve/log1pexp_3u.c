@@ -0,0 +1,48 @@
+/*
+ * Double-precision SVE log1pexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_logexp_common.h"
+
+static double
+log1pexp_scalar (double x)
+{
+  if (x > 0)
+    return x + log1p (exp (-x));
+  return log1p (exp (x));
+}
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t cmp)
+{
+  return sv_call_f64 (log1pexp_scalar, x, y, cmp);
+}
+
+/* Same algorithm as the AdvSIMD routine, the maximum observed error is
+   2.76 ULP.  */
+svfloat64_t SV_NAME_D1 (log1pexp) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_logexp_data *d = ptr_barrier (&sv_logexp_data);
+  svfloat64_t m = svmax_x (pg, x, 0);
+  svfloat64_t t = svneg_x (pg, svabs_x (pg, x));
+  svbool_t special = sv_logexp_special (pg, m, t, d);
+  svfloat64_t ret
+      = svadd_x (pg, m, sv_log1pmexp_inline (pg, t, sv_f64 (0), 0, d));
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (SV, D, 1, log1pexp, -10.0, 10.0)
+TEST_ULP (SV_NAME_D1 (log1pexp), 2.26)
+TEST_INTERVAL (SV_NAME_D1 (log1pexp), 0, 10, 100000)
+TEST_INTERVAL (SV_NAME_D1 (log1pexp), 10, inf, 10000)
+TEST_INTERVAL (SV_NAME_D1 (log1pexp), -0.0, -10, 100000)
+TEST_INTERVAL (SV_NAME_D1 (log1pexp), -10, -inf, 10000)
+CLOSE_SVE_ATTR
@@ -0,0 +1,48 @@
+/*
+ * Single-precision SVE log1pexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_logexpf_common.h"
+
+static float
+log1pexpf_scalar (float x)
+{
+  if (x > 0)
+    return x + log1pf (expf (-x));
+  return log1pf (expf (x));
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp)
+{
+  return sv_call_f32 (log1pexpf_scalar, x, y, cmp);
+}
+
+/* Same algorithm as the AdvSIMD routine, the maximum observed error is
+   2.89 ULP.  */
+svfloat32_t SV_NAME_F1 (log1pexp) (svfloat32_t x, const svbool_t pg)
+{
+  const struct sv_logexpf_data *d = ptr_barrier (&sv_logexpf_data);
+  svfloat32_t m = svmax_x (pg, x, 0);
+  svfloat32_t t = svneg_x (pg, svabs_x (pg, x));
+  svbool_t special = sv_logexpf_special (pg, m, t, d);
+  svfloat32_t ret
+      = svadd_x (pg, m, sv_log1pmexpf_inline (pg, t, sv_f32 (0), 0, d));
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, ret, special);
+  return ret;
+}
+
+TEST_SIG (SV, F, 1, log1pexp, -10.0, 10.0)
+TEST_ULP (SV_NAME_F1 (log1pexp), 2.39)
+TEST_INTERVAL (SV_NAME_F1 (log1pexp), 0, 10, 100000)
+TEST_INTERVAL (SV_NAME_F1 (log1pexp), 10, inf, 10000)
+TEST_INTERVAL (SV_NAME_F1 (log1pexp), -0.0, -10, 100000)
+TEST_INTERVAL (SV_NAME_F1 (log1pexp), -10, -inf, 10000)
+CLOSE_SVE_ATTR
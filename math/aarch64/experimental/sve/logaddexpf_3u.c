@@ -0,0 +1,57 @@
+/*
+ * Single-precision SVE logaddexp function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_logexpf_common.h"
+
+static float
+logaddexpf_scalar (float x, float y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  float m = x > y ? x : y;
+  if (isinf (m))
+    return m;
+  return m + log1pf (expf ((x > y ? y : x) - m));
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svfloat32_t ret, svbool_t cmp)
+{
+  return sv_call2_f32 (logaddexpf_scalar, x, y, ret, cmp);
+}
+
+/* Same algorithm as the AdvSIMD routine.  The relative error is unbounded
+   around the curve e^x + e^y = 1, away from it the maximum observed error
+   is 2.56 ULP.  */
+svfloat32_t SV_NAME_F2 (logaddexp) (svfloat32_t x, svfloat32_t y,
+				    const svbool_t pg)
+{
+  const struct sv_logexpf_data *d = ptr_barrier (&sv_logexpf_data);
+  svfloat32_t m = svmax_x (pg, x, y);
+  svfloat32_t tl, t = sv_logexpf_diff (pg, svmin_x (pg, x, y), m, &tl);
+  svbool_t special = sv_logexpf_special (pg, m, t, d);
+  svfloat32_t ret = svadd_x (pg, m, sv_log1pmexpf_inline (pg, t, tl, 0, d));
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, ret, special);
+  return ret;
+}
+
+TEST_SIG (SV, F, 2, logaddexp, -10.0, 10.0)
+TEST_ULP (SV_NAME_F2 (logaddexp), 2.06)
+/* Errors are only bounded away from e^x + e^y = 1, test where
+   max(x, y) >= 0 or where both are below -1.2.  */
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), 0, 10, 0, 10, 10000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), 0, 10, -0.0, -10, 10000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), -0.0, -10, 0, 10, 10000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), -1.2, -100, -1.2, -100, 10000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), 10, inf, -0.0, -inf, 1000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), -0.0, -inf, 10, inf, 1000)
+TEST_INTERVAL2 (SV_NAME_F2 (logaddexp), -100, -inf, -100, -inf, 1000)
+CLOSE_SVE_ATTR
@@ -0,0 +1,134 @@
+/*
+ * Single-precision SVE uniform and normal random number generators.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "mathlib.h"
+#include "sv_logf_inline.h"
+#include "sv_sincosf_common.h"
+
+static const struct data
+{
+  struct sv_logf_data log_consts;
+  uint32_t m0, m1, w0, w1;
+  float inv_2p32, half_inv_2p32, pi_inv_2p23;
+} data = {
+  .log_consts = SV_LOGF_CONSTANTS,
+  /* Philox4x32 multipliers and Weyl key increments.  */
+  .m0 = 0xd2511f53,
+  .m1 = 0xcd9e8d57,
+  .w0 = 0x9e3779b9,
+  .w1 = 0xbb67ae85,
+  .inv_2p32 = 0x1p-32f,
+  .half_inv_2p32 = 0x1p-33f,
+  .pi_inv_2p23 = 0x1.921fb6p-22f,
+};
+
+/* Philox4x32-10 applied to the blocks counter, counter + 1, ..., one per
+   32-bit lane, see arm_math_advsimd_randu_f32.  */
+static inline svuint32x4_t
+philox (svbool_t pg, uint64_t counter, uint64_t seed, const struct data *d)
+{
+  uint32_t base = counter;
+  svuint32_t x0 = svindex_u32 (base, 1);
+  /* Propagate the carry of the low word.  */
+  svuint32_t x1 = svadd_m (svcmplt (pg, x0, base),
+			   sv_u32 ((uint32_t) (counter >> 32)), 1);
+  svuint32_t x2 = sv_u32 (0), x3 = sv_u32 (0);
+  uint32_t k0 = seed, k1 = seed >> 32;
+  for (int r = 0; r < 10; r++)
+    {
+      svuint32_t hi0 = svmulh_x (pg, x0, d->m0);
+      svuint32_t lo0 = svmul_x (pg, x0, d->m0);
+      svuint32_t hi1 = svmulh_x (pg, x2, d->m1);
+      svuint32_t lo1 = svmul_x (pg, x2, d->m1);
+      x0 = sveor_x (pg, sveor_x (pg, hi1, x1), k0);
+      x2 = sveor_x (pg, sveor_x (pg, hi0, x3), k1);
+      x1 = lo1;
+      x3 = lo0;
+      k0 += d->w0;
+      k1 += d->w1;
+    }
+  return svcreate4 (x0, x1, x2, x3);
+}
+
+static inline svfloat32_t
+uniform (svbool_t pg, svuint32_t w)
+{
+  return svmul_x (pg, svcvt_f32_x (pg, svlsr_x (pg, w, 8)), 0x1p-24f);
+}
+
+static inline svfloat32x4_t
+randu_block (svbool_t pg, uint64_t counter, uint64_t seed,
+	     const struct data *d)
+{
+  svuint32x4_t w = philox (pg, counter, seed, d);
+  return svcreate4 (uniform (pg, svget4 (w, 0)), uniform (pg, svget4 (w, 1)),
+		    uniform (pg, svget4 (w, 2)), uniform (pg, svget4 (w, 3)));
+}
+
+/* Box-Muller transform of the word pair (a, b), see
+   arm_math_advsimd_randn_f32.  The result holds r cos(t) and r sin(t).  */
+static inline svfloat32x2_t
+box_muller (svbool_t pg, svuint32_t a, svuint32_t b, const struct data *d)
+{
+  svfloat32_t u = svmla_x (pg, sv_f32 (d->half_inv_2p32),
+			   svcvt_f32_x (pg, a), d->inv_2p32);
+  svfloat32_t r = svsqrt_x (
+      pg, svmul_x (pg, sv_logf_inline (pg, u, &d->log_consts), -2.0f));
+  svfloat32_t t = svmul_x (
+      pg, svcvt_f32_x (pg, svasr_x (pg, svreinterpret_s32 (b), 8)),
+      d->pi_inv_2p23);
+  svfloat32x2_t sc = sv_sincosf_inline (t, &trig_data);
+  return svcreate2 (svmul_x (pg, r, svget2 (sc, 1)),
+		    svmul_x (pg, r, svget2 (sc, 0)));
+}
+
+static inline svfloat32x4_t
+randn_block (svbool_t pg, uint64_t counter, uint64_t seed,
+	     const struct data *d)
+{
+  svuint32x4_t w = philox (pg, counter, seed, d);
+  svfloat32x2_t z01 = box_muller (pg, svget4 (w, 0), svget4 (w, 1), d);
+  svfloat32x2_t z23 = box_muller (pg, svget4 (w, 2), svget4 (w, 3), d);
+  return svcreate4 (svget2 (z01, 0), svget2 (z01, 1), svget2 (z23, 0),
+		    svget2 (z23, 1));
+}
+
+/* One block per 32-bit lane, the 4 deviates of a block are stored
+   contiguously.  A partial last block still consumes a whole counter
+   value.  */
+#define RAND_F32(name, block)                                                 \
+  void name (struct arm_math_rng_state *s, float *out, size_t n)              \
+  {                                                                           \
+    const struct data *d = ptr_barrier (&data);                               \
+    uint64_t nblocks = n / 4;                                                 \
+    for (uint64_t i = 0; i < nblocks; i += svcntw ())                         \
+      {                                                                       \
+	svbool_t pg = svwhilelt_b32 (i, nblocks);                             \
+	svst4 (pg, out + 4 * i, block (pg, s->counter + i, s->seed, d));      \
+      }                                                                       \
+    if (n % 4 != 0)                                                           \
+      {                                                                       \
+	float tmp[4];                                                         \
+	svbool_t pg = svptrue_pat_b32 (SV_VL1);                               \
+	svst4 (pg, tmp, block (pg, s->counter + nblocks, s->seed, d));        \
+	for (size_t j = 0; j < n % 4; j++)                                    \
+	  out[4 * nblocks + j] = tmp[j];                                      \
+	nblocks++;                                                            \
+      }                                                                       \
+    s->counter += nblocks;                                                    \
+  }
+
+/* Same streams as arm_math_advsimd_randu_f32 for any vector length.  */
+RAND_F32 (arm_math_sve_randu_f32, randu_block)
+
+/* Same transform as arm_math_advsimd_randn_f32.  The sincos core uses the
+   SVE trigonometric instructions, so results can differ from AdvSIMD in the
+   last bits, but they do not depend on the vector length.  */
+RAND_F32 (arm_math_sve_randn_f32, randn_block)
+
+CLOSE_SVE_ATTR
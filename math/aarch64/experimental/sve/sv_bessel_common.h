@@ -0,0 +1,218 @@
+/*
+ * Helpers for double-precision SVE Bessel functions of the first and second
+ * kind of order 0 and 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_BESSEL_COMMON_H
+#define MATH_SV_BESSEL_COMMON_H
+
+#include "sv_math.h"
+#include "sv_poly_f64.h"
+#include "sv_rsqrt_inline.h"
+#include "sv_sincos_common.h"
+
+/* Bounds of the table-driven region.  */
+#define MidBound 2.0
+#define AsymBound 8.0
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_bessel_common.h.  For x >= AsymBound, J_nu and Y_nu are evaluated in
+   phase-amplitude form, with M_nu(x) = m(v) and phi_nu(x) = h(v)/x
+   polynomials in v = 128/x^2 - 1.  */
+struct sv_bessel_asym_data
+{
+  double m[12], h[15];
+  double neg_pio2_1, neg_pio2_2, neg_pio2_3, inv_pio2;
+  double range_val;
+};
+
+#define SV_BESSEL_ASYM_PIO2                                                   \
+  .neg_pio2_1 = -0x1.921fb54442d18p+0, .neg_pio2_2 = -0x1.1a62633145c06p-54,  \
+  .neg_pio2_3 = -0x1.c1cd129024e09p-107, .inv_pio2 = 0x1.45f306dc9c883p-1,    \
+  .range_val = 0x1p23
+
+#define SV_BESSEL_ASYM0_DATA                                                  \
+  {                                                                           \
+    .m = { 0x1.9851e56f2953bp-1, -0x1.8e883c79ce76dp-12,                      \
+	   0x1.2e71cc5894d6ap-18, -0x1.4c1305bb8efb7p-23,                     \
+	   0x1.504f0fb9fc5efp-27, -0x1.00e966237750fp-30,                     \
+	   0x1.085eb1b997cfbp-33, -0x1.54e4e753ffca1p-36,                     \
+	   0x1.00493050ab342p-38, -0x1.c2731cce3c6ecp-41,                     \
+	   0x1.325ba2a803493p-42, -0x1.5fb1a8960a4f5p-44 },                   \
+    .h = { -0x1.fdf756b3b84fp-4, 0x1.fca9766f0e5fap-12,                       \
+	   -0x1.6c57b2bfdbb43p-17, 0x1.1fbcc34a706d7p-21,                     \
+	   -0x1.74c6ebc327436p-25, 0x1.556c3e28ac817p-28,                     \
+	   -0x1.945cab8278afep-31, 0x1.23f10579ca93ap-33,                     \
+	   -0x1.eda1306067bdfp-36, 0x1.deede53efe30fp-38,                     \
+	   -0x1.00b99715ac5d4p-39, 0x1.fd8febf2479bcp-42,                     \
+	   -0x1.37f34aef187c8p-43, 0x1.c2a52066ff167p-44,                     \
+	   -0x1.5005329418aeap-45 },                                          \
+    SV_BESSEL_ASYM_PIO2                                                       \
+  }
+
+#define SV_BESSEL_ASYM1_DATA                                                  \
+  {                                                                           \
+    .m = { 0x1.991c527e7f063p-1, 0x1.2dabbdc47f2a3p-10,                       \
+	   -0x1.20f37ac00c488p-17, 0x1.fbf50c2399d9cp-23,                     \
+	   -0x1.cca807b7171f9p-27, 0x1.4b0ebe68b203p-30,                      \
+	   -0x1.47fc1d9454126p-33, 0x1.9c2fff2e41622p-36,                     \
+	   -0x1.309e237d3e0eep-38, 0x1.07e13a52144e3p-40,                     \
+	   -0x1.6023d18496288p-42, 0x1.9184ae7bc29a4p-44 },                   \
+    .h = { 0x1.7eb5a9fde20fep-2, -0x1.44eb77ec8b7fdp-10,                      \
+	   0x1.4c0898f5e1b45p-16, -0x1.afa09b7645ceap-21,                     \
+	   0x1.f99d287d45b26p-25, -0x1.b5786b09c37e2p-28,                     \
+	   0x1.f3dec166ef31dp-31, -0x1.6035cd44c1c83p-33,                     \
+	   0x1.25c75b83c0d48p-35, -0x1.17291815f917ap-37,                     \
+	   0x1.0b3524da952cep-39, -0x1.2d8306d1dc591p-41,                     \
+	   0x1.59d037d18339cp-42, -0x1.e66e1b4315862p-44 },                   \
+    SV_BESSEL_ASYM_PIO2                                                       \
+  }
+
+/* For |x| < MidBound, J0(x) = (x^2 - z^2) * P(x^2) and
+   J1(x) = (x^2 - z^2) * x * P(x^2), with z the first positive zero.  */
+struct sv_bessel_small_data
+{
+  double poly[10];
+  double z2_hi, z2_lo;
+};
+
+#define SV_BESSEL_J0_SMALL_DATA                                               \
+  {                                                                           \
+    .poly = { -0x1.62214bb3c7121p-3, 0x1.b4c4fb6b81b8cp-7,                    \
+	      -0x1.a04594c03628p-12, 0x1.add15693722bep-18,                   \
+	      -0x1.17e92e9d26fbcp-24, 0x1.f6e066f2b308bp-32,                  \
+	      -0x1.4ab3e7f7ea077p-39, 0x1.4eb4af24ffcd8p-47,                  \
+	      -0x1.56f813df4e791p-55, 0x1.3560d7d7d1e2cp-61 },                \
+    .z2_hi = 0x1.721fb80462bbbp+2, .z2_lo = 0x1.db60c816c15d3p-52,            \
+  }
+
+#define SV_BESSEL_J1_SMALL_DATA                                               \
+  {                                                                           \
+    .poly = { -0x1.16fb4ba6b9f63p-5, 0x1.fbdfb0a3d1727p-10,                   \
+	      -0x1.7cf8005bbfa3fp-15, 0x1.43316b385b82cp-21,                  \
+	      -0x1.648982ef7a90fp-28, 0x1.1572ba1dcc9f6p-35,                  \
+	      -0x1.416f4abda6a09p-43, 0x1.16b4b9a1f5f81p-51,                  \
+	      0x1.c82a743cb47d6p-61, -0x1.06ce4d957babp-63 },                 \
+    .z2_hi = 0x1.d5d2b4189822cp+3, .z2_lo = -0x1.c6a0d245172bap-54,           \
+  }
+
+/* Return (x^2 - z^2) * P(z), with z = x^2.  */
+static inline svfloat64_t
+sv_bessel_small (svbool_t pg, svfloat64_t x, svfloat64_t z,
+		 const struct sv_bessel_small_data *d)
+{
+  svfloat64_t dz = svsub_x (pg, svmad_x (pg, x, x, -d->z2_hi), d->z2_lo);
+  return svmul_x (pg, dz, sv_horner_9_f64_x (pg, z, d->poly));
+}
+
+/* In [MidBound, AsymBound), each interval [k, k + 1) has its own polynomial
+   with the zero z closest to it factored out, F(x) = t * Q(t) with
+   t = x - z.  Rows of tab are { z_hi, z_lo, q_0, ..., q_(nq - 1) }, padded as
+   in the AdvSIMD tables, and coefficients are gathered per lane.  Lanes
+   outside the interval are clamped to the first or last row.  */
+static inline svfloat64_t
+sv_bessel_mid (svbool_t pg, svfloat64_t x, const double *tab, int nq)
+{
+  uint64_t stride = (nq + 3) & ~1;
+  svuint64_t k = svcvt_u64_x (
+      pg, svmin_x (pg, svsub_x (pg, x, MidBound), AsymBound - 3));
+  svuint64_t idx = svmul_x (pg, k, stride);
+
+  svfloat64_t z_hi = svld1_gather_index (pg, tab, idx);
+  svfloat64_t z_lo = svld1_gather_index (pg, tab + 1, idx);
+  svfloat64_t t = svsub_x (pg, svsub_x (pg, x, z_hi), z_lo);
+
+  /* Horner evaluation of Q.  */
+  svfloat64_t q = svld1_gather_index (pg, tab + nq + 1, idx);
+  for (int j = nq; j >= 2; j--)
+    q = svmad_x (pg, q, t, svld1_gather_index (pg, tab + j, idx));
+  return svmul_x (pg, t, q);
+}
+
+/* Return cos(t + q * pi/2), given sin(t) and cos(t).  */
+static inline svfloat64_t
+sv_bessel_quadrant (svbool_t pg, svfloat64_t s, svfloat64_t c, svuint64_t q)
+{
+  svbool_t odd = svcmpne (pg, svand_x (pg, q, 1), 0);
+  svfloat64_t t = svsel (odd, s, c);
+  svuint64_t sign = svlsl_x (pg, svand_x (pg, svadd_x (pg, q, 1), 2), 62);
+  return svreinterpret_f64 (sveor_x (pg, svreinterpret_u64 (t), sign));
+}
+
+/* For |x| >= 2^23, use the large range reduction of sincos, which gives
+   x = k * pi/128 + r.  The phase correction is added to r, and the phase
+   shift to k, so that x - pi/4 + phi + quad * pi/2 = k' * pi/128 + r', and
+   the cosine is reconstructed from the table of cos(k pi/128) and
+   sin(k pi/128) as in sv_sincos_fallback.  Infinity returns 0.  */
+static svfloat64_t NOINLINE
+sv_bessel_special (svfloat64_t x, svfloat64_t phi, svfloat64_t scale,
+		   svfloat64_t y, svbool_t special, uint64_t quad)
+{
+  svbool_t ptrue = svptrue_b64 ();
+  svfloat64x2_t red = sv_large_range_reduction (x);
+  svfloat64_t r = svadd_x (ptrue, svget2 (red, 0), phi);
+  svuint64_t k = svadd_x (ptrue, svreinterpret_u64 (svget2 (red, 1)),
+			  64 * quad - 32);
+  svfloat64x2_t eval = sv_sincos_eval (r);
+  svfloat64x2_t lookup = sv_sin_cos_lookup (k);
+
+  /* cos(k + r) = cos(k)*cosm1(r) - sin(k)*sin(r) + cos(k).  */
+  svfloat64_t cos_k = svget2 (lookup, 1);
+  svfloat64_t t = svmla_x (ptrue, cos_k, svget2 (eval, 1), cos_k);
+  t = svmls_x (ptrue, t, svget2 (lookup, 0), svget2 (eval, 0));
+  svfloat64_t large = svmul_x (ptrue, scale, t);
+  large = svsel (svcmpeq (ptrue, x, INFINITY), sv_f64 (0), large);
+  return svsel (special, large, y);
+}
+
+/* Phase-amplitude approximation of the Bessel function of order nu selected
+   by quad, for x >= AsymBound.  quad is the number of quarter periods to add
+   to the phase x - pi/4 + phi_nu(x): 0 for J0, 3 for Y0 and J1, 2 for Y1.
+   Other lanes are not valid and need to be overwritten, except that NaN lanes
+   propagate NaN.  */
+static inline svfloat64_t
+sv_bessel_asym (svbool_t pg, svfloat64_t x, int nu, uint64_t quad,
+		const struct sv_bessel_asym_data *d)
+{
+  svfloat64_t pio2_12 = svld1rq (svptrue_b64 (), &d->neg_pio2_1);
+  svfloat64_t pio2_3_inv = svld1rq (svptrue_b64 (), &d->neg_pio2_3);
+
+  svfloat64_t rs = sv_rsqrt_inline (x);
+  svfloat64_t ix = svmul_x (pg, rs, rs);
+  svfloat64_t v = svmad_x (pg, svmul_x (pg, ix, 128.0), ix, -1.0);
+  svfloat64_t v2 = svmul_x (pg, v, v);
+  svfloat64_t m = sv_horner_11_f64_x (pg, v, d->m);
+  svfloat64_t h = nu ? sv_pw_horner_13_f64_x (pg, v, v2, d->h)
+		     : sv_pw_horner_14_f64_x (pg, v, v2, d->h);
+  svfloat64_t phi = svdiv_x (pg, h, x);
+
+  /* x + phi = (n + 1/2) * pi/2 + r, r in [-pi/4, pi/4], rounding n with
+     phi included so that r stays small.  phi is added to r after the first
+     two terms of the reduction, which are exact.  */
+  svfloat64_t n = svrintn_x (
+      pg, svmla_lane (sv_f64 (-0.5), svadd_x (pg, x, phi), pio2_3_inv, 1));
+  svfloat64_t n5 = svadd_x (pg, n, 0.5);
+  svfloat64_t r = svmla_lane (x, n5, pio2_12, 0);
+  r = svmla_lane (r, n5, pio2_12, 1);
+  r = svadd_x (pg, r, phi);
+  r = svmla_lane (r, n5, pio2_3_inv, 0);
+
+  /* x - pi/4 + phi = n * pi/2 + r.  */
+  svfloat64x2_t sc = sv_sincos_inline (r, &sv_sincos_data);
+  svuint64_t q
+      = svadd_x (pg, svreinterpret_u64 (svcvt_s64_x (pg, n)), quad);
+  svfloat64_t scale = svmul_x (pg, m, rs);
+  svfloat64_t t
+      = sv_bessel_quadrant (pg, svget2 (sc, 0), svget2 (sc, 1), q);
+  svfloat64_t y = svmul_x (pg, scale, t);
+
+  svbool_t special = svacge (pg, x, d->range_val);
+  if (unlikely (svptest_any (pg, special)))
+    return sv_bessel_special (x, phi, scale, y, special, quad);
+  return y;
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Helpers for single-precision SVE Bessel functions of the first and second
+ * kind of order 0 and 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_BESSELF_COMMON_H
+#define MATH_SV_BESSELF_COMMON_H
+
+#include "sv_math.h"
+#include "sv_poly_f32.h"
+#include "sv_rsqrtf_inline.h"
+#include "sv_sincosf_common.h"
+
+/* Lower bound of the asymptotic region.  */
+#define AsymBound 2.0f
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_besself_common.h.  For x >= AsymBound, J_nu and Y_nu are evaluated in
+   phase-amplitude form, with M_nu(x) = m(v) and phi_nu(x) = h(v)/x
+   polynomials in v = 8/x^2 - 1.  */
+struct sv_besself_asym_data
+{
+  float m[11], h[13];
+  float inv_pio2, neg_pio2_1, neg_pio2_2, neg_pio2_3;
+  float range_val;
+};
+
+#define SV_BESSELF_ASYM_PIO2                                                  \
+  .inv_pio2 = 0x1.45f306p-1f, .neg_pio2_1 = -0x1.921fb6p+0f,                  \
+  .neg_pio2_2 = 0x1.777a5cp-25f, .neg_pio2_3 = 0x1.ee59dap-50f,               \
+  .range_val = 0x1p20f
+
+#define SV_BESSELF_ASYM0_DATA                                                 \
+  {                                                                           \
+    .m = { 0x1.95c4dcp-1f, -0x1.36b414p-8f, 0x1.f3e23ep-12f,                  \
+	   -0x1.a0ade2p-14f, 0x1.e93b8ap-16f, -0x1.8cfa2ep-17f,               \
+	   0x1.931a0cp-18f, -0x1.1a8332p-22f, -0x1.f0cf7ep-21f,               \
+	   -0x1.15d2a6p-19f, 0x1.a875b2p-20f },                               \
+    .h = { -0x1.e672cep-4f, 0x1.49077cp-8f,   -0x1.b7d694p-11f,               \
+	   0x1.e074a2p-13f, -0x1.57edb6p-14f, 0x1.0a018p-15f,                 \
+	   -0x1.8358c6p-17f, 0x1.e89a96p-17f, -0x1.ca9a1ap-17f,               \
+	   -0x1.c60696p-18f, 0x1.29747p-17f,  0x1.a07326p-18f,                \
+	   -0x1.70f9b8p-18f },                                                \
+    SV_BESSELF_ASYM_PIO2                                                      \
+  }
+
+#define SV_BESSELF_ASYM1_DATA                                                 \
+  {                                                                           \
+    .m = { 0x1.a13342p-1f, 0x1.ffe21cp-7f,  -0x1.19aee4p-10f,                 \
+	   0x1.829782p-13f, -0x1.8b89dep-15f, 0x1.2edf18p-16f,                \
+	   -0x1.8b67a2p-17f, 0x1.626b82p-21f, 0x1.1ccd04p-18f,                \
+	   0x1.6b7778p-19f, -0x1.adaf6p-19f },                                \
+    .h = { 0x1.6ec11ap-2f,   -0x1.d4c2c4p-7f,  0x1.e99dd2p-10f,               \
+	   -0x1.c1f504p-12f, 0x1.1ae5e4p-13f,  -0x1.a711cep-15f,              \
+	   0x1.cc1ce4p-16f,  -0x1.4ba7cep-16f, 0x1.57ad22p-19f,               \
+	   0x1.12bbeap-17f,  0x1.4a86d6p-20f,  -0x1.08c01ep-17f,              \
+	   0x1.ab4308p-19f },                                                 \
+    SV_BESSELF_ASYM_PIO2                                                      \
+  }
+
+/* For |x| < AsymBound, J0(x) = (x^2 - z^2) * P(x^2) and
+   J1(x) = (x^2 - z^2) * x * P(x^2), with z the first positive zero.  */
+struct sv_besself_small_data
+{
+  float poly[6];
+  float z2_hi, z2_lo;
+};
+
+#define SV_BESSELF_J0_SMALL_DATA                                              \
+  {                                                                           \
+    .poly = { -0x1.62214cp-3f,	0x1.b4c514p-7f,	  -0x1.a049eap-12f,           \
+	      0x1.ae6f12p-18f,	-0x1.2190dep-24f, 0x1.633c5ap-31f },          \
+    .z2_hi = 0x1.721fb8p+2f, .z2_lo = 0x1.18aeeep-28f,                        \
+  }
+
+#define SV_BESSELF_J1_SMALL_DATA                                              \
+  {                                                                           \
+    .poly = { -0x1.16fb4cp-5f,	0x1.fbdfe8p-10f, -0x1.7d01a6p-15f,            \
+	      0x1.4490c6p-21f,	-0x1.902c8p-28f, 0x1.841c52p-34f },           \
+    .z2_hi = 0x1.d5d2b4p+3f, .z2_lo = 0x1.89822cp-25f,                        \
+  }
+
+/* Return (x^2 - z^2) * P(z), with z = x^2.  */
+static inline svfloat32_t
+sv_besself_small (svbool_t pg, svfloat32_t x, svfloat32_t z,
+		  const struct sv_besself_small_data *d)
+{
+  svfloat32_t dz = svsub_x (pg, svmad_x (pg, x, x, -d->z2_hi), d->z2_lo);
+  return svmul_x (pg, dz, sv_horner_5_f32_x (pg, z, d->poly));
+}
+
+/* Return cos(t + q * pi/2), given sin(t) and cos(t).  */
+static inline svfloat32_t
+sv_besself_quadrant (svbool_t pg, svfloat32_t s, svfloat32_t c, svuint32_t q)
+{
+  svbool_t odd = svcmpne (pg, svand_x (pg, q, 1), 0);
+  svfloat32_t t = svsel (odd, s, c);
+  svuint32_t sign = svlsl_x (pg, svand_x (pg, svadd_x (pg, q, 1), 2), 30);
+  return svreinterpret_f32 (sveor_x (pg, svreinterpret_u32 (t), sign));
+}
+
+/* For |x| >= 2^20, use the large range reduction of sincosf, which gives
+   x = (k + y_hi + y_mid + y_lo) * pi/2.  Subtracting 1/2 from y_hi is exact,
+   and y_mid and the phase correction are only added afterwards, so that
+   x - pi/4 + phi = k * pi/2 + r with r accurate in relative terms near the
+   zeros of cos(x - pi/4 + phi).  Infinity returns 0.  */
+static svfloat32_t NOINLINE
+sv_besself_special (svfloat32_t x, svfloat32_t phi, svfloat32_t scale,
+		    svfloat32_t y, svbool_t special, uint32_t quad,
+		    const struct sv_besself_asym_data *d)
+{
+  svbool_t ptrue = svptrue_b32 ();
+  svfloat32x4_t red = large_range_reduction_parts (ptrue, x);
+  svfloat32_t y_hi = svsub_x (ptrue, svget4 (red, 0), 0.5f);
+  svfloat32_t k = svget4 (red, 3);
+
+  /* y_hi is in [-1, 0], bring it back to [-1/2, 1/2].  */
+  svbool_t wrap = svcmplt (ptrue, y_hi, -0.5f);
+  y_hi = svadd_m (wrap, y_hi, 1.0f);
+  k = svsub_m (wrap, k, 1.0f);
+
+  y_hi = svadd_x (ptrue, y_hi, svget4 (red, 1));
+  svfloat32_t y_lo = svmla_x (ptrue, svget4 (red, 2), phi, d->inv_pio2);
+  svfloat32_t r = svmul_x (ptrue, y_hi, -d->neg_pio2_2);
+  r = svmla_x (ptrue, r, y_lo, -d->neg_pio2_1);
+  r = svmla_x (ptrue, r, y_hi, -d->neg_pio2_1);
+  svfloat32x2_t sc = sv_sincosf_inline (r, &trig_data);
+  svuint32_t q
+      = svadd_x (ptrue, svreinterpret_u32 (svcvt_s32_x (ptrue, k)), quad);
+  svfloat32_t t
+      = sv_besself_quadrant (ptrue, svget2 (sc, 0), svget2 (sc, 1), q);
+  svfloat32_t large = svmul_x (ptrue, scale, t);
+  large = svsel (svcmpeq (ptrue, x, INFINITY), sv_f32 (0), large);
+  return svsel (special, large, y);
+}
+
+/* Phase-amplitude approximation of the Bessel function selected by quad, for
+   x >= AsymBound.  quad is the number of quarter periods to add to the phase
+   x - pi/4 + phi_nu(x): 0 for J0, 3 for Y0 and J1, 2 for Y1.
+   Other lanes are not valid and need to be overwritten, except that NaN lanes
+   propagate NaN.  */
+static inline svfloat32_t
+sv_besself_asym (svbool_t pg, svfloat32_t x, uint32_t quad,
+		 const struct sv_besself_asym_data *d)
+{
+  svfloat32_t pio2_vals = svld1rq (svptrue_b32 (), &d->inv_pio2);
+  svfloat32_t rs = sv_rsqrtf_inline (x);
+  svfloat32_t ix = svmul_x (pg, rs, rs);
+  svfloat32_t v = svmad_x (pg, svmul_x (pg, ix, 8.0f), ix, -1.0f);
+  svfloat32_t m = sv_horner_10_f32_x (pg, v, d->m);
+  svfloat32_t h = sv_horner_12_f32_x (pg, v, d->h);
+  svfloat32_t phi = svdiv_x (pg, h, x);
+
+  /* x + phi = (n + 1/2) * pi/2 + r, r in [-pi/4, pi/4], rounding n with
+     phi included so that r stays small.  phi is added to r after the first
+     two terms of the reduction, which are exact.  */
+  svfloat32_t n = svrintn_x (
+      pg, svmla_lane (sv_f32 (-0.5f), svadd_x (pg, x, phi), pio2_vals, 0));
+  svfloat32_t n5 = svadd_x (pg, n, 0.5f);
+  svfloat32_t r = svmla_lane (x, n5, pio2_vals, 1);
+  r = svmla_lane (r, n5, pio2_vals, 2);
+  r = svadd_x (pg, r, phi);
+  r = svmla_lane (r, n5, pio2_vals, 3);
+
+  /* x - pi/4 + phi = n * pi/2 + r.  */
+  svfloat32x2_t sc = sv_sincosf_inline (r, &trig_data);
+  svuint32_t q = svadd_x (
+      pg, svreinterpret_u32 (svcvt_s32_x (pg, n)), quad);
+  svfloat32_t scale = svmul_x (pg, m, rs);
+  svfloat32_t t
+      = sv_besself_quadrant (pg, svget2 (sc, 0), svget2 (sc, 1), q);
+  svfloat32_t y = svmul_x (pg, scale, t);
+
+  svbool_t special = svacge (pg, x, d->range_val);
+  if (unlikely (svptest_any (pg, special)))
+    return sv_besself_special (x, phi, scale, y, special, quad, d);
+  return y;
+}
+
+#endif
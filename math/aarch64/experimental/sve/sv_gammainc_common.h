@@ -0,0 +1,414 @@
+/*
+ * Helpers for double-precision SVE incomplete gamma and beta functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_GAMMAINC_COMMON_H
+#define MATH_SV_GAMMAINC_COMMON_H
+
+#define _GNU_SOURCE 1
+#include <math.h>
+#include "sv_math.h"
+#include "mathlib.h"
+#include "sv_poly_f64.h"
+/* Defines data, and the log and exp cores with extra precision.  */
+#define WANT_SV_POW_SIGN_BIAS 0
+#include "sv_pow_inline.h"
+
+/* Same algorithms and coefficients as the AdvSIMD routines, see
+   v_gammainc_common.h.  */
+static const struct sv_gammainc_data
+{
+  double stirling_poly[8];
+  double psi1p_poly[3];
+  double hl2pi_hi, hl2pi_lo;
+} sv_gammainc_data = {
+  .stirling_poly = { 0x1.5555555555555p-4, -0x1.6c16c16c16c17p-9,
+		     0x1.a01a01a01a01ap-11, -0x1.3813813813814p-11,
+		     0x1.b951e2b18ff23p-11, -0x1.f6ab0d9993c7dp-10,
+		     0x1.a41a41a41a41ap-8, -0x1.e4286cb0f5398p-6 },
+  .psi1p_poly = { -0x1.2788cfc6fb619p-1, 0x1.a51a6625307d3p+0,
+		  -0x1.33ba004f00621p+0 },
+  .hl2pi_hi = 0x1.d67f1c864beb5p-1,
+  .hl2pi_lo = -0x1.65b5a1b7ff5dfp-55,
+};
+
+#define StirlingBound 10.0
+#define Eps 0x1p-53
+#define SeriesEps 0x1p-56
+#define MaxIter 1000
+#define LargeA 20.0
+/* Terms of the alternating series for a, x < 1, the remainder is below
+   1/21! < 2^-65.  */
+#define SmallTerms 20
+
+/* Return a + b rounded, and its exact rounding error in *err.  */
+static inline svfloat64_t
+sv_two_sum (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t *err)
+{
+  svfloat64_t s = svadd_x (pg, a, b);
+  svfloat64_t bb = svsub_x (pg, s, a);
+  *err = svadd_x (pg, svsub_x (pg, a, svsub_x (pg, s, bb)),
+		  svsub_x (pg, b, bb));
+  return s;
+}
+
+/* Add x to the double-double hi + lo.  */
+static inline void
+sv_dd_add (svbool_t pg, svfloat64_t *hi, svfloat64_t *lo, svfloat64_t x)
+{
+  svfloat64_t err;
+  *hi = sv_two_sum (pg, *hi, x, &err);
+  *lo = svadd_x (pg, *lo, err);
+}
+
+/* Add t (l + ltail) to the double-double hi + lo.  */
+static inline void
+sv_dd_mla (svbool_t pg, svfloat64_t *hi, svfloat64_t *lo, svfloat64_t t,
+	   svfloat64_t l, svfloat64_t ltail)
+{
+  svfloat64_t p = svmul_x (pg, t, l);
+  svfloat64_t e = svnmls_x (pg, p, t, l);
+  sv_dd_add (pg, hi, lo, p);
+  *lo = svadd_x (pg, *lo, svmla_x (pg, e, t, ltail));
+}
+
+/* Return log(x) + *tail for positive finite x.  */
+static inline svfloat64_t
+sv_gammainc_log (svbool_t pg, svfloat64_t x, svfloat64_t *tail,
+		 const struct data *d)
+{
+  svuint64_t ix = svreinterpret_u64 (x);
+  svbool_t sub = svcmplt (pg, x, 0x1p-1022);
+  if (unlikely (svptest_any (pg, sub)))
+    {
+      svuint64_t norm = svreinterpret_u64 (svmul_m (sub, x, 0x1p52));
+      ix = svsub_m (sub, norm, 52ULL << 52);
+    }
+  return sv_log_inline (pg, ix, tail, d);
+}
+
+/* Return log(hi + lo) + *tail.  */
+static inline svfloat64_t
+sv_gammainc_log_dd (svbool_t pg, svfloat64_t hi, svfloat64_t lo,
+		    svfloat64_t *tail, const struct data *d)
+{
+  svfloat64_t err;
+  hi = sv_two_sum (pg, hi, lo, &err);
+  svfloat64_t y = sv_gammainc_log (pg, hi, tail, d);
+  *tail = svadd_x (pg, *tail, svdiv_x (pg, err, hi));
+  return y;
+}
+
+static double
+lgamma_wrap (double x)
+{
+  int sign;
+  return lgamma_r (x, &sign);
+}
+
+/* Return lgamma(1 + t + ttail) for 0 < t < 1 in lanes of small, other lanes
+   are 0.  There is no SVE lgamma, lanes are evaluated with scalar calls.  */
+static inline svfloat64_t
+sv_lgamma1p (svbool_t pg, svbool_t small, svfloat64_t t, svfloat64_t ttail,
+	     const struct sv_gammainc_data *g)
+{
+  svfloat64_t u = svadd_x (pg, t, 1.0);
+  svfloat64_t du = svadd_x (pg, svsub_x (pg, t, svsub_x (pg, u, 1.0)), ttail);
+  svfloat64_t psi = sv_horner_2_f64_x (pg, t, g->psi1p_poly);
+  svfloat64_t lg = sv_call_f64 (lgamma_wrap, u, sv_f64 (0), small);
+  return svmla_x (pg, lg, du, psi);
+}
+
+/* Add s lgamma(t + ttail) to the double-double hi + lo, for t > 0 and
+   s = +-1, see v_gammainc_add_lgamma.  */
+static inline void
+sv_gammainc_add_lgamma (svbool_t pg, svfloat64_t *hi, svfloat64_t *lo,
+			svfloat64_t s, svfloat64_t t, svfloat64_t ttail,
+			svfloat64_t lt, svfloat64_t lttail,
+			const struct data *d, const struct sv_gammainc_data *g)
+{
+  svbool_t small = svcmplt (pg, t, 1.0);
+  svbool_t shift = svbic_z (pg, svcmplt (pg, t, StirlingBound), small);
+  svfloat64_t u = t, utail = ttail, lu = lt, lutail = lttail;
+
+  if (svptest_any (pg, shift))
+    {
+      svfloat64_t n = svrintp_x (pg, svsubr_x (pg, t, StirlingBound));
+      n = svsel (shift, n, sv_f64 (0));
+      svfloat64_t ph = sv_f64 (1.0), pl = sv_f64 (0);
+      int m = svmaxv (pg, n);
+      for (int k = 0; k < m; k++)
+	{
+	  svbool_t active = svcmpgt (pg, n, k);
+	  svfloat64_t cl, c = sv_two_sum (pg, t, sv_f64 (k), &cl);
+	  c = svsel (active, c, sv_f64 (1.0));
+	  cl = svsel (active, svadd_x (pg, cl, ttail), sv_f64 (0));
+	  svfloat64_t h = svmul_x (pg, ph, c);
+	  svfloat64_t e = svnmls_x (pg, h, ph, c);
+	  pl = svadd_x (pg, e, svmla_x (pg, svmul_x (pg, ph, cl), pl, c));
+	  ph = h;
+	}
+      svfloat64_t lptail, lp = sv_gammainc_log_dd (pg, ph, pl, &lptail, d);
+      svfloat64_t sp = svsel (shift, svneg_x (pg, s), sv_f64 (0));
+      sv_dd_mla (pg, hi, lo, sp, lp, lptail);
+
+      u = sv_two_sum (pg, t, n, &utail);
+      utail = svadd_x (pg, utail, ttail);
+      svfloat64_t l = sv_gammainc_log (pg, u, &lutail, d);
+      lutail = svadd_x (pg, lutail, svdiv_x (pg, utail, u));
+      lu = svsel (shift, l, lt);
+      lutail = svsel (shift, lutail, lttail);
+    }
+
+  /* Stirling series at u, lanes with t < 1 add exactly 0.  */
+  svfloat64_t ss = svsel (small, sv_f64 (0), s);
+  u = svsel (small, sv_f64 (1.0), u);
+  utail = svsel (small, sv_f64 (0), utail);
+  lu = svsel (small, sv_f64 (0), lu);
+  lutail = svsel (small, sv_f64 (0), lutail);
+  svfloat64_t r = svdivr_x (pg, u, 1.0);
+  svfloat64_t corr = svmul_x (
+      pg, r, sv_horner_7_f64_x (pg, svmul_x (pg, r, r), g->stirling_poly));
+  sv_dd_mla (pg, hi, lo, svmul_x (pg, ss, svsub_x (pg, u, 0.5)), lu, lutail);
+  sv_dd_add (pg, hi, lo, svmul_x (pg, ss, svneg_x (pg, u)));
+  sv_dd_add (pg, hi, lo, svmul_x (pg, ss, g->hl2pi_hi));
+  svfloat64_t tail = svmla_x (pg, svsub_x (pg, corr, utail), utail, lu);
+  tail = svadd_x (pg, tail, g->hl2pi_lo);
+  *lo = svmla_x (pg, *lo, ss, tail);
+
+  if (unlikely (svptest_any (pg, small)))
+    {
+      svfloat64_t ts = svsel (small, t, sv_f64 (0.5));
+      svfloat64_t lg = sv_lgamma1p (pg, small, ts,
+				    svsel (small, ttail, sv_f64 (0)), g);
+      svfloat64_t sl = svsel (small, s, sv_f64 (0));
+      sv_dd_add (pg, hi, lo, svmul_x (pg, sl, lg));
+      sv_dd_mla (pg, hi, lo, svneg_x (pg, sl), lt, lttail);
+    }
+}
+
+/* Return exp(hi + lo).  */
+static inline svfloat64_t
+sv_gammainc_exp (svbool_t pg, svfloat64_t hi, svfloat64_t lo,
+		 const struct data *d)
+{
+  svfloat64_t tail, y = sv_two_sum (pg, hi, lo, &tail);
+  return sv_exp_inline (pg, y, tail, sv_u64 (0), d);
+}
+
+/* Regularized incomplete gamma function P(a, x), or Q(a, x) if upper is
+   set, for finite a > 0 and x > 0, see v_gammainc_inline.  */
+static inline svfloat64_t
+sv_gammainc_inline (svbool_t pg, svfloat64_t a, svfloat64_t x, int upper,
+		    const struct data *d, const struct sv_gammainc_data *g)
+{
+  svfloat64_t lat, la = sv_gammainc_log (pg, a, &lat, d);
+  svfloat64_t lxt, lx = sv_gammainc_log (pg, x, &lxt, d);
+  svbool_t small = svand_z (pg, svcmplt (pg, a, 1.0), svcmplt (pg, x, 1.0));
+  svfloat64_t xs = svmla_x (pg, a, svsqrt_x (pg, a), 0.5);
+  xs = svsel (svcmpgt (pg, a, LargeA), xs, a);
+  svbool_t series = svbic_z (pg, svcmplt (pg, x, xs), small);
+  svbool_t cf = svbic_z (pg, svbic_z (pg, pg, small), series);
+
+  /* Exponent a log(x) - x - lgamma(a), without -x in the small region and
+     with -log(a) outside the continued fraction region.  */
+  svfloat64_t hi = sv_f64 (0), lo = sv_f64 (0);
+  sv_dd_mla (pg, &hi, &lo, a, lx, lxt);
+  sv_dd_add (pg, &hi, &lo, svsel (small, sv_f64 (0), svneg_x (pg, x)));
+  sv_gammainc_add_lgamma (pg, &hi, &lo, sv_f64 (-1.0), a, sv_f64 (0), la,
+			  lat, d, g);
+  sv_dd_mla (pg, &hi, &lo, svsel (cf, sv_f64 (0), sv_f64 (-1.0)), la, lat);
+  svfloat64_t pre = sv_gammainc_exp (pg, hi, lo, d);
+
+  svfloat64_t sum = sv_f64 (1.0);
+  if (svptest_any (pg, series))
+    {
+      /* Terms, ratios and sum in double-double.  */
+      svfloat64_t th = svsel (series, sv_f64 (1.0), sv_f64 (0));
+      svfloat64_t tl = sv_f64 (0), sl = sv_f64 (0);
+      svbool_t active = series;
+      for (int n = 1; n < MaxIter && svptest_any (pg, active); n++)
+	{
+	  svfloat64_t cl, c = sv_two_sum (pg, a, sv_f64 ((double) n), &cl);
+	  svfloat64_t rh = svdiv_x (pg, x, c);
+	  svfloat64_t rl = svmls_x (pg, svmls_x (pg, x, rh, c), rh, cl);
+	  rl = svdiv_x (pg, rl, c);
+	  svfloat64_t h = svmul_x (pg, th, rh);
+	  svfloat64_t e = svnmls_x (pg, h, th, rh);
+	  tl = svmla_x (pg, svmla_x (pg, e, th, rl), tl, rh);
+	  th = h;
+	  sv_dd_add (pg, &sum, &sl, th);
+	  sl = svadd_x (pg, sl, tl);
+	  active = svcmpge (active, th, svmul_x (pg, sum, SeriesEps));
+	  th = svsel (active, th, sv_f64 (0));
+	  tl = svsel (active, tl, sv_f64 (0));
+	}
+      sum = svadd_x (pg, sum, sl);
+    }
+
+  svfloat64_t h = sv_f64 (0);
+  if (svptest_any (pg, cf))
+    {
+      /* Legendre's continued fraction with Steed's algorithm.  */
+      svfloat64_t b = svsub_x (pg, svadd_x (pg, x, 1.0), a);
+      b = svsel (cf, b, sv_f64 (1.0));
+      svfloat64_t dd = svdivr_x (pg, b, 1.0);
+      svfloat64_t del = svsel (cf, dd, sv_f64 (0));
+      svbool_t active = cf;
+      h = del;
+      for (int i = 1; i < MaxIter && svptest_any (pg, active); i++)
+	{
+	  svfloat64_t fi = sv_f64 ((double) i);
+	  svfloat64_t an = svmul_x (pg, svsub_x (pg, a, fi), fi);
+	  b = svadd_x (pg, b, 2.0);
+	  svfloat64_t dn = svdivr_x (pg, svmla_x (pg, b, an, dd), 1.0);
+	  del = svmul_x (pg, del,
+			 svmul_x (pg, svneg_x (pg, an), svmul_x (pg, dd, dn)));
+	  dd = dn;
+	  h = svadd_x (pg, h, del);
+	  active = svacge (active, del, svmul_x (pg, h, Eps));
+	  del = svsel (active, del, sv_f64 (0));
+	}
+    }
+
+  svfloat64_t p = svmul_x (pg, pre, sum);
+  svfloat64_t q = svmul_x (pg, pre, h);
+  svfloat64_t y = upper ? svsel (series, svsubr_x (pg, p, 1.0), q)
+			: svsel (series, p, svsubr_x (pg, q, 1.0));
+
+  if (svptest_any (pg, small))
+    {
+      /* T = -a sum_{n=1}^{SmallTerms} u_n / (a + n), u_n = (-x)^n / n!.  */
+      svfloat64_t un = sv_f64 (1.0), tsum = sv_f64 (0);
+      for (int n = 1; n <= SmallTerms; n++)
+	{
+	  un = svmul_x (pg, un, svdiv_x (pg, svneg_x (pg, x), (double) n));
+	  svfloat64_t den = svadd_x (pg, a, (double) n);
+	  tsum = svadd_x (pg, tsum, svdiv_x (pg, un, den));
+	}
+      svfloat64_t t = svneg_x (pg, svmul_x (pg, a, tsum));
+      if (upper)
+	{
+	  svfloat64_t e = svadd_x (pg, hi, lo);
+	  svbool_t near0 = svaclt (small, e, 1.0);
+	  svfloat64_t em1 = _ZGVsMxv_expm1 (e, near0);
+	  em1 = svsel (near0, em1, svsub_x (pg, pre, 1.0));
+	  t = svmla_x (pg, svneg_x (pg, em1), pre, t);
+	}
+      else
+	t = svmls_x (pg, pre, pre, t);
+      y = svsel (small, t, y);
+    }
+  return y;
+}
+
+/* Regularized incomplete beta function I_x(a, b) for finite a, b > 0 and
+   0 < x < 1, see v_betainc_inline.  */
+static inline svfloat64_t
+sv_betainc_inline (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t x,
+		   const struct data *d, const struct sv_gammainc_data *g)
+{
+  svfloat64_t h1 = svsubr_x (pg, x, 1.0);
+  svfloat64_t e1 = svsub_x (pg, svsubr_x (pg, h1, 1.0), x);
+  svfloat64_t sl, s = sv_two_sum (pg, a, b, &sl);
+
+  svfloat64_t lxt, lx = sv_gammainc_log (pg, x, &lxt, d);
+  svfloat64_t l1t, l1 = sv_gammainc_log (pg, h1, &l1t, d);
+  l1t = svadd_x (pg, l1t, svdiv_x (pg, e1, h1));
+  svfloat64_t lst, ls = sv_gammainc_log (pg, s, &lst, d);
+  lst = svadd_x (pg, lst, svdiv_x (pg, sl, s));
+  svfloat64_t lat, la = sv_gammainc_log (pg, a, &lat, d);
+  svfloat64_t lbt, lb = sv_gammainc_log (pg, b, &lbt, d);
+
+  svfloat64_t hi = sv_f64 (0), lo = sv_f64 (0);
+  sv_dd_mla (pg, &hi, &lo, a, lx, lxt);
+  sv_dd_mla (pg, &hi, &lo, b, l1, l1t);
+  sv_gammainc_add_lgamma (pg, &hi, &lo, sv_f64 (-1.0), a, sv_f64 (0), la,
+			  lat, d, g);
+  sv_gammainc_add_lgamma (pg, &hi, &lo, sv_f64 (-1.0), b, sv_f64 (0), lb,
+			  lbt, d, g);
+  sv_gammainc_add_lgamma (pg, &hi, &lo, sv_f64 (1.0), s, sl, ls, lst, d, g);
+  svfloat64_t pre = sv_gammainc_exp (pg, hi, lo, d);
+
+  svfloat64_t bound
+      = svdiv_x (pg, svadd_x (pg, a, 1.0), svadd_x (pg, s, 2.0));
+  svbool_t swap = svcmpgt (pg, x, bound);
+  svfloat64_t p = svsel (swap, b, a);
+  svfloat64_t q = svsel (swap, a, b);
+  svfloat64_t y = svsel (swap, h1, x);
+  svfloat64_t yl = svsel (swap, e1, sv_f64 (0));
+
+  /* c = (p + 1) - (p + q) y, where p1 - ph is exact.  */
+  svfloat64_t ph = svmul_x (pg, s, y);
+  svfloat64_t pl = svnmls_x (pg, ph, s, y);
+  pl = svmla_x (pg, svmla_x (pg, pl, sl, y), s, yl);
+  svfloat64_t p1l, p1 = sv_two_sum (pg, p, sv_f64 (1.0), &p1l);
+  svfloat64_t c
+      = svadd_x (pg, svsub_x (pg, p1, ph), svsub_x (pg, p1l, pl));
+  svfloat64_t y2 = svmul_x (pg, y, y);
+  svfloat64_t two_y = svsubr_x (pg, y, 2.0);
+
+  /* Steed's algorithm for the even part of the continued fraction.  */
+  svfloat64_t f = svdiv_x (pg, svmul_x (pg, p, c), p1);
+  svfloat64_t dd = sv_f64 (0), del = sv_f64 (1.0);
+  svbool_t active = pg;
+  for (int n = 1; n < MaxIter && svptest_any (pg, active); n++)
+    {
+      svfloat64_t nf = sv_f64 ((double) n);
+      svfloat64_t nm1 = sv_f64 ((double) (n - 1));
+      svfloat64_t pn = svadd_x (pg, p, nf);
+      svfloat64_t p2n1 = svadd_x (pg, pn, nm1);
+      svfloat64_t nqn = svmul_x (pg, svsub_x (pg, q, nf), nf);
+      svfloat64_t an = svmul_x (pg, svadd_x (pg, p, nm1),
+				svadd_x (pg, s, nm1));
+      an = svmul_x (pg, an, svmul_x (pg, nqn, y2));
+      an = svdiv_x (pg, an, svmul_x (pg, p2n1, p2n1));
+      svfloat64_t bn = svmla_x (pg, nf, nqn, svdiv_x (pg, y, p2n1));
+      bn = svmla_x (pg, bn, pn,
+		    svdiv_x (pg, svmla_x (pg, c, two_y, nf),
+			     svadd_x (pg, p2n1, 2.0)));
+      svfloat64_t dn = svdivr_x (pg, svmla_x (pg, bn, an, dd), 1.0);
+      del = n == 1 ? svmul_x (pg, an, dn)
+		   : svmul_x (pg, del, svmul_x (pg, svneg_x (pg, an),
+						svmul_x (pg, dd, dn)));
+      dd = dn;
+      f = svadd_x (pg, f, del);
+      active = svacge (active, del, svmul_x (pg, f, Eps));
+      del = svsel (active, del, sv_f64 (0));
+    }
+
+  svfloat64_t r = svdiv_x (pg, pre, f);
+  return svsel (swap, svsubr_x (pg, r, 1.0), r);
+}
+
+/* Values of P(a, x), or Q(a, x) if upper is set, for lanes where a or x is
+   not finite and positive, see v_gammainc_special.  */
+static inline svfloat64_t
+sv_gammainc_special (svbool_t pg, svfloat64_t a, svfloat64_t x, int upper)
+{
+  svbool_t xinf = svcmpeq (pg, x, INFINITY);
+  svbool_t valid = svand_z (pg, svcmpgt (pg, a, 0.0), svcmpge (pg, x, 0.0));
+  valid = svbic_z (pg, valid, svand_z (pg, xinf, svcmpeq (pg, a, INFINITY)));
+  svfloat64_t p = svsel (xinf, sv_f64 (1.0), sv_f64 (0));
+  if (upper)
+    p = svsubr_x (pg, p, 1.0);
+  return svsel (valid, p, sv_f64 (NAN));
+}
+
+/* Values of I_x(a, b) for lanes where a or b is not finite and positive or
+   x is not in (0, 1), see v_betainc_special.  */
+static inline svfloat64_t
+sv_betainc_special (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t x)
+{
+  svbool_t valid = svand_z (pg, svcmpgt (pg, a, 0.0), svcmpgt (pg, b, 0.0));
+  valid = svand_z (pg, valid, svcmplt (pg, svmax_x (pg, a, b), INFINITY));
+  svbool_t x1 = svcmpeq (pg, x, 1.0);
+  valid = svand_z (pg, valid, svorr_z (pg, svcmpeq (pg, x, 0.0), x1));
+  svfloat64_t y = svsel (x1, sv_f64 (1.0), sv_f64 (0));
+  return svsel (valid, y, sv_f64 (NAN));
+}
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * Helpers for double-precision SVE log-domain functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_LOGEXP_COMMON_H
+#define MATH_SV_LOGEXP_COMMON_H
+
+#include "sv_math.h"
+#define WANT_SV_LOG1P_K0_SHORTCUT 0
+#include "sv_log1p_inline.h"
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_logexp_common.h.  The expm1 polynomial is the one of advsimd/expm1.c,
+   pairs of odd coefficients are loaded together for the _lane forms of
+   svmla.  */
+static const struct sv_logexp_data
+{
+  double c1, c3, c5, c7, c9, c10;
+  double c2, c4, c6, c8;
+  double ln2_hi, ln2_lo, inv_ln2;
+  double bound, neg_ln2, tiny;
+} sv_logexp_data = {
+  .c1 = 0x1.5555555555559p-3,
+  .c2 = 0x1.555555555554bp-5,
+  .c3 = 0x1.111111110f663p-7,
+  .c4 = 0x1.6c16c16c1b5f3p-10,
+  .c5 = 0x1.a01a01affa35dp-13,
+  .c6 = 0x1.a01a018b4ecbbp-16,
+  .c7 = 0x1.71ddf82db5bb4p-19,
+  .c8 = 0x1.27e517fc0d54bp-22,
+  .c9 = 0x1.af5eedae67435p-26,
+  .c10 = 0x1.1f143d060a28ap-29,
+  .ln2_hi = 0x1.62e42fefa39efp-1,
+  .ln2_lo = 0x1.abc9e3b39803fp-56,
+  .inv_ln2 = 0x1.71547652b82fep0,
+  .bound = -0x1.62p+9,
+  .neg_ln2 = -0x1.62e42fefa39efp-1,
+  .tiny = 0x1p-960,
+};
+
+/* Lanes where m + log(1 +- e^d) needs the scalar fallback: e^d is subnormal
+   and m is tiny, or m or d is not finite.  */
+static inline svbool_t
+sv_logexp_special (svbool_t pg, svfloat64_t m, svfloat64_t d,
+		   const struct sv_logexp_data *dat)
+{
+  svfloat64_t am = svabs_x (pg, m);
+  svbool_t m_ok = svand_z (pg, svcmpge (pg, am, dat->tiny),
+			   svcmplt (pg, am, INFINITY));
+  return svnor_z (pg, svcmpge (pg, d, dat->bound), m_ok);
+}
+
+/* Return x - y, with the rounding error in *lo.  */
+static inline svfloat64_t
+sv_logexp_diff (svbool_t pg, svfloat64_t x, svfloat64_t y, svfloat64_t *lo)
+{
+  svfloat64_t s = svsub_x (pg, x, y);
+  svfloat64_t xv = svadd_x (pg, s, y);
+  svfloat64_t yv = svsub_x (pg, xv, s);
+  *lo = svadd_x (pg, svsub_x (pg, x, xv), svsub_x (pg, yv, y));
+  return s;
+}
+
+/* log(1 + e^(d + dl)) if SUB is 0 and log(1 - e^(d + dl)) otherwise, for
+   d <= 0 (and d < -0x1p-1022 if SUB) and |dl| <= ulp(d), see
+   v_log1pmexp_inline.  */
+static inline svfloat64_t
+sv_log1pmexp_inline (svbool_t pg, svfloat64_t d, svfloat64_t dl, int sub,
+		     const struct sv_logexp_data *dat)
+{
+  dl = svsel (svcmpge (pg, d, dat->bound), dl, sv_f64 (0));
+  d = svmax_x (pg, d, dat->bound);
+
+  /* Reduction of expm1.  */
+  svfloat64_t ln2 = svld1rq (svptrue_b64 (), &dat->ln2_hi);
+  svfloat64_t n = svrinta_x (pg, svmul_x (svptrue_b64 (), d, dat->inv_ln2));
+  svfloat64_t f = svmls_lane (d, n, ln2, 0);
+  f = svadd_x (pg, svmls_lane (f, n, ln2, 1), dl);
+
+  svfloat64_t f2 = svmul_x (svptrue_b64 (), f, f);
+  svfloat64_t f4 = svmul_x (svptrue_b64 (), f2, f2);
+  svfloat64_t c13 = svld1rq (svptrue_b64 (), &dat->c1);
+  svfloat64_t c57 = svld1rq (svptrue_b64 (), &dat->c5);
+  svfloat64_t c910 = svld1rq (svptrue_b64 (), &dat->c9);
+  svfloat64_t p01 = svmla_lane (sv_f64 (0.5), f, c13, 0);
+  svfloat64_t p23 = svmla_lane (sv_f64 (dat->c2), f, c13, 1);
+  svfloat64_t p45 = svmla_lane (sv_f64 (dat->c4), f, c57, 0);
+  svfloat64_t p67 = svmla_lane (sv_f64 (dat->c6), f, c57, 1);
+  svfloat64_t p03 = svmla_x (pg, p01, f2, p23);
+  svfloat64_t p47 = svmla_x (pg, p45, f2, p67);
+  svfloat64_t p89 = svmla_lane (sv_f64 (dat->c8), f, c910, 0);
+  svfloat64_t p = svmla_lane (p89, f2, c910, 1);
+  p = svmla_x (pg, p47, f4, p);
+  p = svmla_x (pg, p03, f4, p);
+  p = svmla_x (pg, f, f2, p);
+
+  svfloat64_t s = svscale_x (pg, sv_f64 (1.0), svcvt_s64_x (pg, n));
+  svfloat64_t e = svmla_x (pg, s, p, s);
+
+  svfloat64_t uh, ul;
+  if (sub)
+    {
+      uh = svsubr_x (pg, e, 1.0);
+      ul = svsub_x (pg, svsubr_x (pg, uh, 1.0), e);
+      svfloat64_t em = svmla_x (pg, svsub_x (pg, s, 1.0), p, s);
+      svbool_t near0 = svcmpgt (pg, d, dat->neg_ln2);
+      uh = svsel (near0, svneg_x (pg, em), uh);
+      ul = svsel (near0, sv_f64 (0), ul);
+    }
+  else
+    {
+      uh = svadd_x (pg, e, 1.0);
+      ul = svadd_x (pg, svsubr_x (pg, uh, 1.0), e);
+    }
+
+  /* Reduction of log1p applied to the exact uh, g in
+     [sqrt(2)/2 - 1, sqrt(2) - 1] is exact.  */
+  const struct sv_log1p_data *dlp = ptr_barrier (&sv_log1p_data);
+  svuint64_t mi = svreinterpret_u64 (uh);
+  svuint64_t u = svadd_x (pg, mi, dlp->one_m_hf_rt2_top);
+  svfloat64_t k = svcvt_f64_x (
+      pg, svsub_x (pg, svreinterpret_s64 (svlsr_x (pg, u, 52)), dlp->one_top));
+  svuint64_t utop
+      = svadd_x (pg, svand_x (pg, u, 0x000fffff00000000), dlp->hf_rt2_top);
+  svuint64_t u_red = svorr_x (pg, utop, svand_x (pg, mi, dlp->bottom_mask));
+  svfloat64_t g = svsub_x (pg, svreinterpret_f64 (u_red), 1);
+
+  svfloat64_t g2 = svmul_x (svptrue_b64 (), g, g);
+  svfloat64_t q = sv_log1p_poly (g, g2, pg, dlp);
+  svfloat64_t ln2_lo_hi = svld1rq (svptrue_b64 (), &dlp->ln2_lo);
+  svfloat64_t ylo = svmla_lane (svdiv_x (pg, ul, uh), k, ln2_lo_hi, 0);
+  svfloat64_t yhi = svmla_lane (g, k, ln2_lo_hi, 1);
+  return svmad_x (pg, q, g2, svadd_x (pg, ylo, yhi));
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Helpers for single-precision SVE log-domain functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_LOGEXPF_COMMON_H
+#define MATH_SV_LOGEXPF_COMMON_H
+
+#include "sv_math.h"
+#include "sv_expm1f_inline.h"
+#include "sv_log1pf_inline.h"
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_logexpf_common.h.  */
+static const struct sv_logexpf_data
+{
+  struct sv_expm1f_data expm1f_consts;
+  float bound, neg_ln2, tiny;
+} sv_logexpf_data = {
+  .expm1f_consts = SV_EXPM1F_DATA,
+  .bound = -0x1.5cp+6f,
+  .neg_ln2 = -0x1.62e43p-1f,
+  .tiny = 0x1p-100f,
+};
+
+/* Lanes where m + log(1 +- e^d) needs the scalar fallback: e^d is subnormal
+   and m is tiny, or m or d is not finite.  */
+static inline svbool_t
+sv_logexpf_special (svbool_t pg, svfloat32_t m, svfloat32_t d,
+		    const struct sv_logexpf_data *dat)
+{
+  svfloat32_t am = svabs_x (pg, m);
+  svbool_t m_ok = svand_z (pg, svcmpge (pg, am, dat->tiny),
+			   svcmplt (pg, am, INFINITY));
+  return svnor_z (pg, svcmpge (pg, d, dat->bound), m_ok);
+}
+
+/* Return x - y, with the rounding error in *lo.  */
+static inline svfloat32_t
+sv_logexpf_diff (svbool_t pg, svfloat32_t x, svfloat32_t y, svfloat32_t *lo)
+{
+  svfloat32_t s = svsub_x (pg, x, y);
+  svfloat32_t xv = svadd_x (pg, s, y);
+  svfloat32_t yv = svsub_x (pg, xv, s);
+  *lo = svadd_x (pg, svsub_x (pg, x, xv), svsub_x (pg, yv, y));
+  return s;
+}
+
+/* log(1 + e^(d + dl)) if SUB is 0 and log(1 - e^(d + dl)) otherwise, for
+   d <= 0 (and d < -0x1p-126 if SUB) and |dl| <= ulp(d), see
+   v_log1pmexpf_inline.  */
+static inline svfloat32_t
+sv_log1pmexpf_inline (svbool_t pg, svfloat32_t d, svfloat32_t dl, int sub,
+		      const struct sv_logexpf_data *dat)
+{
+  dl = svsel (svcmpge (pg, d, dat->bound), dl, sv_f32 (0));
+  d = svmax_x (pg, d, dat->bound);
+
+  /* Reduction of expm1f, lane_constants is [c2, c4, ln2_hi, ln2_lo].  */
+  const struct sv_expm1f_data *de = &dat->expm1f_consts;
+  svfloat32_t lane_constants = svld1rq (svptrue_b32 (), &de->c2);
+  svfloat32_t j = svrinta_x (pg, svmul_x (svptrue_b32 (), d, de->inv_ln2));
+  svfloat32_t f = svmls_lane (d, j, lane_constants, 2);
+  f = svadd_x (pg, svmls_lane (f, j, lane_constants, 3), dl);
+
+  svfloat32_t p12 = svmla_lane (sv_f32 (de->c1), f, lane_constants, 0);
+  svfloat32_t p34 = svmla_lane (sv_f32 (de->c3), f, lane_constants, 1);
+  svfloat32_t f2 = svmul_x (svptrue_b32 (), f, f);
+  svfloat32_t p = svmla_x (pg, p12, f2, p34);
+  p = svmla_x (pg, sv_f32 (de->c0), f, p);
+  p = svmla_x (pg, f, f2, p);
+
+  svfloat32_t s = svscale_x (pg, sv_f32 (1.0f), svcvt_s32_x (pg, j));
+  svfloat32_t e = svmla_x (pg, s, p, s);
+
+  svfloat32_t uh, ul;
+  if (sub)
+    {
+      uh = svsubr_x (pg, e, 1.0f);
+      ul = svsub_x (pg, svsubr_x (pg, uh, 1.0f), e);
+      svfloat32_t em = svmla_x (pg, svsub_x (pg, s, 1.0f), p, s);
+      svbool_t near0 = svcmpgt (pg, d, dat->neg_ln2);
+      uh = svsel (near0, svneg_x (pg, em), uh);
+      ul = svsel (near0, sv_f32 (0), ul);
+    }
+  else
+    {
+      uh = svadd_x (pg, e, 1.0f);
+      ul = svadd_x (pg, svsubr_x (pg, uh, 1.0f), e);
+    }
+
+  /* Reduction of log1pf applied to the exact uh.  */
+  const struct arm_math_sv_log1pf_data *dlp
+      = ptr_barrier (&sv_log1pf_data.core);
+  svint32_t k = svand_x (
+      pg, svsub_x (pg, svreinterpret_s32 (uh), dlp->three_quarters),
+      sv_s32 (SignExponentMask));
+  svfloat32_t r = svsub_x (
+      pg, svreinterpret_f32 (svsub_x (pg, svreinterpret_s32 (uh), k)), 1.0f);
+  svfloat32_t lp = arm_math_sv_log1pf_poly (r, pg, dlp);
+  svfloat32_t y = svadd_x (pg, lp, svdiv_x (pg, ul, uh));
+  svfloat32_t fconst = svld1rq_f32 (svptrue_b32 (), &dlp->ln2);
+  svfloat32_t kf = svmul_lane_f32 (svcvt_f32_x (pg, k), fconst, 1);
+  return svmla_lane_f32 (y, kf, fconst, 0);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Helpers for double-precision SVE digamma and trigamma.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_POLYGAMMA_COMMON_H
+#define MATH_SV_POLYGAMMA_COMMON_H
+
+#include "sv_math.h"
+#include "sv_poly_f64.h"
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_polygamma_common.h.  */
+struct sv_polygamma_refl_data
+{
+  double sinpi_poly[8];
+  double pi_hi, pi_lo;
+};
+
+#define SV_POLYGAMMA_REFL_DATA                                                \
+  {                                                                           \
+    .sinpi_poly = { -0x1.a51a6625307d3p+0, 0x1.9f9cb402bc45dp-1,              \
+		    -0x1.86a8e4720c74dp-3, 0x1.ac6805cdf33d8p-6,              \
+		    -0x1.33816a063390cp-9, 0x1.3746c58004fp-13,               \
+		    -0x1.d3f28f5ca4278p-18, 0x1.080d9d95e8992p-22 },          \
+    .pi_hi = 0x1.921fb54442d18p+1, .pi_lo = 0x1.1a62633145c07p-53,            \
+  }
+
+/* Return sin(pi r) / pi, for |r| <= 1/2.  */
+static inline svfloat64_t
+sv_polygamma_sinpi (svbool_t pg, svfloat64_t r,
+		    const struct sv_polygamma_refl_data *d)
+{
+  svfloat64_t z = svmul_x (pg, r, r);
+  svfloat64_t p
+      = svmul_x (pg, z, sv_horner_7_f64_x (pg, z, d->sinpi_poly));
+  return svmla_x (pg, r, r, p);
+}
+
+/* Return pi cot(pi x), the reflection term of digamma.  Infinite for
+   integer x.  */
+static inline svfloat64_t
+sv_polygamma_picot (svbool_t pg, svfloat64_t x,
+		    const struct sv_polygamma_refl_data *d)
+{
+  svfloat64_t r = svsub_x (pg, x, svrinta_x (pg, x));
+  svfloat64_t s = sv_polygamma_sinpi (pg, r, d);
+  /* cos(pi r) = sin(pi (1/2 - |r|)), the subtraction is exact.  */
+  svfloat64_t c
+      = sv_polygamma_sinpi (pg, svsubr_x (pg, svabs_x (pg, r), 0.5), d);
+  c = svmla_x (pg, svmul_x (pg, c, d->pi_lo), c, d->pi_hi);
+  return svdiv_x (pg, c, s);
+}
+
+/* Return pi^2 / sin^2(pi x), the reflection term of trigamma.  Infinite for
+   integer x.  */
+static inline svfloat64_t
+sv_polygamma_pi2csc2 (svbool_t pg, svfloat64_t x,
+		      const struct sv_polygamma_refl_data *d)
+{
+  svfloat64_t s
+      = sv_polygamma_sinpi (pg, svsub_x (pg, x, svrinta_x (pg, x)), d);
+  return svdivr_x (pg, svmul_x (pg, s, s), 1.0);
+}
+
+/* Add sum_{k=0}^{n-1} 1/c_k^p to the fraction a/b, with c_k = t + off + k,
+   p = 2 if square is set and 1 otherwise, see v_polygamma_sum.  n must not
+   be NaN in active lanes.  */
+static inline svfloat64x2_t
+sv_polygamma_sum (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t t,
+		  svfloat64_t off, svfloat64_t n, int square)
+{
+  int m = svmaxv (pg, n);
+  for (int k = m - 1; k >= 0; k--)
+    {
+      svbool_t active = svcmpgt (pg, n, (double) k);
+      svfloat64_t c = svadd_x (pg, t, svadd_x (pg, off, (double) k));
+      if (square)
+	c = svmul_x (pg, c, c);
+      a = svmad_m (active, a, c, b);
+      b = svmul_m (active, b, c);
+    }
+  return svcreate2 (a, b);
+}
+
+#endif
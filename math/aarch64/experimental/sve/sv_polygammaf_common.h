@@ -0,0 +1,86 @@
+/*
+ * Helpers for single-precision SVE digamma and trigamma.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_POLYGAMMAF_COMMON_H
+#define MATH_SV_POLYGAMMAF_COMMON_H
+
+#include "sv_math.h"
+#include "sv_poly_f32.h"
+
+/* Same algorithm and coefficients as the AdvSIMD routines, see
+   v_polygammaf_common.h.  */
+struct sv_polygammaf_refl_data
+{
+  float sinpi_poly[5];
+  float pi_hi, pi_lo;
+};
+
+#define SV_POLYGAMMAF_REFL_DATA                                               \
+  {                                                                           \
+    .sinpi_poly = { -0x1.a51a66p+0f, 0x1.9f9cb2p-1f, -0x1.86a7f8p-3f,         \
+		    0x1.ac1514p-6f, -0x1.27943cp-9f },                        \
+    .pi_hi = 0x1.921fb6p+1f, .pi_lo = -0x1.777a5cp-24f,                       \
+  }
+
+/* Return sin(pi r) / pi, for |r| <= 1/2.  */
+static inline svfloat32_t
+sv_polygammaf_sinpi (svbool_t pg, svfloat32_t r,
+		     const struct sv_polygammaf_refl_data *d)
+{
+  svfloat32_t z = svmul_x (pg, r, r);
+  svfloat32_t p
+      = svmul_x (pg, z, sv_horner_4_f32_x (pg, z, d->sinpi_poly));
+  return svmla_x (pg, r, r, p);
+}
+
+/* Return pi cot(pi x), the reflection term of digamma.  Infinite for
+   integer x.  */
+static inline svfloat32_t
+sv_polygammaf_picot (svbool_t pg, svfloat32_t x,
+		     const struct sv_polygammaf_refl_data *d)
+{
+  svfloat32_t r = svsub_x (pg, x, svrinta_x (pg, x));
+  svfloat32_t s = sv_polygammaf_sinpi (pg, r, d);
+  /* cos(pi r) = sin(pi (1/2 - |r|)), the subtraction is exact.  */
+  svfloat32_t c
+      = sv_polygammaf_sinpi (pg, svsubr_x (pg, svabs_x (pg, r), 0.5f), d);
+  c = svmla_x (pg, svmul_x (pg, c, d->pi_lo), c, d->pi_hi);
+  return svdiv_x (pg, c, s);
+}
+
+/* Return pi^2 / sin^2(pi x), the reflection term of trigamma.  Infinite for
+   integer x.  */
+static inline svfloat32_t
+sv_polygammaf_pi2csc2 (svbool_t pg, svfloat32_t x,
+		       const struct sv_polygammaf_refl_data *d)
+{
+  svfloat32_t s
+      = sv_polygammaf_sinpi (pg, svsub_x (pg, x, svrinta_x (pg, x)), d);
+  return svdivr_x (pg, svmul_x (pg, s, s), 1.0f);
+}
+
+/* Add sum_{k=0}^{n-1} 1/c_k^p to the fraction a/b, with c_k = t + off + k,
+   p = 2 if square is set and 1 otherwise, see v_polygammaf_sum.  n must not
+   be NaN in active lanes.  */
+static inline svfloat32x2_t
+sv_polygammaf_sum (svbool_t pg, svfloat32_t a, svfloat32_t b, svfloat32_t t,
+		   svfloat32_t off, svfloat32_t n, int square)
+{
+  int m = svmaxv (pg, n);
+  for (int k = m - 1; k >= 0; k--)
+    {
+      svbool_t active = svcmpgt (pg, n, (float) k);
+      svfloat32_t c = svadd_x (pg, t, svadd_x (pg, off, (float) k));
+      if (square)
+	c = svmul_x (pg, c, c);
+      a = svmad_m (active, a, c, b);
+      b = svmul_m (active, b, c);
+    }
+  return svcreate2 (a, b);
+}
+
+#endif
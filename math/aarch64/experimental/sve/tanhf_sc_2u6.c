@@ -0,0 +1,91 @@
+/*
+ * Streaming-compatible single-precision SVE tanh(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "mathlib.h"
+#include "test_defs.h"
+
+#if __ARM_FEATURE_SME
+
+/* Largest value of x for which tanhf(x) rounds to 1 (or -1 for negative).  */
+# define SpecialBound 0x1.205966p+3f /* ~9.01.  */
+
+static const struct data
+{
+  /* These 4 are grouped together so they can be loaded as one quadword, then
+   used with _lane forms of svmla/svmls.  */
+  float32_t c2, c4, ln2_hi, ln2_lo;
+  float c0, two_over_ln2, c1, c3, special_bound;
+} data = {
+  /* Same coefficients as _ZGVsMxv_tanhf.  */
+  .special_bound = SpecialBound,
+  .c0 = 0x1.fffffep-2,
+  .c1 = 0x1.5554aep-3,
+  .two_over_ln2 = 0x1.715476p+1f,
+  .c2 = 0x1.555736p-5,
+  .c3 = 0x1.12287cp-7,
+  .c4 = 0x1.6b55a2p-10,
+  .ln2_lo = 0x1.7f7d1cp-20f,
+  .ln2_hi = 0x1.62e4p-1f,
+};
+
+/* Estimate of e^2x - 1, see _ZGVsMxv_tanhf.  Only uses instructions that are
+   legal in streaming mode: 2^i is built with FSCALE.  */
+static inline svfloat32_t
+e2xm1f_inline (svfloat32_t x, svbool_t pg, const struct data *d) SC_ATTR
+{
+  svfloat32_t lane_constants = svld1rq (svptrue_b32 (), &d->c2);
+
+  svfloat32_t j = svmul_x (svptrue_b32 (), x, d->two_over_ln2);
+  j = svrinta_x (pg, j);
+  svfloat32_t f = svadd_x (pg, x, x);
+  f = svmls_lane (f, j, lane_constants, 2);
+  f = svmls_lane (f, j, lane_constants, 3);
+
+  svfloat32_t p12 = svmla_lane (svdup_f32 (d->c1), f, lane_constants, 0);
+  svfloat32_t p34 = svmla_lane (svdup_f32 (d->c3), f, lane_constants, 1);
+  svfloat32_t f2 = svmul_x (svptrue_b32 (), f, f);
+  svfloat32_t p = svmla_x (pg, p12, f2, p34);
+  p = svmla_x (pg, svdup_f32 (d->c0), f, p);
+  p = svmla_x (pg, f, f2, p);
+
+  svfloat32_t t = svscale_x (pg, svdup_f32 (1.0f), svcvt_s32_x (pg, j));
+  return svmla_x (pg, svsub_x (pg, t, 1.0f), p, t);
+}
+
+/* Streaming-compatible SVE tanhf, safe to call with PSTATE.SM set.  The
+   algorithm is that of _ZGVsMxv_tanhf, with saturated lanes selected in
+   vector registers rather than in a separate call.
+   Maximum error is 2.06 +0.5 ULP:
+   arm_math_sve_sc_tanhf (0x1.fc1832p-5) got 0x1.fb71a4p-5
+					want 0x1.fb71aap-5.  */
+svfloat32_t
+arm_math_sve_sc_tanhf (svfloat32_t x, const svbool_t pg) SC_ATTR
+{
+  const struct data *d = ptr_barrier (&data);
+
+  /* tanh is odd: evaluate on |x| and restore the sign, which also gives
+     tanh(-0) = -0.  tanh(x) = (e^2x - 1) / (e^2x + 1).  */
+  svfloat32_t ax = svabs_x (pg, x);
+  svuint32_t sign = svand_x (pg, svreinterpret_u32 (x), 0x80000000);
+  svfloat32_t q = e2xm1f_inline (ax, pg, d);
+  svfloat32_t y = svdiv_x (pg, q, svadd_x (pg, q, 2.0));
+
+  /* Set overflowing lanes to 1.  */
+  svbool_t special = svcmpgt (pg, ax, d->special_bound);
+  y = svsel (special, svdup_f32 (1.0f), y);
+  return svreinterpret_f32 (svorr_x (pg, svreinterpret_u32 (y), sign));
+}
+
+TEST_ULP (arm_math_sve_sc_tanhf, 2.07)
+TEST_SYM_INTERVAL (arm_math_sve_sc_tanhf, 0, 0x1p-23, 1000)
+TEST_SYM_INTERVAL (arm_math_sve_sc_tanhf, 0x1p-23, SpecialBound, 100000)
+TEST_SYM_INTERVAL (arm_math_sve_sc_tanhf, SpecialBound, inf, 100)
+/* Full range including NaNs.  */
+TEST_SYM_INTERVAL (arm_math_sve_sc_tanhf, 0, 0xffff0000, 50000)
+#endif
+CLOSE_SVE_ATTR
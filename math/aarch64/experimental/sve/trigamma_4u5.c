@@ -0,0 +1,78 @@
+/*
+ * Double-precision SVE trigamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_polygamma_common.h"
+
+static const struct data
+{
+  struct sv_polygamma_refl_data refl;
+  double asym_poly[6];
+} data = {
+  .refl = SV_POLYGAMMA_REFL_DATA,
+  /* trigamma(u) = r + r^2/2 + r^3 Q(r^2), r = 1/u, u >= AsymBound.  */
+  .asym_poly = { 0x1.5555555555544p-3, -0x1.1111111098c93p-5,
+		 0x1.86185d35d5d5p-6, -0x1.110d6ec0954f5p-5,
+		 0x1.34e8ab07a24f9p-4, -0x1.c615e13444695p-3 },
+};
+
+#define AsymBound 10.0
+#define TinyBound 0x1p-28
+
+/* For |x| < TinyBound, trigamma(x) rounds to 1/x^2.  */
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t cmp)
+{
+  return svsel (cmp, svdivr_x (cmp, svmul_x (cmp, x, x), 1.0), y);
+}
+
+/* SVE implementation of trigamma, see _ZGVnN2v_trigamma.  Poles at negative
+   integers return +inf.  The maximum observed error is 4.23 ULP:
+   _ZGVsMxv_trigamma(-0x1.28d90e2d92032p-2) got 0x1.d56faf800ceb6p+3
+					    want 0x1.d56faf800cebap+3.  */
+svfloat64_t SV_NAME_D1 (trigamma) (svfloat64_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t neg = svcmplt (pg, x, 0.0);
+  svfloat64_t t = svsel (neg, svsubr_x (pg, x, 1.0), x);
+
+  /* n = floor(AsymBound - t) + 1 so that t + n >= AsymBound, 0 for larger t
+     and NaN.  */
+  svfloat64_t n = svadd_x (pg, svrintm_x (pg, svsubr_x (pg, t, AsymBound)),
+			   1.0);
+  n = svsel (svcmplt (pg, t, AsymBound), n, sv_f64 (0));
+  svfloat64x2_t s
+      = sv_polygamma_sum (pg, sv_f64 (0), sv_f64 (1.0), t, sv_f64 (0), n, 1);
+
+  svfloat64_t r = svdivr_x (pg, svadd_x (pg, t, n), 1.0);
+  svfloat64_t z = svmul_x (pg, r, r);
+  svfloat64_t p
+      = svmad_x (pg, sv_horner_5_f64_x (pg, z, d->asym_poly), r, 0.5);
+  svfloat64_t y = svadd_x (pg, svdiv_x (pg, svget2 (s, 0), svget2 (s, 1)),
+			   svmla_x (pg, r, z, p));
+
+  /* Integer x < 0 give +inf, -inf gives NaN.  */
+  if (unlikely (svptest_any (pg, neg)))
+    y = svsel (neg,
+	       svsub_x (pg, sv_polygamma_pi2csc2 (pg, x, &d->refl), y), y);
+
+  svbool_t cmp = svaclt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_SIG (SV, D, 1, trigamma, 0.01, 10.0)
+TEST_ULP (SV_NAME_D1 (trigamma), 3.74)
+TEST_SYM_INTERVAL (SV_NAME_D1 (trigamma), 0, 0x1p-28, 1000)
+TEST_SYM_INTERVAL (SV_NAME_D1 (trigamma), 0x1p-28, 1, 100000)
+TEST_SYM_INTERVAL (SV_NAME_D1 (trigamma), 1, 10, 100000)
+TEST_SYM_INTERVAL (SV_NAME_D1 (trigamma), 10, 0x1p1023, 100000)
+TEST_SYM_INTERVAL (SV_NAME_D1 (trigamma), inf, inf, 1)
+CLOSE_SVE_ATTR
@@ -0,0 +1,76 @@
+/*
+ * Single-precision SVE trigamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_polygammaf_common.h"
+
+static const struct data
+{
+  struct sv_polygammaf_refl_data refl;
+  float asym_poly[4];
+} data = {
+  .refl = SV_POLYGAMMAF_REFL_DATA,
+  /* trigamma(u) = r + r^2/2 + r^3 Q(r^2), r = 1/u, u >= AsymBound.  */
+  .asym_poly = { 0x1.555554p-3f, -0x1.110a66p-5f, 0x1.81c0d4p-6f,
+		 -0x1.a92372p-6f },
+};
+
+#define AsymBound 4.0f
+#define TinyBound 0x1p-14f
+
+/* For |x| < TinyBound, trigamma(x) rounds to 1/x^2.  */
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp)
+{
+  return svsel (cmp, svdivr_x (cmp, svmul_x (cmp, x, x), 1.0f), y);
+}
+
+/* SVE implementation of trigamma, see _ZGVnN4v_trigammaf.  Poles at negative
+   integers return +inf.  The maximum observed error is 4.29 ULP:
+   _ZGVsMxv_trigammaf(-0x1.27be2ep-2) got 0x1.d813p+3
+				      want 0x1.d812f8p+3.  */
+svfloat32_t SV_NAME_F1 (trigamma) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t neg = svcmplt (pg, x, 0.0f);
+  svfloat32_t t = svsel (neg, svsubr_x (pg, x, 1.0f), x);
+
+  /* n = floor(AsymBound - t) + 1 so that t + n >= AsymBound, 0 for larger t
+     and NaN.  */
+  svfloat32_t n = svadd_x (pg, svrintm_x (pg, svsubr_x (pg, t, AsymBound)),
+			   1.0f);
+  n = svsel (svcmplt (pg, t, AsymBound), n, sv_f32 (0));
+  svfloat32x2_t s = sv_polygammaf_sum (pg, sv_f32 (0), sv_f32 (1.0f), t,
+				       sv_f32 (0), n, 1);
+
+  svfloat32_t r = svdivr_x (pg, svadd_x (pg, t, n), 1.0f);
+  svfloat32_t z = svmul_x (pg, r, r);
+  svfloat32_t p
+      = svmad_x (pg, sv_horner_3_f32_x (pg, z, d->asym_poly), r, 0.5f);
+  svfloat32_t y = svadd_x (pg, svdiv_x (pg, svget2 (s, 0), svget2 (s, 1)),
+			   svmla_x (pg, r, z, p));
+
+  /* Integer x < 0 give +inf, -inf gives NaN.  */
+  if (unlikely (svptest_any (pg, neg)))
+    y = svsel (neg,
+	       svsub_x (pg, sv_polygammaf_pi2csc2 (pg, x, &d->refl), y), y);
+
+  svbool_t cmp = svaclt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+TEST_SIG (SV, F, 1, trigamma, 0.01, 10.0)
+TEST_ULP (SV_NAME_F1 (trigamma), 3.79)
+TEST_SYM_INTERVAL (SV_NAME_F1 (trigamma), 0, 0x1p-14, 1000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (trigamma), 0x1p-14, 1, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (trigamma), 1, 4, 100000)
+TEST_SYM_INTERVAL (SV_NAME_F1 (trigamma), 4, inf, 100000)
+CLOSE_SVE_ATTR
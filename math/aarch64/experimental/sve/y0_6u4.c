@@ -0,0 +1,193 @@
+/*
+ * Double-precision SVE Bessel function of the second kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_bessel_common.h"
+
+#define SV_LOG_INLINE_POLY_ORDER 5
+#include "sv_log_inline.h"
+
+#define NQ 16
+
+static const struct data
+{
+  struct sv_bessel_asym_data asym;
+  struct sv_bessel_small_data j0;
+  double poly[11], local_poly[19];
+  double y01_hi, y01_lo, local_lo, local_hi;
+  double tpi, ln2_52;
+  struct sv_log_inline_data log_consts;
+  double mid[6][18];
+} data = {
+  .asym = SV_BESSEL_ASYM0_DATA,
+  .j0 = SV_BESSEL_J0_SMALL_DATA,
+  /* U(x^2) = Y0(x) - 2/pi log(x) J0(x), even and analytic.  */
+  .poly = { -0x1.2e4d699cbd01fp-4, 0x1.6bbcb4103428bp-3, -0x1.075b1bbf4142dp-6,
+	    0x1.1a6206b7bd662p-11, -0x1.3e9979435ea9bp-17,
+	    0x1.bce4a68fa0bc9p-24, -0x1.a6ee9e30e2355p-31,
+	    0x1.2399d07d3761cp-38, -0x1.3238303cf39e7p-46,
+	    0x1.1c30ec46f6244p-54, -0x1.1ec73b886e697p-61 },
+  /* Y0(x) = t G(t) in [0.625, 1.125), with t = x - y01 and y01 the first zero
+     of Y0.  */
+  .local_poly = { 0x1.c24371844b88ap-1, -0x1.f7e38a46d7104p-2,
+		  0x1.c3b1338af3f2ap-3, -0x1.cf18e6a4b2bdbp-3,
+		  0x1.c068086bee677p-3, -0x1.a396a80671a1dp-3,
+		  0x1.9424b9682f013p-3, -0x1.8d35b41191f6bp-3,
+		  0x1.8c08b9adf8b98p-3, -0x1.8f7e570973783p-3,
+		  0x1.96e3922602f47p-3, -0x1.a1afaaa879d8p-3,
+		  0x1.af218271ec629p-3, -0x1.c1c307d6bd305p-3,
+		  0x1.e10be7fbcde96p-3, -0x1.db949fcf96a33p-3,
+		  0x1.873895ad8a1ffp-3, -0x1.65067e600fe43p-2,
+		  0x1.2e1d8ef4b449ap-1 },
+  .y01_hi = 0x1.c982eb8d417eap-1,
+  .y01_lo = 0x1.ea9d270347f83p-56,
+  .local_lo = 0.625,
+  .local_hi = 1.125,
+  .tpi = 0x1.45f306dc9c883p-1,
+  .ln2_52 = 0x1.205966f2b4f12p+5, /* 52 * ln2.  */
+  .log_consts = SV_LOG_CONSTANTS,
+  .mid = {
+	  { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54,
+	    -0x1.9c345970782afp-2, 0x1.a089f87ba1266p-5, 0x1.df0a449efa9c3p-5,
+	    -0x1.cb46c81f857d5p-8, -0x1.4c81dff906926p-9,
+	    -0x1.9bb200f2cb484p-12, -0x1.694889138a56bp-11,
+	    -0x1.7aeb29724bfbap-11, -0x1.1bf03bbf6adb4p-11,
+	    -0x1.4ce5be38c1648p-12, -0x1.2d68860348be1p-13,
+	    -0x1.9e649869ddae6p-15, -0x1.a2fc77a18aabp-17,
+	    -0x1.26e2fdf81a5a8p-19, -0x1.0304f2fdabbe9p-22,
+	    -0x1.af9ecc6493171p-27 },
+	  { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54,
+	    -0x1.9c34256a12a0cp-2, 0x1.a09c9290367f5p-5, 0x1.df6d59bf50e87p-5,
+	    -0x1.c116fdc5a2096p-8, -0x1.1e32bc51d1144p-9,
+	    0x1.998273af0428ep-13, 0x1.ab2bcda144c4ep-15,
+	    -0x1.486f8f6ba56ebp-18, -0x1.3d6f415bcd5c9p-22,
+	    -0x1.c23920df2163dp-26, 0x1.bf1df3bd3eba5p-27,
+	    -0x1.3265d66b1dff9p-27, -0x1.1fbcddb3c41ffp-29,
+	    -0x1.0d2f3b18c85edp-30, 0x0p+0, 0x0p+0 },
+	  { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54,
+	    -0x1.9c34256a12a0ep-2, 0x1.a09c929036babp-5, 0x1.df6d59bf4b03dp-5,
+	    -0x1.c116fdc31658cp-8, -0x1.1e32bc7861539p-9,
+	    0x1.998284459d39ep-13, 0x1.ab2b52b20af67p-15,
+	    -0x1.4852ed027762bp-18, -0x1.3d05256447d4ap-22,
+	    -0x1.4ffa260190618p-26, 0x1.20ae2502648fcp-26,
+	    -0x1.3a06bf821c57dp-29, 0x1.5ec63df1de2fp-33, 0x0p+0, 0x0p+0,
+	    0x0p+0 },
+	  { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54,
+	    -0x1.9c34256e6f314p-2, 0x1.a09c93db46c09p-5, 0x1.df6d540de6023p-5,
+	    -0x1.c116824bbe157p-8, -0x1.1e3489e088f9bp-9,
+	    0x1.99a9e6174717ap-13, 0x1.aa88c537d47a4p-15,
+	    -0x1.444b33a42c1d8p-18, -0x1.6475a33d6e34p-22,
+	    -0x1.5b3a9a61ecbc5p-29, 0x1.7d80acd44514dp-27,
+	    -0x1.2148f589fe5d2p-30, 0x1.0cf339604c23p-35, 0x0p+0, 0x0p+0,
+	    0x0p+0 },
+	  { 0x1.c581dc4e72103p+2, -0x1.9774a495f56cfp-54, 0x1.334cca0697a5bp-2,
+	    -0x1.5aef611fc4c5fp-6, -0x1.8969c64cbec12p-5, 0x1.b2f14a95a200fp-9,
+	    0x1.1d35e861c62a4p-9, -0x1.26dd71649f64p-13,
+	    -0x1.8177df2ea7b69p-15, 0x1.6a92eb1dbf7bcp-19,
+	    0x1.34af24b666ce7p-21, -0x1.09d4d2460da1cp-25,
+	    -0x1.4217cb94101bp-28, 0x1.0f9c013df5f8ep-32,
+	    0x1.2e7bd8ef0a295p-35, 0x0p+0, 0x0p+0, 0x0p+0 },
+	  { 0x1.c581dc4e72103p+2, -0x1.9774a495f56cfp-54, 0x1.334cca0697a5bp-2,
+	    -0x1.5aef611fc4d64p-6, -0x1.8969c64cbf897p-5, 0x1.b2f14a9571f01p-9,
+	    0x1.1d35e860b2696p-9, -0x1.26dd72cab5797p-13,
+	    -0x1.8177d09aeff43p-15, 0x1.6a8e30eef94b1p-19,
+	    0x1.34c8b5d6f950cp-21, -0x1.0c6b5fd1ca749p-25,
+	    -0x1.370e8e9a610ebp-28, 0x1.58b081d19f613p-33,
+	    0x1.4868cef814cabp-35, 0x0p+0, 0x0p+0, 0x0p+0 },
+  },
+};
+
+#define TinyBound 0x1p-1022
+
+/* Handle x <= 0, which returns -inf for 0 and NaN otherwise, and subnormal x
+   for which log is computed on x * 2^52.  */
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svfloat64_t j0, svfloat64_t u,
+	      svbool_t cmp, const struct data *d)
+{
+  svbool_t ptrue = svptrue_b64 ();
+  svbool_t tiny = svcmplt (ptrue, x, TinyBound);
+  svfloat64_t xs = svmul_m (tiny, x, 0x1p52);
+  svfloat64_t logx = sv_log_inline (ptrue, xs, &d->log_consts);
+  logx = svsub_m (tiny, logx, d->ln2_52);
+  svfloat64_t ys = svmla_x (ptrue, u, svmul_x (ptrue, logx, d->tpi), j0);
+  svfloat64_t yneg = svsel (svcmpeq (ptrue, x, 0.0), sv_f64 (-INFINITY),
+			    sv_f64 (__builtin_nan ("")));
+  ys = svsel (svcmple (ptrue, x, 0.0), yneg, ys);
+  return svsel (cmp, ys, y);
+}
+
+/* Y0(x) = 2/pi log(x) J0(x) + U(x^2).  */
+static inline svfloat64_t
+y0_small (svbool_t pg, svfloat64_t x, const struct data *d)
+{
+  svfloat64_t z = svmul_x (pg, x, x);
+  svfloat64_t j0 = sv_bessel_small (pg, x, z, &d->j0);
+  svfloat64_t u = sv_horner_10_f64_x (pg, z, d->poly);
+  svfloat64_t logx = sv_log_inline (pg, x, &d->log_consts);
+  svfloat64_t y = svmla_x (pg, u, svmul_x (pg, logx, d->tpi), j0);
+
+  /* Around the first zero, the absolute error of the sum above is too large
+     relative to Y0(x).  */
+  svbool_t local = svcmplt (svcmpge (pg, x, d->local_lo), x, d->local_hi);
+  if (unlikely (svptest_any (pg, local)))
+    {
+      svfloat64_t t = svsub_x (pg, svsub_x (pg, x, d->y01_hi), d->y01_lo);
+      svfloat64_t t2 = svmul_x (pg, t, t);
+      svfloat64_t g = svmul_x (
+	  pg, t, sv_pw_horner_18_f64_x (pg, t, t2, d->local_poly));
+      y = svsel (local, g, y);
+    }
+
+  svbool_t cmp = svcmplt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, j0, u, cmp, d);
+  return y;
+}
+
+/* SVE implementation of Y0, the Bessel function of the second kind of order
+   0, see _ZGVnN2v_y0.  Relative error is unbounded around the zeros above 8,
+   the error grows like 1/|x - zero|.  Away from those zeros by at least 1/16,
+   the maximum observed error is 6.32 ULP:
+   _ZGVsMxv_y0(0x1.9a1da67092ff1p+3) got -0x1.d95fdf11b5854p-4
+				     want -0x1.d95fdf11b584ep-4.  */
+svfloat64_t SV_NAME_D1 (y0) (svfloat64_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  /* NaN is not in the asymptotic region, and propagates through the table
+     region approximation.  */
+  svbool_t asym = svcmpge (pg, x, AsymBound);
+  svbool_t lt_asym = svnot_z (pg, asym);
+  if (!svptest_any (pg, lt_asym))
+    return sv_bessel_asym (pg, x, 0, 3, &d->asym);
+
+  svfloat64_t y = sv_bessel_mid (pg, x, &d->mid[0][0], NQ);
+  svbool_t small = svcmplt (pg, x, MidBound);
+  if (svptest_any (pg, small))
+    y = svsel (small, y0_small (pg, x, d), y);
+  if (svptest_any (pg, asym))
+    y = svsel (asym, sv_bessel_asym (pg, x, 0, 3, &d->asym), y);
+  return y;
+}
+
+TEST_SIG (SV, D, 1, y0, 0.01, 10.0)
+TEST_ULP (SV_NAME_D1 (y0), 5.82)
+/* Errors are only bounded away from the zeros of Y0 above 8, test in
+   between.  */
+TEST_INTERVAL (SV_NAME_D1 (y0), 0, 0x1p-1022, 1000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 0x1p-1022, 10.15, 100000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 10.29, 13.29, 100000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 4094.35, 4097.35, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 8388603.02, 8388606.02, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 8388609.3, 8388612.31, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y0), 10000000001.36, 10000000004.37, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y0), inf, inf, 1)
+TEST_INTERVAL (SV_NAME_D1 (y0), -0, -inf, 1000)
+CLOSE_SVE_ATTR
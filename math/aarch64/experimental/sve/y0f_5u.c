@@ -0,0 +1,125 @@
+/*
+ * Single-precision SVE Bessel function of the second kind of order 0.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_besself_common.h"
+#include "sv_logf_inline.h"
+
+static const struct data
+{
+  struct sv_besself_asym_data asym;
+  struct sv_besself_small_data j0;
+  float poly[8], local_poly[9];
+  float y01_hi, y01_lo, local_lo, local_hi;
+  float tpi, ln2_23;
+  struct sv_logf_data logf_consts;
+} data = {
+  .asym = SV_BESSELF_ASYM0_DATA,
+  .j0 = SV_BESSELF_J0_SMALL_DATA,
+  /* U(x^2) = Y0(x) - 2/pi log(x) J0(x), even and analytic.  */
+  .poly = { -0x1.2e4d6ap-4f, 0x1.6bbcb6p-3f, -0x1.075b46p-6f, 0x1.1a684ep-11f,
+	    -0x1.3f8dfcp-17f, 0x1.e4b5fp-24f, -0x1.3d0eeep-29f,
+	    0x1.d2963cp-34f },
+  /* Y0(x) = t G(t) in [0.625, 1.125), with t = x - y01 and y01 the first zero
+     of Y0.  */
+  .local_poly = { 0x1.c24372p-1f, -0x1.f7e384p-2f, 0x1.c3af0cp-3f,
+		  -0x1.cf237cp-3f, 0x1.c10b64p-3f, -0x1.a11bdep-3f,
+		  0x1.8200e2p-3f, -0x1.c4deep-3f, 0x1.256c96p-2f },
+  .y01_hi = 0x1.c982ecp-1f,
+  .y01_lo = -0x1.cafa06p-27f,
+  .local_lo = 0.625f,
+  .local_hi = 1.125f,
+  .tpi = 0x1.45f306p-1f,
+  .ln2_23 = 0x1.fe2804p+3f, /* 23 * ln2.  */
+  .logf_consts = SV_LOGF_CONSTANTS,
+};
+
+#define TinyBound 0x1p-126f
+
+/* Handle x <= 0, which returns -inf for 0 and NaN otherwise, and subnormal x
+   for which log is computed on x * 2^23.  */
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svfloat32_t j0, svfloat32_t u,
+	      svbool_t cmp, const struct data *d)
+{
+  svbool_t ptrue = svptrue_b32 ();
+  svbool_t tiny = svcmplt (ptrue, x, TinyBound);
+  svfloat32_t xs = svmul_m (tiny, x, 0x1p23f);
+  svfloat32_t logx = sv_logf_inline (ptrue, xs, &d->logf_consts);
+  logx = svsub_m (tiny, logx, d->ln2_23);
+  svfloat32_t ys = svmla_x (ptrue, u, svmul_x (ptrue, logx, d->tpi), j0);
+  svfloat32_t yneg = svsel (svcmpeq (ptrue, x, 0.0f), sv_f32 (-INFINITY),
+			    sv_f32 (__builtin_nanf ("")));
+  ys = svsel (svcmple (ptrue, x, 0.0f), yneg, ys);
+  return svsel (cmp, ys, y);
+}
+
+/* Y0(x) = 2/pi log(x) J0(x) + U(x^2).  */
+static inline svfloat32_t
+y0_small (svbool_t pg, svfloat32_t x, const struct data *d)
+{
+  svfloat32_t z = svmul_x (pg, x, x);
+  svfloat32_t j0 = sv_besself_small (pg, x, z, &d->j0);
+  svfloat32_t u = sv_horner_7_f32_x (pg, z, d->poly);
+  svfloat32_t logx = sv_logf_inline (pg, x, &d->logf_consts);
+  svfloat32_t y = svmla_x (pg, u, svmul_x (pg, logx, d->tpi), j0);
+
+  /* Around the first zero, the absolute error of the sum above is too large
+     relative to Y0(x).  */
+  svbool_t local = svcmplt (svcmpge (pg, x, d->local_lo), x, d->local_hi);
+  if (unlikely (svptest_any (pg, local)))
+    {
+      svfloat32_t t = svsub_x (pg, svsub_x (pg, x, d->y01_hi), d->y01_lo);
+      svfloat32_t g
+	  = svmul_x (pg, t, sv_horner_8_f32_x (pg, t, d->local_poly));
+      y = svsel (local, g, y);
+    }
+
+  svbool_t cmp = svcmplt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, j0, u, cmp, d);
+  return y;
+}
+
+/* SVE implementation of Y0, the Bessel function of the second kind of order
+   0, see _ZGVnN4v_y0f.  Relative error is unbounded around the zeros above
+   the first one, the error grows like 1/|x - zero|.  Away from zeros by at
+   least 1/16, the maximum observed error is 4.95 ULP:
+   _ZGVsMxv_y0f(0x1.bf77dap+2) got -0x1.d260b4p-6
+			      want -0x1.d260aap-6.  */
+svfloat32_t SV_NAME_F1 (y0) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t asym = svcmpge (pg, x, AsymBound);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  if (!svptest_any (pg, asym))
+    return y0_small (pg, x, d);
+
+  svfloat32_t y = sv_besself_asym (pg, x, 3, &d->asym);
+  svbool_t small = svnot_z (pg, asym);
+  if (svptest_any (pg, small))
+    return svsel (small, y0_small (pg, x, d), y);
+  return y;
+}
+
+TEST_SIG (SV, F, 1, y0, 0.01, 10.0)
+TEST_ULP (SV_NAME_F1 (y0), 4.46)
+/* Errors are only bounded away from the zeros of Y0 above the first one, test
+   in between.  */
+TEST_INTERVAL (SV_NAME_F1 (y0), 0, 0x1p-126, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y0), 0x1p-126, 3.89, 100000)
+TEST_INTERVAL (SV_NAME_F1 (y0), 4.03, 7.02, 100000)
+TEST_INTERVAL (SV_NAME_F1 (y0), 4091.21, 4094.21, 10000)
+TEST_INTERVAL (SV_NAME_F1 (y0), 524285.54, 524288.55, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y0), 2097149.04, 2097152.04, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y0), inf, inf, 1)
+TEST_INTERVAL (SV_NAME_F1 (y0), -0, -inf, 1000)
+CLOSE_SVE_ATTR
@@ -0,0 +1,176 @@
+/*
+ * Double-precision SVE Bessel function of the second kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_bessel_common.h"
+
+#define SV_LOG_INLINE_POLY_ORDER 5
+#include "sv_log_inline.h"
+
+#define NQ 17
+
+static const struct data
+{
+  struct sv_bessel_asym_data asym;
+  struct sv_bessel_small_data j1;
+  double poly[11], local_poly[12];
+  double y11_hi, y11_lo, local_lo, tpi;
+  struct sv_log_inline_data log_consts;
+  double mid[6][20];
+} data = {
+  .asym = SV_BESSEL_ASYM1_DATA,
+  .j1 = SV_BESSEL_J1_SMALL_DATA,
+  /* x U(x^2) = Y1(x) - 2/pi (log(x) J1(x) - 1/x), odd and analytic.  */
+  .poly = { -0x1.91866143cbc8ap-3, 0x1.bd3975c75b493p-5, -0x1.835b97894b79cp-9,
+	    0x1.2c7dbffcbd507p-14, -0x1.0a780abc2af89p-20,
+	    0x1.32e5a040d5ce5p-27, -0x1.f0cbd7dcf0418p-35,
+	    0x1.29ec3f9b249b9p-42, -0x1.010aa3a64d6ep-50,
+	    -0x1.5c320fe1ea9b2p-58, 0x1.9cddf494e19b2p-62 },
+  /* Y1(x) = t G(t) in [1.75, 2), with t = x - y11 and y11 the first zero of
+     Y1.  */
+  .local_poly = { 0x1.0aa48442791a8p-1, -0x1.e56f82b60fe2p-4,
+		  -0x1.0d2b09f64a65dp-5, -0x1.3a7513e9dd49ep-8,
+		  0x1.e63dd788a6e7dp-8, -0x1.563b62c39d47cp-9,
+		  0x1.08834874d42adp-10, -0x1.5b5835dfa77a4p-11,
+		  -0x1.b5e9a24845ef5p-15, -0x1.f7e162006dcb6p-12,
+		  -0x1.0d4f3a4c0d216p-12, -0x1.41dcbbb3d052fp-13 },
+  .y11_hi = 0x1.193bed4dff243p+1,
+  .y11_lo = -0x1.bd1e50d219bfdp-55,
+  .local_lo = 1.75,
+  .tpi = 0x1.45f306dc9c883p-1,
+  .log_consts = SV_LOG_CONSTANTS,
+  .mid = {
+	  { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x1.0aa48442f014bp-1,
+	    -0x1.e56f82217b8fp-4, -0x1.0d2af4e932759p-5, -0x1.3a6dec3726cf8p-8,
+	    0x1.e671c7d1e376bp-8, -0x1.5429dc5f7ffabp-9, 0x1.17ab4a7fa85f6p-10,
+	    -0x1.0b2d81d5c28f1p-11, 0x1.eea7d9210df73p-13,
+	    -0x1.c3ff0b0437dfap-14, 0x1.9d2b712f624dap-15,
+	    -0x1.791dfbd3516b7p-16, 0x1.541e49298e1b8p-17,
+	    -0x1.22d90ac54d045p-18, 0x1.aae45a5cdd188p-20,
+	    -0x1.c262ea61763d5p-22, 0x1.e3f92661c9d83p-25, 0 },
+	  { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x1.0aa4834f718fep-1,
+	    -0x1.e56f1fc925d04p-4, -0x1.0d2f9829b0969p-5,
+	    -0x1.39e2ea365fffcp-8, 0x1.e5074b1cc33b1p-8, -0x1.4eb2dd42ac832p-9,
+	    0x1.0774f3c69e207p-10, -0x1.ca71d58db6482p-12,
+	    0x1.5f792659db7e7p-13, -0x1.cc3eaf87df10ap-15,
+	    0x1.f14c821d3b8f6p-17, -0x1.a27e3321f6c29p-19,
+	    0x1.fc1ad7b960cd4p-22, -0x1.88f54373b9cf1p-25,
+	    0x1.215bf4873c83ap-29, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556ee3531p-2,
+	    0x1.00b9f86c02831p-5, 0x1.a15d937b49505p-5, -0x1.10a31437dbe77p-8,
+	    -0x1.1be65a3b4a996p-9, 0x1.338d87ec405ap-13, 0x1.86216b4fb659ap-15,
+	    -0x1.7916f612889acp-19, -0x1.0d8516a1ddd12p-21,
+	    0x1.ba93b9f9afbefp-25, 0x1.13f08e96ed368p-26,
+	    0x1.36bb76abcf229p-29, 0x1.74d60e31a7166p-32, 0x0p+0, 0x0p+0,
+	    0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556f0c19ap-2,
+	    0x1.00b9f8571ca2p-5, 0x1.a15d92dfe3f7bp-5, -0x1.10a329e2c2addp-8,
+	    -0x1.1be6db9948c9ep-9, 0x1.337c7e15bca7ep-13,
+	    0x1.85b941560865fp-15, -0x1.80619969b6336p-19,
+	    -0x1.255ef3bc87f48p-21, 0x1.b6465ed916796p-26,
+	    0x1.812adb1b2a16fp-28, -0x1.b707df9252db6p-32,
+	    0x1.ef39b4c10c93dp-39, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, -0x1.5c7c556f03e32p-2,
+	    0x1.00b9f8539af26p-5, 0x1.a15d92f5bbd13p-5, -0x1.10a32c73a1194p-8,
+	    -0x1.1be6ce9e62bcep-9, 0x1.337b093869d55p-13,
+	    0x1.85c0e15773144p-15, -0x1.80d726dcd9b1dp-19,
+	    -0x1.2412ca82a0654p-21, 0x1.a155189629649p-26,
+	    0x1.9cb0d1b1e8959p-28, -0x1.f9dd4d390b8c7p-32,
+	    0x1.0325f10d3af04p-40, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+	  { 0x1.13127ae6169b4p+3, 0x1.479cc068d9046p-52, 0x1.15f993fce48efp-2,
+	    -0x1.02b3934203a53p-6, -0x1.6395dff3d986p-5, 0x1.3ced26bbdbf56p-9,
+	    0x1.07a67070f4ce3p-9, -0x1.b50f4db66d597p-14,
+	    -0x1.6f80370badb8ep-15, 0x1.172b751c1feacp-19,
+	    0x1.2b39122741bfdp-21, -0x1.ae2b43b0eda05p-26,
+	    -0x1.4f3fb6d20dc6bp-28, 0x1.55ede1f0e9825p-33,
+	    0x1.ec22bcc4859fbp-36, 0x0p+0, 0x0p+0, 0x0p+0, 0x0p+0, 0 },
+  },
+};
+
+#define TinyBound 0x1p-1022
+
+/* For x < TinyBound, Y1(x) rounds to -2/(pi x), which overflows to -inf only
+   when Y1 does, and gives -inf for -0 and 0.  x < 0 returns NaN.  */
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t cmp,
+	      const struct data *d)
+{
+  svfloat64_t ytiny = svdivr_x (cmp, svabs_x (cmp, x), -d->tpi);
+  ytiny = svsel (svcmplt (cmp, x, 0.0), sv_f64 (__builtin_nan ("")), ytiny);
+  return svsel (cmp, ytiny, y);
+}
+
+/* Y1(x) = 2/pi (log(x) J1(x) - 1/x) + x U(x^2).  */
+static inline svfloat64_t
+y1_small (svbool_t pg, svfloat64_t x, const struct data *d)
+{
+  svfloat64_t z = svmul_x (pg, x, x);
+  svfloat64_t j1 = svmul_x (pg, x, sv_bessel_small (pg, x, z, &d->j1));
+  svfloat64_t u = svmul_x (pg, x, sv_horner_10_f64_x (pg, z, d->poly));
+  svfloat64_t logx = sv_log_inline (pg, x, &d->log_consts);
+  svfloat64_t a = svmla_x (pg, svdivr_x (pg, x, -1.0), j1, logx);
+  svfloat64_t y = svmla_x (pg, u, a, d->tpi);
+
+  /* Up to the first zero, the absolute error of the sum above is too large
+     relative to Y1(x).  */
+  svbool_t local = svcmpge (pg, x, d->local_lo);
+  if (unlikely (svptest_any (pg, local)))
+    {
+      svfloat64_t t = svsub_x (pg, svsub_x (pg, x, d->y11_hi), d->y11_lo);
+      svfloat64_t g
+	  = svmul_x (pg, t, sv_horner_11_f64_x (pg, t, d->local_poly));
+      y = svsel (local, g, y);
+    }
+
+  svbool_t cmp = svcmplt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp, d);
+  return y;
+}
+
+/* SVE implementation of Y1, the Bessel function of the second kind of order
+   1, see _ZGVnN2v_y1.  Relative error is unbounded around the zeros above 8,
+   the error grows like 1/|x - zero|.  Away from those zeros by at least 1/16,
+   the maximum observed error is 5.59 ULP:
+   _ZGVsMxv_y1(0x1.73bc231351dc3p+3) got 0x1.f9ceb8dfe901cp-6
+				     want 0x1.f9ceb8dfe9016p-6.  */
+svfloat64_t SV_NAME_D1 (y1) (svfloat64_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  /* NaN is not in the asymptotic region, and propagates through the table
+     region approximation.  */
+  svbool_t asym = svcmpge (pg, x, AsymBound);
+  svbool_t lt_asym = svnot_z (pg, asym);
+  if (!svptest_any (pg, lt_asym))
+    return sv_bessel_asym (pg, x, 1, 2, &d->asym);
+
+  svfloat64_t y = sv_bessel_mid (pg, x, &d->mid[0][0], NQ);
+  svbool_t small = svcmplt (pg, x, MidBound);
+  if (svptest_any (pg, small))
+    y = svsel (small, y1_small (pg, x, d), y);
+  if (svptest_any (pg, asym))
+    y = svsel (asym, sv_bessel_asym (pg, x, 1, 2, &d->asym), y);
+  return y;
+}
+
+TEST_SIG (SV, D, 1, y1, 0.01, 10.0)
+TEST_ULP (SV_NAME_D1 (y1), 5.09)
+/* Errors are only bounded away from the zeros of Y1 above 8, test in
+   between.  */
+TEST_INTERVAL (SV_NAME_D1 (y1), 0, 0x1p-1022, 1000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 0x1p-1022, 8.53, 100000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 8.66, 11.68, 100000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 4092.78, 4095.78, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 8388601.45, 8388604.45, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 8388610.87, 8388613.88, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y1), 10000000002.93, 10000000005.94, 10000)
+TEST_INTERVAL (SV_NAME_D1 (y1), inf, inf, 1)
+TEST_INTERVAL (SV_NAME_D1 (y1), -0, -inf, 1000)
+CLOSE_SVE_ATTR
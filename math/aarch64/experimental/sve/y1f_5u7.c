@@ -0,0 +1,115 @@
+/*
+ * Single-precision SVE Bessel function of the second kind of order 1.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "test_sig.h"
+#include "test_defs.h"
+#include "sv_besself_common.h"
+#include "sv_logf_inline.h"
+
+static const struct data
+{
+  struct sv_besself_asym_data asym;
+  struct sv_besself_small_data j1;
+  float poly[8], local_poly[6];
+  float y11_hi, y11_lo, local_lo, tpi;
+  struct sv_logf_data logf_consts;
+} data = {
+  .asym = SV_BESSELF_ASYM1_DATA,
+  .j1 = SV_BESSELF_J1_SMALL_DATA,
+  /* x U(x^2) = Y1(x) - 2/pi (log(x) J1(x) - 1/x), odd and analytic.  */
+  .poly = { -0x1.918662p-3f, 0x1.bd3992p-5f, -0x1.83606ap-9f, 0x1.2d36c4p-14f,
+	    -0x1.26ddd2p-20f, 0x1.7717f8p-25f, -0x1.92aaa6p-28f,
+	    0x1.aa7256p-32f },
+  /* Y1(x) = t G(t) in [1.75, 2), with t = x - y11 and y11 the first zero of
+     Y1.  */
+  .local_poly = { 0x1.0aa43p-1f, -0x1.e5a39p-4f, -0x1.106d94p-5f,
+		  -0x1.a63396p-8f, 0x1.f0c238p-9f, -0x1.a6b44ep-8f },
+  .y11_hi = 0x1.193beep+1f,
+  .y11_lo = -0x1.6401b8p-24f,
+  .local_lo = 1.75f,
+  .tpi = 0x1.45f306p-1f,
+  .logf_consts = SV_LOGF_CONSTANTS,
+};
+
+#define TinyBound 0x1p-126f
+
+/* For x < TinyBound, Y1(x) rounds to -2/(pi x), which overflows to -inf only
+   when Y1 does, and gives -inf for -0 and 0.  x < 0 returns NaN.  */
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp,
+	      const struct data *d)
+{
+  svfloat32_t ytiny = svdivr_x (cmp, svabs_x (cmp, x), -d->tpi);
+  ytiny = svsel (svcmplt (cmp, x, 0.0f), sv_f32 (__builtin_nanf ("")), ytiny);
+  return svsel (cmp, ytiny, y);
+}
+
+/* Y1(x) = 2/pi (log(x) J1(x) - 1/x) + x U(x^2).  */
+static inline svfloat32_t
+y1_small (svbool_t pg, svfloat32_t x, const struct data *d)
+{
+  svfloat32_t z = svmul_x (pg, x, x);
+  svfloat32_t j1 = svmul_x (pg, x, sv_besself_small (pg, x, z, &d->j1));
+  svfloat32_t u = svmul_x (pg, x, sv_horner_7_f32_x (pg, z, d->poly));
+  svfloat32_t logx = sv_logf_inline (pg, x, &d->logf_consts);
+  svfloat32_t a = svmla_x (pg, svdivr_x (pg, x, -1.0f), j1, logx);
+  svfloat32_t y = svmla_x (pg, u, a, d->tpi);
+
+  /* Up to the first zero, the absolute error of the sum above is too large
+     relative to Y1(x).  */
+  svbool_t local = svcmpge (pg, x, d->local_lo);
+  if (unlikely (svptest_any (pg, local)))
+    {
+      svfloat32_t t = svsub_x (pg, svsub_x (pg, x, d->y11_hi), d->y11_lo);
+      svfloat32_t g
+	  = svmul_x (pg, t, sv_horner_5_f32_x (pg, t, d->local_poly));
+      y = svsel (local, g, y);
+    }
+
+  svbool_t cmp = svcmplt (pg, x, TinyBound);
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp, d);
+  return y;
+}
+
+/* SVE implementation of Y1, the Bessel function of the second kind of order
+   1, see _ZGVnN4v_y1f.  Relative error is unbounded around the zeros, the
+   error grows like 1/|x - zero|.  Away from zeros by at least 1/16, the
+   maximum observed error is 5.66 ULP:
+   _ZGVsMxv_y1f(0x1.0c9b84p+1) got -0x1.ae0ae4p-5
+			      want -0x1.ae0ad8p-5.  */
+svfloat32_t SV_NAME_F1 (y1) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+  svbool_t asym = svcmpge (pg, x, AsymBound);
+
+  /* NaN is not in the asymptotic region, and propagates through the small
+     region approximation.  */
+  if (!svptest_any (pg, asym))
+    return y1_small (pg, x, d);
+
+  svfloat32_t y = sv_besself_asym (pg, x, 2, &d->asym);
+  svbool_t small = svnot_z (pg, asym);
+  if (svptest_any (pg, small))
+    return svsel (small, y1_small (pg, x, d), y);
+  return y;
+}
+
+TEST_SIG (SV, F, 1, y1, 0.01, 10.0)
+TEST_ULP (SV_NAME_F1 (y1), 5.17)
+/* Errors are only bounded away from the zeros of Y1, test in between.  */
+TEST_INTERVAL (SV_NAME_F1 (y1), 0, 0x1p-126, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 0x1p-126, 2.13, 100000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 2.27, 5.36, 100000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 5.5, 8.53, 100000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 4092.78, 4095.78, 10000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 524287.11, 524290.12, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y1), 2097150.61, 2097153.61, 1000)
+TEST_INTERVAL (SV_NAME_F1 (y1), inf, inf, 1)
+TEST_INTERVAL (SV_NAME_F1 (y1), -0, -inf, 1000)
+CLOSE_SVE_ATTR
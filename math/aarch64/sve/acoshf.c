@@ -26,7 +26,7 @@ static svfloat32_t inline special_case (svfloat32_t x, svfloat32_t xm1,
 					const struct sv_log1pf_data *d)
 {
   svfloat32_t logv = sv_log1pf_inline (svsel (special, xm1, y), pg);
-  svfloat32_t result = svadd_m (special, logv, sv_f32 (d->ln2));
+  svfloat32_t result = svadd_m (special, logv, sv_f32 (d->core.ln2));
 
   /* Catch x<1, and x==inf.
      Also catch x==nan using negation of fp comparison.  */
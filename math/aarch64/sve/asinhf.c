@@ -27,7 +27,7 @@ special_case (svfloat32_t ax, svfloat32_t y, svuint32_t sign, svbool_t pg,
   svfloat32_t inf = svreinterpret_f32 (sv_u32 (d->inf));
   svbool_t is_inf = svcmpeq (special, ax, inf);
   svbool_t is_nan = svcmpne (special, ax, ax);
-  svfloat32_t inf_ln2 = svsel (is_inf, inf, sv_f32 (d->ln2));
+  svfloat32_t inf_ln2 = svsel (is_inf, inf, sv_f32 (d->core.ln2));
   svfloat32_t inf_nan_ln2
       = svsel (is_nan, svreinterpret_f32 (sv_u32 (d->nan)), inf_ln2);
   svfloat32_t asinh_x_res = svadd_x (special, log_ax, inf_nan_ln2);
@@ -16,7 +16,7 @@
 
 static const struct data
 {
-  struct sv_expf_data expf_consts;
+  struct arm_math_sv_expf_data expf_consts;
   float32_t special_bound, cosh_9;
 } data = {
   .expf_consts = SV_EXPF_DATA,
@@ -6,6 +6,7 @@
  */
 
 #include "sv_math.h"
+#include "sv_rsqrt_inline.h"
 #include "test_defs.h"
 
 static const struct data
@@ -23,35 +24,11 @@ static const struct data
   .scale_down = 27,
 };
 
-static inline svfloat64_t
-inline_rsqrt (svfloat64_t x)
-{
-  /* Do estimate instruction.  */
-  svfloat64_t estimate = svrsqrte_f64 (x);
-
-  /* Do first step instruction.  */
-  svfloat64_t estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
-  svfloat64_t step = svrsqrts_f64 (x, estimate_squared);
-  estimate = svmul_x (svptrue_b64 (), estimate, step);
-
-  /* Do second step instruction.  */
-  estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
-  step = svrsqrts_f64 (x, estimate_squared);
-  estimate = svmul_x (svptrue_b64 (), estimate, step);
-
-  /* Do third step instruction.
-     This is required to achieve < 3.0 ULP.  */
-  estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
-  step = svrsqrts_f64 (x, estimate_squared);
-  estimate = svmul_x (svptrue_b64 (), estimate, step);
-  return estimate;
-}
-
 static svfloat64_t NOINLINE
 special_case (svfloat64_t x, svbool_t special, const struct data *d)
 {
   x = svscale_f64_m (special, x, sv_s64 (d->scale_up));
-  svfloat64_t estimate = inline_rsqrt (x);
+  svfloat64_t estimate = sv_rsqrt_inline (x);
   return svscale_f64_m (special, estimate, sv_s64 (d->scale_down));
 }
 
@@ -68,7 +45,7 @@ svfloat64_t SV_NAME_D1 (rsqrt) (svfloat64_t x, svbool_t pg)
     {
       return special_case (x, special, d);
     }
-  return inline_rsqrt (x);
+  return sv_rsqrt_inline (x);
 }
 
 #if WANT_C23_TESTS
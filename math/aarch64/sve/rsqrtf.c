@@ -6,6 +6,7 @@
  */
 
 #include "sv_math.h"
+#include "sv_rsqrtf_inline.h"
 #include "test_defs.h"
 
 static const struct data
@@ -24,30 +25,11 @@ static const struct data
   .scale_down = 11,
 };
 
-static inline svfloat32_t
-inline_rsqrt (svfloat32_t x)
-{
-  /* Do estimate instruction.  */
-  svfloat32_t estimate = svrsqrte_f32 (x);
-
-  /* Do first step instruction.  */
-  svfloat32_t estimate_squared = svmul_x (svptrue_b32 (), estimate, estimate);
-  svfloat32_t step = svrsqrts_f32 (x, estimate_squared);
-  estimate = svmul_x (svptrue_b32 (), estimate, step);
-
-  /* Do second step instruction.
-    This is required to achieve < 3.0 ULP.  */
-  estimate_squared = svmul_x (svptrue_b32 (), estimate, estimate);
-  step = svrsqrts_f32 (x, estimate_squared);
-  estimate = svmul_x (svptrue_b32 (), estimate, step);
-  return estimate;
-}
-
 static svfloat32_t NOINLINE
 special_case (svfloat32_t x, svbool_t special, const struct data *d)
 {
   x = svscale_f32_m (special, x, sv_s32 (d->scale_up));
-  svfloat32_t estimate = inline_rsqrt (x);
+  svfloat32_t estimate = sv_rsqrtf_inline (x);
   return svscale_f32_m (special, estimate, sv_s32 (d->scale_down));
 }
 
@@ -64,7 +46,7 @@ svfloat32_t SV_NAME_F1 (rsqrt) (svfloat32_t x, svbool_t pg)
     {
       return special_case (x, special, d);
     }
-  return inline_rsqrt (x);
+  return sv_rsqrtf_inline (x);
 }
 
 #if WANT_C23_TESTS
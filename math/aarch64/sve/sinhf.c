@@ -14,7 +14,7 @@
 static const struct data
 {
   struct sv_expm1f_data expm1f_consts;
-  struct sv_expf_data expf_consts;
+  struct arm_math_sv_expf_data expf_consts;
   float32_t special_bound, cosh_9;
   uint32_t halff;
 } data = {
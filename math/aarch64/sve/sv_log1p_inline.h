@@ -51,6 +51,46 @@ static const struct sv_log1p_data
   .one_top = 0x3ff
 };
 
+/* P such that log1p(f) ~= f + f^2 P(f) on the reduced interval.  */
+static inline svfloat64_t
+sv_log1p_poly (svfloat64_t f, svfloat64_t f2, const svbool_t pg,
+	       const struct sv_log1p_data *d)
+{
+  svfloat64_t f4 = svmul_x (svptrue_b64 (), f2, f2),
+	      f8 = svmul_x (svptrue_b64 (), f4, f4),
+	      f16 = svmul_x (svptrue_b64 (), f8, f8);
+
+  svfloat64_t c13 = svld1rq (svptrue_b64 (), &d->c1);
+  svfloat64_t c57 = svld1rq (svptrue_b64 (), &d->c5);
+  svfloat64_t c911 = svld1rq (svptrue_b64 (), &d->c9);
+  svfloat64_t c1315 = svld1rq (svptrue_b64 (), &d->c13);
+  svfloat64_t c1718 = svld1rq (svptrue_b64 (), &d->c17);
+
+  /* Order-18 Estrin scheme.  */
+  svfloat64_t p01 = svmla_lane (sv_f64 (d->c0), f, c13, 0);
+  svfloat64_t p23 = svmla_lane (sv_f64 (d->c2), f, c13, 1);
+  svfloat64_t p45 = svmla_lane (sv_f64 (d->c4), f, c57, 0);
+  svfloat64_t p67 = svmla_lane (sv_f64 (d->c6), f, c57, 1);
+
+  svfloat64_t p03 = svmla_x (pg, p01, f2, p23);
+  svfloat64_t p47 = svmla_x (pg, p45, f2, p67);
+  svfloat64_t p07 = svmla_x (pg, p03, f4, p47);
+
+  svfloat64_t p89 = svmla_lane (sv_f64 (d->c8), f, c911, 0);
+  svfloat64_t p1011 = svmla_lane (sv_f64 (d->c10), f, c911, 1);
+  svfloat64_t p1213 = svmla_lane (sv_f64 (d->c12), f, c1315, 0);
+  svfloat64_t p1415 = svmla_lane (sv_f64 (d->c14), f, c1315, 1);
+
+  svfloat64_t p811 = svmla_x (pg, p89, f2, p1011);
+  svfloat64_t p1215 = svmla_x (pg, p1213, f2, p1415);
+  svfloat64_t p815 = svmla_x (pg, p811, f4, p1215);
+
+  svfloat64_t p015 = svmla_x (pg, p07, f8, p815);
+  svfloat64_t p1617 = svmla_lane (sv_f64 (d->c16), f, c1718, 0);
+  svfloat64_t p1618 = svmla_lane (p1617, f2, c1718, 1);
+  return svmla_x (pg, p015, f16, p1618);
+}
+
 static inline svfloat64_t
 sv_log1p_inline (svfloat64_t x, const svbool_t pg)
 {
@@ -97,40 +137,8 @@ sv_log1p_inline (svfloat64_t x, const svbool_t pg)
 #endif
 
   /* Approximate log1p(f) on the reduced input using a polynomial.  */
-  svfloat64_t f2 = svmul_x (svptrue_b64 (), f, f),
-	      f4 = svmul_x (svptrue_b64 (), f2, f2),
-	      f8 = svmul_x (svptrue_b64 (), f4, f4),
-	      f16 = svmul_x (svptrue_b64 (), f8, f8);
-
-  svfloat64_t c13 = svld1rq (svptrue_b64 (), &d->c1);
-  svfloat64_t c57 = svld1rq (svptrue_b64 (), &d->c5);
-  svfloat64_t c911 = svld1rq (svptrue_b64 (), &d->c9);
-  svfloat64_t c1315 = svld1rq (svptrue_b64 (), &d->c13);
-  svfloat64_t c1718 = svld1rq (svptrue_b64 (), &d->c17);
-
-  /* Order-18 Estrin scheme.  */
-  svfloat64_t p01 = svmla_lane (sv_f64 (d->c0), f, c13, 0);
-  svfloat64_t p23 = svmla_lane (sv_f64 (d->c2), f, c13, 1);
-  svfloat64_t p45 = svmla_lane (sv_f64 (d->c4), f, c57, 0);
-  svfloat64_t p67 = svmla_lane (sv_f64 (d->c6), f, c57, 1);
-
-  svfloat64_t p03 = svmla_x (pg, p01, f2, p23);
-  svfloat64_t p47 = svmla_x (pg, p45, f2, p67);
-  svfloat64_t p07 = svmla_x (pg, p03, f4, p47);
-
-  svfloat64_t p89 = svmla_lane (sv_f64 (d->c8), f, c911, 0);
-  svfloat64_t p1011 = svmla_lane (sv_f64 (d->c10), f, c911, 1);
-  svfloat64_t p1213 = svmla_lane (sv_f64 (d->c12), f, c1315, 0);
-  svfloat64_t p1415 = svmla_lane (sv_f64 (d->c14), f, c1315, 1);
-
-  svfloat64_t p811 = svmla_x (pg, p89, f2, p1011);
-  svfloat64_t p1215 = svmla_x (pg, p1213, f2, p1415);
-  svfloat64_t p815 = svmla_x (pg, p811, f4, p1215);
-
-  svfloat64_t p015 = svmla_x (pg, p07, f8, p815);
-  svfloat64_t p1617 = svmla_lane (sv_f64 (d->c16), f, c1718, 0);
-  svfloat64_t p1618 = svmla_lane (p1617, f2, c1718, 1);
-  svfloat64_t p = svmla_x (pg, p015, f16, p1618);
+  svfloat64_t f2 = svmul_x (svptrue_b64 (), f, f);
+  svfloat64_t p = sv_log1p_poly (f, f2, pg, d);
 
   /* Assemble log1p(x) = k * log2 + log1p(f) + c/m.  */
   svfloat64_t ln2_lo_hi = svld1rq (svptrue_b64 (), &d->ln2_lo);
@@ -76,7 +76,7 @@ sv_log_inline (svbool_t pg, svfloat64_t x, const struct sv_log_inline_data *d)
   svfloat64_t y = svmla_x (pg, P (2), r, P (3));
   svfloat64_t p = svmla_x (pg, P (0), r, P (1));
 #if SV_LOG_INLINE_POLY_ORDER == 5
-  y = svmla_x (pg, P (4), r2);
+  y = svmla_x (pg, y, r2, P (4));
 #endif
   y = svmla_x (pg, p, r2, y);
   return svmla_x (pg, hi, r2, y);
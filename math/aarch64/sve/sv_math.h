@@ -32,6 +32,16 @@
 #else
 # define SVE_VECTOR_BYTES (__ARM_FEATURE_SVE_BITS / 8)
 #endif
+/* Streaming-compatible routines may be called in streaming mode (SME), so
+   they must avoid instructions that are illegal there, such as FEXPA, gathers
+   and calls to non-streaming functions.  This includes the helpers below,
+   which are not SC_ATTR: use the ACLE intrinsics directly.  */
+#if __ARM_FEATURE_SME
+# define SC_ATTR __arm_streaming_compatible
+#else
+# define SC_ATTR
+#endif
+
 #define SVE_NUM_FLTS (SVE_VECTOR_BYTES / sizeof (float))
 #define SVE_NUM_DBLS (SVE_VECTOR_BYTES / sizeof (double))
 /* Predicate is stored as one bit per byte of VL so requires VL / 64 bytes.  */
@@ -41,6 +51,7 @@
 #define SV_NAME_D1(fun) _ZGVsMxv_##fun
 #define SV_NAME_F2(fun) _ZGVsMxvv_##fun##f
 #define SV_NAME_D2(fun) _ZGVsMxvv_##fun
+#define SV_NAME_D3(fun) _ZGVsMxvvv_##fun
 #define SV_NAME_F1_L1(fun) _ZGVsMxvl4_##fun##f
 #define SV_NAME_D1_L1(fun) _ZGVsMxvl8_##fun
 #define SV_NAME_F1_L2(fun) _ZGVsMxvl4l4_##fun##f
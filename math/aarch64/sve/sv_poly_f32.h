@@ -13,16 +13,16 @@
 
 /* Wrap SVE f32 helpers: evaluation of some scheme/order has form:
    sv_[scheme]_[order]_f32_x.  */
-#define PTRUE svptrue_b32 ()
-#define VTYPE svfloat32_t
-#define STYPE float
-#define VWRAP(f) sv_##f##_f32_x
-#define DUP svdup_f32
-#include "sv_poly_generic.h"
-#undef DUP
-#undef VWRAP
-#undef STYPE
-#undef VTYPE
-#undef PTRUE
+#define ARM_MATH_POLY_PTRUE svptrue_b32 ()
+#define ARM_MATH_POLY_VTYPE svfloat32_t
+#define ARM_MATH_POLY_STYPE float
+#define ARM_MATH_POLY_WRAP(f) sv_##f##_f32_x
+#define ARM_MATH_POLY_DUP svdup_f32
+#include "arm_math_sv_poly_generic.h"
+#undef ARM_MATH_POLY_DUP
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_STYPE
+#undef ARM_MATH_POLY_VTYPE
+#undef ARM_MATH_POLY_PTRUE
 
 #endif
@@ -13,16 +13,16 @@
 
 /* Wrap SVE f64 helpers: evaluation of some scheme/order has form:
    sv_[scheme]_[order]_f64_x.  */
-#define PTRUE svptrue_b64 ()
-#define VTYPE svfloat64_t
-#define STYPE double
-#define VWRAP(f) sv_##f##_f64_x
-#define DUP svdup_f64
-#include "sv_poly_generic.h"
-#undef DUP
-#undef VWRAP
-#undef STYPE
-#undef VTYPE
-#undef PTRUE
+#define ARM_MATH_POLY_PTRUE svptrue_b64 ()
+#define ARM_MATH_POLY_VTYPE svfloat64_t
+#define ARM_MATH_POLY_STYPE double
+#define ARM_MATH_POLY_WRAP(f) sv_##f##_f64_x
+#define ARM_MATH_POLY_DUP svdup_f64
+#include "arm_math_sv_poly_generic.h"
+#undef ARM_MATH_POLY_DUP
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_STYPE
+#undef ARM_MATH_POLY_VTYPE
+#undef ARM_MATH_POLY_PTRUE
 
 #endif
@@ -0,0 +1,40 @@
+/*
+ * Helper for double-precision SVE routines which calculate 1/sqrt(x) and do
+ * not need special-case handling
+ *
+ * Copyright (c) 2025-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_RSQRT_INLINE_H
+#define MATH_SV_RSQRT_INLINE_H
+
+#include "sv_math.h"
+
+/* Only valid for normal positive x large enough for the estimate not to
+   overflow, see the special bound of the corresponding rsqrt routine.  */
+static inline svfloat64_t
+sv_rsqrt_inline (svfloat64_t x)
+{
+  /* Do estimate instruction.  */
+  svfloat64_t estimate = svrsqrte_f64 (x);
+
+  /* Do first step instruction.  */
+  svfloat64_t estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
+  svfloat64_t step = svrsqrts_f64 (x, estimate_squared);
+  estimate = svmul_x (svptrue_b64 (), estimate, step);
+
+  /* Do second step instruction.  */
+  estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
+  step = svrsqrts_f64 (x, estimate_squared);
+  estimate = svmul_x (svptrue_b64 (), estimate, step);
+
+  /* Do third step instruction.
+     This is required to achieve < 3.0 ULP.  */
+  estimate_squared = svmul_x (svptrue_b64 (), estimate, estimate);
+  step = svrsqrts_f64 (x, estimate_squared);
+  estimate = svmul_x (svptrue_b64 (), estimate, step);
+  return estimate;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Helper for single-precision SVE routines which calculate 1/sqrt(x) and do
+ * not need special-case handling
+ *
+ * Copyright (c) 2025-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATH_SV_RSQRTF_INLINE_H
+#define MATH_SV_RSQRTF_INLINE_H
+
+#include "sv_math.h"
+
+/* Only valid for normal positive x large enough for the estimate not to
+   overflow, see the special bound of the corresponding rsqrt routine.  */
+static inline svfloat32_t
+sv_rsqrtf_inline (svfloat32_t x)
+{
+  /* Do estimate instruction.  */
+  svfloat32_t estimate = svrsqrte_f32 (x);
+
+  /* Do first step instruction.  */
+  svfloat32_t estimate_squared = svmul_x (svptrue_b32 (), estimate, estimate);
+  svfloat32_t step = svrsqrts_f32 (x, estimate_squared);
+  estimate = svmul_x (svptrue_b32 (), estimate, step);
+
+  /* Do second step instruction.
+    This is required to achieve < 3.0 ULP.  */
+  estimate_squared = svmul_x (svptrue_b32 (), estimate, estimate);
+  step = svrsqrts_f32 (x, estimate_squared);
+  estimate = svmul_x (svptrue_b32 (), estimate, step);
+  return estimate;
+}
+
+#endif
@@ -84,15 +84,14 @@ load_datablock (svbool_t pg, svuint32_t idx,
 }
 
 /* Reduce x for |x| > 0x1p8 inputs, such that:
-    x = (q + y) * (pi / 2), with y in [-1/2, 1/2]
+    x = (q + y_hi + y_mid + y_lo) * (pi / 2), with y_hi in [-1/2, 1/2]
 
-   Returns a svfloat32x2_t struct containing:
-    remainder: The remainder after reduction
-    quadrant: Quadrant of x as an integer reinterpreted as a float for packing.
-
-   Designed to be used with the SVE trig instructions.  */
-static inline svfloat32x2_t
-large_range_reduction (svbool_t pg, svfloat32_t x)
+   Returns a svfloat32x4_t struct containing y_hi, y_mid, y_lo and q as a
+   float, for callers that need to adjust the reduced argument before scaling
+   by pi/2.  y_hi is a multiple of 2^-22, so adding or subtracting 1/2 is
+   exact.  */
+static inline svfloat32x4_t
+large_range_reduction_parts (svbool_t pg, svfloat32_t x)
 {
   const struct trigf_fallback_data *d = ptr_barrier (&trigf_fallback_data);
 
@@ -160,15 +159,33 @@ large_range_reduction (svbool_t pg, svfloat32_t x)
     result, so a simple FMA is sufficient.  */
   svfloat32_t y_lo = svmla_x (pg, pl_lo, x_reduced, svget4 (datablock, 3));
 
-  /* We then accumulate the final hi/lo remainders.  */
-  y_hi = svadd_x (pg, y_hi, svget2 (y_mid, 0));
   y_lo = svadd_x (pg, y_lo, svget2 (y_mid, 1));
+  return svcreate4 (y_hi, svget2 (y_mid, 0), y_lo, kd);
+}
+
+/* Reduce x for |x| > 0x1p8 inputs, such that:
+    x = (q + y) * (pi / 2), with y in [-1/2, 1/2]
+
+   Returns a svfloat32x2_t struct containing:
+    remainder: The remainder after reduction
+    quadrant: Quadrant of x as an integer reinterpreted as a float for packing.
+
+   Designed to be used with the SVE trig instructions.  */
+static inline svfloat32x2_t
+large_range_reduction (svbool_t pg, svfloat32_t x)
+{
+  const struct trigf_fallback_data *d = ptr_barrier (&trigf_fallback_data);
+  svfloat32x4_t parts = large_range_reduction_parts (pg, x);
+
+  /* We then accumulate the final hi/lo remainders.  */
+  svfloat32_t y_hi = svadd_x (pg, svget4 (parts, 0), svget4 (parts, 1));
+  svfloat32_t y_lo = svget4 (parts, 2);
 
   /* Multiply the accumulated remainders by pi/2, and adding gives a single
      final remainder.  */
   svfloat32_t remainder = svmla_x (pg, svmul_x (pg, y_lo, sv_f32 (d->pio2)),
 				   y_hi, sv_f32 (d->pio2));
-  svint32_t quadrant = svcvt_s32_x (pg, kd);
+  svint32_t quadrant = svcvt_s32_x (pg, svget4 (parts, 3));
   /* Reinterpret quadrant into a float to pack into struct for return.  */
   return svcreate2 (remainder, svreinterpret_f32 (quadrant));
 }
@@ -24,6 +24,7 @@ cosf (float y)
   int n;
   const sincos_t *p = &__sincosf_table[0];
 
+  STATS_CALL (cosf);
   if (abstop12 (y) < abstop12 (pio4f))
     {
       double x2 = x * x;
@@ -50,6 +51,7 @@ cosf (float y)
       uint32_t xi = asuint (y);
       int sign = xi >> 31;
 
+      STATS_SLOW (cosf);
       x = reduce_large (xi, &n);
 
       /* Setup signs for sin and cos - include original sign.  */
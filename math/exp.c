@@ -88,6 +88,7 @@ exp_inline (double x, double xtail)
   abstop = top12 (x) & 0x7ff;
   if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
     {
+      STATS_SLOW (exp);
       if (abstop - top12 (0x1p-54) >= 0x80000000)
 	/* Avoid spurious underflow for tiny x.  */
 	/* Note: 0 is common input.  */
@@ -157,6 +158,7 @@ exp_inline (double x, double xtail)
 double
 exp (double x)
 {
+  STATS_CALL (exp);
   return exp_inline (x, 0);
 }
 
@@ -81,9 +81,11 @@ exp2 (double x)
   uint64_t ki, idx, top, sbits;
   double kd, r, r2, scale, tail, tmp;
 
+  STATS_CALL (exp2);
   abstop = top12 (x) & 0x7ff;
   if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
     {
+      STATS_SLOW (exp2);
       if (abstop - top12 (0x1p-54) >= 0x80000000)
 	/* Avoid spurious underflow for tiny x.  */
 	/* Note: 0 is common input.  */
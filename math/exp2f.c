@@ -39,10 +39,12 @@ exp2f (float x)
   uint64_t ki, t;
   double kd, xd, z, r, r2, y, s;
 
+  STATS_CALL (exp2f);
   xd = x;
   abstop = top12 (x) & 0x7ff;
   if (unlikely (abstop >= top12 (128.0f)))
     {
+      STATS_SLOW (exp2f);
       /* |x| >= 128 or x is nan.  */
       if (asuint (x) == asuint (-INFINITY))
 	return 0.0f;
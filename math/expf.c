@@ -39,10 +39,12 @@ expf (float x)
   uint64_t ki, t;
   double kd, xd, z, r, r2, y, s;
 
+  STATS_CALL (expf);
   xd = x;
   abstop = top12 (x) & 0x7ff;
   if (unlikely (abstop >= top12 (88.0f)))
     {
+      STATS_SLOW (expf);
       /* |x| >= 88 or x is nan.  */
       if (asuint (x) == asuint (-INFINITY))
 	return 0.0f;
@@ -0,0 +1,373 @@
+/*
+ * Public inline versions of vector math cores.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef _ARM_MATH_INLINE_H
+#define _ARM_MATH_INLINE_H
+
+/* Static inline versions of the approximation cores used by the vector
+   routines, so that they can be fused with surrounding user code instead of
+   going through an out-of-line vector PCS call.
+
+   Unlike the _ZGV* routines, these helpers do not handle special cases: each
+   helper documents the domain in which its result is valid, outside of which
+   the result is unspecified.  Callers are expected to check the domain
+   themselves if needed, and fall back to the corresponding _ZGV* or scalar
+   routine.
+
+   Each helper takes a pointer to its constant data, so that loads can be
+   hoisted out of the caller's loop.  The data is provided by the header as a
+   static object of the same name, e.g.
+
+     const struct arm_math_v_expf_data *d = &arm_math_v_expf_data;
+     for (i = 0; i < n; i += 4)
+       {
+	 float32x4_t x = vld1q_f32 (in + i);
+	 vst1q_f32 (out + i, vmulq_f32 (x, arm_math_v_expf_inline (x, d)));
+       }
+
+   Helpers are self-contained and only depend on the ACLE headers, the
+   layout of the data structures is not part of the ABI.  The
+   ARM_MATH_*_DATA_INIT macros expand to the initialisers of the data, so
+   that it can also be embedded in a larger structure; the library's own
+   routines share the cores this way.  */
+
+#if __aarch64__ && defined(__ARM_NEON)
+# include <arm_neon.h>
+
+#define ARM_MATH_V4(x) { x, x, x, x }
+
+/* exp(x).  */
+struct arm_math_v_expf_data
+{
+  float ln2_hi, ln2_lo, c0, c2;
+  float32x4_t inv_ln2, c1, c3, c4;
+  uint32x4_t exponent_bias;
+};
+
+#define ARM_MATH_V_EXPF_DATA_INIT                                             \
+  {                                                                           \
+    .c0 = 0x1.0e4020p-7f, .c1 = ARM_MATH_V4 (0x1.573e2ep-5f),                 \
+    .c2 = 0x1.555e66p-3f, .c3 = ARM_MATH_V4 (0x1.fffdb6p-2f),                 \
+    .c4 = ARM_MATH_V4 (0x1.ffffecp-1f), .ln2_hi = 0x1.62e4p-1f,               \
+    .ln2_lo = 0x1.7f7d1cp-20f, .inv_ln2 = ARM_MATH_V4 (0x1.715476p+0f),       \
+    .exponent_bias = ARM_MATH_V4 (0x3f800000),                                \
+  }
+
+static const struct arm_math_v_expf_data arm_math_v_expf_data
+    = ARM_MATH_V_EXPF_DATA_INIT;
+
+/* Reduction and polynomial of arm_math_v_expf_inline, for callers that
+   handle |x| > 87 themselves: exp(x) = 2^n (1 + poly), the return value is
+   poly, *e is n shifted into the exponent field and *scale is 2^n unless it
+   overflows.  */
+static inline float32x4_t
+arm_math_v_expf_core (float32x4_t x, const struct arm_math_v_expf_data *d,
+		      float32x4_t *n, uint32x4_t *e, float32x4_t *scale)
+{
+  /* exp(x) = 2^n (1 + poly(r)), with 1 + poly(r) in [1/sqrt(2),sqrt(2)]
+     x = ln2*n + r, with r in [-ln2/2, ln2/2].  */
+  float32x4_t ln2_c02 = vld1q_f32 (&d->ln2_hi);
+  *n = vrndaq_f32 (vmulq_f32 (x, d->inv_ln2));
+  float32x4_t r = vfmsq_laneq_f32 (x, *n, ln2_c02, 0);
+  r = vfmsq_laneq_f32 (r, *n, ln2_c02, 1);
+  *e = vshlq_n_u32 (vreinterpretq_u32_s32 (vcvtq_s32_f32 (*n)), 23);
+  *scale = vreinterpretq_f32_u32 (vaddq_u32 (*e, d->exponent_bias));
+
+  /* Custom order-4 Estrin avoids building high order monomial.  */
+  float32x4_t r2 = vmulq_f32 (r, r);
+  float32x4_t p = vfmaq_laneq_f32 (d->c1, r, ln2_c02, 2);
+  float32x4_t q = vfmaq_laneq_f32 (d->c3, r, ln2_c02, 3);
+  q = vfmaq_f32 (q, p, r2);
+  p = vmulq_f32 (d->c4, r);
+  return vfmaq_f32 (p, q, r2);
+}
+
+/* Core of _ZGVnN4v_expf, valid for |x| <= 87.
+   Maximum error is 1.44 + 0.5 ULP:
+   arm_math_v_expf_inline (-0x1.86f03cp+5) got 0x1.69e27p-71
+					  want 0x1.69e274p-71.  */
+static inline float32x4_t
+arm_math_v_expf_inline (float32x4_t x, const struct arm_math_v_expf_data *d)
+{
+  float32x4_t n, scale;
+  uint32x4_t e;
+  float32x4_t poly = arm_math_v_expf_core (x, d, &n, &e, &scale);
+  return vfmaq_f32 (scale, poly, scale);
+}
+
+/* log(1 + x).  */
+struct arm_math_v_log1pf_data
+{
+  uint32x4_t four;
+  int32x4_t three_quarters;
+  float c0, c3, c5, c7;
+  float32x4_t c4, c6, c1, c2, ln2;
+};
+
+/* Polynomial generated using FPMinimax in [-0.25, 0.5].  First two
+   coefficients (1, -0.5) are not stored as they can be generated more
+   efficiently.  */
+#define ARM_MATH_V_LOG1PF_DATA_INIT                                           \
+  {                                                                           \
+    .c0 = 0x1.5555aap-2f, .c1 = ARM_MATH_V4 (-0x1.000038p-2f),                \
+    .c2 = ARM_MATH_V4 (0x1.99675cp-3f), .c3 = -0x1.54ef78p-3f,                \
+    .c4 = ARM_MATH_V4 (0x1.28a1f4p-3f), .c5 = -0x1.0da91p-3f,                 \
+    .c6 = ARM_MATH_V4 (0x1.abcb6p-4f), .c7 = -0x1.6f0d5ep-5f,                 \
+    .ln2 = ARM_MATH_V4 (0x1.62e43p-1f), .four = ARM_MATH_V4 (0x40800000),     \
+    .three_quarters = ARM_MATH_V4 (0x3f400000),                               \
+  }
+
+static const struct arm_math_v_log1pf_data arm_math_v_log1pf_data
+    = ARM_MATH_V_LOG1PF_DATA_INIT;
+
+/* log1p(m) for m in [-0.25, 0.5], using pairwise Horner.  */
+static inline float32x4_t
+arm_math_v_log1pf_poly (float32x4_t m,
+			const struct arm_math_v_log1pf_data *d)
+{
+  float32x4_t c0357 = vld1q_f32 (&d->c0);
+  float32x4_t q = vfmaq_laneq_f32 (vdupq_n_f32 (-0.5f), m, c0357, 0);
+  float32x4_t m2 = vmulq_f32 (m, m);
+  float32x4_t p67 = vfmaq_laneq_f32 (d->c6, m, c0357, 3);
+  float32x4_t p45 = vfmaq_laneq_f32 (d->c4, m, c0357, 2);
+  float32x4_t p23 = vfmaq_laneq_f32 (d->c2, m, c0357, 1);
+  float32x4_t p = vfmaq_f32 (p45, m2, p67);
+  p = vfmaq_f32 (p23, m2, p);
+  p = vfmaq_f32 (d->c1, m, p);
+  p = vmulq_f32 (m2, p);
+  p = vfmaq_f32 (m, m2, p);
+  return vfmaq_f32 (p, m2, q);
+}
+
+/* Core of _ZGVnN4v_log1pf, valid for finite x > -1.
+   Maximum error is 1.20 + 0.5 ULP:
+   arm_math_v_log1pf_inline (0x1.04418ap-2) got 0x1.cfcbd8p-3
+					    want 0x1.cfcbdcp-3.  */
+static inline float32x4_t
+arm_math_v_log1pf_inline (float32x4_t x,
+			  const struct arm_math_v_log1pf_data *d)
+{
+  /* With x + 1 = t * 2^k (where t = m + 1 and k is chosen such that m
+     is in [-0.25, 0.5]):
+     log1p(x) = log(t) + log(2^k) = log1p(m) + k*log(2).
+     An intermediate scale factor s = 4*k*log(2) ensures the scale is
+     representable as a normalised fp32 number.  */
+  float32x4_t m = vaddq_f32 (x, vdupq_n_f32 (1.0f));
+  int32x4_t k
+      = vandq_s32 (vsubq_s32 (vreinterpretq_s32_f32 (m), d->three_quarters),
+		   vdupq_n_s32 ((int32_t) 0xff800000));
+  uint32x4_t ku = vreinterpretq_u32_s32 (k);
+  float32x4_t s = vreinterpretq_f32_u32 (vsubq_u32 (d->four, ku));
+  float32x4_t m_scale
+      = vreinterpretq_f32_u32 (vsubq_u32 (vreinterpretq_u32_f32 (x), ku));
+  m_scale = vaddq_f32 (
+      m_scale, vfmaq_f32 (vdupq_n_f32 (-1.0f), vdupq_n_f32 (0.25f), s));
+
+  float32x4_t p = arm_math_v_log1pf_poly (m_scale, d);
+
+  /* Multiplying float(k) by 2^-23 gives the unbiased exponent of k.  */
+  float32x4_t scale_back
+      = vmulq_f32 (vcvtq_f32_s32 (k), vdupq_n_f32 (0x1.0p-23f));
+  return vfmaq_f32 (p, scale_back, d->ln2);
+}
+
+/* sin(x) and cos(x).  */
+struct arm_math_v_sincosf_data
+{
+  float inv_pio2, pio2_1, pio2_2, pio2_3;
+  float s2, c2, c0, null;
+  float32x4_t s0, s1, c1, shift;
+};
+
+#define ARM_MATH_V_SINCOSF_DATA_INIT                                          \
+  {                                                                           \
+    .s0 = ARM_MATH_V4 (-0x1.555546p-3f), .s1 = ARM_MATH_V4 (0x1.11076p-7f),   \
+    .s2 = -0x1.994eb4p-13f, .c0 = 0x1.55554ap-5f,                             \
+    .c1 = ARM_MATH_V4 (-0x1.6c0c1ap-10f), .c2 = 0x1.99e0eep-16f,              \
+    .inv_pio2 = 0x1.45f306p-1f, .pio2_1 = 0x1.921fb6p+0f,                     \
+    .pio2_2 = -0x1.777a5cp-25f, .pio2_3 = -0x1.ee59dap-50f,                   \
+    .shift = ARM_MATH_V4 (0x1.8p23f),                                         \
+  }
+
+static const struct arm_math_v_sincosf_data arm_math_v_sincosf_data
+    = ARM_MATH_V_SINCOSF_DATA_INIT;
+
+/* Core of _ZGVnN4vl4l4_sincosf, returns { sin(x), cos(x) }, valid for
+   |x| <= 0x1p20.
+   Maximum error for sin is 1.17 + 0.5 ULP:
+   arm_math_v_sincosf_inline (0x1.c704c4p+19) got 0x1.fff698p-5
+					      want 0x1.fff69cp-5
+   Maximum error for cos is 1.31 + 0.5 ULP:
+   arm_math_v_sincosf_inline (0x1.e506fp+19) got -0x1.ffec6ep-6
+					     want -0x1.ffec72p-6.  */
+static inline float32x4x2_t
+arm_math_v_sincosf_inline (float32x4_t x,
+			   const struct arm_math_v_sincosf_data *d)
+{
+  float32x4_t pio2_vals = vld1q_f32 (&d->inv_pio2);
+  /* n = rint ( x / (pi/2) ).  */
+  float32x4_t q = vfmaq_laneq_f32 (d->shift, x, pio2_vals, 0);
+  q = vsubq_f32 (q, d->shift);
+  int32x4_t n = vcvtq_s32_f32 (q);
+
+  /* Reduce x such that r is in [ -pi/4, pi/4 ].  */
+  float32x4_t r = vfmsq_laneq_f32 (x, q, pio2_vals, 1);
+  r = vfmsq_laneq_f32 (r, q, pio2_vals, 2);
+  r = vfmsq_laneq_f32 (r, q, pio2_vals, 3);
+
+  float32x4_t coeffs = vld1q_f32 (&d->s2);
+
+  /* Approximate sin(r) ~= r + r^3 * poly_sin(r^2).  */
+  float32x4_t r2 = vmulq_f32 (r, r);
+  float32x4_t r3 = vmulq_f32 (r, r2);
+  float32x4_t s = vfmaq_laneq_f32 (d->s1, r2, coeffs, 0);
+  s = vfmaq_f32 (d->s0, r2, s);
+  s = vfmaq_f32 (r, r3, s);
+
+  /* Approximate cos(r) ~= 1 - (r^2)/2 + r^4 * poly_cos(r^2).  */
+  float32x4_t r4 = vmulq_f32 (r2, r2);
+  float32x4_t p = vfmaq_laneq_f32 (d->c1, r2, coeffs, 1);
+  float32x4_t c = vfmaq_laneq_f32 (vdupq_n_f32 (-0.5f), r2, coeffs, 2);
+  c = vfmaq_f32 (c, r4, p);
+  c = vfmaq_f32 (vdupq_n_f32 (1.0f), c, r2);
+
+  /* If odd quadrant, swap cos and sin.  */
+  uint32x4_t swap = vtstq_u32 (vreinterpretq_u32_s32 (n), vdupq_n_u32 (1));
+  float32x4_t ss = vbslq_f32 (swap, c, s);
+  float32x4_t cc = vbslq_f32 (swap, s, c);
+
+  /* Fix signs according to quadrant.  */
+  uint32x4_t sin_sign = vshlq_n_u32 (
+      vandq_u32 (vreinterpretq_u32_s32 (n), vdupq_n_u32 (2)), 30);
+  uint32x4_t cos_sign = vshlq_n_u32 (
+      vandq_u32 (vreinterpretq_u32_s32 (vaddq_s32 (n, vdupq_n_s32 (1))),
+		 vdupq_n_u32 (2)),
+      30);
+  ss = vreinterpretq_f32_u32 (
+      veorq_u32 (vreinterpretq_u32_f32 (ss), sin_sign));
+  cc = vreinterpretq_f32_u32 (
+      veorq_u32 (vreinterpretq_u32_f32 (cc), cos_sign));
+  return (float32x4x2_t){ { ss, cc } };
+}
+#endif
+
+#if __aarch64__ && defined(__ARM_FEATURE_SVE)
+# include <arm_sve.h>
+
+/* exp(x).  */
+struct arm_math_sv_expf_data
+{
+  float ln2_hi, ln2_lo, c1, null;
+  float inv_ln2, shift;
+};
+
+/* Shift is 1.5*2^17 + 127.  */
+#define ARM_MATH_SV_EXPF_DATA_INIT                                            \
+  {                                                                           \
+    .c1 = 0.5f, .inv_ln2 = 0x1.715476p+0f, .ln2_hi = 0x1.62e4p-1f,            \
+    .ln2_lo = 0x1.7f7d1cp-20f, .shift = 0x1.803f8p17f,                        \
+  }
+
+static const struct arm_math_sv_expf_data arm_math_sv_expf_data
+    = ARM_MATH_SV_EXPF_DATA_INIT;
+
+/* Low-order exp using FEXPA, valid for |x| <= 87.
+   Maximum measured error is 0.88 + 0.5 ULP:
+   arm_math_sv_expf_inline (-0x1.bba4c6p-6) got 0x1.f25276p-1
+					    want 0x1.f25278p-1.  */
+static inline svfloat32_t
+arm_math_sv_expf_inline (svfloat32_t x, svbool_t pg,
+			 const struct arm_math_sv_expf_data *d)
+{
+  /* exp(x) = 2^(n/64) (1 + poly(r)), x = ln2*n/64 + r, |r| <= ln2/128.  */
+  svfloat32_t lane_consts = svld1rq_f32 (svptrue_b32 (), &d->ln2_hi);
+
+  /* n = round(x/(ln2/64)), FEXPA uses the low bits of z.  */
+  svfloat32_t z = svmad_x (pg, svdup_f32 (d->inv_ln2), x, d->shift);
+  svfloat32_t n = svsub_x (pg, z, d->shift);
+
+  svfloat32_t r = svmls_lane_f32 (x, n, lane_consts, 0);
+  r = svmls_lane_f32 (r, n, lane_consts, 1);
+
+  svfloat32_t scale = svexpa_f32 (svreinterpret_u32_f32 (z));
+
+  /* poly(r) = exp(r) - 1 ~= r + 0.5 r^2.  */
+  svfloat32_t r2 = svmul_x (svptrue_b32 (), r, r);
+  svfloat32_t poly = svmla_lane_f32 (r, r2, lane_consts, 2);
+  return svmla_x (pg, scale, scale, poly);
+}
+
+/* log(1 + x).  */
+struct arm_math_sv_log1pf_data
+{
+  float c0, c2, c4, c6;
+  float c1, c3, c5, c7;
+  float ln2, exp_bias, quarter;
+  uint32_t four, three_quarters;
+};
+
+#define ARM_MATH_SV_LOG1PF_DATA_INIT                                          \
+  {                                                                           \
+    .c0 = 0x1.5555aap-2f, .c1 = -0x1.000038p-2f, .c2 = 0x1.99675cp-3f,        \
+    .c3 = -0x1.54ef78p-3f, .c4 = 0x1.28a1f4p-3f, .c5 = -0x1.0da91p-3f,        \
+    .c6 = 0x1.abcb6p-4f, .c7 = -0x1.6f0d5ep-5f, .ln2 = 0x1.62e43p-1f,         \
+    .exp_bias = 0x1p-23f, .quarter = 0x1p-2f, .four = 0x40800000,             \
+    .three_quarters = 0x3f400000,                                             \
+  }
+
+static const struct arm_math_sv_log1pf_data arm_math_sv_log1pf_data
+    = ARM_MATH_SV_LOG1PF_DATA_INIT;
+
+/* log1p(m) for m in [-0.25, 0.5].  */
+static inline svfloat32_t
+arm_math_sv_log1pf_poly (svfloat32_t m, svbool_t pg,
+			 const struct arm_math_sv_log1pf_data *d)
+{
+  svfloat32_t m2 = svmul_x (svptrue_b32 (), m, m);
+  svfloat32_t c1357 = svld1rq_f32 (svptrue_b32 (), &d->c1);
+  svfloat32_t p01 = svmla_lane_f32 (svdup_f32 (d->c0), m, c1357, 0);
+  svfloat32_t p23 = svmla_lane_f32 (svdup_f32 (d->c2), m, c1357, 1);
+  svfloat32_t p45 = svmla_lane_f32 (svdup_f32 (d->c4), m, c1357, 2);
+  svfloat32_t p67 = svmla_lane_f32 (svdup_f32 (d->c6), m, c1357, 3);
+
+  svfloat32_t p = svmla_x (pg, p45, p67, m2);
+  p = svmla_x (pg, p23, p, m2);
+  p = svmla_x (pg, p01, p, m2);
+  p = svmad_x (pg, m, p, -0.5);
+  return svmla_x (pg, m, m, svmul_x (pg, m, p));
+}
+
+/* Core of _ZGVsMxv_log1pf, valid for finite x > -1.
+   Maximum error is 0.77 + 0.5 ULP:
+   arm_math_sv_log1pf_inline (0x1.fffffep-2) got 0x1.9f324p-2
+					     want 0x1.9f323ep-2.  */
+static inline svfloat32_t
+arm_math_sv_log1pf_inline (svfloat32_t x, svbool_t pg,
+			   const struct arm_math_sv_log1pf_data *d)
+{
+  /* Same algorithm as arm_math_v_log1pf_inline.  */
+  svfloat32_t m = svadd_x (pg, x, 1);
+  svint32_t k = svand_x (
+      pg, svsub_x (pg, svreinterpret_s32_f32 (m), d->three_quarters),
+      svdup_s32 ((int32_t) 0xff800000));
+
+  svfloat32_t m_scale = svreinterpret_f32_u32 (svsub_x (
+      pg, svreinterpret_u32_f32 (x), svreinterpret_u32_s32 (k)));
+  svfloat32_t s = svreinterpret_f32_s32 (svsubr_x (pg, k, d->four));
+  svfloat32_t fconst = svld1rq_f32 (svptrue_b32 (), &d->ln2);
+  m_scale = svadd_x (pg, m_scale,
+		     svmla_lane_f32 (svdup_f32 (-1), s, fconst, 2));
+
+  svfloat32_t p = arm_math_sv_log1pf_poly (m_scale, pg, d);
+
+  /* Multiplying float(k) by 2^-23 gives the unbiased exponent of k.  */
+  svfloat32_t scale_back = svmul_lane_f32 (svcvt_f32_x (pg, k), fconst, 1);
+  return svmla_lane_f32 (p, scale_back, fconst, 0);
+}
+#endif
+
+#endif
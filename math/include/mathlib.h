@@ -20,6 +20,20 @@ void arm_math_sincospif (float, float *, float *);
 void arm_math_sincospi (double, double *, double *);
 #endif
 
+/* Number of calls and of slow path entries, e.g. special cases or fallbacks
+   to scalar code, of an instrumented routine.  */
+struct arm_math_stats
+{
+  const char *name;
+  unsigned long long calls;
+  unsigned long long slow;
+};
+
+/* Write the counters summed over all threads to STATS, which has space for N
+   routines, and return the number of instrumented routines.  Returns 0 unless
+   the library is built with WANT_STATS=1.  */
+int arm_math_stats_dump (struct arm_math_stats *stats, int n);
+
 /* SIMD declaration for autovectorisation with fast-math enabled. Only GCC is
    supported, and vector routines are only supported on Linux on AArch64.  */
 #if defined __aarch64__ && __linux__ && defined(__GNUC__)                     \
@@ -32,17 +46,25 @@ void arm_math_sincospi (double, double *, double *);
 #if WANT_EXPERIMENTAL_MATH
 
 float arm_math_erff (float);
+float arm_math_expf_repro (float);
 DECL_SIMD_aarch64 float cospif (float);
 DECL_SIMD_aarch64 float erfinvf (float);
 DECL_SIMD_aarch64 float sinpif (float);
 DECL_SIMD_aarch64 float tanpif (float);
 
 double arm_math_erf (double);
+double arm_math_exp_dd (double, double *);
+double arm_math_log_dd (double, double *);
+double arm_math_pow_dd (double, double, double *);
 DECL_SIMD_aarch64 double cospi (double);
 DECL_SIMD_aarch64 double erfinv (double);
 DECL_SIMD_aarch64 double sinpi (double);
 DECL_SIMD_aarch64 double tanpi (double);
 
+long double arm_math_expl (long double);
+long double arm_math_expm1l (long double);
+long double arm_math_log1pl (long double);
+long double arm_math_logl (long double);
 long double erfinvl (long double);
 
 #endif
@@ -209,12 +231,75 @@ __vpcs void _ZGVnN2vl8l8_sincos (float64x2_t, double *, double *);
 __vpcs void _ZGVnN2vl8l8_sincospi (float64x2_t, double *, double *);
 
 # if WANT_EXPERIMENTAL_MATH
+#  include <stddef.h>
 __vpcs float32x4_t arm_math_advsimd_fast_cosf (float32x4_t);
 __vpcs float32x4_t arm_math_advsimd_fast_sinf (float32x4_t);
 __vpcs float32x4_t arm_math_advsimd_fast_powf (float32x4_t, float32x4_t);
 __vpcs float32x4_t arm_math_advsimd_fast_expf (float32x4_t);
+__vpcs float32x4_t arm_math_advsimd_expf_repro (float32x4_t);
 __vpcs float32x4_t _ZGVnN4v_erfinvf (float32x4_t);
 __vpcs float64x2_t _ZGVnN2v_erfinv (float64x2_t);
+/* Bessel functions of the first and second kind of order 0 and 1.  */
+__vpcs float32x4_t _ZGVnN4v_j0f (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_j1f (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_y0f (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_y1f (float32x4_t);
+__vpcs float64x2_t _ZGVnN2v_j0 (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_j1 (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_y0 (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_y1 (float64x2_t);
+/* Digamma and its derivative trigamma.  */
+__vpcs float32x4_t _ZGVnN4v_digammaf (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_trigammaf (float32x4_t);
+__vpcs float64x2_t _ZGVnN2v_digamma (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_trigamma (float64x2_t);
+/* Regularized incomplete gamma and beta functions.  */
+__vpcs float64x2_t _ZGVnN2vv_gammainc (float64x2_t, float64x2_t);
+__vpcs float64x2_t _ZGVnN2vv_gammaincc (float64x2_t, float64x2_t);
+__vpcs float64x2_t _ZGVnN2vvv_betainc (float64x2_t, float64x2_t,
+				       float64x2_t);
+/* Log-domain sums log(e^x + e^y), log(e^x - e^y), log(1 + e^x) and
+   log(1 - e^x).  */
+__vpcs float32x4_t _ZGVnN4vv_logaddexpf (float32x4_t, float32x4_t);
+__vpcs float32x4_t _ZGVnN4vv_logsubexpf (float32x4_t, float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_log1pexpf (float32x4_t);
+__vpcs float32x4_t _ZGVnN4v_log1mexpf (float32x4_t);
+__vpcs float64x2_t _ZGVnN2vv_logaddexp (float64x2_t, float64x2_t);
+__vpcs float64x2_t _ZGVnN2vv_logsubexp (float64x2_t, float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_log1pexp (float64x2_t);
+__vpcs float64x2_t _ZGVnN2v_log1mexp (float64x2_t);
+/* exp, log and pow with the result as a double-double hi + lo, returned in
+   val[0] and val[1].  */
+__vpcs float64x2x2_t arm_math_advsimd_exp_dd (float64x2_t);
+__vpcs float64x2x2_t arm_math_advsimd_log_dd (float64x2_t);
+__vpcs float64x2x2_t arm_math_advsimd_pow_dd (float64x2_t, float64x2_t);
+/* Two interleaved calls per invocation, for simdlen(8) and simdlen(4).  */
+__vpcs float32x4x2_t arm_math_advsimd_expf_x2 (float32x4x2_t);
+__vpcs float64x2x2_t arm_math_advsimd_exp_x2 (float64x2x2_t);
+/* Array variants of pow with a fixed exponent y or base b.  */
+void arm_math_advsimd_powf_const_exp (const float *, float, float *, size_t);
+void arm_math_advsimd_powf_const_base (float, const float *, float *, size_t);
+void arm_math_advsimd_pow_const_exp (const double *, double, double *,
+				     size_t);
+void arm_math_advsimd_pow_const_base (double, const double *, double *,
+				      size_t);
+/* Array variants with deferred special-case handling.  The output may be
+   the input array, but must not otherwise overlap it.  */
+void arm_math_advsimd_expf_array (const float *, float *, size_t);
+void arm_math_advsimd_log1pf_array (const float *, float *, size_t);
+/* Counter-based random number generators.  The output only depends on the
+   seed and on the number of 4-element blocks drawn since the counter was
+   last set, so it is reproducible whatever the vector length.  */
+#  include <stdint.h>
+struct arm_math_rng_state
+{
+  uint64_t seed;
+  uint64_t counter;
+};
+void arm_math_advsimd_randu_f32 (struct arm_math_rng_state *, float *,
+				 size_t);
+void arm_math_advsimd_randn_f32 (struct arm_math_rng_state *, float *,
+				 size_t);
 # endif
 
 #  include <arm_sve.h>
@@ -316,11 +401,45 @@ svfloat32_t arm_math_sve_fast_cosf (svfloat32_t, svbool_t);
 svfloat32_t arm_math_sve_fast_sinf (svfloat32_t, svbool_t);
 svfloat32_t arm_math_sve_fast_powf (svfloat32_t, svfloat32_t, svbool_t);
 svfloat32_t arm_math_sve_fast_expf (svfloat32_t, svbool_t);
+svfloat32_t arm_math_sve_expf_repro (svfloat32_t, svbool_t);
+#   if __ARM_FEATURE_SME
+/* Streaming-compatible variants, safe to call in streaming mode.  */
+svfloat32_t arm_math_sve_sc_expf (svfloat32_t, svbool_t)
+    __arm_streaming_compatible;
+svfloat32_t arm_math_sve_sc_tanhf (svfloat32_t, svbool_t)
+    __arm_streaming_compatible;
+#   endif
 svfloat32_t _ZGVsMxv_erfinvf (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_j0f (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_j1f (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_y0f (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_y1f (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_digammaf (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_trigammaf (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxvv_logaddexpf (svfloat32_t, svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxvv_logsubexpf (svfloat32_t, svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_log1pexpf (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_log1mexpf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxvv_powi (svfloat32_t, svint32_t, svbool_t);
 
 svfloat64_t _ZGVsMxvv_powk (svfloat64_t, svint64_t, svbool_t);
 svfloat64_t _ZGVsMxv_erfinv (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_j0 (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_j1 (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_y0 (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_y1 (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_digamma (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_trigamma (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_gammainc (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_gammaincc (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvvv_betainc (svfloat64_t, svfloat64_t, svfloat64_t,
+				svbool_t);
+svfloat64_t _ZGVsMxvv_logaddexp (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_logsubexp (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_log1pexp (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxv_log1mexp (svfloat64_t, svbool_t);
+void arm_math_sve_randu_f32 (struct arm_math_rng_state *, float *, size_t);
+void arm_math_sve_randn_f32 (struct arm_math_rng_state *, float *, size_t);
 
 # endif
 #endif
@@ -14,5 +14,6 @@
 #define TEST_INTERVAL(f, lo, hi, n)
 #define TEST_SYM_INTERVAL(f, lo, hi, n)
 #define TEST_INTERVAL2(f, xlo, xhi, ylo, yhi, n)
+#define TEST_INTERVAL3(f, xlo, xhi, ylo, yhi, zlo, zhi, n)
 
 #define TEST_CONTROL_VALUE(f, c)
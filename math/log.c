@@ -36,6 +36,7 @@ log (double x)
   uint32_t top;
   int k, i;
 
+  STATS_CALL (log);
   ix = asuint64 (x);
   top = top16 (x);
 
@@ -99,6 +100,7 @@ log (double x)
     }
   if (unlikely (top - 0x0010 >= 0x7ff0 - 0x0010))
     {
+      STATS_SLOW (log);
       /* x < 0x1p-1022 or inf or nan.  */
       if (ix * 2 == 0)
 	return __math_divzero (1);
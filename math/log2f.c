@@ -31,6 +31,7 @@ log2f (float x)
   uint32_t ix, iz, top, tmp;
   int k, i;
 
+  STATS_CALL (log2f);
   ix = asuint (x);
 #if WANT_ROUNDING
   /* Fix sign of zero with downward rounding when x==1.  */
@@ -39,6 +40,7 @@ log2f (float x)
 #endif
   if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
     {
+      STATS_SLOW (log2f);
       /* x < 0x1p-126 or inf or nan.  */
       if (ix * 2 == 0)
 	return __math_divzerof (1);
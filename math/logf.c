@@ -32,6 +32,7 @@ logf (float x)
   uint32_t ix, iz, tmp;
   int k, i;
 
+  STATS_CALL (logf);
   ix = asuint (x);
 #if WANT_ROUNDING
   /* Fix sign of zero with downward rounding when x==1.  */
@@ -40,6 +41,7 @@ logf (float x)
 #endif
   if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
     {
+      STATS_SLOW (logf);
       /* x < 0x1p-126 or inf or nan.  */
       if (ix * 2 == 0)
 	return __math_divzerof (1);
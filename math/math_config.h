@@ -28,6 +28,11 @@
 /* Set errno to ERANGE if result underflows to 0 (in all rounding modes).  */
 # define WANT_ERRNO_UFLOW (WANT_ROUNDING && WANT_ERRNO)
 #endif
+#ifndef WANT_STATS
+/* If defined to 1, count calls and slow path entries of the instrumented
+   routines, see arm_math_stats_dump.  */
+# define WANT_STATS 0
+#endif
 
 /* Compiler can inline round as a single instruction.  */
 #ifndef HAVE_FAST_ROUND
@@ -122,6 +127,8 @@
 #define __math_check_uflow arm_math_check_uflow
 #define __math_check_oflowf arm_math_check_oflowf
 #define __math_check_uflowf arm_math_check_uflowf
+#define __math_stats_local arm_math_stats_local
+#define __math_stats_init arm_math_stats_init
 
 #define __exp_data arm_math_exp_data
 #define __asin_poly arm_math_asin_poly
@@ -135,11 +142,13 @@
 #define __erf_data arm_math_erf_data
 #define __expf_data arm_math_expf_data
 #define __expm1_poly arm_math_expm1_poly
+#define __expl_data arm_math_expl_data
 #define __expm1f_poly arm_math_expm1f_poly
 #define __log10_data arm_math_log10_data
 #define __log1p_data arm_math_log1p_data
 #define __log1pf_data arm_math_log1pf_data
 #define __log_data arm_math_log_data
+#define __logl_data arm_math_logl_data
 #define __tanf_poly_data arm_math_tanf_poly_data
 #define __v_log_data arm_math_v_log_data
 #define __sincosf_table arm_math_sincosf_table
@@ -334,6 +343,64 @@ eval_as_double (double x)
   return x;
 }
 
+/* Routines with call counters when WANT_STATS is set.  Fast path calls are
+   the calls that are not counted as slow.  */
+#define STATS_FUNCS(X)                                                        \
+  X (exp) X (exp2) X (log) X (pow)                                            \
+  X (expf) X (exp2f) X (logf) X (log2f) X (powf) X (sinf) X (cosf)            \
+  X (_ZGVnN2v_exp) X (_ZGVnN4v_expf)                                          \
+  X (_ZGVnN2v_log) X (_ZGVnN4v_logf)                                          \
+  X (_ZGVnN2vv_pow) X (_ZGVnN4vv_powf)                                        \
+  X (_ZGVnN2v_sin) X (_ZGVnN4v_sinf)                                          \
+  X (_ZGVnN2v_cos) X (_ZGVnN4v_cosf)
+
+#define STATS_ID(f) STATS_##f,
+enum
+{
+  STATS_FUNCS (STATS_ID) STATS_NFUNCS
+};
+
+#if WANT_STATS
+/* Counters of a thread, padded to a cache line so that threads do not
+   share lines.  They are only written by their thread, but are read
+   concurrently by arm_math_stats_dump.  The shared block of threads that
+   could not allocate their own is incremented atomically.  */
+struct math_stats_block
+{
+  struct
+  {
+    uint64_t calls, slow;
+  } count[STATS_NFUNCS];
+  struct math_stats_block *next;
+  int shared;
+} ALIGN (64);
+
+extern __thread struct math_stats_block *__math_stats_local HIDDEN;
+HIDDEN struct math_stats_block *__math_stats_init (void);
+
+static inline void
+math_stats_add (int id, int slow)
+{
+  struct math_stats_block *b = __math_stats_local;
+  if (unlikely (b == 0))
+    b = __math_stats_init ();
+  uint64_t *c = slow ? &b->count[id].slow : &b->count[id].calls;
+  if (unlikely (b->shared))
+    __atomic_fetch_add (c, 1, __ATOMIC_RELAXED);
+  else
+    __atomic_store_n (c, __atomic_load_n (c, __ATOMIC_RELAXED) + 1,
+		      __ATOMIC_RELAXED);
+}
+
+/* F may be a macro such as V_NAME_D1 (exp).  */
+# define STATS_CALL(f) STATS_ADD (f, 0)
+# define STATS_SLOW(f) STATS_ADD (f, 1)
+# define STATS_ADD(f, slow) math_stats_add (STATS_##f, slow)
+#else
+# define STATS_CALL(f) ((void) 0)
+# define STATS_SLOW(f) ((void) 0)
+#endif
+
 /* Error handling tail calls for special cases, with a sign argument.
    The sign of the return value is set if the argument is non-zero.  */
 
@@ -733,6 +800,23 @@ extern const float __expm1f_poly[EXPM1F_POLY_ORDER] HIDDEN;
 # define EXPM1_POLY_ORDER 11
 extern const double __expm1_poly[EXPM1_POLY_ORDER] HIDDEN;
 
+/* Data for binary128 exp and expm1, only defined if LDBL_MANT_DIG is 113.  */
+# define EXPL_TABLE_BITS 8
+# define EXPL_POLY_ORDER 13
+extern const struct expl_data
+{
+  double invln2N, shift, ln2loN;
+  long double ln2hiN;
+  /* exp(r) - 1 ~ r + r^2 (C2 + r C3 + ...), poly holds C2 to C8 and dpoly
+     holds C6 to C13 rounded to double.  */
+  long double poly[7];
+  double dpoly[EXPL_POLY_ORDER - 5];
+  struct
+  {
+    long double hi, lo;
+  } tab[1 << EXPL_TABLE_BITS];
+} __expl_data HIDDEN;
+
 /* Data for low accuracy log10 (with 1/ln(10) included in coefficients).  */
 # define LOG10_TABLE_BITS 7
 # define LOG10_POLY_ORDER 6
@@ -756,6 +840,24 @@ extern const struct log10_data
 #  endif
 } __log10_data ALIGN(16) HIDDEN;
 
+/* Data for binary128 log and log1p, only defined if LDBL_MANT_DIG is 113.  */
+# define LOGL_TABLE_BITS 8
+# define LOGL_POLY_ORDER 13
+extern const struct logl_data
+{
+  long double ln2hi;
+  double ln2lo;
+  /* log(1+r) ~ r + r^2 (C2 + r C3 + ...), poly holds C2 to C7 and dpoly
+     holds C8 to C13 rounded to double.  */
+  long double poly[6];
+  double dpoly[LOGL_POLY_ORDER - 7];
+  struct
+  {
+    long double logc;
+    double invc, logctail;
+  } tab[1 << LOGL_TABLE_BITS];
+} __logl_data HIDDEN;
+
 # define TANF_P_POLY_NCOEFFS 6
 /* cotan approach needs order 3 on [0, pi/4] to reach <3.5ulps.  */
 # define TANF_Q_POLY_NCOEFFS 4
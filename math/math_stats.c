@@ -0,0 +1,69 @@
+/*
+ * Call counters of the math routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdlib.h>
+#include "math_config.h"
+#include "mathlib.h"
+
+#define STATS_NAME(f) #f,
+static const char *const names[] = { STATS_FUNCS (STATS_NAME) };
+
+#if WANT_STATS
+__thread struct math_stats_block *__math_stats_local;
+/* Blocks of all threads, including exited ones so that their calls are
+   still reported.  Blocks are never freed: this costs one block per thread
+   that called an instrumented routine, which is acceptable in a build that
+   is only meant for profiling.  */
+static struct math_stats_block *blocks;
+/* Shared by threads that could not allocate their block.  */
+static struct math_stats_block fallback = { .shared = 1 };
+
+struct math_stats_block *
+__math_stats_init (void)
+{
+  size_t align = __alignof__ (struct math_stats_block);
+  char *p = calloc (1, sizeof (struct math_stats_block) + align - 1);
+  struct math_stats_block *b = &fallback;
+  if (p != NULL)
+    {
+      b = (struct math_stats_block *) (p + (-(uintptr_t) p & (align - 1)));
+      b->next = __atomic_load_n (&blocks, __ATOMIC_RELAXED);
+      while (!__atomic_compare_exchange_n (&blocks, &b->next, b, 1,
+					   __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+	;
+    }
+  __math_stats_local = b;
+  return b;
+}
+
+static void
+add (struct arm_math_stats *s, struct math_stats_block *b, int i)
+{
+  s->calls += __atomic_load_n (&b->count[i].calls, __ATOMIC_RELAXED);
+  s->slow += __atomic_load_n (&b->count[i].slow, __ATOMIC_RELAXED);
+}
+#endif
+
+int
+arm_math_stats_dump (struct arm_math_stats *stats, int n)
+{
+  if (!WANT_STATS)
+    return 0;
+  for (int i = 0; i < n && i < STATS_NFUNCS; i++)
+    {
+      stats[i].name = names[i];
+      stats[i].calls = stats[i].slow = 0;
+#if WANT_STATS
+      add (&stats[i], &fallback, i);
+      for (struct math_stats_block *b
+	   = __atomic_load_n (&blocks, __ATOMIC_ACQUIRE);
+	   b != NULL; b = b->next)
+	add (&stats[i], b, i);
+#endif
+    }
+  return STATS_NFUNCS;
+}
@@ -13,12 +13,12 @@
 
 /* Wrap scalar f32 helpers: evaluation of some scheme/order has form:
    [scheme]_[order]_f32.  */
-#define VTYPE float
-#define FMA fmaf
-#define VWRAP(f) f##_f32
-#include "poly_generic.h"
-#undef VWRAP
-#undef FMA
-#undef VTYPE
+#define ARM_MATH_POLY_VTYPE float
+#define ARM_MATH_POLY_FMA fmaf
+#define ARM_MATH_POLY_WRAP(f) f##_f32
+#include "arm_math_poly_generic.h"
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_FMA
+#undef ARM_MATH_POLY_VTYPE
 
 #endif
@@ -13,12 +13,12 @@
 
 /* Wrap scalar f64 helpers: evaluation of some scheme/order has form:
    [scheme]_[order]_f64.  */
-#define VTYPE double
-#define FMA fma
-#define VWRAP(f) f##_f64
-#include "poly_generic.h"
-#undef VWRAP
-#undef FMA
-#undef VTYPE
+#define ARM_MATH_POLY_VTYPE double
+#define ARM_MATH_POLY_FMA fma
+#define ARM_MATH_POLY_WRAP(f) f##_f64
+#include "arm_math_poly_generic.h"
+#undef ARM_MATH_POLY_WRAP
+#undef ARM_MATH_POLY_FMA
+#undef ARM_MATH_POLY_VTYPE
 
 #endif
@@ -178,6 +178,7 @@ exp_inline (double x, double xtail, uint32_t sign_bias)
   abstop = top12 (x) & 0x7ff;
   if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
     {
+      STATS_SLOW (pow);
       if (abstop - top12 (0x1p-54) >= 0x80000000)
 	{
 	  /* Avoid spurious underflow for tiny x.  */
@@ -250,6 +251,7 @@ pow (double x, double y)
   uint64_t ix, iy;
   uint32_t topx, topy;
 
+  STATS_CALL (pow);
   ix = asuint64 (x);
   iy = asuint64 (y);
   topx = top12 (x);
@@ -257,6 +259,7 @@ pow (double x, double y)
   if (unlikely (topx - 0x001 >= 0x7ff - 0x001
 		|| (topy & 0x7ff) - 0x3be >= 0x43e - 0x3be))
     {
+      STATS_SLOW (pow);
       /* Note: if |y| > 1075 * ln2 * 2^53 ~= 0x1.749p62 then pow(x,y) = inf/0
 	 and if |y| < 2^-54 / 1075 ~= 0x1.e7b6p-65 then pow(x,y) = +-1.  */
       /* Special cases: (x < 0x1p-126 or inf or nan) or
@@ -110,10 +110,12 @@ powf (float x, float y)
   uint32_t sign_bias = 0;
   uint32_t ix, iy;
 
+  STATS_CALL (powf);
   ix = asuint (x);
   iy = asuint (y);
   if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000 || zeroinfnan (iy)))
     {
+      STATS_SLOW (powf);
       /* Either (x < 0x1p-126 or inf or nan) or (y is 0 or inf or nan).  */
       if (unlikely (zeroinfnan (iy)))
 	{
@@ -171,6 +173,7 @@ powf (float x, float y)
   if (unlikely ((asuint64 (ylogx) >> 47 & 0xffff)
 		 >= asuint64 (126.0 * POWF_SCALE) >> 47))
     {
+      STATS_SLOW (powf);
       if (ylogx <= -150.0 * POWF_SCALE)
 	return __math_uflowf (sign_bias);
 
@@ -23,6 +23,7 @@ sinf (float y)
   int n;
   const sincos_t *p = &__sincosf_table[0];
 
+  STATS_CALL (sinf);
   if (abstop12 (y) < abstop12 (pio4f))
     {
       s = x * x;
@@ -54,6 +55,7 @@ sinf (float y)
       uint32_t xi = asuint (y);
       int sign = xi >> 31;
 
+      STATS_SLOW (sinf);
       x = reduce_large (xi, &n);
 
       /* Setup signs for sin and cos - include original sign.  */
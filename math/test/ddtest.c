@@ -0,0 +1,218 @@
+/*
+ * Check the relative error of the double-double exp, log and pow results.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "mathlib.h"
+
+/* The reference is computed in long double, which is IEEE binary128 on
+   AArch64 Linux, the only target of the double-double routines.  */
+#if __aarch64__ && __linux__ && WANT_EXPERIMENTAL_MATH && LDBL_MANT_DIG == 113
+
+static int fails;
+
+static uint64_t seed = 0x9e3779b97f4a7c15;
+
+/* Random double in [lo, hi], uniform in the bit representation so that
+   intervals over many binades are covered evenly.  lo and hi have the same
+   sign.  */
+static double
+sample (double lo, double hi)
+{
+  uint64_t ilo, ihi, i;
+  memcpy (&ilo, &lo, 8);
+  memcpy (&ihi, &hi, 8);
+  if (ilo > ihi)
+    {
+      uint64_t t = ilo;
+      ilo = ihi;
+      ihi = t;
+    }
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  i = ilo + seed % (ihi - ilo + 1);
+  double x;
+  memcpy (&x, &i, 8);
+  return x;
+}
+
+/* Largest relative error of hi + tail, with the arguments it was seen at.  */
+struct maxerr
+{
+  long double err;
+  double x, y, hi, tail;
+  long double want;
+};
+
+static void
+update (struct maxerr *m, double x, double y, double hi, double tail,
+	long double want)
+{
+  long double err = fabsl (((long double) hi + tail - want) / want);
+  if (err > m->err)
+    *m = (struct maxerr){ err, x, y, hi, tail, want };
+}
+
+/* Results below 2^-969 lose tail bits, and results that overflow have no
+   meaningful tail, so they are not checked.  */
+static int
+in_range (long double want)
+{
+  return fabsl (want) >= 0x1p-969L && fabsl (want) <= DBL_MAX;
+}
+
+static void
+report (const char *name, struct maxerr *m, double log2_lim)
+{
+  double e = m->err > 0 ? log2 ((double) m->err) : -INFINITY;
+  int fail = e > log2_lim;
+  printf ("%s %s max relative error 2^%.2f, limit 2^%.1f\n",
+	  fail ? "FAIL" : "PASS", name, e, log2_lim);
+  if (fail)
+    {
+      double want_hi = m->want;
+      double want_lo = m->want - want_hi;
+      printf ("  %s (%a, %a) got %a + %a want %a + %a\n", name, m->x, m->y,
+	      m->hi, m->tail, want_hi, want_lo);
+      fails++;
+    }
+}
+
+/* The documented bounds of arm_math_*_dd and arm_math_advsimd_*_dd.  The
+   pow bound is that of the error model 2^-68 |y log(x)| + 2^-65 at the
+   largest |y log(x)| of a normal result.  */
+#define EXP_LIM -65.2
+#define LOG_LIM -67.6
+#define POW_LIM -58.5
+
+#define N 100000
+
+static const double exp_itv[][2] = {
+  { 0, 0x1p-6 },
+  { -0, -0x1p-6 },
+  { 0x1p-6, 0x1p6 },
+  { -0x1p-6, -0x1p6 },
+  { 0x1p6, 709.7 },
+  { -0x1p6, -671.5 },
+};
+
+static const double log_itv[][2] = {
+  { 0x1p-4, 0x1p4 },
+  { 0x1.fp-1, 0x1.08p0 },
+  { 0x1p-1022, 0x1p1023 },
+  { 0x1p-1074, 0x1p-1022 },
+};
+
+static const double pow_itv[][4] = {
+  { 0x1p-1, 0x1p1, 0x1p-10, 0x1p10 },
+  { 0x1p-1, 0x1p1, -0x1p-10, -0x1p10 },
+  { 0x1p-500, 0x1p500, 0x1p-1, 0x1p1 },
+  { 0x1.ep-1, 0x1.1p0, 0x1p8, 0x1p16 },
+  { 0x1.fp-1, 0x1.08p0, 0x1p8, 0x1p17 },
+  { 0x1.fp-1, 0x1.08p0, -0x1p8, -0x1p17 },
+  { 0x1p-100, 0x1p100, 0x1p-80, 0x1p-60 },
+};
+
+#define NITV(a) (sizeof (a) / sizeof (a)[0])
+
+static void
+check_exp (void)
+{
+  struct maxerr m = { 0 }, vm = { 0 };
+  for (size_t i = 0; i < NITV (exp_itv); i++)
+    for (int j = 0; j < N; j += 2)
+      {
+	double x[2] = { sample (exp_itv[i][0], exp_itv[i][1]),
+			sample (exp_itv[i][0], exp_itv[i][1]) };
+	float64x2x2_t v = arm_math_advsimd_exp_dd (vld1q_f64 (x));
+	for (int k = 0; k < 2; k++)
+	  {
+	    long double want = expl (x[k]);
+	    if (!in_range (want))
+	      continue;
+	    double tail, hi = arm_math_exp_dd (x[k], &tail);
+	    update (&m, x[k], 0, hi, tail, want);
+	    update (&vm, x[k], 0, v.val[0][k], v.val[1][k], want);
+	  }
+      }
+  report ("arm_math_exp_dd", &m, EXP_LIM);
+  report ("arm_math_advsimd_exp_dd", &vm, EXP_LIM);
+}
+
+static void
+check_log (void)
+{
+  struct maxerr m = { 0 }, vm = { 0 };
+  for (size_t i = 0; i < NITV (log_itv); i++)
+    for (int j = 0; j < N; j += 2)
+      {
+	double x[2] = { sample (log_itv[i][0], log_itv[i][1]),
+			sample (log_itv[i][0], log_itv[i][1]) };
+	float64x2x2_t v = arm_math_advsimd_log_dd (vld1q_f64 (x));
+	for (int k = 0; k < 2; k++)
+	  {
+	    long double want = logl (x[k]);
+	    if (want == 0)
+	      continue;
+	    double tail, hi = arm_math_log_dd (x[k], &tail);
+	    update (&m, x[k], 0, hi, tail, want);
+	    update (&vm, x[k], 0, v.val[0][k], v.val[1][k], want);
+	  }
+      }
+  report ("arm_math_log_dd", &m, LOG_LIM);
+  report ("arm_math_advsimd_log_dd", &vm, LOG_LIM);
+}
+
+static void
+check_pow (void)
+{
+  struct maxerr m = { 0 }, vm = { 0 };
+  for (size_t i = 0; i < NITV (pow_itv); i++)
+    for (int j = 0; j < N; j += 2)
+      {
+	double x[2] = { sample (pow_itv[i][0], pow_itv[i][1]),
+			sample (pow_itv[i][0], pow_itv[i][1]) };
+	double y[2] = { sample (pow_itv[i][2], pow_itv[i][3]),
+			sample (pow_itv[i][2], pow_itv[i][3]) };
+	float64x2x2_t v
+	    = arm_math_advsimd_pow_dd (vld1q_f64 (x), vld1q_f64 (y));
+	for (int k = 0; k < 2; k++)
+	  {
+	    long double want = powl (x[k], y[k]);
+	    if (!in_range (want))
+	      continue;
+	    double tail, hi = arm_math_pow_dd (x[k], y[k], &tail);
+	    update (&m, x[k], y[k], hi, tail, want);
+	    update (&vm, x[k], y[k], v.val[0][k], v.val[1][k], want);
+	  }
+      }
+  report ("arm_math_pow_dd", &m, POW_LIM);
+  report ("arm_math_advsimd_pow_dd", &vm, POW_LIM);
+}
+
+int
+main (void)
+{
+  check_exp ();
+  check_log ();
+  check_pow ();
+  return fails != 0;
+}
+
+#else
+
+int
+main (void)
+{
+  return 0;
+}
+
+#endif
@@ -1,7 +1,7 @@
 /*
  * Microbenchmark for math functions.
  *
- * Copyright (c) 2018-2025, Arm Limited.
+ * Copyright (c) 2018-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -20,6 +20,7 @@
 
 #undef _GNU_SOURCE
 #define _GNU_SOURCE 1
+#include <float.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -27,6 +28,31 @@
 #include <time.h>
 #include <math.h>
 #include "mathlib.h"
+#include "test/mathbench_trace.h"
+
+#if __linux__
+#  include <linux/perf_event.h>
+#  include <pthread.h>
+#  include <sched.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  define HAVE_PERF_EVENTS 1
+#  define HAVE_THREADS 1
+#  define THREAD_LOCAL __thread
+#else
+#  define HAVE_PERF_EVENTS 0
+#  define HAVE_THREADS 0
+#  define THREAD_LOCAL
+#endif
+
+#if !defined(_WIN32)
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  define HAVE_MMAP 1
+#else
+#  define HAVE_MMAP 0
+#endif
 
 /* Number of measurements, best result is reported.  */
 #define MEASURE 60
@@ -36,12 +62,66 @@
 #define ITER 125
 
 static double *Trace;
+/* Second column of two-column text traces.  */
+static double *Trace2;
 static size_t trace_size;
+/* Number of arguments per record of the trace.  */
+static int trace_arity = 1;
 static double A[N];
 static float Af[N];
+/* Second arguments of binary routines.  */
+static double A2[N];
+static float Af2[N];
+/* Outputs of array routines are per thread to avoid false sharing.  */
+static THREAD_LOCAL double B[N];
+static THREAD_LOCAL float Bf[N];
+static long double Al[N];
 static long measurecount = MEASURE;
 static long itercount = ITER;
 
+/* Hardware counters, read with perf_event_open when -p is given.  */
+enum
+{
+  PERF_CYCLES,
+  PERF_INSNS,
+  PERF_BRANCH_MISSES,
+  PERF_L1D_MISSES,
+  NPERF
+};
+static int perf_fd[NPERF] = { -1, -1, -1, -1 };
+static int perf_enabled;
+/* Counts during the fastest measurement, negative if not available.  */
+static double perf_count[NPERF];
+static const char *const perf_key[NPERF]
+    = { "cycles", "insns", "branch_misses", "l1d_misses" };
+
+/* Memory written between calls with -t cold, its size is set with -k.  */
+static unsigned char *evict_buf;
+static size_t evict_size = 64 << 20;
+/* Inputs and outputs of -t sweep, evict_size bytes each, on hugepages with
+   -H.  */
+static unsigned char *sweep_src, *sweep_dst;
+static int want_hugepages;
+
+/* Latency percentiles are measured with -q, in ticks of tick_ns ns.  The
+   smallest nonzero difference of two reads of the counter is tick_res_ns.  */
+static int want_percentiles;
+static double tick_ns;
+static double tick_res_ns;
+
+/* Number of threads set with -j and their placement set with -a.  */
+static int nthreads = 1;
+static const char *placement = "core";
+
+/* Output format set with -o: 't' for text, 'j' for JSON, 'c' for CSV.  */
+static int output_format = 't';
+static int nrecords;
+/* Time of each measurement of the last benchmark and its value in ns per
+   element or per call.  */
+static uint64_t *sample_ns;
+static double *samples;
+static int nsamples;
+
 static double
 dummy (double x)
 {
@@ -53,6 +133,12 @@ dummyf (float x)
 {
   return x;
 }
+
+static long double
+dummyl (long double x)
+{
+  return x;
+}
 #if __aarch64__ && __linux__
 __vpcs static float64x2_t
 __vn_dummy (float64x2_t x)
@@ -93,25 +179,49 @@ static const struct fun
   {
     double (*d) (double);
     float (*f) (float);
+    long double (*l) (long double);
+    double (*d2) (double, double);
+    float (*f2) (float, float);
+    void (*ad) (const double *, double *, size_t);
+    void (*af) (const float *, float *, size_t);
 #if __aarch64__ && __linux__
     __vpcs float64x2_t (*vnd) (float64x2_t);
     __vpcs float32x4_t (*vnf) (float32x4_t);
+    __vpcs float64x2x2_t (*vwd) (float64x2x2_t);
+    __vpcs float32x4x2_t (*vwf) (float32x4x2_t);
+    __vpcs float64x2_t (*vnd2) (float64x2_t, float64x2_t);
+    __vpcs float32x4_t (*vnf2) (float32x4_t, float32x4_t);
 #endif
 #if WANT_SVE_TESTS
     svfloat64_t (*svd) (svfloat64_t, svbool_t);
     svfloat32_t (*svf) (svfloat32_t, svbool_t);
 #endif
   } fun;
+  /* 2 for binary routines, which take their second argument from
+     [lo2, hi2].  */
+  int arity;
+  double lo2;
+  double hi2;
 } funtab[] = {
 // clang-format off
 #define D(func, lo, hi) {#func, 'd', 0, lo, hi, {.d = func}},
 #define F(func, lo, hi) {#func, 'f', 0, lo, hi, {.f = func}},
+#define L(func, lo, hi) {#func, 'l', 0, lo, hi, {.l = func}},
+#define AD(func, lo, hi) {#func, 'd', 'a', lo, hi, {.ad = func}},
+#define AF(func, lo, hi) {#func, 'f', 'a', lo, hi, {.af = func}},
 #define VND(func, lo, hi) {#func, 'd', 'n', lo, hi, {.vnd = func}},
 #define VNF(func, lo, hi) {#func, 'f', 'n', lo, hi, {.vnf = func}},
+#define VWD(func, lo, hi) {#func, 'd', 'w', lo, hi, {.vwd = func}},
+#define VWF(func, lo, hi) {#func, 'f', 'w', lo, hi, {.vwf = func}},
 #define SVD(func, lo, hi) {#func, 'd', 's', lo, hi, {.svd = func}},
 #define SVF(func, lo, hi) {#func, 'f', 's', lo, hi, {.svf = func}},
+#define D2(func, lo, hi, lo2, hi2) {#func, 'd', 0, lo, hi, {.d2 = func}, 2, lo2, hi2},
+#define F2(func, lo, hi, lo2, hi2) {#func, 'f', 0, lo, hi, {.f2 = func}, 2, lo2, hi2},
+#define VND2(func, lo, hi, lo2, hi2) {#func, 'd', 'n', lo, hi, {.vnd2 = func}, 2, lo2, hi2},
+#define VNF2(func, lo, hi, lo2, hi2) {#func, 'f', 'n', lo, hi, {.vnf2 = func}, 2, lo2, hi2},
 D (dummy, 1.0, 2.0)
 F (dummyf, 1.0, 2.0)
+L (dummyl, 1.0, 2.0)
 #if  __aarch64__ && __linux__
 VND (__vn_dummy, 1.0, 2.0)
 VNF (__vn_dummyf, 1.0, 2.0)
@@ -124,10 +234,19 @@ SVF (__sv_dummyf, 1.0, 2.0)
 {0},
 #undef F
 #undef D
+#undef L
+#undef AF
+#undef AD
 #undef VNF
+#undef VWD
+#undef VWF
 #undef VND
 #undef SVF
 #undef SVD
+#undef F2
+#undef D2
+#undef VNF2
+#undef VND2
   // clang-format on
 };
 
@@ -145,6 +264,13 @@ genf_linear (double lo, double hi)
     Af[i] = (float)(lo * (N - i) + hi * i) / N;
 }
 
+static void
+genl_linear (double lo, double hi)
+{
+  for (int i = 0; i < N; i++)
+    Al[i] = (lo * (N - i) + hi * i) / N;
+}
+
 static inline double
 asdouble (uint64_t i)
 {
@@ -179,303 +305,2079 @@ genf_rand (double lo, double hi)
     Af[i] = (float)frand (lo, hi);
 }
 
+/* Two draws so that all bits of a binary128 significand are random.  */
+static void
+genl_rand (double lo, double hi)
+{
+  for (int i = 0; i < N; i++)
+    {
+      long double u = frand (0, 1) + (long double) frand (0, 1) * 0x1p-52L;
+      Al[i] = lo + (hi - lo) * u;
+    }
+}
+
+/* Fraction of inputs replaced by a special value (nan).  */
+static double special_density;
+
+static void
+gen_special (int prec)
+{
+  if (special_density <= 0)
+    return;
+  for (int i = 0; i < N; i++)
+    if (frand (0, 1) < special_density)
+      {
+	if (prec == 'd')
+	  A[i] = __builtin_nan ("");
+	else if (prec == 'l')
+	  Al[i] = __builtin_nanl ("");
+	else
+	  Af[i] = __builtin_nanf ("");
+      }
+}
+
+/* Binary trace mapped with -f, see mathbench_trace.h.  */
+static const unsigned char *trace_data;
+static struct mathbench_trace_header trace_header;
+static size_t trace_stride;
+
+/* Argument ARG of record K of the trace.  Binary traces are decoded when a
+   chunk of N values is needed and wrap around at the end.  */
+static double
+trace_value (size_t k, int arg)
+{
+  if (trace_data == NULL)
+    return arg ? Trace2[k] : Trace[k];
+
+  const unsigned char *p = trace_data + k % trace_header.count * trace_stride;
+  if (trace_header.flags & MATHBENCH_TRACE_TIMESTAMP)
+    p += 8;
+  if (trace_header.type == 'f')
+    {
+      float x;
+      memcpy (&x, p + arg * sizeof (x), sizeof (x));
+      return x;
+    }
+  double x;
+  memcpy (&x, p + arg * sizeof (x), sizeof (x));
+  return x;
+}
+
 static void
 gen_trace (int index)
 {
   for (int i = 0; i < N; i++)
-    A[i] = Trace[index + i];
+    A[i] = trace_value (index + i, 0);
 }
 
 static void
 genf_trace (int index)
 {
   for (int i = 0; i < N; i++)
-    Af[i] = (float)Trace[index + i];
+    Af[i] = (float)trace_value (index + i, 0);
 }
 
 static void
-run_thruput (double f (double))
+genl_trace (int index)
 {
   for (int i = 0; i < N; i++)
-    f (A[i]);
+    Al[i] = trace_value (index + i, 0);
 }
 
+/* Relation between the arguments of binary routines, set with -J: 'i' for
+   independent, 'd' for y = x, 'n' for integer y, 'r' for y = x u and 'l'
+   for y = u / log2 |x|, where u is drawn from [lo2, hi2].  */
+static int joint = 'i';
+/* Interval of the second arguments, [lo2, hi2] above.  */
+static double y_lo, y_hi;
+
+/* Generate the second arguments of a binary routine F.  The linear
+   generator covers [lo, hi] x [lo2, hi2] with a grid, so it also sets the
+   first arguments.  Traces with two arguments per record are used as is,
+   for traces with one argument u is random.  */
 static void
-runf_thruput (float f (float))
+gen_xy (const struct fun *f, double lo, double hi, double lo2, double hi2,
+	int gen, int index)
 {
+  int side = sqrt (N);
+
   for (int i = 0; i < N; i++)
+    {
+      double x = f->prec == 'd' ? A[i] : Af[i];
+      double y, u;
+
+      if (gen == 't' && trace_arity == 2)
+	y = trace_value (index + i, 1);
+      else
+	{
+	  if (gen == 'l')
+	    {
+	      x = lo + (hi - lo) * (i % side) / side;
+	      u = lo2 + (hi2 - lo2) * (i / side % side) / side;
+	    }
+	  else
+	    u = frand (lo2, hi2);
+	  if (joint == 'd')
+	    y = x;
+	  else if (joint == 'n')
+	    y = round (u);
+	  else if (joint == 'r')
+	    y = x * u;
+	  else if (joint == 'l')
+	    y = u / log2 (fabs (x));
+	  else
+	    y = u;
+	}
+      if (f->prec == 'd')
+	{
+	  A[i] = x;
+	  A2[i] = y;
+	}
+      else
+	{
+	  Af[i] = x;
+	  Af2[i] = y;
+	}
+    }
+}
+
+static void
+run_thruput (double f (double), int lo, int hi)
+{
+  for (int i = lo; i < hi; i++)
+    f (A[i]);
+}
+
+static void
+runf_thruput (float f (float), int lo, int hi)
+{
+  for (int i = lo; i < hi; i++)
     f (Af[i]);
 }
 
+static void
+runl_thruput (long double f (long double), int lo, int hi)
+{
+  for (int i = lo; i < hi; i++)
+    f (Al[i]);
+}
+
+static void
+run_a_thruput (void f (const double *, double *, size_t), int lo, int hi)
+{
+  f (A + lo, B + lo, hi - lo);
+}
+
+static void
+runf_a_thruput (void f (const float *, float *, size_t), int lo, int hi)
+{
+  f (Af + lo, Bf + lo, hi - lo);
+}
+
 volatile double zero = 0;
 
 static void
-run_latency (double f (double))
+run_latency (double f (double), int lo, int hi)
 {
   double z = zero;
   double prev = z;
-  for (int i = 0; i < N; i++)
+  for (int i = lo; i < hi; i++)
     prev = f (A[i] + prev * z);
 }
 
 static void
-runf_latency (float f (float))
+runf_latency (float f (float), int lo, int hi)
 {
   float z = (float)zero;
   float prev = z;
-  for (int i = 0; i < N; i++)
+  for (int i = lo; i < hi; i++)
     prev = f (Af[i] + prev * z);
 }
 
+static void
+runl_latency (long double f (long double), int lo, int hi)
+{
+  long double z = zero;
+  long double prev = z;
+  for (int i = lo; i < hi; i++)
+    prev = f (Al[i] + prev * z);
+}
+
+static void
+run2_thruput (double f (double, double), int lo, int hi)
+{
+  for (int i = lo; i < hi; i++)
+    f (A[i], A2[i]);
+}
+
+static void
+runf2_thruput (float f (float, float), int lo, int hi)
+{
+  for (int i = lo; i < hi; i++)
+    f (Af[i], Af2[i]);
+}
+
+/* The result is fed back into the first argument only.  */
+static void
+run2_latency (double f (double, double), int lo, int hi)
+{
+  double z = zero;
+  double prev = z;
+  for (int i = lo; i < hi; i++)
+    prev = f (A[i] + prev * z, A2[i]);
+}
+
+static void
+runf2_latency (float f (float, float), int lo, int hi)
+{
+  float z = (float)zero;
+  float prev = z;
+  for (int i = lo; i < hi; i++)
+    prev = f (Af[i] + prev * z, Af2[i]);
+}
+
 #if  __aarch64__ && __linux__
 static void
-run_vn_thruput (__vpcs float64x2_t f (float64x2_t))
+run_vn_thruput (__vpcs float64x2_t f (float64x2_t), int lo, int hi)
 {
-  for (int i = 0; i < N; i += 2)
+  for (int i = lo; i < hi; i += 2)
     f (vld1q_f64 (A + i));
 }
 
 static void
-runf_vn_thruput (__vpcs float32x4_t f (float32x4_t))
+runf_vn_thruput (__vpcs float32x4_t f (float32x4_t), int lo, int hi)
 {
-  for (int i = 0; i < N; i += 4)
+  for (int i = lo; i < hi; i += 4)
     f (vld1q_f32 (Af + i));
 }
 
 static void
-run_vn_latency (__vpcs float64x2_t f (float64x2_t))
+run_vn_latency (__vpcs float64x2_t f (float64x2_t), int lo, int hi)
 {
   volatile uint64x2_t vsel = (uint64x2_t) { 0, 0 };
   uint64x2_t sel = vsel;
   float64x2_t prev = vdupq_n_f64 (0);
-  for (int i = 0; i < N; i += 2)
+  for (int i = lo; i < hi; i += 2)
     prev = f (vbslq_f64 (sel, prev, vld1q_f64 (A + i)));
 }
 
 static void
-runf_vn_latency (__vpcs float32x4_t f (float32x4_t))
+runf_vn_latency (__vpcs float32x4_t f (float32x4_t), int lo, int hi)
 {
   volatile uint32x4_t vsel = (uint32x4_t) { 0, 0, 0, 0 };
   uint32x4_t sel = vsel;
   float32x4_t prev = vdupq_n_f32 (0);
-  for (int i = 0; i < N; i += 4)
+  for (int i = lo; i < hi; i += 4)
     prev = f (vbslq_f32 (sel, prev, vld1q_f32 (Af + i)));
 }
+
+static void
+run_vn2_thruput (__vpcs float64x2_t f (float64x2_t, float64x2_t), int lo,
+		 int hi)
+{
+  for (int i = lo; i < hi; i += 2)
+    f (vld1q_f64 (A + i), vld1q_f64 (A2 + i));
+}
+
+static void
+runf_vn2_thruput (__vpcs float32x4_t f (float32x4_t, float32x4_t), int lo,
+		  int hi)
+{
+  for (int i = lo; i < hi; i += 4)
+    f (vld1q_f32 (Af + i), vld1q_f32 (Af2 + i));
+}
+
+static void
+run_vn2_latency (__vpcs float64x2_t f (float64x2_t, float64x2_t), int lo,
+		 int hi)
+{
+  volatile uint64x2_t vsel = (uint64x2_t) { 0, 0 };
+  uint64x2_t sel = vsel;
+  float64x2_t prev = vdupq_n_f64 (0);
+  for (int i = lo; i < hi; i += 2)
+    prev = f (vbslq_f64 (sel, prev, vld1q_f64 (A + i)), vld1q_f64 (A2 + i));
+}
+
+static void
+runf_vn2_latency (__vpcs float32x4_t f (float32x4_t, float32x4_t), int lo,
+		  int hi)
+{
+  volatile uint32x4_t vsel = (uint32x4_t) { 0, 0, 0, 0 };
+  uint32x4_t sel = vsel;
+  float32x4_t prev = vdupq_n_f32 (0);
+  for (int i = lo; i < hi; i += 4)
+    prev = f (vbslq_f32 (sel, prev, vld1q_f32 (Af + i)), vld1q_f32 (Af2 + i));
+}
+
+/* Double-width AdvSIMD routines take two vectors per call.  */
+static void
+run_vw_thruput (__vpcs float64x2x2_t f (float64x2x2_t), int lo, int hi)
+{
+  for (int i = lo; i < hi; i += 4)
+    f (vld1q_f64_x2 (A + i));
+}
+
+static void
+runf_vw_thruput (__vpcs float32x4x2_t f (float32x4x2_t), int lo, int hi)
+{
+  for (int i = lo; i < hi; i += 8)
+    f (vld1q_f32_x2 (Af + i));
+}
+
+static void
+run_vw_latency (__vpcs float64x2x2_t f (float64x2x2_t), int lo, int hi)
+{
+  volatile uint64x2_t vsel = (uint64x2_t) { 0, 0 };
+  uint64x2_t sel = vsel;
+  float64x2x2_t prev = { { vdupq_n_f64 (0), vdupq_n_f64 (0) } };
+  for (int i = lo; i < hi; i += 4)
+    {
+      float64x2x2_t x = vld1q_f64_x2 (A + i);
+      x.val[0] = vbslq_f64 (sel, prev.val[0], x.val[0]);
+      x.val[1] = vbslq_f64 (sel, prev.val[1], x.val[1]);
+      prev = f (x);
+    }
+}
+
+static void
+runf_vw_latency (__vpcs float32x4x2_t f (float32x4x2_t), int lo, int hi)
+{
+  volatile uint32x4_t vsel = (uint32x4_t) { 0, 0, 0, 0 };
+  uint32x4_t sel = vsel;
+  float32x4x2_t prev = { { vdupq_n_f32 (0), vdupq_n_f32 (0) } };
+  for (int i = lo; i < hi; i += 8)
+    {
+      float32x4x2_t x = vld1q_f32_x2 (Af + i);
+      x.val[0] = vbslq_f32 (sel, prev.val[0], x.val[0]);
+      x.val[1] = vbslq_f32 (sel, prev.val[1], x.val[1]);
+      prev = f (x);
+    }
+}
 #endif
 
 #if WANT_SVE_TESTS
 static void
-run_sv_thruput (svfloat64_t f (svfloat64_t, svbool_t))
+run_sv_thruput (svfloat64_t f (svfloat64_t, svbool_t), int lo, int hi)
 {
-  for (int i = 0; i < N; i += svcntd ())
+  for (int i = lo; i < hi; i += svcntd ())
     f (svld1_f64 (svptrue_b64 (), A + i), svptrue_b64 ());
 }
 
 static void
-runf_sv_thruput (svfloat32_t f (svfloat32_t, svbool_t))
+runf_sv_thruput (svfloat32_t f (svfloat32_t, svbool_t), int lo, int hi)
 {
-  for (int i = 0; i < N; i += svcntw ())
+  for (int i = lo; i < hi; i += svcntw ())
     f (svld1_f32 (svptrue_b32 (), Af + i), svptrue_b32 ());
 }
 
 static void
-run_sv_latency (svfloat64_t f (svfloat64_t, svbool_t))
+run_sv_latency (svfloat64_t f (svfloat64_t, svbool_t), int lo, int hi)
 {
   volatile svbool_t vsel = svptrue_b64 ();
   svbool_t sel = vsel;
   svfloat64_t prev = svdup_f64 (0);
-  for (int i = 0; i < N; i += svcntd ())
+  for (int i = lo; i < hi; i += svcntd ())
     prev = f (svsel_f64 (sel, svld1_f64 (svptrue_b64 (), A + i), prev),
 	      svptrue_b64 ());
 }
 
 static void
-runf_sv_latency (svfloat32_t f (svfloat32_t, svbool_t))
+runf_sv_latency (svfloat32_t f (svfloat32_t, svbool_t), int lo, int hi)
 {
   volatile svbool_t vsel = svptrue_b32 ();
   svbool_t sel = vsel;
   svfloat32_t prev = svdup_f32 (0);
-  for (int i = 0; i < N; i += svcntw ())
+  for (int i = lo; i < hi; i += svcntw ())
     prev = f (svsel_f32 (sel, svld1_f32 (svptrue_b32 (), Af + i), prev),
 	      svptrue_b32 ());
 }
 #endif
 
-static uint64_t
-tic (void)
+static void
+run2_range (const struct fun *f, int type, int lo, int hi)
 {
-  struct timespec ts;
-#if defined(_MSC_VER)
-  if (!timespec_get (&ts, TIME_UTC))
-#else
-  if (clock_gettime (CLOCK_REALTIME, &ts))
+  if (f->prec == 'd' && type == 't' && f->vec == 0)
+    run2_thruput (f->fun.d2, lo, hi);
+  else if (f->prec == 'd' && type == 'l' && f->vec == 0)
+    run2_latency (f->fun.d2, lo, hi);
+  else if (f->prec == 'f' && type == 't' && f->vec == 0)
+    runf2_thruput (f->fun.f2, lo, hi);
+  else if (f->prec == 'f' && type == 'l' && f->vec == 0)
+    runf2_latency (f->fun.f2, lo, hi);
+#if __aarch64__ && __linux__
+  else if (f->prec == 'd' && type == 't' && f->vec == 'n')
+    run_vn2_thruput (f->fun.vnd2, lo, hi);
+  else if (f->prec == 'd' && type == 'l' && f->vec == 'n')
+    run_vn2_latency (f->fun.vnd2, lo, hi);
+  else if (f->prec == 'f' && type == 't' && f->vec == 'n')
+    runf_vn2_thruput (f->fun.vnf2, lo, hi);
+  else if (f->prec == 'f' && type == 'l' && f->vec == 'n')
+    runf_vn2_latency (f->fun.vnf2, lo, hi);
 #endif
-    abort ();
-  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
 }
 
-#define TIMEIT(run, f) do { \
-  dt = -1; \
-  run (f); /* Warm up.  */ \
-  for (int j = 0; j < measurecount; j++) \
-    { \
-      uint64_t t0 = tic (); \
-      for (int i = 0; i < itercount; i++) \
-	run (f); \
-      uint64_t t1 = tic (); \
-      if (t1 - t0 < dt) \
-	dt = t1 - t0; \
-    } \
-} while (0)
-
+/* Run F over the inputs from index LO to HI, which are multiples of the
+   number of elements per call.  */
 static void
-bench1 (const struct fun *f, int type, double lo, double hi)
+run_range (const struct fun *f, int type, int lo, int hi)
 {
-  uint64_t dt = 0;
-  uint64_t ns100;
-  const char *s = type == 't' ? "rthruput" : "latency";
-  int vlen = 1;
-
-  if (f->vec == 'n')
-    vlen = f->prec == 'd' ? 2 : 4;
-#if WANT_SVE_TESTS
-  else if (f->vec == 's')
-    vlen = f->prec == 'd' ? svcntd () : svcntw ();
-#endif
-
-  if (f->prec == 'd' && type == 't' && f->vec == 0)
-    TIMEIT (run_thruput, f->fun.d);
+  if (f->arity == 2)
+    run2_range (f, type, lo, hi);
+  else if (f->prec == 'd' && type == 't' && f->vec == 0)
+    run_thruput (f->fun.d, lo, hi);
   else if (f->prec == 'd' && type == 'l' && f->vec == 0)
-    TIMEIT (run_latency, f->fun.d);
+    run_latency (f->fun.d, lo, hi);
   else if (f->prec == 'f' && type == 't' && f->vec == 0)
-    TIMEIT (runf_thruput, f->fun.f);
+    runf_thruput (f->fun.f, lo, hi);
   else if (f->prec == 'f' && type == 'l' && f->vec == 0)
-    TIMEIT (runf_latency, f->fun.f);
+    runf_latency (f->fun.f, lo, hi);
+  else if (f->prec == 'l' && type == 't' && f->vec == 0)
+    runl_thruput (f->fun.l, lo, hi);
+  else if (f->prec == 'l' && type == 'l' && f->vec == 0)
+    runl_latency (f->fun.l, lo, hi);
+  else if (f->prec == 'd' && type == 't' && f->vec == 'a')
+    run_a_thruput (f->fun.ad, lo, hi);
+  else if (f->prec == 'f' && type == 't' && f->vec == 'a')
+    runf_a_thruput (f->fun.af, lo, hi);
 #if __aarch64__ && __linux__
   else if (f->prec == 'd' && type == 't' && f->vec == 'n')
-    TIMEIT (run_vn_thruput, f->fun.vnd);
+    run_vn_thruput (f->fun.vnd, lo, hi);
   else if (f->prec == 'd' && type == 'l' && f->vec == 'n')
-    TIMEIT (run_vn_latency, f->fun.vnd);
+    run_vn_latency (f->fun.vnd, lo, hi);
   else if (f->prec == 'f' && type == 't' && f->vec == 'n')
-    TIMEIT (runf_vn_thruput, f->fun.vnf);
+    runf_vn_thruput (f->fun.vnf, lo, hi);
   else if (f->prec == 'f' && type == 'l' && f->vec == 'n')
-    TIMEIT (runf_vn_latency, f->fun.vnf);
+    runf_vn_latency (f->fun.vnf, lo, hi);
+  else if (f->prec == 'd' && type == 't' && f->vec == 'w')
+    run_vw_thruput (f->fun.vwd, lo, hi);
+  else if (f->prec == 'd' && type == 'l' && f->vec == 'w')
+    run_vw_latency (f->fun.vwd, lo, hi);
+  else if (f->prec == 'f' && type == 't' && f->vec == 'w')
+    runf_vw_thruput (f->fun.vwf, lo, hi);
+  else if (f->prec == 'f' && type == 'l' && f->vec == 'w')
+    runf_vw_latency (f->fun.vwf, lo, hi);
 #endif
 #if WANT_SVE_TESTS
   else if (f->prec == 'd' && type == 't' && f->vec == 's')
-    TIMEIT (run_sv_thruput, f->fun.svd);
+    run_sv_thruput (f->fun.svd, lo, hi);
   else if (f->prec == 'd' && type == 'l' && f->vec == 's')
-    TIMEIT (run_sv_latency, f->fun.svd);
+    run_sv_latency (f->fun.svd, lo, hi);
   else if (f->prec == 'f' && type == 't' && f->vec == 's')
-    TIMEIT (runf_sv_thruput, f->fun.svf);
+    runf_sv_thruput (f->fun.svf, lo, hi);
   else if (f->prec == 'f' && type == 'l' && f->vec == 's')
-    TIMEIT (runf_sv_latency, f->fun.svf);
+    runf_sv_latency (f->fun.svf, lo, hi);
 #endif
-
-  if (type == 't')
-    {
-      ns100 = (100 * dt + itercount * N / 2) / (itercount * N);
-      printf ("%9s %8s: %4u.%02u ns/elem %10llu ns in [%g %g] vlen %d\n",
-	      f->name, s,
-	      (unsigned) (ns100 / 100), (unsigned) (ns100 % 100),
-	      (unsigned long long) dt, lo, hi, vlen);
-    }
-  else if (type == 'l')
-    {
-      ns100 = (100 * dt + itercount * N / vlen / 2) / (itercount * N / vlen);
-      printf ("%9s %8s: %4u.%02u ns/call %10llu ns in [%g %g] vlen %d\n",
-	      f->name, s,
-	      (unsigned) (ns100 / 100), (unsigned) (ns100 % 100),
-	      (unsigned long long) dt, lo, hi, vlen);
-    }
-  fflush (stdout);
 }
 
+/* Run F once over the input array.  */
 static void
-bench (const struct fun *f, double lo, double hi, int type, int gen)
+run1 (const struct fun *f, int type)
 {
-  if (f->prec == 'd' && gen == 'r')
-    gen_rand (lo, hi);
-  else if (f->prec == 'd' && gen == 'l')
-    gen_linear (lo, hi);
-  else if (f->prec == 'd' && gen == 't')
-    gen_trace (0);
-  else if (f->prec == 'f' && gen == 'r')
-    genf_rand (lo, hi);
-  else if (f->prec == 'f' && gen == 'l')
-    genf_linear (lo, hi);
-  else if (f->prec == 'f' && gen == 't')
-    genf_trace (0);
+  run_range (f, type, 0, N);
+}
 
-  if (gen == 't')
-    hi = trace_size / N;
+static uint64_t
+tic (void)
+{
+  struct timespec ts;
+#if defined(_MSC_VER)
+  if (!timespec_get (&ts, TIME_UTC))
+#else
+  if (clock_gettime (CLOCK_REALTIME, &ts))
+#endif
+    abort ();
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
 
-  if (type == 'b' || type == 't')
-    bench1 (f, 't', lo, hi);
+/* Timer for short samples: the time stamp counter on x86_64 and the virtual
+   counter on AArch64, which are cheaper and finer than tic.  The fences
+   keep the timed calls between the reads.  */
+static inline uint64_t
+ticks (void)
+{
+#if defined(__GNUC__) && defined(__x86_64__)
+  __builtin_ia32_lfence ();
+  uint64_t t = __builtin_ia32_rdtsc ();
+  __builtin_ia32_lfence ();
+  return t;
+#elif defined(__GNUC__) && __aarch64__
+  uint64_t t;
+  __asm__ __volatile__ ("isb\n\tmrs %0, cntvct_el0" : "=r"(t) : : "memory");
+  return t;
+#else
+  return tic ();
+#endif
+}
 
-  if (type == 'b' || type == 'l')
-    bench1 (f, 'l', lo, hi);
+/* Measure the period of ticks against tic, and its resolution.  */
+static void
+ticks_init (void)
+{
+  uint64_t t0 = tic (), c0 = ticks (), t1, c1;
+  uint64_t res = UINT64_MAX;
 
-  for (int i = N; i < trace_size; i += N)
+  do
+    t1 = tic ();
+  while (t1 - t0 < 20000000);
+  c1 = ticks ();
+  tick_ns = (double) (t1 - t0) / (c1 - c0);
+
+  for (int i = 0; i < 1000; i++)
     {
-      if (f->prec == 'd')
-	gen_trace (i);
-      else
-	genf_trace (i);
+      uint64_t a = ticks (), b;
+      while ((b = ticks ()) == a)
+	;
+      if (b - a < res)
+	res = b - a;
+    }
+  tick_res_ns = res * tick_ns;
+}
 
-      lo = i / N;
-      if (type == 'b' || type == 't')
-	bench1 (f, 't', lo, hi);
+/* Open the counters, those that are not supported, e.g. in containers or
+   under qemu, are reported as unavailable and only time is measured.  */
+static void
+perf_open (void)
+{
+#if HAVE_PERF_EVENTS
+  static const struct
+  {
+    uint32_t type;
+    uint64_t config;
+  } events[NPERF] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+			    | PERF_COUNT_HW_CACHE_OP_READ << 8
+			    | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+  };
+  int n = 0;
 
-      if (type == 'b' || type == 'l')
-	bench1 (f, 'l', lo, hi);
+  for (int i = 0; i < NPERF; i++)
+    {
+      struct perf_event_attr attr;
+      memset (&attr, 0, sizeof (attr));
+      attr.size = sizeof (attr);
+      attr.type = events[i].type;
+      attr.config = events[i].config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format
+	  = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      perf_fd[i] = syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      if (perf_fd[i] >= 0)
+	n++;
     }
+  if (n == 0)
+    fprintf (stderr,
+	     "perf counters unavailable: %m, only time is measured\n");
+  perf_enabled = n > 0;
+#else
+  fprintf (stderr, "perf counters not supported, only time is measured\n");
+#endif
 }
 
 static void
-readtrace (const char *name)
+perf_start (void)
 {
-	int n = 0;
-	FILE *f = strcmp (name, "-") == 0 ? stdin : fopen (name, "r");
-	if (!f)
-	  {
-	    printf ("openning \"%s\" failed: %m\n", name);
-	    exit (1);
-	  }
-	for (;;)
-	  {
-	    if (n >= trace_size)
-	      {
-		trace_size += N;
-		Trace = realloc (Trace, trace_size * sizeof (Trace[0]));
-		if (Trace == NULL)
-		  {
-		    printf ("out of memory\n");
-		    exit (1);
-		  }
-	      }
-	    if (fscanf (f, "%lf", Trace + n) != 1)
-	      break;
-	    n++;
-	  }
-	if (ferror (f) || n == 0)
+#if HAVE_PERF_EVENTS
+  for (int i = 0; i < NPERF; i++)
+    if (perf_fd[i] >= 0)
+      {
+	ioctl (perf_fd[i], PERF_EVENT_IOC_RESET, 0);
+	ioctl (perf_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+}
+
+static void
+perf_stop (void)
+{
+#if HAVE_PERF_EVENTS
+  for (int i = 0; i < NPERF; i++)
+    if (perf_fd[i] >= 0)
+      ioctl (perf_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+/* Read the counters into perf_count, scaled up if the kernel multiplexed
+   them.  */
+static void
+perf_read (void)
+{
+  for (int i = 0; i < NPERF; i++)
+    {
+      perf_count[i] = -1;
+#if HAVE_PERF_EVENTS
+      uint64_t v[3];
+      if (perf_fd[i] >= 0 && read (perf_fd[i], v, sizeof (v)) == sizeof (v)
+	  && v[2] > 0)
+	perf_count[i] = (double) v[0] * v[1] / v[2];
+#endif
+    }
+}
+
+/* Print counts per element or per call, N is the number of elements or
+   calls of the measurement.  */
+static void
+perf_print (double n, const char *unit)
+{
+  const double *c = perf_count;
+
+  printf ("%9s %8s:", "", "perf");
+  if (c[PERF_CYCLES] >= 0)
+    printf (" %.2f cycles/%s", c[PERF_CYCLES] / n, unit);
+  if (c[PERF_INSNS] >= 0)
+    printf (" %.2f insns/%s", c[PERF_INSNS] / n, unit);
+  if (c[PERF_CYCLES] > 0 && c[PERF_INSNS] >= 0)
+    printf (" IPC %.2f", c[PERF_INSNS] / c[PERF_CYCLES]);
+  if (c[PERF_BRANCH_MISSES] >= 0)
+    printf (" %.4f br-miss/%s", c[PERF_BRANCH_MISSES] / n, unit);
+  if (c[PERF_L1D_MISSES] >= 0)
+    printf (" %.4f l1d-miss/%s", c[PERF_L1D_MISSES] / n, unit);
+  printf ("\n");
+}
+
+/* Call counters of the library, only available when it is built with
+   WANT_STATS=1.  */
+#define MAX_STATS 64
+static struct arm_math_stats stats_start[MAX_STATS];
+static int nstats;
+
+static void
+stats_begin (void)
+{
+  nstats = arm_math_stats_dump (stats_start, MAX_STATS);
+  if (nstats > MAX_STATS)
+    nstats = MAX_STATS;
+}
+
+/* Print the routines called since stats_begin, which may include routines
+   called internally by the benchmarked one.  */
+static void
+stats_print (void)
+{
+  struct arm_math_stats s[MAX_STATS];
+
+  arm_math_stats_dump (s, nstats);
+  for (int i = 0; i < nstats; i++)
+    {
+      unsigned long long calls = s[i].calls - stats_start[i].calls;
+      unsigned long long slow = s[i].slow - stats_start[i].slow;
+      if (calls == 0)
+	continue;
+      printf ("%9s %8s: %s %llu calls, %llu slow path (%.4f%%)\n", "",
+	      "stats", s[i].name, calls, slow, 100.0 * slow / calls);
+    }
+}
+
+/* The counters are read for the fastest measurement, they are started
+   before and stopped after the timed region.  */
+#define TIMEIT(f, type) do { \
+  dt = -1; \
+  nsamples = 0; \
+  run1 (f, type); /* Warm up.  */ \
+  for (int j = 0; j < measurecount; j++) \
+    { \
+      if (perf_enabled) \
+	perf_start (); \
+      uint64_t t0 = tic (); \
+      for (int i = 0; i < itercount; i++) \
+	run1 (f, type); \
+      uint64_t t1 = tic (); \
+      if (perf_enabled) \
+	perf_stop (); \
+      sample_ns[nsamples++] = t1 - t0; \
+      if (t1 - t0 < dt) \
+	{ \
+	  dt = t1 - t0; \
+	  if (perf_enabled) \
+	    perf_read (); \
+	} \
+    } \
+} while (0)
+
+static void *
+xrealloc (void *p, size_t size)
+{
+  p = realloc (p, size);
+  if (p == NULL)
+    {
+      printf ("out of memory\n");
+      exit (1);
+    }
+  return p;
+}
+
+/* Result of one benchmark, with samples in ns per element or per call.  */
+struct result
+{
+  const char *name;
+  const char *type;
+  const char *unit;
+  const char *gen;
+  int prec;
+  int vlen;
+  int threads;
+  double lo;
+  double hi;
+  /* Interval of the second arguments, NAN if not generated from one.  */
+  double lo2;
+  double hi2;
+  /* Number of elements or calls of one measurement.  */
+  double count;
+  const double *v;
+  int n;
+  double min, median, mean, stddev;
+  /* Median of the baseline and one-sided p-value of a slowdown.  */
+  int compared, regression;
+  double base_median, p;
+  /* Calls per sample of the percentiles with -q, 0 if not measured.  The
+     percentiles are of the average over the calls of a sample.  */
+  int pct_calls;
+  double pct[4];
+  /* p99 of the baseline, NAN if it has none, and whether the p99s were
+     compared.  */
+  int tail_compared, tail_regression;
+  double base_p99;
+  /* Bytes of input and output with -t sweep, 0 otherwise.  */
+  size_t working_set;
+  double gbps;
+};
+
+/* Results read from a file written with -o json, for --compare.  */
+struct baseline
+{
+  char name[128];
+  char type[16];
+  int threads;
+  double lo;
+  double hi;
+  double lo2;
+  double hi2;
+  double p99;
+  double working_set;
+  double *v;
+  int n;
+};
+static struct baseline *baseline;
+static int nbaseline;
+static int nregressions;
+
+/* A slowdown is reported as a regression if it is significant at this level
+   and the median is larger by more than the given fraction.  */
+#define COMPARE_ALPHA 0.01
+#define COMPARE_MIN_CHANGE 0.01
+/* A p99 larger than the baseline by more than this fraction is reported as a
+   tail regression.  */
+#define COMPARE_TAIL_CHANGE 0.1
+
+/* Percentiles reported with -q.  */
+static const double pct_level[4] = { 50, 90, 99, 99.9 };
+static const char *const pct_key[4] = { "p50", "p90", "p99", "p99.9" };
+
+/* Equality where NAN means absent.  */
+static int
+same (double x, double y)
+{
+  return x == y || (isnan (x) && isnan (y));
+}
+
+/* Interval of the second arguments in text output.  */
+static const char *
+interval2 (const struct result *r)
+{
+  static char buf[64];
+  if (isnan (r->lo2))
+    return "";
+  snprintf (buf, sizeof (buf), " x [%g %g]", r->lo2, r->hi2);
+  return buf;
+}
+
+static int
+cmp_double (const void *a, const void *b)
+{
+  double x = *(const double *) a;
+  double y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+static void
+result_stats (struct result *r)
+{
+  double *s = xrealloc (NULL, r->n * sizeof (double));
+  double sum = 0, sum2 = 0;
+
+  memcpy (s, r->v, r->n * sizeof (double));
+  qsort (s, r->n, sizeof (double), cmp_double);
+  r->min = s[0];
+  r->median = r->n % 2 ? s[r->n / 2] : (s[r->n / 2 - 1] + s[r->n / 2]) / 2;
+  for (int i = 0; i < r->n; i++)
+    sum += s[i];
+  r->mean = sum / r->n;
+  for (int i = 0; i < r->n; i++)
+    sum2 += (s[i] - r->mean) * (s[i] - r->mean);
+  r->stddev = r->n > 1 ? sqrt (sum2 / (r->n - 1)) : 0;
+  free (s);
+}
+
+/* One-sided p-value of the Mann-Whitney U test for the samples X being
+   larger than the samples Y, with the normal approximation.  Unlike the
+   minimum, this uses all measurements and does not assume the noise is
+   normally distributed.  */
+static double
+mann_whitney_p (const double *x, int n, const double *y, int m)
+{
+  double u = 0;
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < m; j++)
+      u += x[i] > y[j] ? 1 : x[i] == y[j] ? 0.5 : 0;
+  double mu = 0.5 * n * m;
+  double sigma = sqrt (n * m * (n + m + 1) / 12.0);
+  return 0.5 * erfc ((u - mu) / (sigma * sqrt (2)));
+}
+
+static void
+compare (struct result *r)
+{
+  for (int i = 0; i < nbaseline; i++)
+    {
+      const struct baseline *b = &baseline[i];
+      if (strcmp (b->name, r->name) != 0 || strcmp (b->type, r->type) != 0
+	  || b->threads != r->threads || b->lo != r->lo || b->hi != r->hi
+	  || !same (b->lo2, r->lo2) || !same (b->hi2, r->hi2)
+	  || b->working_set != r->working_set)
+	continue;
+      r->base_p99 = b->p99;
+      if (r->pct_calls > 0 && !isnan (b->p99))
+	{
+	  r->tail_compared = 1;
+	  r->tail_regression = r->pct[2] > b->p99 * (1 + COMPARE_TAIL_CHANGE);
+	  nregressions += r->tail_regression;
+	}
+      if (b->n < 2 || r->n < 2)
+	return;
+      struct result base = { .v = b->v, .n = b->n };
+      result_stats (&base);
+      r->compared = 1;
+      r->base_median = base.median;
+      r->p = mann_whitney_p (r->v, r->n, b->v, b->n);
+      r->regression = r->p < COMPARE_ALPHA
+		      && r->median > r->base_median * (1 + COMPARE_MIN_CHANGE);
+      nregressions += r->regression;
+      return;
+    }
+}
+
+/* Return the number after "KEY": in LINE, or NaN.  */
+static double
+json_number (const char *line, const char *key)
+{
+  char pat[32];
+  snprintf (pat, sizeof (pat), "\"%s\": ", key);
+  const char *p = strstr (line, pat);
+  return p ? strtod (p + strlen (pat), 0) : NAN;
+}
+
+/* Copy the string after "KEY": in LINE to BUF, return 0 if not found.  */
+static int
+json_string (const char *line, const char *key, char *buf, size_t size)
+{
+  char pat[32];
+  snprintf (pat, sizeof (pat), "\"%s\": \"", key);
+  const char *p = strstr (line, pat);
+  if (p == NULL)
+    return 0;
+  p += strlen (pat);
+  const char *q = strchr (p, '"');
+  if (q == NULL || q - p >= size)
+    return 0;
+  memcpy (buf, p, q - p);
+  buf[q - p] = 0;
+  return 1;
+}
+
+/* Read the results of a previous run with -o json, which has one result per
+   line.  */
+static void
+read_baseline (const char *name)
+{
+  FILE *f = fopen (name, "r");
+  char *buf = NULL;
+  size_t n = 0, size = 0;
+
+  if (!f)
+    {
+      printf ("openning \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  for (;;)
+    {
+      if (n == size)
+	{
+	  size = size ? 2 * size : 1 << 16;
+	  buf = xrealloc (buf, size + 1);
+	}
+      size_t k = fread (buf + n, 1, size - n, f);
+      if (k == 0)
+	break;
+      n += k;
+    }
+  buf[n] = 0;
+  fclose (f);
+
+  for (char *line = buf, *end; line != NULL; line = end)
+    {
+      end = strchr (line, '\n');
+      if (end)
+	*end++ = 0;
+      struct baseline b = { .n = 0, .v = NULL };
+      const char *p = strstr (line, "\"samples\": [");
+      if (p == NULL || !json_string (line, "func", b.name, sizeof (b.name))
+	  || !json_string (line, "type", b.type, sizeof (b.type)))
+	continue;
+      /* Files written before -j was added have no thread count.  */
+      b.threads = isnan (json_number (line, "threads"))
+		      ? 1
+		      : json_number (line, "threads");
+      b.lo = json_number (line, "lo");
+      b.hi = json_number (line, "hi");
+      b.lo2 = json_number (line, "lo2");
+      b.hi2 = json_number (line, "hi2");
+      b.p99 = json_number (line, "p99");
+      b.working_set = isnan (json_number (line, "working_set"))
+			  ? 0
+			  : json_number (line, "working_set");
+      p += strlen ("\"samples\": [");
+      for (;;)
+	{
+	  char *q;
+	  double x = strtod (p, &q);
+	  if (q == p)
+	    break;
+	  b.v = xrealloc (b.v, (b.n + 1) * sizeof (double));
+	  b.v[b.n++] = x;
+	  for (p = q; *p == ',' || *p == ' '; p++)
+	    ;
+	}
+      baseline = xrealloc (baseline, (nbaseline + 1) * sizeof (*baseline));
+      baseline[nbaseline++] = b;
+    }
+  free (buf);
+  if (nbaseline == 0)
+    {
+      printf ("no results in \"%s\"\n", name);
+      exit (1);
+    }
+}
+
+static void
+print_json (const struct result *r)
+{
+  printf ("%s{\"func\": \"%s\", \"type\": \"%s\", \"prec\": \"%c\", "
+	  "\"vlen\": %d, \"threads\": %d, \"lo\": %.17g, \"hi\": %.17g, "
+	  "\"gen\": \"%s\", \"unit\": \"%s\", \"iterations\": %ld, ",
+	  nrecords++ ? ",\n" : "", r->name, r->type, r->prec, r->vlen,
+	  r->threads, r->lo, r->hi, r->gen, r->unit, itercount);
+  if (!isnan (r->lo2))
+    printf ("\"lo2\": %.17g, \"hi2\": %.17g, ", r->lo2, r->hi2);
+  if (r->working_set > 0)
+    printf ("\"working_set\": %zu, ", r->working_set);
+  printf ("\"min\": %.6g, \"median\": %.6g, \"mean\": %.6g, "
+	  "\"stddev\": %.6g, ",
+	  r->min, r->median, r->mean, r->stddev);
+  if (r->working_set > 0)
+    printf ("\"gbps\": %.6g, ", r->gbps);
+  for (int i = 0; perf_enabled && i < NPERF; i++)
+    if (perf_count[i] >= 0)
+      printf ("\"%s\": %.6g, ", perf_key[i], perf_count[i] / r->count);
+  for (int i = 0; r->pct_calls > 0 && i < 4; i++)
+    printf ("\"%s\": %.6g, ", pct_key[i], r->pct[i]);
+  if (r->pct_calls > 0)
+    printf ("\"pct_batch\": %d, \"timer_res_ns\": %.6g, ", r->pct_calls,
+	    tick_res_ns);
+  if (r->compared)
+    printf ("\"baseline_median\": %.6g, \"p\": %.3g, \"regression\": %s, ",
+	    r->base_median, r->p, r->regression ? "true" : "false");
+  if (r->tail_compared)
+    printf ("\"baseline_p99\": %.6g, \"tail_regression\": %s, ",
+	    r->base_p99, r->tail_regression ? "true" : "false");
+  printf ("\"samples\": [");
+  for (int i = 0; i < r->n; i++)
+    printf ("%s%.6g", i ? ", " : "", r->v[i]);
+  printf ("]}");
+}
+
+static void
+print_csv (const struct result *r)
+{
+  printf ("%s,%s,%c,%d,%d,%.17g,%.17g,", r->name, r->type, r->prec, r->vlen,
+	  r->threads, r->lo, r->hi);
+  if (!isnan (r->lo2))
+    printf ("%.17g,%.17g,", r->lo2, r->hi2);
+  else
+    printf (",,");
+  if (r->working_set > 0)
+    printf ("%zu,", r->working_set);
+  else
+    printf (",");
+  printf ("%s,%s,%ld,%.6g,%.6g,%.6g,%.6g,", r->gen, r->unit, itercount,
+	  r->min, r->median, r->mean, r->stddev);
+  if (r->working_set > 0)
+    printf ("%.6g", r->gbps);
+  for (int i = 0; i < NPERF; i++)
+    if (perf_enabled && perf_count[i] >= 0)
+      printf (",%.6g", perf_count[i] / r->count);
+    else
+      printf (",");
+  for (int i = 0; i < 4; i++)
+    if (r->pct_calls > 0)
+      printf (",%.6g", r->pct[i]);
+    else
+      printf (",");
+  if (r->pct_calls > 0)
+    printf (",%d,%.6g", r->pct_calls, tick_res_ns);
+  else
+    printf (",,");
+  if (r->compared)
+    printf (",%.6g,%.3g,%d", r->base_median, r->p, r->regression);
+  else
+    printf (",,,");
+  printf (",");
+  for (int i = 0; i < r->n; i++)
+    printf ("%s%.6g", i ? ";" : "", r->v[i]);
+  printf ("\n");
+}
+
+static void
+print_compare (const struct result *r)
+{
+  if (r->compared && r->base_median > 0)
+    printf ("%9s %8s: %7.2f -> %.2f %s median (%+.1f%%) p=%.2g%s\n",
+	    r->name, "compare", r->base_median, r->median, r->unit,
+	    100 * (r->median / r->base_median - 1), r->p,
+	    r->regression ? " REGRESSION" : "");
+  if (r->tail_compared && r->base_p99 > 0)
+    printf ("%9s %8s: %7.2f -> %.2f %s p99 (%+.1f%%)%s\n", r->name,
+	    "compare", r->base_p99, r->pct[2], r->unit,
+	    100 * (r->pct[2] / r->base_p99 - 1),
+	    r->tail_regression ? " TAIL REGRESSION" : "");
+}
+
+/* Number of elements per call of F.  */
+static int
+fun_vlen (const struct fun *f)
+{
+  if (f->vec == 'a')
+    return N;
+  else if (f->vec == 'n')
+    return f->prec == 'd' ? 2 : 4;
+  else if (f->vec == 'w')
+    return f->prec == 'd' ? 4 : 8;
+#if WANT_SVE_TESTS
+  else if (f->vec == 's')
+    return f->prec == 'd' ? svcntd () : svcntw ();
+#endif
+  return 1;
+}
+
+#if HAVE_THREADS
+struct thread
+{
+  pthread_t id;
+  const struct fun *f;
+  int type;
+  /* CPU the thread is pinned to, or -1.  */
+  int cpu;
+  /* Time of each measurement.  */
+  uint64_t *dt;
+};
+static struct thread *threads;
+static pthread_barrier_t barrier;
+
+struct cpu_info
+{
+  int cpu;
+  int package;
+  int core;
+  /* Index among the SMT siblings of the core.  */
+  int smt;
+  /* Index among the cores of the package with the same SMT index.  */
+  int rank;
+};
+
+/* Sort key of a CPU for the placement.  */
+static void
+cpu_key (const struct cpu_info *c, int k[4])
+{
+  if (strcmp (placement, "smt") == 0)
+    {
+      /* Fill the SMT siblings of a core before moving to the next core.  */
+      k[0] = c->package;
+      k[1] = c->core;
+      k[2] = c->smt;
+    }
+  else if (strcmp (placement, "socket") == 0)
+    {
+      /* Alternate between packages, one thread per core first.  */
+      k[0] = c->smt;
+      k[1] = c->rank;
+      k[2] = c->package;
+    }
+  else
+    {
+      /* One thread per core, filling a package first.  */
+      k[0] = c->smt;
+      k[1] = c->package;
+      k[2] = c->core;
+    }
+  k[3] = c->cpu;
+}
+
+static int
+cmp_cpu (const void *a, const void *b)
+{
+  int kx[4], ky[4];
+
+  cpu_key (a, kx);
+  cpu_key (b, ky);
+  for (int i = 0; i < 4; i++)
+    if (kx[i] != ky[i])
+      return kx[i] < ky[i] ? -1 : 1;
+  return 0;
+}
+
+static int
+topology_id (int cpu, const char *name)
+{
+  char path[128];
+  int id = -1;
+
+  snprintf (path, sizeof (path), "/sys/devices/system/cpu/cpu%d/topology/%s",
+	    cpu, name);
+  FILE *f = fopen (path, "r");
+  if (f)
+    {
+      if (fscanf (f, "%d", &id) != 1)
+	id = -1;
+      fclose (f);
+    }
+  return id;
+}
+
+/* Assign a CPU to each thread according to the placement, using the CPUs
+   the process may run on and the topology in sysfs.  Without topology, each
+   CPU is treated as a separate core of one package.  */
+static void
+place_threads (void)
+{
+  struct cpu_info *cpus = NULL;
+  cpu_set_t set;
+  int n = 0;
+
+  for (int i = 0; i < nthreads; i++)
+    threads[i].cpu = -1;
+  if (sched_getaffinity (0, sizeof (set), &set) != 0)
+    {
+      fprintf (stderr, "sched_getaffinity failed: %m, threads are not "
+		       "pinned\n");
+      return;
+    }
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    if (CPU_ISSET (cpu, &set))
+      {
+	cpus = xrealloc (cpus, (n + 1) * sizeof (*cpus));
+	cpus[n].cpu = cpu;
+	cpus[n].package = topology_id (cpu, "physical_package_id");
+	cpus[n].core = topology_id (cpu, "core_id");
+	if (cpus[n].package < 0 || cpus[n].core < 0)
 	  {
-	    printf ("reading \"%s\" failed: %m\n", name);
-	    exit (1);
+	    cpus[n].package = 0;
+	    cpus[n].core = cpu;
 	  }
-	fclose (f);
-	if (n % N == 0)
-	  trace_size = n;
-	for (int i = 0; n < trace_size; n++, i++)
-	  Trace[n] = Trace[i];
+	n++;
+      }
+  for (int i = 0; i < n; i++)
+    {
+      cpus[i].smt = 0;
+      for (int j = 0; j < i; j++)
+	cpus[i].smt += cpus[j].package == cpus[i].package
+		       && cpus[j].core == cpus[i].core;
+    }
+  for (int i = 0; i < n; i++)
+    {
+      cpus[i].rank = 0;
+      for (int j = 0; j < n; j++)
+	cpus[i].rank += cpus[j].package == cpus[i].package
+			&& cpus[j].smt == cpus[i].smt
+			&& cpus[j].core < cpus[i].core;
+    }
+  qsort (cpus, n, sizeof (*cpus), cmp_cpu);
+  if (nthreads > n)
+    fprintf (stderr, "%d threads on %d CPUs, some CPUs run several "
+		     "threads\n", nthreads, n);
+  for (int i = 0; i < nthreads; i++)
+    threads[i].cpu = cpus[i % n].cpu;
+  free (cpus);
+}
+
+static void *
+bench_thread (void *arg)
+{
+  struct thread *t = arg;
+
+  if (t->cpu >= 0)
+    {
+      cpu_set_t set;
+      CPU_ZERO (&set);
+      CPU_SET (t->cpu, &set);
+      pthread_setaffinity_np (pthread_self (), sizeof (set), &set);
+    }
+  run1 (t->f, t->type); /* Warm up.  */
+  for (int j = 0; j < measurecount; j++)
+    {
+      pthread_barrier_wait (&barrier);
+      uint64_t t0 = tic ();
+      for (int i = 0; i < itercount; i++)
+	run1 (t->f, t->type);
+      t->dt[j] = tic () - t0;
+    }
+  return NULL;
+}
+
+/* Run F on all threads, each measurement starts at the same time on all
+   threads.  Set the samples to the time of the slowest thread, which gives
+   the aggregate throughput, and return the fastest of them.  */
+static uint64_t
+bench_threads (const struct fun *f, int type)
+{
+  uint64_t dt = -1;
+
+  pthread_barrier_init (&barrier, NULL, nthreads);
+  for (int i = 0; i < nthreads; i++)
+    {
+      threads[i].f = f;
+      threads[i].type = type;
+      if (pthread_create (&threads[i].id, NULL, bench_thread, &threads[i]))
+	{
+	  printf ("pthread_create failed\n");
+	  exit (1);
+	}
+    }
+  for (int i = 0; i < nthreads; i++)
+    pthread_join (threads[i].id, NULL);
+  pthread_barrier_destroy (&barrier);
+
+  nsamples = measurecount;
+  for (int j = 0; j < measurecount; j++)
+    {
+      sample_ns[j] = 0;
+      for (int i = 0; i < nthreads; i++)
+	if (threads[i].dt[j] > sample_ns[j])
+	  sample_ns[j] = threads[i].dt[j];
+      if (sample_ns[j] < dt)
+	dt = sample_ns[j];
+    }
+  return dt;
+}
+
+/* Print the time of the fastest measurement of each thread and the
+   aggregate throughput.  COUNT is the number of elements or calls per
+   measurement and thread.  */
+static void
+print_threads (const struct result *r, uint64_t dt)
+{
+  char label[32];
+
+  for (int i = 0; i < nthreads; i++)
+    {
+      uint64_t t = -1;
+      for (int j = 0; j < measurecount; j++)
+	if (threads[i].dt[j] < t)
+	  t = threads[i].dt[j];
+      snprintf (label, sizeof (label), "thread%d", i);
+      printf ("%9s %8s: %7.2f %s on cpu %d\n", "", label, t / r->count,
+	      r->unit, threads[i].cpu);
+    }
+  printf ("%9s %8s: %.1f M%s/s on %d threads\n", r->name, "total",
+	  1e3 * nthreads * r->count / dt,
+	  strcmp (r->unit, "ns/elem") == 0 ? "elem" : "call", nthreads);
+}
+#endif
+
+/* Samples of percentiles span at least this many times the resolution of
+   the counter, which bounds their quantization error to about 3%, so coarse
+   timers time a batch of several calls per sample.  */
+#define PCT_MIN_RES 32
+/* Independent calls per sample in throughput mode.  */
+#define PCT_THRUPUT_CALLS 16
+
+/* Time consecutive batches of calls over all inputs, measurecount times, and
+   set the percentiles of R, in ns per element or per call.  Unlike the
+   minimum or median over whole runs, they show the cost of the rare slow
+   paths.  The overhead of the timer is subtracted.  */
+static void
+percentiles (const struct fun *f, int type, struct result *r)
+{
+  int elems = f->vec == 'a' ? 1 : fun_vlen (f);
+  int calls = type == 't' ? PCT_THRUPUT_CALLS : 1;
+  double call_ns = r->median * (type == 't' ? elems : 1);
+  while (calls * call_ns < PCT_MIN_RES * tick_res_ns
+	 && 2 * calls * elems <= N)
+    calls *= 2;
+  int step = calls * elems;
+  int n = N / step * measurecount;
+  double *v = xrealloc (NULL, n * sizeof (double));
+  double overhead;
+
+  for (int j = 0; j < n; j++)
+    {
+      uint64_t t0 = ticks ();
+      v[j] = ticks () - t0;
+    }
+  qsort (v, n, sizeof (double), cmp_double);
+  overhead = v[n / 2];
+
+  run1 (f, type); /* Warm up.  */
+  for (int j = 0, k = 0; j < measurecount; j++)
+    for (int i = 0; i + step <= N; i += step)
+      {
+	uint64_t t0 = ticks ();
+	run_range (f, type, i, i + step);
+	uint64_t t1 = ticks ();
+	double t = (t1 - t0 - overhead) * tick_ns;
+	v[k++] = (t > 0 ? t : 0) / (type == 't' ? step : calls);
+      }
+  qsort (v, n, sizeof (double), cmp_double);
+  for (int i = 0; i < 4; i++)
+    r->pct[i] = v[(int) (pct_level[i] / 100 * (n - 1) + 0.5)];
+  r->pct_calls = calls;
+  free (v);
+}
+
+static void
+bench1 (const struct fun *f, int type, double lo, double hi, int gen)
+{
+  uint64_t dt = 0;
+  uint64_t ns100;
+  const char *s = type == 't' ? "rthruput" : "latency";
+  int vlen = fun_vlen (f);
+
+  /* Array routines have no meaningful latency.  */
+  if (f->vec == 'a' && type == 'l')
+    return;
+  stats_begin ();
+
+#if HAVE_THREADS
+  if (nthreads > 1)
+    dt = bench_threads (f, type);
+  else
+#endif
+    TIMEIT (f, type);
+
+  struct result r = {
+    .name = f->name,
+    .type = s,
+    .unit = type == 't' ? "ns/elem" : "ns/call",
+    .gen = gen == 'r' ? "rand" : gen == 'l' ? "linear" : "trace",
+    .prec = f->prec,
+    .vlen = vlen,
+    .threads = nthreads,
+    .lo = lo,
+    .hi = hi,
+    .lo2 = f->arity == 2 && gen != 't' ? y_lo : NAN,
+    .hi2 = f->arity == 2 && gen != 't' ? y_hi : NAN,
+    .count = (double) itercount * N / (type == 't' ? 1 : vlen),
+    .v = samples,
+    .n = nsamples,
+  };
+  for (int j = 0; j < nsamples; j++)
+    samples[j] = sample_ns[j] / r.count;
+  if (nsamples > 0)
+    result_stats (&r);
+  if (want_percentiles)
+    percentiles (f, type, &r);
+  if (nbaseline > 0)
+    compare (&r);
+
+  if (output_format == 'j')
+    print_json (&r);
+  else if (output_format == 'c')
+    print_csv (&r);
+  else if (type == 't')
+    {
+      ns100 = (100 * dt + itercount * N / 2) / (itercount * N);
+      printf ("%9s %8s: %4u.%02u ns/elem %10llu ns in [%g %g]%s vlen %d",
+	      f->name, s,
+	      (unsigned) (ns100 / 100), (unsigned) (ns100 % 100),
+	      (unsigned long long) dt, lo, hi, interval2 (&r), vlen);
+      /* Array routines, including the random number generators, also report
+	 their throughput in elements per second.  */
+      if (f->vec == 'a' && dt > 0)
+	printf (" %.1f Melem/s", 1e3 * itercount * N / dt);
+      printf ("\n");
+      if (perf_enabled)
+	perf_print (r.count, "elem");
+    }
+  else if (type == 'l')
+    {
+      ns100 = (100 * dt + itercount * N / vlen / 2) / (itercount * N / vlen);
+      printf ("%9s %8s: %4u.%02u ns/call %10llu ns in [%g %g]%s vlen %d\n",
+	      f->name, s,
+	      (unsigned) (ns100 / 100), (unsigned) (ns100 % 100),
+	      (unsigned long long) dt, lo, hi, interval2 (&r), vlen);
+      if (perf_enabled)
+	perf_print (r.count, "call");
+    }
+  if (output_format == 't')
+    stats_print ();
+  if (output_format == 't' && r.pct_calls > 0)
+    printf ("%9s %8s: p50 %.2f p90 %.2f p99 %.2f p99.9 %.2f %s, %s%d call%s "
+	    "per sample, timer resolution %.2f ns\n", "", "pctl", r.pct[0],
+	    r.pct[1], r.pct[2], r.pct[3], r.unit,
+	    r.pct_calls > 1 ? "batch average of " : "", r.pct_calls,
+	    r.pct_calls > 1 ? "s" : "", tick_res_ns);
+#if HAVE_THREADS
+  if (output_format == 't' && nthreads > 1)
+    print_threads (&r, dt);
+#endif
+  if (output_format == 't' && (r.compared || r.tail_compared))
+    print_compare (&r);
+  fflush (stdout);
+}
+
+/* Write to every cache line of the eviction buffer, which evicts tables and
+   code of the routine from caches that are not larger than the buffer.  */
+static void
+evict (void)
+{
+  for (size_t i = 0; i < evict_size; i += 64)
+    evict_buf[i]++;
+}
+
+#define TIME1(call) do { \
+  if (perf_enabled) \
+    perf_start (); \
+  t0 = tic (); \
+  call; \
+  t1 = tic (); \
+  if (perf_enabled) \
+    perf_stop (); \
+} while (0)
+
+/* Time one call of F on the inputs at index I, which are loaded before the
+   timer starts.  */
+static uint64_t
+time1 (const struct fun *f, int i)
+{
+  uint64_t t0 = 0, t1 = 0;
+
+  if (f->arity == 2 && f->prec == 'd' && f->vec == 0)
+    {
+      double x = A[i], y = A2[i];
+      TIME1 (f->fun.d2 (x, y));
+    }
+  else if (f->arity == 2 && f->prec == 'f' && f->vec == 0)
+    {
+      float x = Af[i], y = Af2[i];
+      TIME1 (f->fun.f2 (x, y));
+    }
+#if __aarch64__ && __linux__
+  else if (f->arity == 2 && f->prec == 'd' && f->vec == 'n')
+    {
+      float64x2_t x = vld1q_f64 (A + i), y = vld1q_f64 (A2 + i);
+      TIME1 (f->fun.vnd2 (x, y));
+    }
+  else if (f->arity == 2 && f->prec == 'f' && f->vec == 'n')
+    {
+      float32x4_t x = vld1q_f32 (Af + i), y = vld1q_f32 (Af2 + i);
+      TIME1 (f->fun.vnf2 (x, y));
+    }
+#endif
+  else if (f->prec == 'd' && f->vec == 0)
+    {
+      double x = A[i];
+      TIME1 (f->fun.d (x));
+    }
+  else if (f->prec == 'f' && f->vec == 0)
+    {
+      float x = Af[i];
+      TIME1 (f->fun.f (x));
+    }
+  else if (f->prec == 'l' && f->vec == 0)
+    {
+      long double x = Al[i];
+      TIME1 (f->fun.l (x));
+    }
+#if __aarch64__ && __linux__
+  else if (f->prec == 'd' && f->vec == 'n')
+    {
+      float64x2_t x = vld1q_f64 (A + i);
+      TIME1 (f->fun.vnd (x));
+    }
+  else if (f->prec == 'f' && f->vec == 'n')
+    {
+      float32x4_t x = vld1q_f32 (Af + i);
+      TIME1 (f->fun.vnf (x));
+    }
+  else if (f->prec == 'd' && f->vec == 'w')
+    {
+      float64x2x2_t x = vld1q_f64_x2 (A + i);
+      TIME1 (f->fun.vwd (x));
+    }
+  else if (f->prec == 'f' && f->vec == 'w')
+    {
+      float32x4x2_t x = vld1q_f32_x2 (Af + i);
+      TIME1 (f->fun.vwf (x));
+    }
+#endif
+#if WANT_SVE_TESTS
+  else if (f->prec == 'd' && f->vec == 's')
+    {
+      svfloat64_t x = svld1_f64 (svptrue_b64 (), A + i);
+      TIME1 (f->fun.svd (x, svptrue_b64 ()));
+    }
+  else if (f->prec == 'f' && f->vec == 's')
+    {
+      svfloat32_t x = svld1_f32 (svptrue_b32 (), Af + i);
+      TIME1 (f->fun.svf (x, svptrue_b32 ()));
+    }
+#endif
+  return t1 - t0;
+}
+
+/* Add the counters of the last call to SUM.  */
+static void
+perf_add (double *sum)
+{
+  if (!perf_enabled)
+    return;
+  perf_read ();
+  for (int i = 0; i < NPERF; i++)
+    sum[i] = sum[i] < 0 || perf_count[i] < 0 ? -1 : sum[i] + perf_count[i];
+}
+
+static void
+print_cold (const struct result *r, const double *perf)
+{
+  for (int i = 0; i < NPERF; i++)
+    perf_count[i] = perf[i] < 0 ? -1 : perf[i] / r->n;
+  if (output_format == 'j')
+    print_json (r);
+  else if (output_format == 'c')
+    print_csv (r);
+  else
+    {
+      printf ("%9s %8s: %7.2f ns/call median %7.2f min in [%g %g]%s "
+	      "vlen %d\n", r->name, r->type, r->median, r->min, r->lo, r->hi,
+	      interval2 (r), r->vlen);
+      if (perf_enabled)
+	perf_print (1, "call");
+      if (r->compared || r->tail_compared)
+	print_compare (r);
+    }
+}
+
+/* Time single calls of F, after touching evict_size bytes of memory (cold)
+   and right after a call on the same input (warm).  The difference of the
+   medians is the cost of the cache misses on the tables and code of F.  The
+   overhead of the timer is subtracted.  */
+static void
+bench_cold (const struct fun *f, double lo, double hi, int gen)
+{
+  double *warm = xrealloc (NULL, measurecount * sizeof (double));
+  double cold_perf[NPERF] = { 0 }, warm_perf[NPERF] = { 0 };
+  double overhead;
+  uint64_t t0, t1;
+
+  /* Array routines have no meaningful call latency.  */
+  if (f->vec == 'a')
+    return;
+
+  for (int j = 0; j < measurecount; j++)
+    {
+      t0 = tic ();
+      t1 = tic ();
+      samples[j] = t1 - t0;
+    }
+  qsort (samples, measurecount, sizeof (double), cmp_double);
+  overhead = samples[measurecount / 2];
+
+  time1 (f, 0); /* Warm up.  */
+  for (int j = 0; j < measurecount; j++)
+    {
+      /* Use different inputs, vectors need up to 64 elements.  */
+      int i = j * 64 % (N / 2);
+      evict ();
+      samples[j] = time1 (f, i) - overhead;
+      perf_add (cold_perf);
+      warm[j] = time1 (f, i) - overhead;
+      perf_add (warm_perf);
+    }
+
+  struct result r = {
+    .name = f->name,
+    .type = "cold",
+    .unit = "ns/call",
+    .gen = gen == 'r' ? "rand" : gen == 'l' ? "linear" : "trace",
+    .prec = f->prec,
+    .vlen = fun_vlen (f),
+    .threads = 1,
+    .lo = lo,
+    .hi = hi,
+    .lo2 = f->arity == 2 && gen != 't' ? y_lo : NAN,
+    .hi2 = f->arity == 2 && gen != 't' ? y_hi : NAN,
+    .count = 1,
+    .v = samples,
+    .n = measurecount,
+  };
+  struct result w = r;
+  w.type = "warm";
+  w.v = warm;
+  result_stats (&r);
+  result_stats (&w);
+  if (nbaseline > 0)
+    {
+      compare (&r);
+      compare (&w);
+    }
+  print_cold (&r, cold_perf);
+  print_cold (&w, warm_perf);
+  if (output_format == 't')
+    printf ("%9s %8s: %7.2f ns/call for %zu bytes touched between calls\n",
+	    f->name, "misscost", r.median - w.median, evict_size);
+  fflush (stdout);
+  free (warm);
+}
+
+/* Smallest working set of -t sweep, the largest is evict_size.  */
+#define SWEEP_MIN 4096
+
+/* Map SIZE bytes for -t sweep, on hugepages with -H: explicit ones if the
+   system has reserved any, transparent ones otherwise.  */
+static unsigned char *
+sweep_alloc (size_t size)
+{
+#if HAVE_MMAP
+  void *p = MAP_FAILED;
+#  ifdef MAP_HUGETLB
+  if (want_hugepages)
+    p = mmap (NULL, size, PROT_READ | PROT_WRITE,
+	      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#  endif
+  if (p == MAP_FAILED)
+    {
+      p = mmap (NULL, size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED)
+	{
+	  printf ("mapping %zu bytes failed: %m\n", size);
+	  exit (1);
+	}
+#  ifdef MADV_HUGEPAGE
+      if (want_hugepages)
+	madvise (p, size, MADV_HUGEPAGE);
+#  endif
+      if (want_hugepages)
+	fprintf (stderr, "no explicit hugepages, using transparent ones\n");
+    }
+#else
+  void *p = xrealloc (NULL, size);
+  if (want_hugepages)
+    fprintf (stderr, "hugepages are not supported\n");
+#endif
+  /* Fault the pages in before timing.  */
+  memset (p, 0, size);
+  return p;
+}
+
+/* Return 1 if -t sweep supports F: array routines and routines of one
+   argument that can be called in a loop over an array.  */
+static int
+sweep_supported (const struct fun *f)
+{
+  if (f->arity == 2 || (f->prec != 'd' && f->prec != 'f'))
+    return 0;
+#if __aarch64__ && __linux__
+  if (f->vec == 'n' || f->vec == 'w')
+    return 1;
+#endif
+  return f->vec == 0 || f->vec == 'a';
+}
+
+/* Compute F on the N elements of X, into Y which may be X.  */
+static void
+sweep_pass (const struct fun *f, const void *x, void *y, size_t n)
+{
+  const double *xd = x;
+  const float *xf = x;
+  double *yd = y;
+  float *yf = y;
+
+  if (f->prec == 'd' && f->vec == 'a')
+    f->fun.ad (xd, yd, n);
+  else if (f->prec == 'f' && f->vec == 'a')
+    f->fun.af (xf, yf, n);
+  else if (f->prec == 'd' && f->vec == 0)
+    for (size_t i = 0; i < n; i++)
+      yd[i] = f->fun.d (xd[i]);
+  else if (f->prec == 'f' && f->vec == 0)
+    for (size_t i = 0; i < n; i++)
+      yf[i] = f->fun.f (xf[i]);
+#if __aarch64__ && __linux__
+  else if (f->prec == 'd' && f->vec == 'n')
+    for (size_t i = 0; i < n; i += 2)
+      vst1q_f64 (yd + i, f->fun.vnd (vld1q_f64 (xd + i)));
+  else if (f->prec == 'f' && f->vec == 'n')
+    for (size_t i = 0; i < n; i += 4)
+      vst1q_f32 (yf + i, f->fun.vnf (vld1q_f32 (xf + i)));
+  else if (f->prec == 'd' && f->vec == 'w')
+    for (size_t i = 0; i < n; i += 4)
+      vst1q_f64_x2 (yd + i, f->fun.vwd (vld1q_f64_x2 (xd + i)));
+  else if (f->prec == 'f' && f->vec == 'w')
+    for (size_t i = 0; i < n; i += 8)
+      vst1q_f32_x2 (yf + i, f->fun.vwf (vld1q_f32_x2 (xf + i)));
+#endif
+}
+
+/* Write back and invalidate the SIZE bytes at P from all data caches, so
+   that the copy of the inputs made before an in place pass does not leave
+   them cached.  Other targets leave them cached.  */
+static void
+sweep_flush (void *p, size_t size)
+{
+  char *c = p;
+#if defined(__GNUC__) && defined(__x86_64__)
+  for (size_t i = 0; i < size; i += 64)
+    __builtin_ia32_clflush (c + i);
+  __builtin_ia32_mfence ();
+#elif defined(__GNUC__) && __aarch64__
+  uint64_t ctr;
+  __asm__ __volatile__ ("mrs %0, ctr_el0" : "=r"(ctr));
+  size_t line = 4 << ((ctr >> 16) & 15);
+  for (size_t i = 0; i < size; i += line)
+    __asm__ __volatile__ ("dc civac, %0" : : "r"(c + i) : "memory");
+  __asm__ __volatile__ ("dsb ish" : : : "memory");
+#else
+  (void) c;
+  (void) size;
+#endif
+}
+
+/* Time F over arrays of WORKING_SET bytes of inputs and outputs, out of
+   place or in place.  In place the outputs overwrite a copy of the inputs,
+   refreshed and flushed from the caches outside the timed region before
+   every pass, so the pass starts with its array in memory.  Small working
+   sets are processed several times per measurement, so that every
+   measurement computes at least N * itercount elements.  */
+static void
+bench_sweep1 (const struct fun *f, size_t working_set, int inplace, double lo,
+	      double hi, int gen)
+{
+  size_t esize = f->prec == 'd' ? sizeof (double) : sizeof (float);
+  size_t n = working_set / esize / (inplace ? 1 : 2);
+  size_t passes = n < (size_t) N * itercount ? N * itercount / n : 1;
+  double perf[NPERF] = { 0 };
+  double overhead;
+  uint64_t t0, t1;
+
+  for (int j = 0; j < measurecount; j++)
+    {
+      t0 = tic ();
+      t1 = tic ();
+      samples[j] = t1 - t0;
+    }
+  qsort (samples, measurecount, sizeof (double), cmp_double);
+  overhead = samples[measurecount / 2];
+
+  sweep_pass (f, sweep_src, sweep_dst, n); /* Warm up.  */
+  for (int j = 0; j < measurecount; j++)
+    {
+      double ns = 0;
+      for (size_t k = 0; k < passes; k++)
+	{
+	  if (inplace)
+	    {
+	      memcpy (sweep_dst, sweep_src, n * esize);
+	      sweep_flush (sweep_dst, n * esize);
+	    }
+	  void *x = inplace ? sweep_dst : sweep_src;
+	  TIME1 (sweep_pass (f, x, sweep_dst, n));
+	  perf_add (perf);
+	  ns += t1 - t0 - overhead;
+	}
+      samples[j] = (ns > 0 ? ns : 0) / (passes * n);
+    }
+
+  struct result r = {
+    .name = f->name,
+    .type = inplace ? "inplace" : "outplace",
+    .unit = "ns/elem",
+    .gen = gen == 'r' ? "rand" : gen == 'l' ? "linear" : "trace",
+    .prec = f->prec,
+    .vlen = fun_vlen (f),
+    .threads = 1,
+    .lo = lo,
+    .hi = hi,
+    .lo2 = NAN,
+    .hi2 = NAN,
+    .count = (double) passes * n,
+    .v = samples,
+    .n = measurecount,
+    .working_set = working_set,
+  };
+  result_stats (&r);
+  /* Bytes read and written per nanosecond.  */
+  r.gbps = 2 * esize / r.median;
+  for (int i = 0; i < NPERF; i++)
+    perf_count[i] = perf[i] < 0 ? -1 : perf[i] / measurecount;
+  if (nbaseline > 0)
+    compare (&r);
+
+  if (output_format == 'j')
+    print_json (&r);
+  else if (output_format == 'c')
+    print_csv (&r);
+  else
+    {
+      printf ("%9s %8s: %7.2f ns/elem %7.2f GB/s %9zu KiB in [%g %g] "
+	      "vlen %d\n", r.name, r.type, r.median, r.gbps,
+	      working_set >> 10, lo, hi, r.vlen);
+      if (perf_enabled)
+	perf_print (r.count, "elem");
+      if (r.compared || r.tail_compared)
+	print_compare (&r);
+    }
+  fflush (stdout);
+}
+
+/* Time F on working sets from SWEEP_MIN to evict_size bytes, which go from
+   L1 to DRAM, to show where it becomes limited by memory bandwidth.  The
+   inputs repeat the generated ones, or cover the whole trace.  */
+static void
+bench_sweep (const struct fun *f, double lo, double hi, int gen)
+{
+  size_t esize = f->prec == 'd' ? sizeof (double) : sizeof (float);
+
+  if (!sweep_supported (f))
+    return;
+  for (size_t i = 0; i < evict_size / esize; i++)
+    {
+      double x = gen == 't' ? trace_value (i % trace_size, 0)
+			    : f->prec == 'd' ? A[i % N] : Af[i % N];
+      if (f->prec == 'd')
+	((double *) sweep_src)[i] = x;
+      else
+	((float *) sweep_src)[i] = x;
+    }
+  for (size_t ws = SWEEP_MIN; ws <= evict_size; ws *= 2)
+    {
+      bench_sweep1 (f, ws, 0, lo, hi, gen);
+      bench_sweep1 (f, ws, 1, lo, hi, gen);
+    }
+}
+
+static void
+bench (const struct fun *f, double lo, double hi, int type, int gen)
+{
+  if (f->prec == 'd' && gen == 'r')
+    gen_rand (lo, hi);
+  else if (f->prec == 'd' && gen == 'l')
+    gen_linear (lo, hi);
+  else if (f->prec == 'd' && gen == 't')
+    gen_trace (0);
+  else if (f->prec == 'f' && gen == 'r')
+    genf_rand (lo, hi);
+  else if (f->prec == 'f' && gen == 'l')
+    genf_linear (lo, hi);
+  else if (f->prec == 'f' && gen == 't')
+    genf_trace (0);
+  else if (f->prec == 'l' && gen == 'r')
+    genl_rand (lo, hi);
+  else if (f->prec == 'l' && gen == 'l')
+    genl_linear (lo, hi);
+  else if (f->prec == 'l' && gen == 't')
+    genl_trace (0);
+
+  if (f->arity == 2)
+    gen_xy (f, lo, hi, y_lo, y_hi, gen, 0);
+  gen_special (f->prec);
+
+  if (gen == 't')
+    hi = trace_size / N;
+
+  if (type == 'b' || type == 't')
+    bench1 (f, 't', lo, hi, gen);
+
+  if (type == 'b' || type == 'l')
+    bench1 (f, 'l', lo, hi, gen);
+
+  if (type == 'c')
+    bench_cold (f, lo, hi, gen);
+
+  /* The sweep covers the whole trace at once.  */
+  if (type == 'w')
+    {
+      bench_sweep (f, lo, hi, gen);
+      return;
+    }
+
+  for (int i = N; i < trace_size; i += N)
+    {
+      if (f->prec == 'd')
+	gen_trace (i);
+      else if (f->prec == 'l')
+	genl_trace (i);
+      else
+	genf_trace (i);
+      if (f->arity == 2)
+	gen_xy (f, lo, hi, y_lo, y_hi, gen, i);
+      gen_special (f->prec);
+
+      lo = i / N;
+      if (type == 'b' || type == 't')
+	bench1 (f, 't', lo, hi, gen);
+
+      if (type == 'b' || type == 'l')
+	bench1 (f, 'l', lo, hi, gen);
+
+      if (type == 'c')
+	bench_cold (f, lo, hi, gen);
+    }
+}
+
+/* Map NAME if it is a binary trace, return 0 if it is not.  */
+static int
+maptrace (const char *name)
+{
+  struct mathbench_trace_header h;
+  FILE *f = fopen (name, "rb");
+
+  if (!f)
+    {
+      printf ("openning \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  if (fread (&h, sizeof (h), 1, f) != 1
+      || memcmp (h.magic, MATHBENCH_TRACE_MAGIC, sizeof (h.magic)) != 0)
+    {
+      fclose (f);
+      return 0;
+    }
+  if ((h.type != 'd' && h.type != 'f') || h.arity < 1 || h.arity > 2)
+    {
+      printf ("\"%s\" is not a valid binary trace\n", name);
+      exit (1);
+    }
+  trace_stride = mathbench_trace_stride (&h);
+  if (h.count == 0 && fseek (f, 0, SEEK_END) == 0)
+    {
+      /* Capture interrupted before the count was written.  */
+      long end = ftell (f);
+      if (end > (long) sizeof (h))
+	h.count = (end - sizeof (h)) / trace_stride;
+      fseek (f, sizeof (h), SEEK_SET);
+    }
+  if (h.count == 0)
+    {
+      printf ("\"%s\" is empty\n", name);
+      exit (1);
+    }
+  trace_header = h;
+  trace_arity = h.arity;
+  size_t size = sizeof (h) + h.count * trace_stride;
+#if HAVE_MMAP
+  struct stat st;
+  if (fstat (fileno (f), &st) != 0 || st.st_size < size)
+    {
+      printf ("\"%s\" is truncated\n", name);
+      exit (1);
+    }
+  void *p = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fileno (f), 0);
+  if (p == MAP_FAILED)
+    {
+      printf ("mapping \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  /* Chunks are decoded in order.  */
+  madvise (p, size, MADV_SEQUENTIAL);
+  trace_data = (const unsigned char *) p + sizeof (h);
+#else
+  unsigned char *p = xrealloc (NULL, size - sizeof (h));
+  if (fread (p, size - sizeof (h), 1, f) != 1)
+    {
+      printf ("reading \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  trace_data = p;
+#endif
+  fclose (f);
+  trace_size = (h.count + N - 1) / N * N;
+  return 1;
+}
+
+static void
+readtrace (const char *name)
+{
+  int n = 0;
+  char line[256];
+  if (strcmp (name, "-") != 0 && maptrace (name))
+    return;
+  FILE *f = strcmp (name, "-") == 0 ? stdin : fopen (name, "r");
+  if (!f)
+    {
+      printf ("openning \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  /* One or two arguments per line, the first line sets the number.  */
+  while (fgets (line, sizeof (line), f))
+    {
+      char *p, *q;
+      double x = strtod (line, &p);
+      if (p == line)
+	continue;
+      double y = strtod (p, &q);
+      if (n == 0)
+	trace_arity = q == p ? 1 : 2;
+      if (n >= trace_size)
+	{
+	  trace_size += N;
+	  Trace = xrealloc (Trace, trace_size * sizeof (Trace[0]));
+	  if (trace_arity == 2)
+	    Trace2 = xrealloc (Trace2, trace_size * sizeof (Trace2[0]));
+	}
+      Trace[n] = x;
+      if (trace_arity == 2)
+	Trace2[n] = y;
+      n++;
+    }
+  if (ferror (f) || n == 0)
+    {
+      printf ("reading \"%s\" failed: %m\n", name);
+      exit (1);
+    }
+  fclose (f);
+  if (n % N == 0)
+    trace_size = n;
+  for (int i = 0; n < trace_size; n++, i++)
+    {
+      Trace[n] = Trace[i];
+      if (trace_arity == 2)
+	Trace2[n] = Trace2[i];
+    }
 }
 
 static void
 usage (void)
 {
-  printf ("usage: ./mathbench [-g rand|linear|trace] [-t latency|thruput|both] "
-	  "[-i low high] [-f tracefile] [-m measurements] [-c iterations] func "
-	  "[func2 ..]\n");
+  printf ("usage: ./mathbench [-g rand|linear|trace] "
+	  "[-t latency|thruput|both|cold|sweep] [-k bytes] [-H] "
+	  "[-i low high] [-y low high] [-J indep|diag|int|ratio|log] "
+	  "[-f tracefile] [-m measurements] [-c iterations] "
+	  "[-s density] [-p] [-q] [-o text|json|csv] "
+	  "[--compare baseline.json] "
+	  "[-j threads] [-a core|smt|socket] func [func2 ..]\n");
   printf ("func:\n");
   printf ("%7s [run all benchmarks]\n", "all");
   for (const struct fun *f = funtab; f->name; f++)
@@ -486,7 +2388,7 @@ usage (void)
 int
 main (int argc, char *argv[])
 {
-  int usergen = 0, gen = 'r', type = 'b', all = 0;
+  int usergen = 0, usergen2 = 0, gen = 'r', type = 'b', all = 0;
   double lo = 0, hi = 0;
   const char *tracefile = "-";
 
@@ -506,6 +2408,27 @@ main (int argc, char *argv[])
 	  argv += 3;
 	  argc -= 3;
 	}
+      else if (argc >= 3 && strcmp (argv[0], "-y") == 0)
+	{
+	  usergen2 = 1;
+	  y_lo = strtod (argv[1], 0);
+	  y_hi = strtod (argv[2], 0);
+	  argv += 3;
+	  argc -= 3;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "-J") == 0)
+	{
+	  static const char *const modes[] = { "indep", "diag", "int", "ratio",
+					       "log" };
+	  joint = 0;
+	  for (int i = 0; i < 5; i++)
+	    if (strcmp (argv[1], modes[i]) == 0)
+	      joint = "idnrl"[i];
+	  if (joint == 0)
+	    usage ();
+	  argv += 2;
+	  argc -= 2;
+	}
       else if (argc >= 2 && strcmp (argv[0], "-m") == 0)
 	{
 	  measurecount = strtol (argv[1], 0, 0);
@@ -518,6 +2441,78 @@ main (int argc, char *argv[])
 	  argv += 2;
 	  argc -= 2;
 	}
+      else if (argc >= 2 && strcmp (argv[0], "-s") == 0)
+	{
+	  special_density = strtod (argv[1], 0);
+	  argv += 2;
+	  argc -= 2;
+	}
+      else if (strcmp (argv[0], "-p") == 0)
+	{
+	  perf_open ();
+	  argv += 1;
+	  argc -= 1;
+	}
+      else if (strcmp (argv[0], "-H") == 0)
+	{
+	  want_hugepages = 1;
+	  argv += 1;
+	  argc -= 1;
+	}
+      else if (strcmp (argv[0], "-q") == 0)
+	{
+	  want_percentiles = 1;
+	  ticks_init ();
+	  argv += 1;
+	  argc -= 1;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "-o") == 0)
+	{
+	  output_format = argv[1][0];
+	  if (strchr ("tjc", output_format) == 0)
+	    usage ();
+	  argv += 2;
+	  argc -= 2;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "-k") == 0)
+	{
+	  char *end;
+	  double size = strtod (argv[1], &end);
+	  if (*end == 'K' || *end == 'k')
+	    size *= 1 << 10;
+	  else if (*end == 'M' || *end == 'm')
+	    size *= 1 << 20;
+	  else if (*end == 'G' || *end == 'g')
+	    size *= 1 << 30;
+	  if (size < 64)
+	    usage ();
+	  evict_size = size;
+	  argv += 2;
+	  argc -= 2;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "-j") == 0)
+	{
+	  nthreads = strtol (argv[1], 0, 0);
+	  if (nthreads < 1)
+	    usage ();
+	  argv += 2;
+	  argc -= 2;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "-a") == 0)
+	{
+	  placement = argv[1];
+	  if (strcmp (placement, "core") != 0 && strcmp (placement, "smt") != 0
+	      && strcmp (placement, "socket") != 0)
+	    usage ();
+	  argv += 2;
+	  argc -= 2;
+	}
+      else if (argc >= 2 && strcmp (argv[0], "--compare") == 0)
+	{
+	  read_baseline (argv[1]);
+	  argv += 2;
+	  argc -= 2;
+	}
       else if (argc >= 2 && strcmp (argv[0], "-g") == 0)
 	{
 	  gen = argv[1][0];
@@ -535,8 +2530,8 @@ main (int argc, char *argv[])
 	}
       else if (argc >= 2 && strcmp (argv[0], "-t") == 0)
 	{
-	  type = argv[1][0];
-	  if (strchr ("ltb", type) == 0)
+	  type = strcmp (argv[1], "sweep") == 0 ? 'w' : argv[1][0];
+	  if (strchr ("ltbcw", type) == 0)
 	    usage ();
 	  argv += 2;
 	  argc -= 2;
@@ -550,6 +2545,54 @@ main (int argc, char *argv[])
       lo = hi = 0;
       usergen = 1;
     }
+  if (measurecount < 1)
+    usage ();
+  sample_ns = xrealloc (NULL, measurecount * sizeof (sample_ns[0]));
+  samples = xrealloc (NULL, measurecount * sizeof (samples[0]));
+  if (type == 'c')
+    {
+      evict_buf = xrealloc (NULL, evict_size);
+      memset (evict_buf, 0, evict_size);
+      if (nthreads > 1)
+	fprintf (stderr, "-t cold runs on one thread\n");
+      nthreads = 1;
+    }
+  if (type == 'w')
+    {
+      sweep_src = sweep_alloc (2 * evict_size);
+      sweep_dst = sweep_src + evict_size;
+      if (nthreads > 1)
+	fprintf (stderr, "-t sweep runs on one thread\n");
+      nthreads = 1;
+    }
+  if (nthreads > 1 && want_percentiles)
+    {
+      fprintf (stderr, "-q is not supported with -j\n");
+      exit (1);
+    }
+  if (nthreads > 1)
+    {
+#if HAVE_THREADS
+      threads = xrealloc (NULL, nthreads * sizeof (threads[0]));
+      for (int i = 0; i < nthreads; i++)
+	threads[i].dt = xrealloc (NULL, measurecount * sizeof (uint64_t));
+      place_threads ();
+      if (perf_enabled)
+	fprintf (stderr, "perf counters are not supported with -j\n");
+      perf_enabled = 0;
+#else
+      fprintf (stderr, "threads are not supported, using 1 thread\n");
+      nthreads = 1;
+#endif
+    }
+  if (output_format == 'j')
+    printf ("[\n");
+  else if (output_format == 'c')
+    printf ("func,type,prec,vlen,threads,lo,hi,lo2,hi2,working_set,gen,unit,"
+	    "iterations,min,median,mean,stddev,gbps,cycles,insns,"
+	    "branch_misses,l1d_misses,"
+	    "p50,p90,p99,p99.9,pct_batch,timer_res_ns,baseline_median,p,"
+	    "regression,samples\n");
   while (argc > 0)
     {
       int found = 0;
@@ -563,16 +2606,24 @@ main (int argc, char *argv[])
 		lo = f->lo;
 		hi = f->hi;
 	      }
+	    if (!usergen2)
+	      {
+		y_lo = f->lo2;
+		y_hi = f->hi2;
+	      }
 	    bench (f, lo, hi, type, gen);
 	    if (usergen && !all)
 	      break;
 	  }
       if (!found)
-	printf ("unknown function: %s\n", argv[0]);
+	fprintf (stderr, "unknown function: %s\n", argv[0]);
       argv++;
       argc--;
     }
-  return 0;
+  if (output_format == 'j')
+    printf ("\n]\n");
+  /* Let scripts detect regressions from the exit status.  */
+  return nregressions > 0;
 }
 
 #if __aarch64__ && __linux__ && WANT_SVE_TESTS && defined(__clang__)
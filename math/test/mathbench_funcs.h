@@ -5,7 +5,7 @@
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 /* clang-format off */
-{"pow", 'd', 0, 0.01, 11.1, {.d = xypow}},
+D2 (pow, 0.01, 11.1, -9.9, 9.9)
 D (xpow, 0.01, 11.1)
 D (ypow, -9.9, 9.9)
 #if defined (__APPLE__) || defined (_WIN32)
@@ -13,7 +13,7 @@ D (ypow, -9.9, 9.9)
 #else
 {"lgamma_r", 'd', 0, -10.0, 10.0, {.d = lgamma_r_wrap}},
 #endif
-{"powf", 'f', 0, 0.01, 11.1, {.f = xypowf}},
+F2 (powf, 0.01, 11.1, -9.9, 9.9)
 F (xpowf, 0.01, 11.1)
 F (ypowf, -9.9, 9.9)
 #if defined (__APPLE__) || defined (_WIN32)
@@ -21,6 +21,8 @@ F (ypowf, -9.9, 9.9)
 #else
 {"lgammaf_r", 'f', 0, -10.0, 10.0, {.f = lgammaf_r_wrap}},
 #endif
+D2 (hypot, -10.0, 10.0, -10.0, 10.0)
+F2 (hypotf, -10.0, 10.0, -10.0, 10.0)
 {"sincosf", 'f', 0, 0.1, 0.7, {.f = sincosf_wrap}},
 {"sincosf", 'f', 0, 0.8, 3.1, {.f = sincosf_wrap}},
 {"sincosf", 'f', 0, -3.1, 3.1, {.f = sincosf_wrap}},
@@ -40,29 +42,44 @@ D (arm_math_tanpi, -0.9, 0.9)
 #if WANT_EXPERIMENTAL_MATH
 D (arm_math_erf, -6.0, 6.0)
 F (arm_math_erff, -4.0, 4.0)
-{"atan2f", 'f', 0, -10.0, 10.0, {.f = atan2f_wrap}},
-{"atan2",  'd', 0, -10.0, 10.0, {.d = atan2_wrap}},
+F (arm_math_expf_repro, -9.9, 9.9)
+F2 (atan2f, -10.0, 10.0, -10.0, 10.0)
+D2 (atan2, -10.0, 10.0, -10.0, 10.0)
 {"atan2pif", 'f', 0, -10.0, 10.0, {.f = atan2pif_wrap}},
 {"atan2pi", 'd', 0, -10.0, 10.0, {.d = atan2pi_wrap}},
 {"powi",   'd', 0,  0.01, 11.1, {.d = powi_wrap}},
+{"arm_math_exp_dd", 'd', 0, -9.9, 9.9, {.d = exp_dd_wrap}},
+{"arm_math_log_dd", 'd', 0, 0.01, 11.1, {.d = log_dd_wrap}},
+{"arm_math_pow_dd", 'd', 0, 0.01, 11.1, {.d = pow_dd_wrap}},
+# if LDBL_MANT_DIG == 113
+/* Binary128 routines and the C library ones they are measured against.  */
+L (arm_math_expl, -10.0, 10.0)
+L (expl, -10.0, 10.0)
+L (arm_math_expm1l, -10.0, 10.0)
+L (expm1l, -10.0, 10.0)
+L (arm_math_logl, 0.01, 11.1)
+L (logl, 0.01, 11.1)
+L (arm_math_log1pl, -0.9, 10.0)
+L (log1pl, -0.9, 10.0)
+# endif
 #endif
 #if __aarch64__ && __linux__
-{"_ZGVnN4vv_atan2f", 'f', 'n', -10.0, 10.0, {.vnf = _Z_atan2f_wrap}},
-{"_ZGVnN2vv_atan2",  'd', 'n', -10.0, 10.0, {.vnd = _Z_atan2_wrap}},
+VNF2 (_ZGVnN4vv_atan2f, -10.0, 10.0, -10.0, 10.0)
+VND2 (_ZGVnN2vv_atan2, -10.0, 10.0, -10.0, 10.0)
 {"_ZGVnN4vv_atan2pif", 'f', 'n', -10.0, 10.0, {.vnf = _Z_atan2pif_wrap}},
 {"_ZGVnN2vv_atan2pi", 'd', 'n', -10.0, 10.0, {.vnd = _Z_atan2pi_wrap}},
-{"_ZGVnN4vv_hypotf", 'f', 'n', -10.0, 10.0, {.vnf = _Z_hypotf_wrap}},
-{"_ZGVnN2vv_hypot",  'd', 'n', -10.0, 10.0, {.vnd = _Z_hypot_wrap}},
-{"_ZGVnN2vv_pow",    'd', 'n', -10.0, 10.0, {.vnd = xy_Z_pow}},
+VNF2 (_ZGVnN4vv_hypotf, -10.0, 10.0, -10.0, 10.0)
+VND2 (_ZGVnN2vv_hypot, -10.0, 10.0, -10.0, 10.0)
+VND2 (_ZGVnN2vv_pow, 0.01, 11.1, -9.9, 9.9)
 {"x_ZGVnN2vv_pow",   'd', 'n', -10.0, 10.0, {.vnd = x_Z_pow}},
 {"y_ZGVnN2vv_pow",   'd', 'n', -10.0, 10.0, {.vnd = y_Z_pow}},
-{"_ZGVnN2vv_powr",   'd', 'n',   0.01, 11.1, {.vnd = xy_Z_powr}},
+VND2 (_ZGVnN2vv_powr, 0.01, 11.1, -9.9, 9.9)
 {"x_ZGVnN2vv_powr",  'd', 'n',   0.01, 11.1, {.vnd = x_Z_powr}},
 {"y_ZGVnN2vv_powr",  'd', 'n',  -10.0, 10.0, {.vnd = y_Z_powr}},
-{"_ZGVnN4vv_powf",  'f', 'n',   0.01, 11.1, {.vnf = xy_Z_powf}},
+VNF2 (_ZGVnN4vv_powf, 0.01, 11.1, -9.9, 9.9)
 {"x_ZGVnN4vv_powf", 'f', 'n',   0.01, 11.1, {.vnf = x_Z_powf}},
 {"y_ZGVnN4vv_powf", 'f', 'n',  -10.0, 10.0, {.vnf = y_Z_powf}},
-{"_ZGVnN4vv_powrf", 'f', 'n',   0.01, 11.1, {.vnf = xy_Z_powrf}},
+VNF2 (_ZGVnN4vv_powrf, 0.01, 11.1, -9.9, 9.9)
 {"x_ZGVnN4vv_powrf", 'f', 'n',  0.01, 11.1, {.vnf = x_Z_powrf}},
 {"y_ZGVnN4vv_powrf", 'f', 'n', -10.0, 10.0, {.vnf = y_Z_powrf}},
 {"_ZGVnN4vl4_modff", 'f', 'n', -10.0, 10.0, {.vnf = _Z_modff_wrap}},
@@ -84,6 +101,27 @@ VNF (arm_math_advsimd_fast_sinf, -3.1, 3.1)
 {"xarm_math_advsimd_fast_powf", 'f', 'n',  0.01, 11.1, {.vnf = x_Z_fast_powf}},
 {"yarm_math_advsimd_fast_powf", 'f', 'n', -10.0, 10.0, {.vnf = y_Z_fast_powf}},
 VNF (arm_math_advsimd_fast_expf, -10.0,10.0)
+VNF (arm_math_advsimd_expf_repro, -9.9, 9.9)
+{"arm_math_advsimd_powf_const_exp",  'f', 'a',  0.01, 11.1, {.af = x_Z_powf_const_exp}},
+{"arm_math_advsimd_powf_const_base", 'f', 'a', -10.0, 10.0, {.af = y_Z_powf_const_base}},
+{"arm_math_advsimd_pow_const_exp",   'd', 'a',  0.01, 11.1, {.ad = x_Z_pow_const_exp}},
+{"arm_math_advsimd_pow_const_base",  'd', 'a', -10.0, 10.0, {.ad = y_Z_pow_const_base}},
+AF (arm_math_advsimd_expf_array, -9.9, 9.9)
+AF (arm_math_advsimd_log1pf_array, -0.9, 10.0)
+VWF (arm_math_advsimd_expf_x2, -9.9, 9.9)
+VWD (arm_math_advsimd_exp_x2, -9.9, 9.9)
+{"_ZGVnN2vv_gammainc",  'd', 'n', 0.01, 20.0, {.vnd = x_Z_gammainc}},
+{"_ZGVnN2vv_gammaincc", 'd', 'n', 0.01, 20.0, {.vnd = x_Z_gammaincc}},
+{"_ZGVnN2vvv_betainc",  'd', 'n', 0.0, 1.0, {.vnd = x_Z_betainc}},
+{"_ZGVnN4vv_logaddexpf", 'f', 'n', -10.0, 10.0, {.vnf = x_Z_logaddexpf}},
+{"_ZGVnN4vv_logsubexpf", 'f', 'n', -1.0, 10.0, {.vnf = x_Z_logsubexpf}},
+{"_ZGVnN2vv_logaddexp",  'd', 'n', -10.0, 10.0, {.vnd = x_Z_logaddexp}},
+{"_ZGVnN2vv_logsubexp",  'd', 'n', -1.0, 10.0, {.vnd = x_Z_logsubexp}},
+{"arm_math_advsimd_exp_dd",  'd', 'n', -9.9, 9.9, {.vnd = x_Z_exp_dd}},
+{"arm_math_advsimd_log_dd",  'd', 'n', 0.01, 11.1, {.vnd = x_Z_log_dd}},
+{"arm_math_advsimd_pow_dd", 'd', 'n', 0.01, 11.1, {.vnd = x_Z_pow_dd}},
+{"arm_math_advsimd_randu_f32", 'f', 'a', 0, 1, {.af = Z_randu_f32}},
+{"arm_math_advsimd_randn_f32", 'f', 'a', 0, 1, {.af = Z_randn_f32}},
 # endif
 # if WANT_C23_TESTS
 VNF (_ZGVnN4v_asinpif, -0.9, 0.9)
@@ -179,6 +217,24 @@ SVF (arm_math_sve_fast_sinf, -3.1, 3.1)
 {"_ZGVsMxvv_powi",   'f', 's', -10.0, 10.0, {.svf = _Z_sv_powi_wrap}},
 {"_ZGVsMxvv_powk",   'd', 's', -10.0, 10.0, {.svd = _Z_sv_powk_wrap}},
 SVF (arm_math_sve_fast_expf, -9.9, 9.9)
+SVF (arm_math_sve_expf_repro, -9.9, 9.9)
+{"_ZGVsMxvv_gammainc",  'd', 's', 0.01, 20.0, {.svd = x_Z_sv_gammainc}},
+{"_ZGVsMxvv_gammaincc", 'd', 's', 0.01, 20.0, {.svd = x_Z_sv_gammaincc}},
+{"_ZGVsMxvvv_betainc",  'd', 's', 0.0, 1.0, {.svd = x_Z_sv_betainc}},
+{"_ZGVsMxvv_logaddexpf", 'f', 's', -10.0, 10.0, {.svf = x_Z_sv_logaddexpf}},
+{"_ZGVsMxvv_logsubexpf", 'f', 's', -1.0, 10.0, {.svf = x_Z_sv_logsubexpf}},
+{"_ZGVsMxvv_logaddexp",  'd', 's', -10.0, 10.0, {.svd = x_Z_sv_logaddexp}},
+{"_ZGVsMxvv_logsubexp",  'd', 's', -1.0, 10.0, {.svd = x_Z_sv_logsubexp}},
+{"arm_math_sve_randu_f32", 'f', 'a', 0, 1, {.af = Z_sv_randu_f32}},
+{"arm_math_sve_randn_f32", 'f', 'a', 0, 1, {.af = Z_sv_randn_f32}},
+#  if __ARM_FEATURE_SME
+{"arm_math_sve_sc_expf",    'f', 'a', -9.9, 9.9, {.af = sme_expf_sc}},
+{"sme_switch_expf",         'f', 'a', -9.9, 9.9, {.af = sme_expf_switch}},
+{"sve_nosm_expf",           'f', 'a', -9.9, 9.9, {.af = sme_expf_nosm}},
+{"arm_math_sve_sc_tanhf",   'f', 'a', -10.0, 10.0, {.af = sme_tanhf_sc}},
+{"sme_switch_tanhf",        'f', 'a', -10.0, 10.0, {.af = sme_tanhf_switch}},
+{"sve_nosm_tanhf",          'f', 'a', -10.0, 10.0, {.af = sme_tanhf_nosm}},
+#  endif
 # endif
 #endif
     /* clang-format on */
@@ -0,0 +1,43 @@
+/*
+ * Binary trace format for mathbench.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#ifndef MATHBENCH_TRACE_H
+#define MATHBENCH_TRACE_H
+
+#include <stdint.h>
+
+/* A binary trace is a header followed by COUNT records.  A record holds an
+   optional timestamp and ARITY arguments of the given TYPE, without padding,
+   so it is (timestamp ? 8 : 0) + ARITY * sizeof (TYPE) bytes.  All fields use
+   the byte order of the host.  The timestamp is not used by mathbench, it is
+   kept for the analysis of captured traces.  */
+#define MATHBENCH_TRACE_MAGIC "MBTRACE1"
+#define MATHBENCH_TRACE_TIMESTAMP 1
+
+struct mathbench_trace_header
+{
+  char magic[8];
+  /* 'd' for double or 'f' for float arguments.  */
+  uint8_t type;
+  /* Number of arguments per record, 1 or 2.  */
+  uint8_t arity;
+  /* MATHBENCH_TRACE_TIMESTAMP if records start with a uint64_t.  */
+  uint16_t flags;
+  uint32_t reserved;
+  /* Number of records, 0 if the writer did not finish, then the count is
+     derived from the file size.  */
+  uint64_t count;
+};
+
+static inline size_t
+mathbench_trace_stride (const struct mathbench_trace_header *h)
+{
+  size_t size = h->type == 'f' ? sizeof (float) : sizeof (double);
+  return (h->flags & MATHBENCH_TRACE_TIMESTAMP ? 8 : 0) + h->arity * size;
+}
+
+#endif
@@ -11,33 +11,43 @@
 #endif
 
 static double
-atan2_wrap (double x)
+atan2pi_wrap (double x)
 {
-  return atan2 (5.0, x);
+  return atan2 (5.0, x) / M_PIl;
 }
 
 static float
-atan2f_wrap (float x)
+atan2pif_wrap (float x)
 {
-  return atan2f (5.0f, x);
+  return atan2 (5.0f, x) / M_PIl;
 }
 
 static double
-atan2pi_wrap (double x)
+powi_wrap (double x)
 {
-  return atan2 (5.0, x) / M_PIl;
+  return __builtin_powi (x, (int) round (x));
 }
 
-static float
-atan2pif_wrap (float x)
+/* The double-double results are summed so the tail is not optimized out.  */
+static double
+exp_dd_wrap (double x)
 {
-  return atan2 (5.0f, x) / M_PIl;
+  double t, y = arm_math_exp_dd (x, &t);
+  return y + t;
 }
 
 static double
-powi_wrap (double x)
+log_dd_wrap (double x)
 {
-  return __builtin_powi (x, (int) round (x));
+  double t, y = arm_math_log_dd (x, &t);
+  return y + t;
+}
+
+static double
+pow_dd_wrap (double x)
+{
+  double t, y = arm_math_pow_dd (x, 23.4, &t);
+  return y + t;
 }
 #endif /* WANT_EXPERIMENTAL_MATH.  */
 
@@ -97,18 +107,6 @@ _Z_cexpipi_wrap (float64x2_t x)
 }
 #endif
 
-__vpcs static float64x2_t
-_Z_atan2_wrap (float64x2_t x)
-{
-  return _ZGVnN2vv_atan2 (vdupq_n_f64 (5.0), x);
-}
-
-__vpcs static float32x4_t
-_Z_atan2f_wrap (float32x4_t x)
-{
-  return _ZGVnN4vv_atan2f (vdupq_n_f32 (5.0f), x);
-}
-
 __vpcs static float32x4_t
 _Z_atan2pif_wrap (float32x4_t x)
 {
@@ -121,24 +119,6 @@ _Z_atan2pi_wrap (float64x2_t x)
   return _ZGVnN2vv_atan2pi (vdupq_n_f64 (5.0f), x);
 }
 
-__vpcs static float32x4_t
-_Z_hypotf_wrap (float32x4_t x)
-{
-  return _ZGVnN4vv_hypotf (vdupq_n_f32 (5.0f), x);
-}
-
-__vpcs static float64x2_t
-_Z_hypot_wrap (float64x2_t x)
-{
-  return _ZGVnN2vv_hypot (vdupq_n_f64 (5.0), x);
-}
-
-__vpcs static float32x4_t
-xy_Z_powf (float32x4_t x)
-{
-  return _ZGVnN4vv_powf (x, x);
-}
-
 __vpcs static float32x4_t
 x_Z_powf (float32x4_t x)
 {
@@ -151,12 +131,6 @@ y_Z_powf (float32x4_t x)
   return _ZGVnN4vv_powf (vdupq_n_f32 (2.34), x);
 }
 
-__vpcs static float64x2_t
-xy_Z_pow (float64x2_t x)
-{
-  return _ZGVnN2vv_pow (x, x);
-}
-
 __vpcs static float64x2_t
 x_Z_pow (float64x2_t x)
 {
@@ -169,12 +143,6 @@ y_Z_pow (float64x2_t x)
   return _ZGVnN2vv_pow (vdupq_n_f64 (2.34), x);
 }
 
-__vpcs static float64x2_t
-xy_Z_powr (float64x2_t x)
-{
-  return _ZGVnN2vv_powr (x, x);
-}
-
 __vpcs static float64x2_t
 x_Z_powr (float64x2_t x)
 {
@@ -187,12 +155,6 @@ y_Z_powr (float64x2_t x)
   return _ZGVnN2vv_powr (vdupq_n_f64 (2.34), x);
 }
 
-__vpcs static float32x4_t
-xy_Z_powrf (float32x4_t x)
-{
-  return _ZGVnN4vv_powrf (x, x);
-}
-
 __vpcs static float32x4_t
 x_Z_powrf (float32x4_t x)
 {
@@ -285,6 +247,109 @@ y_Z_fast_powf (float32x4_t x)
   return arm_math_advsimd_fast_powf (vdupq_n_f32 (2.34), x);
 }
 
+static void
+x_Z_powf_const_exp (const float *x, float *out, size_t n)
+{
+  arm_math_advsimd_powf_const_exp (x, 23.4f, out, n);
+}
+
+static void
+y_Z_powf_const_base (const float *x, float *out, size_t n)
+{
+  arm_math_advsimd_powf_const_base (2.34f, x, out, n);
+}
+
+static void
+x_Z_pow_const_exp (const double *x, double *out, size_t n)
+{
+  arm_math_advsimd_pow_const_exp (x, 23.4, out, n);
+}
+
+static void
+y_Z_pow_const_base (const double *x, double *out, size_t n)
+{
+  arm_math_advsimd_pow_const_base (2.34, x, out, n);
+}
+
+/* The generators ignore their input, the state persists across runs.  */
+static struct arm_math_rng_state rng_state = { .seed = 42 };
+
+static void
+Z_randu_f32 (const float *x, float *out, size_t n)
+{
+  arm_math_advsimd_randu_f32 (&rng_state, out, n);
+}
+
+static void
+Z_randn_f32 (const float *x, float *out, size_t n)
+{
+  arm_math_advsimd_randn_f32 (&rng_state, out, n);
+}
+
+__vpcs static float64x2_t
+x_Z_gammainc (float64x2_t x)
+{
+  return _ZGVnN2vv_gammainc (vdupq_n_f64 (4.5), x);
+}
+
+__vpcs static float64x2_t
+x_Z_gammaincc (float64x2_t x)
+{
+  return _ZGVnN2vv_gammaincc (vdupq_n_f64 (4.5), x);
+}
+
+__vpcs static float64x2_t
+x_Z_betainc (float64x2_t x)
+{
+  return _ZGVnN2vvv_betainc (vdupq_n_f64 (2.5), vdupq_n_f64 (4.5), x);
+}
+
+/* The fixed y is below the x range of logsubexp, so results are finite.  */
+__vpcs static float32x4_t
+x_Z_logaddexpf (float32x4_t x)
+{
+  return _ZGVnN4vv_logaddexpf (x, vdupq_n_f32 (-1.5f));
+}
+
+__vpcs static float32x4_t
+x_Z_logsubexpf (float32x4_t x)
+{
+  return _ZGVnN4vv_logsubexpf (x, vdupq_n_f32 (-1.5f));
+}
+
+__vpcs static float64x2_t
+x_Z_logaddexp (float64x2_t x)
+{
+  return _ZGVnN2vv_logaddexp (x, vdupq_n_f64 (-1.5));
+}
+
+__vpcs static float64x2_t
+x_Z_logsubexp (float64x2_t x)
+{
+  return _ZGVnN2vv_logsubexp (x, vdupq_n_f64 (-1.5));
+}
+
+__vpcs static float64x2_t
+x_Z_exp_dd (float64x2_t x)
+{
+  float64x2x2_t y = arm_math_advsimd_exp_dd (x);
+  return vaddq_f64 (y.val[0], y.val[1]);
+}
+
+__vpcs static float64x2_t
+x_Z_log_dd (float64x2_t x)
+{
+  float64x2x2_t y = arm_math_advsimd_log_dd (x);
+  return vaddq_f64 (y.val[0], y.val[1]);
+}
+
+__vpcs static float64x2_t
+x_Z_pow_dd (float64x2_t x)
+{
+  float64x2x2_t y = arm_math_advsimd_pow_dd (x, vdupq_n_f64 (23.4));
+  return vaddq_f64 (y.val[0], y.val[1]);
+}
+
 # endif
 
 #endif
@@ -523,6 +588,105 @@ _Z_sv_powk_wrap (svfloat64_t x, svbool_t pg)
   return _ZGVsMxvv_powk (x, svcvt_s64_f64_x (pg, x), pg);
 }
 
+static void
+Z_sv_randu_f32 (const float *x, float *out, size_t n)
+{
+  arm_math_sve_randu_f32 (&rng_state, out, n);
+}
+
+static void
+Z_sv_randn_f32 (const float *x, float *out, size_t n)
+{
+  arm_math_sve_randn_f32 (&rng_state, out, n);
+}
+
+static svfloat64_t
+x_Z_sv_gammainc (svfloat64_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_gammainc (svdup_f64 (4.5), x, pg);
+}
+
+static svfloat64_t
+x_Z_sv_gammaincc (svfloat64_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_gammaincc (svdup_f64 (4.5), x, pg);
+}
+
+static svfloat64_t
+x_Z_sv_betainc (svfloat64_t x, svbool_t pg)
+{
+  return _ZGVsMxvvv_betainc (svdup_f64 (2.5), svdup_f64 (4.5), x, pg);
+}
+
+static svfloat32_t
+x_Z_sv_logaddexpf (svfloat32_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_logaddexpf (x, svdup_f32 (-1.5f), pg);
+}
+
+static svfloat32_t
+x_Z_sv_logsubexpf (svfloat32_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_logsubexpf (x, svdup_f32 (-1.5f), pg);
+}
+
+static svfloat64_t
+x_Z_sv_logaddexp (svfloat64_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_logaddexp (x, svdup_f64 (-1.5), pg);
+}
+
+static svfloat64_t
+x_Z_sv_logsubexp (svfloat64_t x, svbool_t pg)
+{
+  return _ZGVsMxvv_logsubexp (x, svdup_f64 (-1.5), pg);
+}
+
+#  if __ARM_FEATURE_SME
+/* Array loops for the streaming-mode comparison:
+   - _nosm: regular SVE routine, never entering streaming mode (baseline),
+   - _switch: in streaming mode, leaving it around each call to the regular
+     SVE routine, one streaming vector at a time,
+   - _sc: in streaming mode, calling the streaming-compatible routine.
+   _switch - _nosm is the cost of the mode switches.  */
+#   define SME_ARRAY_WRAPPERS(name, sc_fun, sv_fun)                           \
+      static void __attribute__ ((noinline))                                 \
+      name##_sv_chunk (const float *x, float *y, size_t n)                    \
+      {                                                                       \
+	for (size_t i = 0; i < n; i += svcntw ())                             \
+	  {                                                                   \
+	    svbool_t pg = svwhilelt_b32 (i, n);                               \
+	    svst1 (pg, y + i, sv_fun (svld1 (pg, x + i), pg));                \
+	  }                                                                   \
+      }                                                                       \
+                                                                              \
+      static void name##_nosm (const float *x, float *y, size_t n)            \
+      {                                                                       \
+	name##_sv_chunk (x, y, n);                                            \
+      }                                                                       \
+                                                                              \
+      __arm_locally_streaming static void                                     \
+      name##_switch (const float *x, float *y, size_t n)                      \
+      {                                                                       \
+	size_t vl = svcntw ();                                                \
+	for (size_t i = 0; i < n; i += vl)                                    \
+	  name##_sv_chunk (x + i, y + i, n - i < vl ? n - i : vl);            \
+      }                                                                       \
+                                                                              \
+      __arm_locally_streaming static void                                     \
+      name##_sc (const float *x, float *y, size_t n)                          \
+      {                                                                       \
+	for (size_t i = 0; i < n; i += svcntw ())                             \
+	  {                                                                   \
+	    svbool_t pg = svwhilelt_b32 (i, n);                               \
+	    svst1 (pg, y + i, sc_fun (svld1 (pg, x + i), pg));                \
+	  }                                                                   \
+      }
+
+SME_ARRAY_WRAPPERS (sme_expf, arm_math_sve_sc_expf, _ZGVsMxv_expf)
+SME_ARRAY_WRAPPERS (sme_tanhf, arm_math_sve_sc_tanhf, _ZGVsMxv_tanhf)
+#  endif
+
 # endif
 
 #endif
@@ -545,18 +709,6 @@ sincospi_wrap (double x)
 }
 #endif
 
-static double
-xypow (double x)
-{
-  return pow (x, x);
-}
-
-static float
-xypowf (float x)
-{
-  return powf (x, x);
-}
-
 static double
 xpow (double x)
 {
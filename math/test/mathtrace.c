@@ -0,0 +1,404 @@
+/*
+ * LD_PRELOAD interposer recording the arguments of math functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Usage:
+
+     MATHTRACE_FUNCS=expf,powf LD_PRELOAD=build/lib/libmathtrace.so ./app
+
+   writes the arguments of the interposed functions to FUNC.PID.bin in the
+   binary trace format of mathbench (see mathbench_trace.h), which can be
+   replayed with mathbench -f.  The interposer is configured with environment
+   variables:
+
+     MATHTRACE_DIR        output directory, default ".".
+     MATHTRACE_FUNCS      comma-separated functions to record, default all.
+     MATHTRACE_PERIOD     record one call in PERIOD per thread, default 1.
+     MATHTRACE_TIMESTAMP  if not 0, records start with CLOCK_MONOTONIC ns.
+
+   Calls are recorded into per-thread buffers without locks or atomics on
+   the fast path.  Full buffers are appended to the trace file with a single
+   write, and the buffers of a thread are flushed when it exits.  At process
+   exit, the buffers of the exiting thread are flushed and the record counts
+   in the headers are updated.  Threads that are still running lose the
+   records in their buffers, which are only ever accessed by their owner.  */
+
+#undef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#if __aarch64__
+#  include <arm_neon.h>
+#endif
+#include "mathbench_trace.h"
+
+#define unlikely(x) __builtin_expect (!!(x), 0)
+
+/* Records per thread and function buffer.  */
+#define BUFSIZE 4096
+
+/* Interposed functions: F1 and F2 for scalar functions with 1 or 2
+   arguments, V1 and V2 for AdvSIMD functions, with the element type and the
+   number of lanes.  */
+#if __aarch64__
+#  define VECTOR_FUNCS(V1, V2)                                                \
+    V1 (_ZGVnN4v_expf, float32x4_t, float, 4)                                 \
+    V1 (_ZGVnN2v_exp, float64x2_t, double, 2)                                 \
+    V1 (_ZGVnN4v_logf, float32x4_t, float, 4)                                 \
+    V1 (_ZGVnN2v_log, float64x2_t, double, 2)                                 \
+    V1 (_ZGVnN4v_sinf, float32x4_t, float, 4)                                 \
+    V1 (_ZGVnN2v_sin, float64x2_t, double, 2)                                 \
+    V1 (_ZGVnN4v_cosf, float32x4_t, float, 4)                                 \
+    V1 (_ZGVnN2v_cos, float64x2_t, double, 2)                                 \
+    V2 (_ZGVnN4vv_powf, float32x4_t, float, 4)                                \
+    V2 (_ZGVnN2vv_pow, float64x2_t, double, 2)
+#else
+#  define VECTOR_FUNCS(V1, V2)
+#endif
+
+#define FUNCS(F1, F2, V1, V2)                                                 \
+  F1 (exp, double) F1 (expf, float)                                           \
+  F1 (exp2, double) F1 (exp2f, float)                                         \
+  F1 (expm1, double) F1 (expm1f, float)                                       \
+  F1 (log, double) F1 (logf, float)                                           \
+  F1 (log2, double) F1 (log2f, float)                                         \
+  F1 (log10, double) F1 (log10f, float)                                       \
+  F1 (log1p, double) F1 (log1pf, float)                                       \
+  F1 (sin, double) F1 (sinf, float)                                           \
+  F1 (cos, double) F1 (cosf, float)                                           \
+  F1 (tan, double) F1 (tanf, float)                                           \
+  F1 (asin, double) F1 (asinf, float)                                         \
+  F1 (acos, double) F1 (acosf, float)                                         \
+  F1 (atan, double) F1 (atanf, float)                                         \
+  F1 (sinh, double) F1 (sinhf, float)                                         \
+  F1 (cosh, double) F1 (coshf, float)                                         \
+  F1 (tanh, double) F1 (tanhf, float)                                         \
+  F1 (erf, double) F1 (erff, float)                                           \
+  F1 (erfc, double) F1 (erfcf, float)                                         \
+  F1 (cbrt, double) F1 (cbrtf, float)                                         \
+  F2 (pow, double) F2 (powf, float)                                           \
+  F2 (atan2, double) F2 (atan2f, float)                                       \
+  F2 (hypot, double) F2 (hypotf, float)                                       \
+  VECTOR_FUNCS (V1, V2)
+
+#define ID_F(name, type) FN_##name,
+#define ID_V(name, vtype, type, lanes) FN_##name,
+enum
+{
+  FUNCS (ID_F, ID_F, ID_V, ID_V) NFUNCS
+};
+
+static const struct
+{
+  const char *name;
+  int type;
+  int arity;
+} funcs[] = {
+#define INFO_F1(name, type) { #name, sizeof (type) == 4 ? 'f' : 'd', 1 },
+#define INFO_F2(name, type) { #name, sizeof (type) == 4 ? 'f' : 'd', 2 },
+#define INFO_V1(name, vtype, type, lanes)                                     \
+  { #name, sizeof (type) == 4 ? 'f' : 'd', 1 },
+#define INFO_V2(name, vtype, type, lanes)                                     \
+  { #name, sizeof (type) == 4 ? 'f' : 'd', 2 },
+  FUNCS (INFO_F1, INFO_F2, INFO_V1, INFO_V2)
+};
+
+struct buffer
+{
+  unsigned char *data;
+  size_t n;
+};
+
+struct thread_state
+{
+  int flushed;
+  /* Calls left before the next recorded one.  */
+  uint32_t countdown[NFUNCS];
+  struct buffer buf[NFUNCS];
+};
+
+static __thread struct thread_state *self;
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+/* Protects fds and finished, and serializes writes to the trace files.  */
+static pthread_mutex_t file_lock = PTHREAD_MUTEX_INITIALIZER;
+static int finished;
+static char dir[512] = ".";
+static uint32_t period = 1;
+static int timestamps;
+static int enabled[NFUNCS];
+static int fds[NFUNCS];
+
+static struct mathbench_trace_header
+header (int fn, uint64_t count)
+{
+  struct mathbench_trace_header h = {
+    .type = funcs[fn].type,
+    .arity = funcs[fn].arity,
+    .flags = timestamps ? MATHBENCH_TRACE_TIMESTAMP : 0,
+    .count = count,
+  };
+  memcpy (h.magic, MATHBENCH_TRACE_MAGIC, sizeof (h.magic));
+  return h;
+}
+
+static size_t
+stride (int fn)
+{
+  struct mathbench_trace_header h = header (fn, 0);
+  return mathbench_trace_stride (&h);
+}
+
+/* Return the trace file of FN, created with an empty header on first use,
+   or -1 once the files are closed.  The record count is set when the
+   process exits.  Called with file_lock held.  */
+static int
+trace_fd (int fn)
+{
+  if (fds[fn] < 0 && !finished)
+    {
+      char path[sizeof (dir) + 64];
+      snprintf (path, sizeof (path), "%s/%s.%d.bin", dir, funcs[fn].name,
+		(int) getpid ());
+      int fd = open (path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+      if (fd < 0)
+	{
+	  fprintf (stderr, "mathtrace: cannot open %s: %m\n", path);
+	  enabled[fn] = 0;
+	}
+      else
+	{
+	  struct mathbench_trace_header h = header (fn, 0);
+	  if (write (fd, &h, sizeof (h)) != sizeof (h))
+	    enabled[fn] = 0;
+	}
+      fds[fn] = fd;
+    }
+  return fds[fn];
+}
+
+static void
+flush (struct thread_state *t, int fn)
+{
+  struct buffer *b = &t->buf[fn];
+  if (b->n == 0)
+    return;
+  pthread_mutex_lock (&file_lock);
+  int fd = trace_fd (fn);
+  if (fd >= 0 && write (fd, b->data, b->n * stride (fn)) < 0)
+    enabled[fn] = 0;
+  pthread_mutex_unlock (&file_lock);
+  b->n = 0;
+}
+
+/* Flush and free the buffers of T, which must be the state of the calling
+   thread.  Later calls of the thread are not recorded.  */
+static void
+flush_thread (struct thread_state *t)
+{
+  if (t->flushed)
+    return;
+  t->flushed = 1;
+  for (int fn = 0; fn < NFUNCS; fn++)
+    {
+      flush (t, fn);
+      free (t->buf[fn].data);
+      t->buf[fn].data = NULL;
+    }
+}
+
+static void
+thread_exit (void *arg)
+{
+  flush_thread (arg);
+}
+
+static void
+init (void)
+{
+  const char *s;
+
+  for (int fn = 0; fn < NFUNCS; fn++)
+    fds[fn] = -1;
+  if ((s = getenv ("MATHTRACE_DIR")) != NULL)
+    snprintf (dir, sizeof (dir), "%s", s);
+  if ((s = getenv ("MATHTRACE_PERIOD")) != NULL && atol (s) > 0)
+    period = atol (s);
+  if ((s = getenv ("MATHTRACE_TIMESTAMP")) != NULL)
+    timestamps = atoi (s) != 0;
+  s = getenv ("MATHTRACE_FUNCS");
+  for (int fn = 0; fn < NFUNCS; fn++)
+    {
+      size_t len = strlen (funcs[fn].name);
+      enabled[fn] = s == NULL;
+      for (const char *p = s; p != NULL && *p; p += strspn (p, ","))
+	{
+	  size_t n = strcspn (p, ",");
+	  if (n == len && strncmp (p, funcs[fn].name, len) == 0)
+	    enabled[fn] = 1;
+	  p += n;
+	}
+    }
+  pthread_key_create (&key, thread_exit);
+}
+
+static struct thread_state *
+thread_init (void)
+{
+  pthread_once (&once, init);
+  struct thread_state *t = calloc (1, sizeof (*t));
+  if (t == NULL)
+    abort ();
+  for (int fn = 0; fn < NFUNCS; fn++)
+    t->countdown[fn] = period;
+  pthread_setspecific (key, t);
+  self = t;
+  return t;
+}
+
+/* Record N sets of arguments of FN, one every PERIOD calls.  */
+static inline void
+record (int fn, const void *args, int n)
+{
+  struct thread_state *t = self;
+  if (unlikely (t == NULL))
+    t = thread_init ();
+  if (!enabled[fn] || --t->countdown[fn] != 0 || t->flushed)
+    return;
+  t->countdown[fn] = period;
+
+  struct buffer *b = &t->buf[fn];
+  size_t size = stride (fn);
+  size_t argsize = size - (timestamps ? 8 : 0);
+  if (unlikely (b->data == NULL))
+    {
+      b->data = malloc (BUFSIZE * size);
+      if (b->data == NULL)
+	return;
+    }
+  for (int i = 0; i < n; i++)
+    {
+      unsigned char *p = b->data + b->n * size;
+      if (timestamps)
+	{
+	  struct timespec ts;
+	  clock_gettime (CLOCK_MONOTONIC, &ts);
+	  uint64_t ns = ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+	  memcpy (p, &ns, 8);
+	  p += 8;
+	}
+      memcpy (p, (const unsigned char *) args + i * argsize, argsize);
+      if (++b->n == BUFSIZE)
+	flush (t, fn);
+    }
+}
+
+static void *
+resolve (const char *name)
+{
+  void *p = dlsym (RTLD_NEXT, name);
+  if (p == NULL)
+    {
+      fprintf (stderr, "mathtrace: %s not found\n", name);
+      abort ();
+    }
+  return p;
+}
+
+#define WRAP_F1(name, type)                                                   \
+  type name (type x)                                                          \
+  {                                                                           \
+    static type (*real) (type);                                               \
+    if (unlikely (real == NULL))                                              \
+      real = resolve (#name);                                                 \
+    record (FN_##name, &x, 1);                                                \
+    return real (x);                                                          \
+  }
+#define WRAP_F2(name, type)                                                   \
+  type name (type x, type y)                                                  \
+  {                                                                           \
+    static type (*real) (type, type);                                         \
+    type args[2] = { x, y };                                                  \
+    if (unlikely (real == NULL))                                              \
+      real = resolve (#name);                                                 \
+    record (FN_##name, args, 1);                                              \
+    return real (x, y);                                                       \
+  }
+/* Vector calls record one record per lane.  */
+#define WRAP_V1(name, vtype, type, lanes)                                     \
+  __attribute__ ((aarch64_vector_pcs)) vtype name (vtype x)                   \
+  {                                                                           \
+    static __attribute__ ((aarch64_vector_pcs)) vtype (*real) (vtype);        \
+    type args[lanes];                                                         \
+    if (unlikely (real == NULL))                                              \
+      real = resolve (#name);                                                 \
+    memcpy (args, &x, sizeof (args));                                         \
+    record (FN_##name, args, lanes);                                          \
+    return real (x);                                                          \
+  }
+#define WRAP_V2(name, vtype, type, lanes)                                     \
+  __attribute__ ((aarch64_vector_pcs)) vtype name (vtype x, vtype y)          \
+  {                                                                           \
+    static __attribute__ ((aarch64_vector_pcs)) vtype (*real) (vtype, vtype); \
+    type args[2 * lanes], a[lanes], b[lanes];                                 \
+    if (unlikely (real == NULL))                                              \
+      real = resolve (#name);                                                 \
+    memcpy (a, &x, sizeof (a));                                               \
+    memcpy (b, &y, sizeof (b));                                               \
+    for (int i = 0; i < lanes; i++)                                           \
+      {                                                                       \
+	args[2 * i] = a[i];                                                   \
+	args[2 * i + 1] = b[i];                                               \
+      }                                                                       \
+    record (FN_##name, args, lanes);                                          \
+    return real (x, y);                                                       \
+  }
+
+FUNCS (WRAP_F1, WRAP_F2, WRAP_V1, WRAP_V2)
+
+/* Flush the exiting thread and set the record counts from the file sizes.
+   The buffers of other threads may be in use, so they are not touched, and
+   their later flushes are dropped once the files are closed.  */
+static void __attribute__ ((destructor))
+fini (void)
+{
+  if (self != NULL)
+    flush_thread (self);
+  pthread_mutex_lock (&file_lock);
+  finished = 1;
+  for (int fn = 0; fn < NFUNCS; fn++)
+    {
+      struct stat st;
+      if (fds[fn] < 0 || fstat (fds[fn], &st) != 0)
+	continue;
+      size_t size = st.st_size - sizeof (struct mathbench_trace_header);
+      struct mathbench_trace_header h = header (fn, size / stride (fn));
+      /* On Linux pwrite appends to files opened with O_APPEND, so reopen
+	 the file to update the header.  */
+      char path[sizeof (dir) + 64];
+      snprintf (path, sizeof (path), "%s/%s.%d.bin", dir, funcs[fn].name,
+		(int) getpid ());
+      int fd = open (path, O_WRONLY);
+      if (fd >= 0)
+	{
+	  if (pwrite (fd, &h, sizeof (h), 0) != sizeof (h))
+	    fprintf (stderr, "mathtrace: cannot update %s\n", path);
+	  close (fd);
+	}
+      close (fds[fn]);
+      fds[fn] = -1;
+    }
+  pthread_mutex_unlock (&file_lock);
+}
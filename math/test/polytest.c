@@ -0,0 +1,73 @@
+/*
+ * Check the public polynomial helpers of arm_math_poly.h.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* The header must neither use nor clobber common macro names defined by the
+   including code.  Any use of these expands to an undeclared identifier.  */
+#define VTYPE user_vtype
+#define STYPE user_stype
+#define VWRAP(f) user_##f
+#define FMA(x, y, z) user_fma
+#define DUP(x) user_dup
+#define PTRUE user_ptrue
+
+#include <stdio.h>
+#include "arm_math_poly.h"
+
+#if !defined(VTYPE) || !defined(STYPE) || !defined(VWRAP) || !defined(FMA) \
+    || !defined(DUP) || !defined(PTRUE)
+# error arm_math_poly.h undefined a user macro
+#endif
+
+static int fails;
+
+static void
+check (const char *name, double got, double want)
+{
+  if (got != want)
+    {
+      printf ("FAIL %s got %a want %a\n", name, got, want);
+      fails++;
+    }
+}
+
+int
+main (void)
+{
+  /* With x = 1/2 and small integer coefficients every evaluation is exact,
+     whatever the scheme.  */
+  static const double cd[]
+      = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+  static const float cf[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  double x = 0.5, x2 = x * x, x4 = x2 * x2, x8 = x4 * x4;
+  double want7 = 0, want15 = 0;
+  for (int i = 15; i >= 0; i--)
+    {
+      want15 = want15 * x + cd[i];
+      if (i <= 7)
+	want7 = want7 * x + cd[i];
+    }
+
+  check ("horner_7_f64", arm_math_horner_7_f64 (x, cd), want7);
+  check ("pw_horner_7_f64", arm_math_pw_horner_7_f64 (x, x2, cd), want7);
+  check ("estrin_7_f64", arm_math_estrin_7_f64 (x, x2, x4, cd), want7);
+  check ("estrin_15_f64", arm_math_estrin_15_f64 (x, x2, x4, x8, cd),
+	 want15);
+  check ("horner_7_f32", arm_math_horner_7_f32 (x, cf), want7);
+  check ("estrin_7_f32", arm_math_estrin_7_f32 (x, x2, x4, cf), want7);
+
+#if __aarch64__ && defined(__ARM_NEON)
+  float64x2_t vcd[8];
+  for (int i = 0; i < 8; i++)
+    vcd[i] = vdupq_n_f64 (cd[i]);
+  float64x2_t vx = vdupq_n_f64 (x), vx2 = vdupq_n_f64 (x2);
+  check ("v_pw_horner_7_f64",
+	 vgetq_lane_f64 (arm_math_v_pw_horner_7_f64 (vx, vx2, vcd), 1),
+	 want7);
+#endif
+
+  return fails != 0;
+}
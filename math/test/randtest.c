@@ -0,0 +1,262 @@
+/*
+ * Check the vector random number generators against a scalar Philox4x32-10.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#if WANT_SVE_TESTS
+#  if __aarch64__ && __linux__
+#    ifdef __clang__
+#      pragma clang attribute push(__attribute__((target("sve"))),            \
+				   apply_to = any(function))
+#    else
+#      pragma GCC target("+sve")
+#    endif
+#  else
+#    error "SVE not supported - please disable WANT_SVE_TESTS"
+#  endif
+#endif
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "mathlib.h"
+#if WANT_SVE_TESTS
+# include <sys/prctl.h>
+#endif
+
+static int fails;
+
+/* Reference Philox4x32-10 on a 128-bit counter and a 64-bit key.  */
+static void
+philox (uint32_t out[4], const uint32_t ctr[4], const uint32_t key[2])
+{
+  uint32_t x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < 10; r++)
+    {
+      uint64_t p0 = (uint64_t) x0 * 0xd2511f53;
+      uint64_t p1 = (uint64_t) x2 * 0xcd9e8d57;
+      x0 = (uint32_t) (p1 >> 32) ^ x1 ^ k0;
+      x2 = (uint32_t) (p0 >> 32) ^ x3 ^ k1;
+      x1 = (uint32_t) p1;
+      x3 = (uint32_t) p0;
+      k0 += 0x9e3779b9;
+      k1 += 0xbb67ae85;
+    }
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+/* Known answers from the Random123 distribution (kat_vectors).  */
+static const struct
+{
+  uint32_t ctr[4], key[2], want[4];
+} kat[] = {
+  { { 0, 0, 0, 0 },
+    { 0, 0 },
+    { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+  { { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+    { 0xffffffff, 0xffffffff },
+    { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+  { { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 },
+    { 0xa4093822, 0x299f31d0 },
+    { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } },
+};
+
+#if __aarch64__ && __linux__ && WANT_EXPERIMENTAL_MATH
+
+/* Words of block COUNTER of stream SEED, as used by the generators.  */
+static void
+block (uint32_t w[4], uint64_t counter, uint64_t seed)
+{
+  uint32_t ctr[4] = { counter, counter >> 32, 0, 0 };
+  uint32_t key[2] = { seed, seed >> 32 };
+  philox (w, ctr, key);
+}
+
+static uint32_t
+asuint (float f)
+{
+  union
+  {
+    float f;
+    uint32_t i;
+  } u = { f };
+  return u.i;
+}
+
+typedef void rng_fn (struct arm_math_rng_state *, float *, size_t);
+
+/* Uniform deviate of word w.  */
+static float
+randu_ref (uint32_t w)
+{
+  return (w >> 8) * 0x1p-24f;
+}
+
+/* Box-Muller transform of the words (a, b) as in the generators, but with
+   the transcendental functions evaluated in double precision.  */
+static void
+randn_ref (uint32_t a, uint32_t b, double *z0, double *z1)
+{
+  float u = fmaf ((float) a, 0x1p-32f, 0x1p-33f);
+  float t = (float) ((int32_t) b >> 8) * 0x1.921fb6p-22f;
+  double r = sqrt (-2.0 * log (u));
+  *z0 = r * cos (t);
+  *z1 = r * sin (t);
+}
+
+/* The routines are built from the logf and sincosf cores, each within a few
+   ULP, and r is at most 6.77.  The largest error seen is below 2^-22.  */
+# define RANDN_TOL 0x1p-21
+
+/* Draw N deviates from stream SEED starting at block COUNTER, and compare
+   them with the reference.  The state must advance by the number of blocks,
+   rounded up.  */
+static void
+check_rng (const char *name, rng_fn *f, int normal, uint64_t seed,
+	   uint64_t counter, size_t n)
+{
+  float out[64];
+  struct arm_math_rng_state s = { seed, counter };
+  f (&s, out, n);
+  if (s.counter != counter + (n + 3) / 4)
+    {
+      printf ("FAIL %s n=%zu counter %llu want %llu\n", name, n,
+	      (unsigned long long) s.counter,
+	      (unsigned long long) (counter + (n + 3) / 4));
+      fails++;
+    }
+  for (size_t i = 0; i < n; i += 4)
+    {
+      uint32_t w[4];
+      double want[4];
+      block (w, counter + i / 4, seed);
+      if (normal)
+	{
+	  randn_ref (w[0], w[1], &want[0], &want[1]);
+	  randn_ref (w[2], w[3], &want[2], &want[3]);
+	}
+      else
+	for (int j = 0; j < 4; j++)
+	  want[j] = randu_ref (w[j]);
+      for (size_t j = 0; j < 4 && i + j < n; j++)
+	{
+	  double err = fabs (out[i + j] - want[j]);
+	  if (normal ? err > RANDN_TOL : err != 0)
+	    {
+	      printf ("FAIL %s seed=%#llx counter=%#llx n=%zu out[%zu] got %a "
+		      "want %a\n",
+		      name, (unsigned long long) seed,
+		      (unsigned long long) counter, n, i + j, out[i + j],
+		      want[j]);
+	      fails++;
+	      return;
+	    }
+	}
+    }
+}
+
+/* Drawing 64 deviates in one call or in calls of 4 blocks must give the
+   same stream.  */
+static void
+check_split (const char *name, rng_fn *f, uint64_t seed)
+{
+  float all[64], part[64];
+  struct arm_math_rng_state s = { seed, 0 }, t = { seed, 0 };
+  f (&s, all, 64);
+  for (int i = 0; i < 64; i += 16)
+    f (&t, part + i, 16);
+  for (int i = 0; i < 64; i++)
+    if (asuint (all[i]) != asuint (part[i]))
+      {
+	printf ("FAIL %s split out[%d] got %a want %a\n", name, i, part[i],
+		all[i]);
+	fails++;
+	return;
+      }
+}
+
+static void
+check_fn (const char *name, rng_fn *f, int normal)
+{
+  static const uint64_t seeds[] = { 0, 1, 0xffffffff, 0x123456789abcdef0 };
+  /* Include counters whose low word wraps within a call.  */
+  static const uint64_t counters[]
+      = { 0, 5, 0xfffffffc, 0xfffffffe, 0x1fffffffd, 0xfffffffffffffff0 };
+  for (size_t i = 0; i < sizeof seeds / sizeof seeds[0]; i++)
+    {
+      for (size_t j = 0; j < sizeof counters / sizeof counters[0]; j++)
+	for (size_t n = 1; n <= 64; n++)
+	  check_rng (name, f, normal, seeds[i], counters[j], n);
+      check_split (name, f, seeds[i]);
+    }
+}
+
+# if WANT_SVE_TESTS
+/* The SVE generators must return the same deviates for every vector length
+   the system supports.  */
+static void
+check_sve_vl (const char *name, rng_fn *f)
+{
+  float want[64], got[64];
+  struct arm_math_rng_state s = { 42, 7 };
+  f (&s, want, 61);
+  int vl0 = prctl (PR_SVE_GET_VL);
+  if (vl0 < 0)
+    return;
+  for (int vl = 16; vl <= 256; vl += 16)
+    {
+      int r = prctl (PR_SVE_SET_VL, vl);
+      if (r < 0 || (r & PR_SVE_VL_LEN_MASK) != vl)
+	continue;
+      struct arm_math_rng_state t = { 42, 7 };
+      f (&t, got, 61);
+      for (int i = 0; i < 61; i++)
+	if (asuint (got[i]) != asuint (want[i]))
+	  {
+	    printf ("FAIL %s vl=%d out[%d] got %a want %a\n", name, vl, i,
+		    got[i], want[i]);
+	    fails++;
+	    break;
+	  }
+    }
+  prctl (PR_SVE_SET_VL, vl0 & PR_SVE_VL_LEN_MASK);
+}
+# endif
+#endif
+
+int
+main (void)
+{
+  for (size_t i = 0; i < sizeof kat / sizeof kat[0]; i++)
+    {
+      uint32_t got[4];
+      philox (got, kat[i].ctr, kat[i].key);
+      for (int j = 0; j < 4; j++)
+	if (got[j] != kat[i].want[j])
+	  {
+	    printf ("FAIL philox4x32-10 kat %zu word %d got %08x want %08x\n",
+		    i, j, got[j], kat[i].want[j]);
+	    fails++;
+	  }
+    }
+
+#if __aarch64__ && __linux__ && WANT_EXPERIMENTAL_MATH
+  check_fn ("arm_math_advsimd_randu_f32", arm_math_advsimd_randu_f32, 0);
+  check_fn ("arm_math_advsimd_randn_f32", arm_math_advsimd_randn_f32, 1);
+# if WANT_SVE_TESTS
+  check_fn ("arm_math_sve_randu_f32", arm_math_sve_randu_f32, 0);
+  check_fn ("arm_math_sve_randn_f32", arm_math_sve_randn_f32, 1);
+  check_sve_vl ("arm_math_sve_randu_f32", arm_math_sve_randu_f32);
+  check_sve_vl ("arm_math_sve_randn_f32", arm_math_sve_randn_f32);
+# endif
+#endif
+
+  return fails != 0;
+}
@@ -23,7 +23,7 @@ t() {
     # First argument: routine name
     routine=$1; shift
     # Second and third argument: lo and hi bounds
-    # Extra processing needed for bivariate routines
+    # Extra processing needed for bivariate and trivariate routines
     IFS=',' read -ra LO <<< "$1"; shift
     IFS=',' read -ra HI <<< "$1"; shift
     ITV="${LO[0]} ${HI[0]}"
@@ -78,6 +78,45 @@ if [[ $WANT_EXPERIMENTAL_MATH -eq 1 ]] && [[ $WANT_SVE_TESTS -eq 1 ]] && [[ $USE
     fi
 fi
 
+if [[ $WANT_EXPERIMENTAL_MATH -eq 1 ]] && [[ $USE_MPFR -eq 0 ]]; then
+    # Vector variants of expf_repro must be bitwise identical to the scalar
+    # routine (see ulp_wrappers.h), including in special cases.
+    for v in advsimd sve; do
+	F=arm_math_${v}_expf_repro
+	grep -q "^$F " $ARCH_ITVS || continue
+	if [ -z "$FUNC" ] || [ "$FUNC" == "$F" ]; then
+	    for r in $rmodes; do
+		check -e 0 -r $r ${F}_vs_scalar  0  0x1.58p6 100000
+		check -e 0 -r $r ${F}_vs_scalar -0 -0x1.58p6 100000
+		check -e 0 -r $r ${F}_vs_scalar  0x1.58p6  inf 10000
+		check -e 0 -r $r ${F}_vs_scalar -0x1.58p6 -inf 10000
+	    done
+	fi
+    done
+fi
+
+# Public inline cores from arm_math_inline.h are not library routines, so have
+# no TEST_INTERVAL: check them on the domain documented in the header.
+inline_check() {
+    F=$1; L=$2; shift 2
+    [ -z "$FUNC" ] || [ "$FUNC" == "$F" ] || return 0
+    check -z -r n -e $L $F "$@"
+}
+if grep -q "^_ZGVnN4v_expf " $ARCH_ITVS; then
+    inline_check arm_math_v_expf_inline 1.49 0 87 100000
+    inline_check arm_math_v_expf_inline 1.49 -0 -87 100000
+    inline_check arm_math_v_log1pf_inline 1.20 0 0x1p127 100000
+    inline_check arm_math_v_log1pf_inline 1.20 -0 -0x1.fffffep-1 100000
+    inline_check arm_math_v_sincosf_inline_sin 1.18 -0x1p20 0x1p20 100000
+    inline_check arm_math_v_sincosf_inline_cos 1.32 -0x1p20 0x1p20 100000
+fi
+if [[ $WANT_SVE_TESTS -eq 1 ]]; then
+    inline_check arm_math_sv_expf_inline 0.9 0 87 100000
+    inline_check arm_math_sv_expf_inline 0.9 -0 -87 100000
+    inline_check arm_math_sv_log1pf_inline 0.77 0 0x1p127 100000
+    inline_check arm_math_sv_log1pf_inline 0.77 -0 -0x1.fffffep-1 100000
+fi
+
 # Test generic routines in all rounding modes
 for r in $rmodes
 do
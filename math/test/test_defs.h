@@ -16,6 +16,8 @@
 // clang-format off
 #define TEST_INTERVAL2(f, xlo, xhi, ylo, yhi, n)                            \
   TEST_INTERVAL f xlo,ylo xhi,yhi n
+#define TEST_INTERVAL3(f, xlo, xhi, ylo, yhi, zlo, zhi, n)                  \
+  TEST_INTERVAL f xlo,ylo,zlo xhi,yhi,zhi n
 // clang-format on
 
 #define TEST_CONTROL_VALUE(f, c) TEST_CONTROL_VALUE f c
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "mathlib.h"
+#include "arm_math_inline.h"
 
 #include "c23_references.h"
 
@@ -73,6 +74,8 @@ struct gen
   uint64_t len;
   uint64_t start2;
   uint64_t len2;
+  uint64_t start3;
+  uint64_t len3;
   uint64_t off;
   uint64_t step;
   uint64_t cnt;
@@ -100,6 +103,13 @@ struct args_d2
   double x2;
 };
 
+struct args_d3
+{
+  double x;
+  double x2;
+  double x3;
+};
+
 /* result = y + tail*2^ulpexp.  */
 struct ret_f
 {
@@ -141,6 +151,14 @@ next2 (uint64_t *x2, struct gen *g)
   return r;
 }
 
+static inline uint64_t
+next3 (uint64_t *x2, uint64_t *x3, struct gen *g)
+{
+  uint64_t r = next2 (x2, g);
+  *x3 = g->start3 + randn (g->len3);
+  return r;
+}
+
 static struct args_f1
 next_f1 (void *g)
 {
@@ -169,6 +187,14 @@ next_d2 (void *g)
   return (struct args_d2){asdouble (x), asdouble (x2)};
 }
 
+static struct args_d3
+next_d3 (void *g)
+{
+  uint64_t x2, x3;
+  uint64_t x = next3 (&x2, &x3, g);
+  return (struct args_d3){asdouble (x), asdouble (x2), asdouble (x3)};
+}
+
 /* A bit of a hack: call vector functions twice with the same
    input in lane 0 but a different value in other lanes: once
    with an in-range value and then with a special case value.  */
@@ -275,11 +301,13 @@ struct fun
     float (*f2) (float, float);
     double (*d1) (double);
     double (*d2) (double, double);
+    double (*d3) (double, double, double);
 #if WANT_SVE_TESTS
     float (*f1_pred) (svbool_t, float);
     float (*f2_pred) (svbool_t, float, float);
     double (*d1_pred) (svbool_t, double);
     double (*d2_pred) (svbool_t, double, double);
+    double (*d3_pred) (svbool_t, double, double, double);
 #endif
   } fun;
   union
@@ -288,6 +316,7 @@ struct fun
     double (*f2) (double, double);
     long double (*d1) (long double);
     long double (*d2) (long double, long double);
+    long double (*d3) (long double, long double, long double);
   } fun_long;
 #if USE_MPFR
   union
@@ -296,6 +325,7 @@ struct fun
     int (*f2) (mpfr_t, const mpfr_t, const mpfr_t, mpfr_rnd_t);
     int (*d1) (mpfr_t, const mpfr_t, mpfr_rnd_t);
     int (*d2) (mpfr_t, const mpfr_t, const mpfr_t, mpfr_rnd_t);
+    int (*d3) (mpfr_t, const mpfr_t, const mpfr_t, const mpfr_t, mpfr_rnd_t);
   } fun_mpfr;
 #endif
 };
@@ -399,6 +429,15 @@ call_d2 (const struct fun *f, struct args_d2 a, const struct conf *conf)
   return f->fun.d2 (a.x, a.x2);
 }
 static inline double
+call_d3 (const struct fun *f, struct args_d3 a, const struct conf *conf)
+{
+#if WANT_SVE_TESTS
+  if (f->is_predicated)
+    return f->fun.d3_pred (*conf->pg, a.x, a.x2, a.x3);
+#endif
+  return f->fun.d3 (a.x, a.x2, a.x3);
+}
+static inline double
 call_long_f1 (const struct fun *f, struct args_f1 a)
 {
   return f->fun_long.f1 (a.x);
@@ -418,6 +457,11 @@ call_long_d2 (const struct fun *f, struct args_d2 a)
 {
   return f->fun_long.d2 (a.x, a.x2);
 }
+static inline long double
+call_long_d3 (const struct fun *f, struct args_d3 a)
+{
+  return f->fun_long.d3 (a.x, a.x2, a.x3);
+}
 static inline void
 printcall_f1 (const struct fun *f, struct args_f1 a)
 {
@@ -439,6 +483,11 @@ printcall_d2 (const struct fun *f, struct args_d2 a)
   printf ("%s(%a, %a)", f->name, a.x, a.x2);
 }
 static inline void
+printcall_d3 (const struct fun *f, struct args_d3 a)
+{
+  printf ("%s(%a, %a, %a)", f->name, a.x, a.x2, a.x3);
+}
+static inline void
 printgen_f1 (const struct fun *f, struct gen *gen)
 {
   printf ("%s in [%a;%a]", f->name, asfloat (gen->start),
@@ -464,11 +513,20 @@ printgen_d2 (const struct fun *f, struct gen *gen)
 	  asdouble (gen->start + gen->len), asdouble (gen->start2),
 	  asdouble (gen->start2 + gen->len2));
 }
+static inline void
+printgen_d3 (const struct fun *f, struct gen *gen)
+{
+  printf ("%s in [%a;%a] x [%a;%a] x [%a;%a]", f->name,
+	  asdouble (gen->start), asdouble (gen->start + gen->len),
+	  asdouble (gen->start2), asdouble (gen->start2 + gen->len2),
+	  asdouble (gen->start3), asdouble (gen->start3 + gen->len3));
+}
 
 #define reduce_f1(a, f, op) (f (a.x))
 #define reduce_f2(a, f, op) (f (a.x) op f (a.x2))
 #define reduce_d1(a, f, op) (f (a.x))
 #define reduce_d2(a, f, op) (f (a.x) op f (a.x2))
+#define reduce_d3(a, f, op) (f (a.x) op f (a.x2) op f (a.x3))
 
 #ifndef IEEE_754_2008_SNAN
 # define IEEE_754_2008_SNAN 1
@@ -548,6 +606,17 @@ call_mpfr_d2 (mpfr_t y, const struct fun *f, struct args_d2 a, mpfr_rnd_t r)
   mpfr_set_d (x2, a.x2, MPFR_RNDN);
   return f->fun_mpfr.d2 (y, x, x2, r);
 }
+static inline int
+call_mpfr_d3 (mpfr_t y, const struct fun *f, struct args_d3 a, mpfr_rnd_t r)
+{
+  MPFR_DECL_INIT (x, prec_d);
+  MPFR_DECL_INIT (x2, prec_d);
+  MPFR_DECL_INIT (x3, prec_d);
+  mpfr_set_d (x, a.x, MPFR_RNDN);
+  mpfr_set_d (x2, a.x2, MPFR_RNDN);
+  mpfr_set_d (x3, a.x3, MPFR_RNDN);
+  return f->fun_mpfr.d3 (y, x, x2, x3, r);
+}
 #endif
 
 #define float_f float
@@ -592,13 +661,16 @@ call_mpfr_d2 (mpfr_t y, const struct fun *f, struct args_d2 a, mpfr_rnd_t r)
 #define T(x) x##_d2
 #include "ulp.h"
 #undef T
+#define T(x) x##_d3
+#include "ulp.h"
+#undef T
 #undef RT
 
 static void
 usage (void)
 {
   puts ("./ulp [-q] [-m] [-f] [-r {n|u|d|z}] [-l soft-ulplimit] [-e ulplimit] func "
-	"lo [hi [x lo2 hi2] [count]]");
+	"lo [hi [x lo2 hi2 [x lo3 hi3]] [count]]");
   puts ("Compares func against a higher precision implementation in [lo; hi].");
   puts ("-q: quiet.");
   puts ("-m: use mpfr even if faster method is available.");
@@ -632,6 +704,8 @@ cmp (const struct fun *f, struct gen *gen, const struct conf *conf)
     r = cmp_d1 (f, gen, conf);
   else if (f->arity == 2 && !f->singleprec)
     r = cmp_d2 (f, gen, conf);
+  else if (f->arity == 3 && !f->singleprec)
+    r = cmp_d3 (f, gen, conf);
   else
     usage ();
   return r;
@@ -694,7 +768,7 @@ parsegen (struct gen *g, int argc, char *argv[], const struct fun *f)
 {
   int singleprec = f->singleprec;
   int arity = f->arity;
-  uint64_t a, b, a2, b2, n;
+  uint64_t a, b, a2, b2, a3, b3, n;
   if (argc < 1)
     usage ();
   b = a = getnum (argv[0], singleprec);
@@ -716,6 +790,17 @@ parsegen (struct gen *g, int argc, char *argv[], const struct fun *f)
   b2 = a2 = getnum (argv[0], singleprec);
   if (argc > 1)
     b2 = getnum (argv[1], singleprec);
+  a3 = a2;
+  b3 = b2;
+  if (argc > 2 && strcmp (argv[2], "x") == 0)
+    {
+      if (argc < 5)
+	usage ();
+      a3 = getnum (argv[3], singleprec);
+      b3 = getnum (argv[4], singleprec);
+      argc -= 3;
+      argv += 3;
+    }
   if (argc > 2)
     n = strtoull (argv[2], 0, 0);
   if (argc > 3)
@@ -730,6 +815,7 @@ parsegen (struct gen *g, int argc, char *argv[], const struct fun *f)
       g->off = 0;
       g->step = n ? (g->len + 1) / n : 1;
       g->start2 = g->len2 = 0;
+      g->start3 = g->len3 = 0;
       g->cnt = n;
     }
   else if (arity == 2)
@@ -739,6 +825,18 @@ parsegen (struct gen *g, int argc, char *argv[], const struct fun *f)
       g->off = g->step = 0;
       g->start2 = a2;
       g->len2 = b2 - a2;
+      g->start3 = g->len3 = 0;
+      g->cnt = n;
+    }
+  else if (arity == 3)
+    {
+      g->start = a;
+      g->len = b - a;
+      g->off = g->step = 0;
+      g->start2 = a2;
+      g->len2 = b2 - a2;
+      g->start3 = a3;
+      g->len3 = b3 - a3;
       g->cnt = n;
     }
   else
@@ -32,6 +32,10 @@
  F (_ZGVnN2vl8_modf_int, v_modf_int, modfl_int, modf_mpfr_int, 1, 0, d1, 0)
  F (_ZGVnN2v_modf_stret_frac, v_modf_stret_frac, modfl_frac, modf_mpfr_frac, 1, 0, d1, 0)
  F (_ZGVnN2v_modf_stret_int, v_modf_stret_int, modfl_int, modf_mpfr_int, 1, 0, d1, 0)
+ F (arm_math_v_expf_inline, Z_inline_expf, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_v_log1pf_inline, Z_inline_log1pf, log1p, mpfr_log1p, 1, 1, f1, 0)
+ F (arm_math_v_sincosf_inline_sin, Z_inline_sincosf_sin, sin, mpfr_sin, 1, 1, f1, 0)
+ F (arm_math_v_sincosf_inline_cos, Z_inline_sincosf_cos, cos, mpfr_cos, 1, 1, f1, 0)
 #endif
 
 #if WANT_SVE_TESTS
@@ -51,24 +55,53 @@ SVF (_ZGVsMxvl8_modf_frac, sv_modf_frac, modfl_frac, modf_mpfr_frac, 1, 0, d1, 0
 SVF (_ZGVsMxvl8_modf_int, sv_modf_int, modfl_int, modf_mpfr_int, 1, 0, d1, 0)
 SVF (_ZGVsMxv_modf_stret_frac, sv_modf_stret_frac, modfl_frac, modf_mpfr_frac, 1, 0, d1, 0)
 SVF (_ZGVsMxv_modf_stret_int, sv_modf_stret_int, modfl_int, modf_mpfr_int, 1, 0, d1, 0)
+SVF (arm_math_sv_expf_inline, Z_sv_inline_expf, exp, mpfr_exp, 1, 1, f1, 0)
+SVF (arm_math_sv_log1pf_inline, Z_sv_inline_log1pf, log1p, mpfr_log1p, 1, 1, f1, 0)
 #endif
 
 #if WANT_EXPERIMENTAL_MATH
  F (arm_math_erff, arm_math_erff, erf, mpfr_erf, 1, 1, f1, 0)
  F (arm_math_erf,  arm_math_erf,  erfl, mpfr_erf, 1, 0, d1, 0)
+ F (arm_math_expf_repro, arm_math_expf_repro, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_exp_dd, Z_exp_dd_hi, expl, mpfr_exp, 1, 0, d1, 0)
+ F (arm_math_log_dd, Z_log_dd_hi, logl, mpfr_log, 1, 0, d1, 0)
+ F (arm_math_pow_dd, Z_pow_dd_hi, powl, mpfr_pow, 2, 0, d2, 0)
 # if __aarch64__ && __linux__
  F (arm_math_advsimd_fast_cosf, Z_fast_cosf, cos, mpfr_cos, 1, 1, f1, 0)
  F (arm_math_advsimd_fast_sinf, Z_fast_sinf, sin, mpfr_sin, 1, 1, f1, 0)
  F (arm_math_advsimd_fast_powf, Z_fast_powf, pow, mpfr_pow, 2, 1, f2, 1)
  F (arm_math_advsimd_fast_expf, Z_fast_expf, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_advsimd_expf_repro, Z_expf_repro, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_advsimd_expf_repro_vs_scalar, Z_expf_repro, ref_expf_repro, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_advsimd_powf_const_exp, Z_powf_const_exp, pow, mpfr_pow, 2, 1, f2, 1)
+ F (arm_math_advsimd_powf_const_base, Z_powf_const_base, pow, mpfr_pow, 2, 1, f2, 1)
+ F (arm_math_advsimd_pow_const_exp, Z_pow_const_exp, powl, mpfr_pow, 2, 0, d2, 0)
+ F (arm_math_advsimd_pow_const_base, Z_pow_const_base, powl, mpfr_pow, 2, 0, d2, 0)
+ F (arm_math_advsimd_expf_array, Z_expf_array, exp, mpfr_exp, 1, 1, f1, 1)
+ F (arm_math_advsimd_log1pf_array, Z_log1pf_array, log1p, mpfr_log1p, 1, 1, f1, 1)
+ F (arm_math_advsimd_expf_array_inplace, Z_expf_array_inplace, exp, mpfr_exp, 1, 1, f1, 1)
+ F (arm_math_advsimd_log1pf_array_inplace, Z_log1pf_array_inplace, log1p, mpfr_log1p, 1, 1, f1, 1)
+ F (arm_math_advsimd_expf_x2, Z_expf_x2, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_advsimd_exp_x2, Z_exp_x2, expl, mpfr_exp, 1, 0, d1, 0)
+ F (arm_math_advsimd_exp_dd, Z_exp_dd, expl, mpfr_exp, 1, 0, d1, 0)
+ F (arm_math_advsimd_log_dd, Z_log_dd, logl, mpfr_log, 1, 0, d1, 0)
+ F (arm_math_advsimd_pow_dd, Z_pow_dd, powl, mpfr_pow, 2, 0, d2, 0)
+ F (_ZGVnN2vvv_betainc, Z_betainc, betaincl, mpfr_betainc, 3, 0, d3, 0)
 # endif
 # if WANT_SVE_TESTS
  SVF (arm_math_sve_fast_cosf, Z_sv_fast_cosf, cos, mpfr_cos, 1, 1, f1, 0)
  SVF (arm_math_sve_fast_sinf, Z_sv_fast_sinf, sin, mpfr_sin, 1, 1, f1, 0)
  SVF (arm_math_sve_fast_powf, Z_sv_fast_powf, pow, mpfr_pow, 2, 1, f2, 0)
  SVF (arm_math_sve_fast_expf, Z_sv_fast_expf, exp, mpfr_exp, 1, 1, f1, 0)
+ SVF (arm_math_sve_expf_repro, Z_sv_expf_repro, exp, mpfr_exp, 1, 1, f1, 0)
+ SVF (arm_math_sve_expf_repro_vs_scalar, Z_sv_expf_repro, ref_expf_repro, mpfr_exp, 1, 1, f1, 0)
  SVF (_ZGVsMxvv_powk, Z_sv_powk, ref_powi, wrap_mpfr_powi, 2, 0, d2, 0)
  SVF (_ZGVsMxvv_powi, Z_sv_powi, ref_powif, wrap_mpfr_powi, 2, 1, f2, 0)
+ SVF (_ZGVsMxvvv_betainc, Z_sv_betainc, betaincl, mpfr_betainc, 3, 0, d3, 0)
+#  if __ARM_FEATURE_SME
+ F (arm_math_sve_sc_expf, Z_sme_sc_expf, exp, mpfr_exp, 1, 1, f1, 0)
+ F (arm_math_sve_sc_tanhf, Z_sme_sc_tanhf, tanh, mpfr_tanh, 1, 1, f1, 0)
+#  endif
 # endif
 #endif
 
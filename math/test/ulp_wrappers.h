@@ -170,6 +170,269 @@ static int wrap_mpfr_powi(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t
   mpfr_trunc(y2, y);
   return mpfr_pow(ret, x, y2, rnd);
 }
+
+/* MPFR has no trigamma: shift x up to at least 64 and use the asymptotic
+   expansion, with reflection for x < 0.  The truncation error is below
+   2^-150 relative.  */
+static int mpfr_trigamma (mpfr_t ret, const mpfr_t arg, mpfr_rnd_t rnd) {
+  static const double b2k_num[] = { 1, -1, 1, -1, 5, -691, 7, -3617, 43867,
+    -174611, 854513, -236364091, 8553103, -23749461029.0, 8615841276005.0 };
+  static const unsigned long b2k_den[] = { 6, 30, 42, 30, 66, 2730, 6, 510,
+    798, 330, 138, 2730, 6, 870, 14322 };
+  if (mpfr_nan_p (arg) || (mpfr_inf_p (arg) && mpfr_sgn (arg) < 0)) {
+    mpfr_set_nan (ret);
+    return 0;
+  }
+  if (mpfr_inf_p (arg)) {
+    mpfr_set_zero (ret, 1);
+    return 0;
+  }
+  if (mpfr_sgn (arg) <= 0 && mpfr_integer_p (arg)) {
+    mpfr_set_inf (ret, 1);
+    return 0;
+  }
+  MPFR_DECL_INIT (x, 1080);
+  MPFR_DECL_INIT (s, 1080);
+  MPFR_DECL_INIT (t, 1080);
+  MPFR_DECL_INIT (z, 1080);
+  MPFR_DECL_INIT (p, 1080);
+  int neg = mpfr_sgn (arg) < 0;
+  if (neg)
+    mpfr_ui_sub (x, 1, arg, rnd);
+  else
+    mpfr_set (x, arg, rnd);
+  mpfr_set_zero (s, 1);
+  for (; mpfr_cmp_ui (x, 64) < 0; mpfr_add_ui (x, x, 1, rnd)) {
+    mpfr_sqr (t, x, rnd);
+    mpfr_ui_div (t, 1, t, rnd);
+    mpfr_add (s, s, t, rnd);
+  }
+  /* trigamma(x) ~ 1/x + 1/(2x^2) + sum_k B_2k / x^(2k+1).  */
+  mpfr_sqr (z, x, rnd);
+  mpfr_ui_div (z, 1, z, rnd);
+  mpfr_set_zero (p, 1);
+  for (int k = 14; k >= 0; k--) {
+    mpfr_mul (p, p, z, rnd);
+    mpfr_set_d (t, b2k_num[k], rnd);
+    mpfr_div_ui (t, t, b2k_den[k], rnd);
+    mpfr_add (p, p, t, rnd);
+  }
+  mpfr_mul (p, p, z, rnd);
+  mpfr_div (p, p, x, rnd);
+  mpfr_div_ui (t, z, 2, rnd);
+  mpfr_add (p, p, t, rnd);
+  mpfr_ui_div (t, 1, x, rnd);
+  mpfr_add (p, p, t, rnd);
+  mpfr_add (s, s, p, rnd);
+  if (!neg)
+    return mpfr_set (ret, s, rnd);
+  /* pi^2 / sin^2(pi x) - trigamma(1 - x).  */
+  mpfr_sinpi (t, arg, rnd);
+  mpfr_sqr (t, t, rnd);
+  mpfr_const_pi (p, rnd);
+  mpfr_sqr (p, p, rnd);
+  mpfr_div (p, p, t, rnd);
+  return mpfr_sub (ret, p, s, rnd);
+}
+
+/* Regularized incomplete gamma functions, mpfr_gamma_inc is the unregularized
+   upper one.  P uses the power series below x = a + 1, where 1 - Q would
+   cancel, and is finite and positive or special otherwise.  */
+static int gammainc_special (mpfr_t ret, const mpfr_t a, const mpfr_t x,
+			     int upper) {
+  if (mpfr_nan_p (a) || mpfr_nan_p (x) || mpfr_sgn (a) <= 0
+      || mpfr_sgn (x) < 0 || (mpfr_inf_p (a) && mpfr_inf_p (x))) {
+    mpfr_set_nan (ret);
+    return 1;
+  }
+  if (mpfr_zero_p (x) || mpfr_inf_p (x) || mpfr_inf_p (a)) {
+    mpfr_set_ui (ret, mpfr_inf_p (x) ? !upper : upper, MPFR_RNDN);
+    return 1;
+  }
+  return 0;
+}
+
+static int mpfr_gammaincc (mpfr_t ret, const mpfr_t a, const mpfr_t x,
+			   mpfr_rnd_t rnd) {
+  if (gammainc_special (ret, a, x, 1))
+    return 0;
+  MPFR_DECL_INIT (q, 256);
+  MPFR_DECL_INIT (g, 256);
+  mpfr_gamma_inc (q, a, x, rnd);
+  mpfr_gamma (g, a, rnd);
+  return mpfr_div (ret, q, g, rnd);
+}
+
+static int mpfr_gammainc (mpfr_t ret, const mpfr_t a, const mpfr_t x,
+			  mpfr_rnd_t rnd) {
+  if (gammainc_special (ret, a, x, 0))
+    return 0;
+  MPFR_DECL_INIT (s, 256);
+  MPFR_DECL_INIT (t, 256);
+  MPFR_DECL_INIT (c, 256);
+  mpfr_add_ui (c, a, 1, rnd);
+  if (mpfr_cmp (x, c) >= 0) {
+    mpfr_gammaincc (s, a, x, rnd);
+    return mpfr_ui_sub (ret, 1, s, rnd);
+  }
+  /* P = x^a e^-x / Gamma(a + 1) sum_n x^n / ((a + 1) ... (a + n)).  */
+  mpfr_set_ui (s, 1, rnd);
+  mpfr_set_ui (t, 1, rnd);
+  do {
+    mpfr_mul (t, t, x, rnd);
+    mpfr_div (t, t, c, rnd);
+    mpfr_add (s, s, t, rnd);
+    mpfr_add_ui (c, c, 1, rnd);
+  } while (mpfr_get_exp (t) > mpfr_get_exp (s) - 260);
+  mpfr_log (t, x, rnd);
+  mpfr_mul (t, t, a, rnd);
+  mpfr_sub (t, t, x, rnd);
+  mpfr_add_ui (c, a, 1, rnd);
+  MPFR_DECL_INIT (l, 256);
+  int sign;
+  mpfr_lgamma (l, &sign, c, rnd);
+  mpfr_sub (t, t, l, rnd);
+  mpfr_exp (t, t, rnd);
+  return mpfr_mul (ret, s, t, rnd);
+}
+
+/* Regularized incomplete beta function, evaluated as betaincl below.  */
+static void mpfr_betainc_cf (mpfr_t ret, const mpfr_t a, const mpfr_t b,
+			     const mpfr_t x, mpfr_rnd_t rnd) {
+  MPFR_DECL_INIT (c, 256);
+  MPFR_DECL_INIT (d, 256);
+  MPFR_DECL_INIT (h, 256);
+  MPFR_DECL_INIT (an, 256);
+  MPFR_DECL_INIT (t, 256);
+  MPFR_DECL_INIT (u, 256);
+  /* d = 1 / (1 - (a + b) x / (a + 1)), c = 1.  */
+  mpfr_add (t, a, b, rnd);
+  mpfr_mul (t, t, x, rnd);
+  mpfr_add_ui (u, a, 1, rnd);
+  mpfr_div (t, t, u, rnd);
+  mpfr_ui_sub (d, 1, t, rnd);
+  mpfr_ui_div (d, 1, d, rnd);
+  mpfr_set (h, d, rnd);
+  mpfr_set_ui (c, 1, rnd);
+  for (unsigned long m = 1; m < 100000; m++) {
+    for (int odd = 0; odd < 2; odd++) {
+      if (!odd) {
+	/* m (b - m) x / ((a + 2m - 1) (a + 2m)).  */
+	mpfr_sub_ui (an, b, m, rnd);
+	mpfr_mul_ui (an, an, m, rnd);
+	mpfr_add_ui (t, a, 2 * m - 1, rnd);
+	mpfr_add_ui (u, a, 2 * m, rnd);
+      } else {
+	/* -(a + m) (a + b + m) x / ((a + 2m) (a + 2m + 1)).  */
+	mpfr_add_ui (an, a, m, rnd);
+	mpfr_add (t, a, b, rnd);
+	mpfr_add_ui (t, t, m, rnd);
+	mpfr_mul (an, an, t, rnd);
+	mpfr_neg (an, an, rnd);
+	mpfr_add_ui (t, a, 2 * m, rnd);
+	mpfr_add_ui (u, a, 2 * m + 1, rnd);
+      }
+      mpfr_mul (an, an, x, rnd);
+      mpfr_mul (t, t, u, rnd);
+      mpfr_div (an, an, t, rnd);
+      mpfr_mul (d, d, an, rnd);
+      mpfr_add_ui (d, d, 1, rnd);
+      mpfr_ui_div (d, 1, d, rnd);
+      mpfr_div (c, an, c, rnd);
+      mpfr_add_ui (c, c, 1, rnd);
+      mpfr_mul (t, d, c, rnd);
+      mpfr_mul (h, h, t, rnd);
+    }
+    mpfr_sub_ui (t, t, 1, rnd);
+    if (mpfr_zero_p (t) || mpfr_get_exp (t) < -250)
+      break;
+  }
+  /* x^a (1 - x)^b / (a B(a, b)).  */
+  int sign;
+  mpfr_log (t, x, rnd);
+  mpfr_mul (t, t, a, rnd);
+  mpfr_ui_sub (u, 1, x, rnd);
+  mpfr_log (u, u, rnd);
+  mpfr_mul (u, u, b, rnd);
+  mpfr_add (t, t, u, rnd);
+  mpfr_lgamma (u, &sign, a, rnd);
+  mpfr_sub (t, t, u, rnd);
+  mpfr_lgamma (u, &sign, b, rnd);
+  mpfr_sub (t, t, u, rnd);
+  mpfr_add (u, a, b, rnd);
+  mpfr_lgamma (u, &sign, u, rnd);
+  mpfr_add (t, t, u, rnd);
+  mpfr_exp (t, t, rnd);
+  mpfr_div (t, t, a, rnd);
+  mpfr_mul (ret, t, h, rnd);
+}
+
+static int mpfr_betainc (mpfr_t ret, const mpfr_t a, const mpfr_t b,
+			 const mpfr_t x, mpfr_rnd_t rnd) {
+  if (mpfr_nan_p (a) || mpfr_nan_p (b) || mpfr_nan_p (x) || mpfr_sgn (a) <= 0
+      || mpfr_sgn (b) <= 0 || mpfr_inf_p (a) || mpfr_inf_p (b)
+      || mpfr_sgn (x) < 0 || mpfr_cmp_ui (x, 1) > 0) {
+    mpfr_set_nan (ret);
+    return 0;
+  }
+  if (mpfr_zero_p (x) || mpfr_cmp_ui (x, 1) == 0)
+    return mpfr_set (ret, x, rnd);
+  MPFR_DECL_INIT (s, 256);
+  MPFR_DECL_INIT (t, 256);
+  MPFR_DECL_INIT (y, 256);
+  /* Swap above x = (a + 1) / (a + b + 2).  */
+  mpfr_add (t, a, b, rnd);
+  mpfr_add_ui (t, t, 2, rnd);
+  mpfr_mul (t, t, x, rnd);
+  mpfr_add_ui (s, a, 1, rnd);
+  if (mpfr_cmp (t, s) <= 0) {
+    mpfr_betainc_cf (s, a, b, x, rnd);
+    return mpfr_set (ret, s, rnd);
+  }
+  mpfr_ui_sub (y, 1, x, rnd);
+  mpfr_betainc_cf (s, b, a, y, rnd);
+  return mpfr_ui_sub (ret, 1, s, rnd);
+}
+
+/* Log-domain sums, evaluated as in the long double references below.  */
+static int mpfr_log1mexp (mpfr_t ret, const mpfr_t x, mpfr_rnd_t rnd) {
+  MPFR_DECL_INIT (t, 1080);
+  mpfr_expm1 (t, x, rnd);
+  mpfr_neg (t, t, rnd);
+  return mpfr_log (ret, t, rnd);
+}
+
+static int mpfr_log1pexp (mpfr_t ret, const mpfr_t x, mpfr_rnd_t rnd) {
+  MPFR_DECL_INIT (t, 1080);
+  mpfr_exp (t, x, rnd);
+  return mpfr_log1p (ret, t, rnd);
+}
+
+static int mpfr_logaddexp (mpfr_t ret, const mpfr_t x, const mpfr_t y,
+			   mpfr_rnd_t rnd) {
+  if (mpfr_nan_p (x) || mpfr_nan_p (y)) {
+    mpfr_set_nan (ret);
+    return 0;
+  }
+  int xmax = mpfr_cmp (x, y) > 0;
+  mpfr_srcptr m = xmax ? x : y, n = xmax ? y : x;
+  if (mpfr_inf_p (m))
+    return mpfr_set (ret, m, rnd);
+  MPFR_DECL_INIT (t, 1080);
+  mpfr_sub (t, n, m, rnd);
+  mpfr_log1pexp (t, t, rnd);
+  return mpfr_add (ret, t, m, rnd);
+}
+
+static int mpfr_logsubexp (mpfr_t ret, const mpfr_t x, const mpfr_t y,
+			   mpfr_rnd_t rnd) {
+  if (mpfr_inf_p (y) && mpfr_sgn (y) < 0 && !mpfr_nan_p (x))
+    return mpfr_set (ret, x, rnd);
+  MPFR_DECL_INIT (t, 1080);
+  mpfr_sub (t, y, x, rnd);
+  mpfr_log1mexp (t, t, rnd);
+  return mpfr_add (ret, t, x, rnd);
+}
 # endif
 #endif
 
@@ -188,17 +451,392 @@ cr_exp (double x)
   return exp (x);
 }
 
+#if WANT_EXPERIMENTAL_MATH
+/* Vector variants of expf_repro are checked for bitwise reproducibility
+   against the scalar routine rather than against exp.  */
+static double __attribute__ ((unused))
+ref_expf_repro (double x)
+{
+  return arm_math_expf_repro ((float) x);
+}
+
+/* Reference digamma and trigamma: shift x up to at least 24 and use the
+   asymptotic expansions, with reflection for x < 0 and a Taylor expansion
+   around the positive zero of digamma.  */
+static const long double polygamma_b2k[] = {
+  1.0L / 6, -1.0L / 30, 1.0L / 42, -1.0L / 30, 5.0L / 66, -691.0L / 2730,
+  7.0L / 6, -3617.0L / 510, 43867.0L / 798, -174611.0L / 330,
+  854513.0L / 138, -236364091.0L / 2730, 8553103.0L / 6,
+  -23749461029.0L / 870, 8615841276005.0L / 14322
+};
+static const long double digamma_x0_hi = 0x1.762d86356be3fp+0L;
+static const long double digamma_x0_lo = 9.549995429965697715184199e-17L;
+static const long double digamma_x0_taylor[] = {
+  0.9676722454476211704274448L, -0.4427631689835921060928653L,
+  0.2584997609556510106244014L, -0.1639427054424065275042513L,
+  0.1078240506912623657571829L, -0.07219956125645471092612178L,
+  0.04880428816414310722509253L, -0.0331611264748473592922584L,
+  0.02259764823221810465962483L, -0.01542476590494895913880032L,
+  0.01053879161661217538812405L, -0.007204534386356868240970474L,
+  0.004926781395729853446354266L, -0.003369801655439328082792857L,
+  0.00230512632673492783693838L, -0.001576936771430197259270935L,
+  0.001078825201916296580691918L, -0.0007380709389960051295660474L,
+  0.0005049532658346020351773982L, -0.000345468025106307699555568L
+};
+static const long double polygamma_pi = 3.141592653589793238462643383279503L;
+
+static long double __attribute__ ((unused))
+digammal (long double x)
+{
+  if (isnan (x) || x == INFINITY)
+    return x;
+  if (x == 0)
+    return -1 / x;
+  if (x < 0)
+    {
+      if (x == floorl (x))
+	return NAN;
+      long double r = x - rintl (x);
+      return digammal (1 - x)
+	     - polygamma_pi * cosl (polygamma_pi * r) / sinl (polygamma_pi * r);
+    }
+  long double d = (x - digamma_x0_hi) - digamma_x0_lo;
+  if (fabsl (d) < 0.125L)
+    {
+      long double p = 0;
+      for (int k = 19; k >= 0; k--)
+	p = p * d + digamma_x0_taylor[k];
+      return p * d;
+    }
+  long double s = 0;
+  for (; x < 24; x++)
+    s -= 1 / x;
+  long double z = 1 / (x * x), p = 0;
+  for (int k = 14; k >= 0; k--)
+    p = p * z + polygamma_b2k[k] / (2 * k + 2);
+  return s + logl (x) - 0.5L / x - p * z;
+}
+
+static long double __attribute__ ((unused))
+trigammal (long double x)
+{
+  if (isnan (x) || x == INFINITY)
+    return isnan (x) ? x : 0;
+  if (x <= 0)
+    {
+      if (x == floorl (x))
+	return x == -INFINITY ? NAN : INFINITY;
+      long double s = sinl (polygamma_pi * (x - rintl (x)));
+      return polygamma_pi * polygamma_pi / (s * s) - trigammal (1 - x);
+    }
+  long double s = 0;
+  for (; x < 24; x++)
+    s += 1 / (x * x);
+  long double z = 1 / (x * x), p = 0;
+  for (int k = 14; k >= 0; k--)
+    p = p * z + polygamma_b2k[k];
+  return s + 1 / x + 0.5L * z + p * z / x;
+}
+
+static double __attribute__ ((unused))
+digamma (double x)
+{
+  return digammal (x);
+}
+
+static double __attribute__ ((unused))
+trigamma (double x)
+{
+  return trigammal (x);
+}
+
+/* Reference regularized incomplete gamma functions.  The power series for P
+   is used for x < a + 1, Legendre's continued fraction for Q otherwise, and
+   for a < 1 and x < 2 the alternating series
+   Q = -expm1(E) + e^E a sum_{n>=1} -(-x)^n / (n! (a + n)),
+   E = a log(x) - lgamma(1 + a), so that Q does not cancel for small a.  */
+static long double
+gammainc_lgamma1pl (long double a)
+{
+  /* u = 1 + a is rounded, correct with the derivative of lgamma at u.  */
+  long double u = 1 + a, du = a - (u - 1);
+  return lgammal (u)
+	 + du * (-0.5772156649015328606065121L
+		 + polygamma_pi * polygamma_pi / 6 * (u - 1));
+}
+
+/* x^a e^-x / Gamma(a).  For a >= 10 it is computed relative to the maximum
+   at x = a, using Stirling's series for Gamma(a), to avoid the large
+   rounding errors of a log(x) - x - lgamma(a).  */
+static long double
+gammainc_prefl (long double a, long double x)
+{
+  if (a < 10)
+    return expl (a * logl (x) - x - lgammal (a));
+  long double d = x - a, z = 1 / (a * a), corr = 0;
+  for (int k = 14; k >= 0; k--)
+    corr = corr * z + polygamma_b2k[k] / ((2 * k + 2) * (2 * k + 1));
+  corr /= a;
+  long double l = fabsl (d) < a / 2 ? log1pl (d / a) : logl (x / a);
+  return expl (a * l - d - corr) * sqrtl (a / (2 * polygamma_pi));
+}
+
+static long double
+gammainc_refl (long double a, long double x, int upper)
+{
+  if (isnan (a) || isnan (x) || a <= 0 || x < 0
+      || (a == INFINITY && x == INFINITY))
+    return NAN;
+  if (x == 0 || x == INFINITY || a == INFINITY)
+    return (x == INFINITY) != upper;
+  if (a < 1 && x < 2)
+    {
+      long double e = a * logl (x) - gammainc_lgamma1pl (a);
+      long double un = 1, t = 0;
+      for (int n = 1; n < 60; n++)
+	{
+	  un *= -x / n;
+	  t -= un / (a + n);
+	}
+      t *= a;
+      return upper ? -expm1l (e) + expl (e) * t : expl (e) * (1 - t);
+    }
+  if (x < a + 1)
+    {
+      long double t = 1, s = 1;
+      for (int n = 1; n < 100000 && t > s * 0x1p-70L; n++)
+	{
+	  t *= x / (a + n);
+	  s += t;
+	}
+      long double p = gammainc_prefl (a, x) / a * s;
+      return upper ? 1 - p : p;
+    }
+  /* Lentz's algorithm.  */
+  long double b = x + 1 - a, c = 0x1p1000L, d = 1 / b, h = d;
+  for (int i = 1; i < 100000; i++)
+    {
+      long double an = -i * (i - a);
+      b += 2;
+      d = 1 / (an * d + b);
+      c = b + an / c;
+      h *= d * c;
+      if (fabsl (d * c - 1) < 0x1p-70L)
+	break;
+    }
+  long double q = gammainc_prefl (a, x) * h;
+  return upper ? q : 1 - q;
+}
+
+static long double __attribute__ ((unused))
+gammaincl (long double a, long double x)
+{
+  return gammainc_refl (a, x, 0);
+}
+
+static long double __attribute__ ((unused))
+gammainccl (long double a, long double x)
+{
+  return gammainc_refl (a, x, 1);
+}
+
+/* Reference regularized incomplete beta function: Lentz's algorithm for the
+   usual continued fraction below x = (a + 1) / (a + b + 2), where it
+   converges quickly, and I_x(a, b) = 1 - I_1-x(b, a) above.  The vector
+   routines are only tested on AArch64, where long double is binary128 and
+   the rounding errors of the lgammal terms are negligible even for large
+   a and b.  */
+static long double
+betainc_cfl (long double a, long double b, long double x)
+{
+  long double tiny = 0x1p-1000L;
+  long double c = 1, d = 1 - (a + b) * x / (a + 1);
+  d = 1 / (fabsl (d) < tiny ? tiny : d);
+  long double h = d;
+  for (int m = 1; m < 100000; m++)
+    {
+      long double m2 = 2 * m;
+      long double an = m * (b - m) * x / ((a + m2 - 1) * (a + m2));
+      d = 1 + an * d;
+      d = 1 / (fabsl (d) < tiny ? tiny : d);
+      c = 1 + an / c;
+      c = fabsl (c) < tiny ? tiny : c;
+      h *= d * c;
+      an = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1));
+      d = 1 + an * d;
+      d = 1 / (fabsl (d) < tiny ? tiny : d);
+      c = 1 + an / c;
+      c = fabsl (c) < tiny ? tiny : c;
+      h *= d * c;
+      if (fabsl (d * c - 1) < LDBL_EPSILON)
+	break;
+    }
+  long double e = a * logl (x) + b * log1pl (-x) - lgammal (a) - lgammal (b)
+		  + lgammal (a + b);
+  return expl (e) / a * h;
+}
+
+static long double __attribute__ ((unused))
+betaincl (long double a, long double b, long double x)
+{
+  if (isnan (a) || isnan (b) || isnan (x) || a <= 0 || b <= 0
+      || a == INFINITY || b == INFINITY || x < 0 || x > 1)
+    return NAN;
+  if (x == 0 || x == 1)
+    return x;
+  if (x > (a + 1) / (a + b + 2))
+    return 1 - betainc_cfl (b, a, 1 - x);
+  return betainc_cfl (a, b, x);
+}
+
+/* Reference log-domain sums: log1p and expm1 avoid the cancellation in
+   1 +- e^x.  */
+static long double
+log1mexpl (long double x)
+{
+  if (x > -0x1.62e42fefa39ef358p-1L)
+    return logl (-expm1l (x));
+  return log1pl (-expl (x));
+}
+
+static long double
+log1pexpl (long double x)
+{
+  if (x > 0)
+    return x + log1pl (expl (-x));
+  return log1pl (expl (x));
+}
+
+static long double __attribute__ ((unused))
+logaddexpl (long double x, long double y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  long double m = x > y ? x : y;
+  if (isinf (m))
+    return m;
+  return m + log1pexpl ((x > y ? y : x) - m);
+}
+
+static long double __attribute__ ((unused))
+logsubexpl (long double x, long double y)
+{
+  if (isnan (x) || isnan (y))
+    return x + y;
+  if (y == -INFINITY)
+    return x;
+  return x + log1mexpl (y - x);
+}
+
+static double __attribute__ ((unused))
+logaddexp (double x, double y)
+{
+  return logaddexpl (x, y);
+}
+
+static double __attribute__ ((unused))
+logsubexp (double x, double y)
+{
+  return logsubexpl (x, y);
+}
+
+static double __attribute__ ((unused))
+log1pexp (double x)
+{
+  return log1pexpl (x);
+}
+
+static double __attribute__ ((unused))
+log1mexp (double x)
+{
+  return log1mexpl (x);
+}
+
+/* Only the high part of the double-double result is checked.  */
+static double
+Z_exp_dd_hi (double x)
+{
+  double t;
+  return arm_math_exp_dd (x, &t);
+}
+
+static double
+Z_log_dd_hi (double x)
+{
+  double t;
+  return arm_math_log_dd (x, &t);
+}
+
+static double
+Z_pow_dd_hi (double x, double y)
+{
+  double t;
+  return arm_math_pow_dd (x, y, &t);
+}
+#endif
+
 /* Wrappers for vector functions.  */
 #if __aarch64__ && __linux__
 static float Z_expf_1u(float x) { return _ZGVnN4v_expf_1u(argf(x))[0]; }
 static float Z_exp2f_1u(float x) { return _ZGVnN4v_exp2f_1u(argf(x))[0]; }
 static float Z_lgammaf(float x) { return _ZGVnN4v_lgammaf(argf(x))[0]; }
 static double Z_lgamma(double x) { return _ZGVnN2v_lgamma(argd(x))[0]; }
+static float Z_inline_expf(float x) { return arm_math_v_expf_inline(argf(x), &arm_math_v_expf_data)[0]; }
+static float Z_inline_log1pf(float x) { return arm_math_v_log1pf_inline(argf(x), &arm_math_v_log1pf_data)[0]; }
+static float Z_inline_sincosf_sin(float x) { return arm_math_v_sincosf_inline(argf(x), &arm_math_v_sincosf_data).val[0][0]; }
+static float Z_inline_sincosf_cos(float x) { return arm_math_v_sincosf_inline(argf(x), &arm_math_v_sincosf_data).val[1][0]; }
 # if WANT_EXPERIMENTAL_MATH
 static float Z_fast_cosf(float x) { return arm_math_advsimd_fast_cosf(argf(x))[0]; }
 static float Z_fast_sinf(float x) { return arm_math_advsimd_fast_sinf(argf(x))[0]; }
 static float Z_fast_powf(float x, float y) { return arm_math_advsimd_fast_powf(argf(x), argf(y))[0]; }
 static float Z_fast_expf(float x) { return arm_math_advsimd_fast_expf(argf(x))[0]; }
+static float Z_expf_repro(float x) { return arm_math_advsimd_expf_repro(argf(x))[0]; }
+/* Array routines are checked on every element: arrays span two vectors and
+   a scalar tail, x moves to the next position on each new input and the
+   other elements are fv[secondcall] or dv[secondcall].  Return the position
+   of x.  The double pow_const routines are only called once: a lane that
+   sends v_exp_inline to its scalar fallback changes the rounding of the
+   other lane, as in _ZGVnN2vv_pow.  */
+#define ARRAY_NF 11
+#define ARRAY_ND 5
+static int
+array_pos (int n)
+{
+  static int pos;
+  if (!secondcall)
+    pos = (pos + 1) % n;
+  return pos;
+}
+static int
+array_argf (float *a, float x)
+{
+  int k = array_pos (ARRAY_NF);
+  for (int i = 0; i < ARRAY_NF; i++)
+    a[i] = i == k ? x : fv[secondcall];
+  return k;
+}
+static int
+array_argd (double *a, double x)
+{
+  int k = array_pos (ARRAY_ND);
+  for (int i = 0; i < ARRAY_ND; i++)
+    a[i] = i == k ? x : dv[secondcall];
+  return k;
+}
+static float Z_powf_const_exp(float x, float y) { float in[ARRAY_NF], out[ARRAY_NF]; int k = array_argf(in, x); arm_math_advsimd_powf_const_exp(in, y, out, ARRAY_NF); return out[k]; }
+static float Z_powf_const_base(float x, float y) { float in[ARRAY_NF], out[ARRAY_NF]; int k = array_argf(in, y); arm_math_advsimd_powf_const_base(x, in, out, ARRAY_NF); return out[k]; }
+static double Z_pow_const_exp(double x, double y) { double in[ARRAY_ND], out[ARRAY_ND]; int k = array_argd(in, x); arm_math_advsimd_pow_const_exp(in, y, out, ARRAY_ND); return out[k]; }
+static double Z_pow_const_base(double x, double y) { double in[ARRAY_ND], out[ARRAY_ND]; int k = array_argd(in, y); arm_math_advsimd_pow_const_base(x, in, out, ARRAY_ND); return out[k]; }
+static float Z_expf_array(float x) { float in[ARRAY_NF], out[ARRAY_NF]; int k = array_argf(in, x); arm_math_advsimd_expf_array(in, out, ARRAY_NF); return out[k]; }
+static float Z_log1pf_array(float x) { float in[ARRAY_NF], out[ARRAY_NF]; int k = array_argf(in, x); arm_math_advsimd_log1pf_array(in, out, ARRAY_NF); return out[k]; }
+static float Z_expf_array_inplace(float x) { float io[ARRAY_NF]; int k = array_argf(io, x); arm_math_advsimd_expf_array(io, io, ARRAY_NF); return io[k]; }
+static float Z_log1pf_array_inplace(float x) { float io[ARRAY_NF]; int k = array_argf(io, x); arm_math_advsimd_log1pf_array(io, io, ARRAY_NF); return io[k]; }
+static float Z_expf_x2(float x) { float32x4x2_t v = {{argf(x), argf(x)}}; return arm_math_advsimd_expf_x2(v).val[1][0]; }
+static double Z_exp_x2(double x) { float64x2x2_t v = {{argd(x), argd(x)}}; return arm_math_advsimd_exp_x2(v).val[1][0]; }
+static double Z_exp_dd(double x) { return arm_math_advsimd_exp_dd(argd(x)).val[0][0]; }
+static double Z_log_dd(double x) { return arm_math_advsimd_log_dd(argd(x)).val[0][0]; }
+static double Z_pow_dd(double x, double y) { return arm_math_advsimd_pow_dd(argd(x), argd(y)).val[0][0]; }
+static double Z_betainc(double a, double b, double x) { return _ZGVnN2vvv_betainc(argd(a), argd(b), argd(x))[0]; }
 # endif
 #endif
 
@@ -630,6 +1268,21 @@ sv_modf_stret_int (svbool_t pg, double x)
   return svretd (svget2 (_ZGVsMxv_modf_stret (svdup_f64 (x), pg), 1), pg);
 }
 
+static float
+Z_sv_inline_expf (svbool_t pg, float x)
+{
+  return svretf (
+      arm_math_sv_expf_inline (svargf (x), pg, &arm_math_sv_expf_data), pg);
+}
+
+static float
+Z_sv_inline_log1pf (svbool_t pg, float x)
+{
+  return svretf (
+      arm_math_sv_log1pf_inline (svargf (x), pg, &arm_math_sv_log1pf_data),
+      pg);
+}
+
 # if WANT_EXPERIMENTAL_MATH
 
 static float
@@ -656,6 +1309,32 @@ Z_sv_fast_expf (svbool_t pg, float x)
   return svretf (arm_math_sve_fast_expf (svargf (x), pg), pg);
 }
 
+static float
+Z_sv_expf_repro (svbool_t pg, float x)
+{
+  return svretf (arm_math_sve_expf_repro (svargf (x), pg), pg);
+}
+
+#  if __ARM_FEATURE_SME
+/* Streaming-compatible routines are checked in streaming mode.  Vectors
+   cannot be passed across the mode switch (the streaming vector length may
+   differ), so these wrappers take and return scalars and only use
+   intrinsics in streaming mode.  */
+__arm_locally_streaming static float
+Z_sme_sc_expf (float x)
+{
+  svbool_t pg = svptrue_b32 ();
+  return svlasta (svpfalse (), arm_math_sve_sc_expf (svdup_f32 (x), pg));
+}
+
+__arm_locally_streaming static float
+Z_sme_sc_tanhf (float x)
+{
+  svbool_t pg = svptrue_b32 ();
+  return svlasta (svpfalse (), arm_math_sve_sc_tanhf (svdup_f32 (x), pg));
+}
+#  endif
+
 /* Our implementations of powi/powk are too imprecise to verify
    against any established pow implementation. Instead we have the
    following simple implementation, against which it is enough to
@@ -703,6 +1382,13 @@ Z_sv_powk (svbool_t pg, double x, double y)
 		 pg);
 }
 
+static double
+Z_sv_betainc (svbool_t pg, double a, double b, double x)
+{
+  return svretd (_ZGVsMxvvv_betainc (svargd (a), svargd (b), svargd (x), pg),
+		 pg);
+}
+
 # endif // WANT_EXPERIMENTAL_MATH
 #endif	// WANT_SVE_TESTS
 
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+
+# Coefficient generator for the vector Bessel functions j0, j1, y0 and y1.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Fits, in the Chebyshev nodes of each interval, the polynomials used by
+# aarch64/experimental/{advsimd,sve}/*bessel*_common.h and the j0/j1/y0/y1
+# routines, and prints them as C hex float literals:
+#
+#  - small: J0(x) = (x^2 - z^2) P(x^2), J1(x) = (x^2 - z^2) x P(x^2) with z
+#    the first positive zero, the even (odd) analytic parts U of Y0 (Y1) after
+#    removing the log(x) J (and 1/x) singular terms, and Y(x) = t G(t) with
+#    t = x - y1 around the first zero of Y0 and Y1.
+#  - mid (double only): one polynomial per unit interval of [2, 8), with the
+#    closest zero z factored out, F(x) = t Q(t), t = x - z.
+#  - asym: amplitude m(v) = sqrt(x) M(x) and phase h(v) = x phi(x) of the
+#    phase-amplitude form, as polynomials in v = 2A^2/x^2 - 1, where A is
+#    the lower bound of the asymptotic region.
+#
+# Requires mpmath.  Coefficients are rounded to the target precision one at
+# a time, lowest degree first, refitting the remaining ones, and the degree
+# is increased until the relative error target is met.
+#
+# example usage:
+# math/tools/bessel.py -p d small
+# math/tools/bessel.py -p f asym
+
+import argparse
+import math
+import struct
+
+from mpmath import mp, mpf, besselj, bessely, besseljzero, besselyzero
+from mpmath import atan2, cos, diff, euler, floor, log, pi, sqrt
+from mpmath import matrix, qr_solve
+
+mp.dps = 60
+
+J = lambda nu, x: besselj(nu, x)
+Y = lambda nu, x: bessely(nu, x)
+
+def rnd(v, prec):
+	if prec == 'f':
+		return struct.unpack('f', struct.pack('f', float(v)))[0]
+	return float(v)
+
+def hexf(v, prec):
+	v = rnd(v, prec)
+	if v == 0:
+		return '0'
+	m, e = float.hex(v).split('p')
+	m = m.rstrip('0').rstrip('.')
+	return m + 'p' + e + ('f' if prec == 'f' else '')
+
+def split(v, prec):
+	hi = rnd(v, prec)
+	return hi, rnd(v - mpf(hi), prec)
+
+def nodes(a, b, n):
+	return [(a + b) / 2 + (b - a) / 2 * cos(pi * (k + mpf(1) / 2) / (n + 1))
+		for k in range(n + 1)]
+
+def horner(c, u):
+	p = mpf(0)
+	for cj in reversed(c):
+		p = p * u + cj
+	return p
+
+def fit(f, a, b, n, prec):
+	"""Degree n fit of f on [a, b], rounding coefficients to prec."""
+	us = nodes(a, b, n)
+	vals = [f(u) for u in us]
+	c = []
+	while len(c) <= n:
+		k0 = len(c)
+		A = matrix(n + 1, n + 1 - k0)
+		y = matrix(n + 1, 1)
+		for i, u in enumerate(us):
+			for j in range(n + 1 - k0):
+				A[i, j] = u ** (k0 + j)
+			y[i] = vals[i] - horner(c, u)
+		c.append(mpf(rnd(qr_solve(A, y)[0][0], prec)))
+	return c
+
+def maxrel(f, c, a, b, n=200):
+	m = 0
+	for k in range(n + 1):
+		u = a + (b - a) * k / n
+		v = f(u)
+		if v != 0:
+			m = max(m, abs((horner(c, u) - v) / v))
+	return m
+
+def best(name, f, a, b, prec, n0, err=None):
+	"""Smallest degree >= n0 meeting the target, or the best found."""
+	target = -27 if prec == 'f' else -55
+	bc, be, stall = None, 0, 0
+	for n in range(n0, 30):
+		c = fit(f, a, b, n, prec)
+		e = math.log2(err(c) if err else maxrel(f, c, a, b))
+		if bc is None or e < be - 0.3:
+			bc, be, stall = c, e, 0
+		else:
+			stall += 1
+		if e < target or stall == 2:
+			break
+	print('/* %s: degree %d, max rel error 2^%.1f.  */' % (name, len(bc) - 1,
+							       be))
+	return bc
+
+def emit(name, c, prec):
+	print('%s = { %s }' % (name, ', '.join(hexf(x, prec) for x in c)))
+
+def emit_split(name, v, prec):
+	hi, lo = split(v, prec)
+	print('%s_hi = %s, %s_lo = %s' % (name, hexf(hi, prec), name,
+					  hexf(lo, prec)))
+
+def phase_amplitude(nu, x):
+	"""sqrt(x) M_nu(x) and x phi_nu(x)."""
+	j, y = J(nu, x), Y(nu, x)
+	phi = atan2(y, j) - (x - (2 * nu + 1) * pi / 4)
+	phi -= 2 * pi * floor((phi + pi) / (2 * pi))
+	return sqrt(j * j + y * y) * sqrt(x), phi * x
+
+def gen_small(prec, bound, y0_local, y1_local):
+	z01, z11 = besseljzero(0, 1), besseljzero(1, 1)
+	y01, y11 = besselyzero(0, 1), besselyzero(1, 1)
+	z2 = mpf(bound) ** 2
+	n0 = 5 if prec == 'f' else 9
+
+	f = lambda z: J(0, sqrt(z)) / (z - z01 ** 2)
+	emit('j0 poly', best('j0', f, 0, z2, prec, n0), prec)
+	emit_split('z2', z01 ** 2, prec)
+	f = lambda z: (J(1, sqrt(z)) / sqrt(z) if z > 0 else mpf(1) / 2) \
+		/ (z - z11 ** 2)
+	emit('j1 poly', best('j1', f, 0, z2, prec, n0), prec)
+	emit_split('z2', z11 ** 2, prec)
+
+	def u0(z):
+		if z == 0:
+			return 2 / pi * (euler - log(2))
+		x = sqrt(z)
+		return Y(0, x) - 2 / pi * log(x) * J(0, x)
+
+	def u1(z):
+		x = sqrt(max(z, mpf(10) ** -50))
+		return (Y(1, x) - 2 / pi * (J(1, x) * log(x) - 1 / x)) / x
+
+	# U is only accurate in absolute terms, measure its error relative to Y
+	# outside the local interval around the first zero.
+	def abserr(u, nu, lo, hi):
+		def e(c):
+			m = 0
+			for k in range(1, 201):
+				z = z2 * k / 200
+				x = sqrt(z)
+				if lo <= x < hi:
+					continue
+				d = (horner(c, z) - u(z)) * (x if nu else 1)
+				m = max(m, abs(d / Y(nu, x)))
+			return m
+		return e
+
+	emit('y0 poly', best('y0', u0, 0, z2, prec, n0 - 1,
+			     abserr(u0, 0, *y0_local)), prec)
+	emit('y1 poly', best('y1', u1, 0, z2, prec, n0 - 1,
+			     abserr(u1, 1, y1_local[0], bound)), prec)
+
+	g = lambda t: Y(0, y01 + t) / t if t != 0 \
+		else diff(lambda s: Y(0, s), y01)
+	lo, hi = (mpf(v) for v in y0_local)
+	emit('y0 local_poly', best('y0 local', g, lo - y01, hi - y01, prec,
+				   n0 - 1), prec)
+	emit_split('y01', y01, prec)
+	g = lambda t: Y(1, y11 + t) / t
+	lo = mpf(y1_local[0])
+	emit('y1 local_poly', best('y1 local', g, lo - y11, bound - y11, prec,
+				   n0 - 3), prec)
+	emit_split('y11', y11, prec)
+
+def gen_mid(prec, lo, hi):
+	fs = { 'j0': (0, J, besseljzero), 'j1': (1, J, besseljzero),
+	       'y0': (0, Y, besselyzero), 'y1': (1, Y, besselyzero) }
+	for name, (nu, F, zero) in fs.items():
+		f = lambda x: F(nu, x)
+		zs = [zero(nu, k) for k in range(1, 5)]
+		print('/* %s mid table, rows { z_hi, z_lo, q_0, ... }.  */' % name)
+		for k in range(lo, hi):
+			a, b = mpf(k), mpf(k + 1)
+			# Factor the zero closest to the interval, so that the
+			# relative error stays bounded next to zeros just outside.
+			z = min(zs, key=lambda q: abs(q - (a + b) / 2))
+			g = lambda t: f(z + t) / t if t != 0 else diff(f, z)
+			c = best('%s [%d, %d)' % (name, k, k + 1), g, a - z, b - z,
+				 prec, 12)
+			hi_, lo_ = split(z, prec)
+			print('{ %s, %s, %s },' % (hexf(hi_, prec), hexf(lo_, prec),
+						   ', '.join(hexf(x, prec)
+							     for x in c)))
+
+def gen_asym(prec, bound):
+	a2 = mpf(bound) ** 2
+	# v in [-1, 1) maps to u = 1/x^2 in (0, 1/A^2].
+	x_of = lambda v: 1 / sqrt((v + 1) / (2 * a2))
+	n0 = 10 if prec == 'f' else 11
+	for nu in (0, 1):
+		m = lambda v: phase_amplitude(nu, x_of(v))[0] if v > -1 \
+			else sqrt(2 / pi)
+		h = lambda v: phase_amplitude(nu, x_of(v))[1] if v > -1 \
+			else mpf(4 * nu * nu - 1) / 8
+		emit('m%d' % nu, best('m%d' % nu, m, -1, 1, prec, n0), prec)
+		emit('h%d' % nu, best('h%d' % nu, h, -1, 1, prec, n0 + 1), prec)
+
+if __name__ == '__main__':
+	ap = argparse.ArgumentParser(
+		description='Bessel function coefficient generator')
+	ap.add_argument('-p', '--prec', choices=('f', 'd'), default='d',
+			help='target precision')
+	ap.add_argument('region', choices=('small', 'mid', 'asym'))
+	args = ap.parse_args()
+	if args.prec == 'f':
+		# Single precision has no table region, the asymptotic form
+		# starts at 2.
+		if args.region == 'small':
+			gen_small('f', 2, (0.625, 1.125), (1.75,))
+		elif args.region == 'asym':
+			gen_asym('f', 2)
+		else:
+			ap.error('no mid region in single precision')
+	else:
+		if args.region == 'small':
+			gen_small('d', 2, (0.625, 1.125), (1.75,))
+		elif args.region == 'mid':
+			gen_mid('d', 2, 8)
+		else:
+			gen_asym('d', 8)
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+
+# Accuracy vs throughput explorer.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Runs ulp and mathbench over the TEST_INTERVALs emitted by the build system
+# and reports worst-case ULP error against reciprocal throughput for every
+# routine, grouped by the function it implements (e.g. expf, _ZGVnN4v_expf,
+# _ZGVnN4v_expf_1u, _ZGVnN4v_cr_expf and arm_math_advsimd_fast_expf are all
+# variants of expf).
+#
+# The interval files are generated by 'make check-math-ulp' (or simply by
+# 'make build/math/test/inputs/itvs build/math/test/inputs/$ARCH/itvs').
+#
+# example usage:
+# math/tools/pareto.py -f expf
+# math/tools/pareto.py -f 'exp|log' -b 1.0 --csv out.csv --plot out.png
+
+import argparse
+import glob
+import math
+import os
+import re
+import subprocess
+import sys
+
+# Has to match the summary line printed by ulp.h
+ULP_RE = re.compile(r'^(PASS|FAIL) \S+ in \[([^;]+);([^\]]+)\](?: x \[[^\]]+\])?'
+		    r' round \S errlim \S+ maxerr ([^ ]+) \+([0-9.]+)')
+# Has to match the throughput line printed by mathbench.c
+BENCH_RE = re.compile(r'^\s*\S+\s+rthruput:\s+([0-9.]+) ns/elem')
+
+def fhex(s):
+	return float.fromhex(s)
+
+def family(name):
+	"""Name of the function implemented by routine NAME."""
+	f = re.sub(r'^_ZGV[ns][NM][0-9x]*[vl0-9]*_', '', name)
+	f = re.sub(r'^arm_math_(advsimd_|sve_)?(fast_)?', '', f)
+	f = re.sub(r'^cr_', '', f)
+	f = re.sub(r'_([0-9]*u[0-9]*|umax)$', '', f)
+	return f
+
+def read_itvs(paths, pattern):
+	"""Return {routine: [(lo, hi, n, arch)]} from TEST_INTERVAL files."""
+	itvs = {}
+	for path in paths:
+		# Intervals under inputs/$ARCH are tested with -z by runulp.sh.
+		arch = os.path.basename(os.path.dirname(path)) != 'inputs'
+		with open(path) as f:
+			for line in f:
+				w = line.split()
+				if len(w) != 4 or not re.search(pattern, w[0]):
+					continue
+				itvs.setdefault(w[0], []).append((w[1], w[2], int(w[3]), arch))
+	return itvs
+
+def run(cmd):
+	p = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+			   universal_newlines=True)
+	return p.stdout
+
+def run_ulp(args, name, lo, hi, n, arch):
+	"""Worst-case error (in ULP) of NAME over one interval, and its bounds."""
+	los = lo.split(',')
+	his = hi.split(',')
+	itv = [los[0], his[0]]
+	for l, h in zip(los[1:], his[1:]):
+		itv += ['x', l, h]
+	flags = ['-q', '-e', 'inf', '-r', 'n']
+	if arch:
+		flags.append('-z')
+	if name.startswith('_ZGV') or name.startswith('arm_math_'):
+		flags.append('-f')
+	cmd = args.emu + [os.path.join(args.bin, 'ulp')] + flags + [name] + itv \
+	      + [str(args.n or n)]
+	for line in run(cmd).splitlines():
+		m = ULP_RE.match(line)
+		if m:
+			return float(m.group(4)) + float(m.group(5)), \
+			       fhex(m.group(2)), fhex(m.group(3)), len(los) > 1
+	return None, None, None, len(los) > 1
+
+def run_bench(args, name, lo, hi):
+	"""Reciprocal throughput (ns/elem) of NAME with inputs in [lo, hi]."""
+	if not (math.isfinite(lo) and math.isfinite(hi)):
+		return None
+	cmd = args.emu + [os.path.join(args.bin, args.mathbench),
+			  '-m', str(args.measure), '-c', str(args.iter),
+			  '-t', 'thruput', '-i', repr(lo), repr(hi), name]
+	for line in run(cmd).splitlines():
+		m = BENCH_RE.match(line)
+		if m:
+			return float(m.group(1))
+	return None
+
+def explore(args, itvs):
+	rows = []
+	for name in sorted(itvs):
+		ulps = []
+		nss = []
+		for lo, hi, n, arch in itvs[name]:
+			ulp, flo, fhi, bivariate = run_ulp(args, name, lo, hi, n, arch)
+			if ulp is None:
+				continue
+			ulps.append(ulp)
+			# Bivariate intervals cannot be reproduced by mathbench.
+			if not bivariate:
+				ns = run_bench(args, name, flo, fhi)
+				if ns is not None:
+					nss.append(ns)
+		if not ulps:
+			print('%s: not supported by %s/ulp' % (name, args.bin),
+			      file=sys.stderr)
+			continue
+		ns = sum(nss) / len(nss) if nss else float('nan')
+		rows.append((family(name), name, max(ulps), ns, len(nss),
+			     len(itvs[name])))
+	return sorted(rows)
+
+def pareto(rows):
+	"""Routines for which no other variant is both cheaper and more
+	accurate."""
+	front = []
+	for r in rows:
+		if math.isnan(r[3]):
+			continue
+		if not any(s[2] <= r[2] and s[3] <= r[3] and (s[2], s[3]) != (r[2], r[3])
+			   for s in rows if not math.isnan(s[3])):
+			front.append(r)
+	return front
+
+def report(args, rows):
+	fams = {}
+	for r in rows:
+		fams.setdefault(r[0], []).append(r)
+	print('%-12s %-32s %9s %10s %7s %s' % ('family', 'routine', 'max ULP',
+						'ns/elem', 'bench', ''))
+	for fam in sorted(fams):
+		front = pareto(fams[fam])
+		for r in fams[fam]:
+			print('%-12s %-32s %9.4f %10.2f %3d/%-3d %s' % (r[0], r[1], r[2],
+				r[3], r[4], r[5], '*' if r in front else ''))
+	if args.budget is None:
+		return
+	print('\ncheapest routine with max ULP <= %g:' % args.budget)
+	for fam in sorted(fams):
+		ok = [r for r in fams[fam] if r[2] <= args.budget]
+		timed = [r for r in ok if not math.isnan(r[3])]
+		if timed:
+			best = min(timed, key=lambda r: r[3])
+			print('%-12s %s (%.4f ULP, %.2f ns/elem)' % (fam, best[1],
+				best[2], best[3]))
+		else:
+			print('%-12s %s' % (fam, 'not benchmarked' if ok else 'none'))
+
+def write_csv(path, rows):
+	with open(path, 'w') as f:
+		f.write('family,routine,max_ulp,ns_per_elem,benchmarked,intervals\n')
+		for r in rows:
+			f.write('%s,%s,%.6g,%.6g,%d,%d\n' % r)
+
+def plot(path, rows):
+	import matplotlib.pyplot as plt
+	fams = sorted(set(r[0] for r in rows))
+	fig, ax = plt.subplots()
+	for fam in fams:
+		rs = [r for r in rows if r[0] == fam and not math.isnan(r[3])]
+		if not rs:
+			continue
+		p = ax.plot([r[3] for r in rs], [r[2] for r in rs], '.', label=fam)
+		front = sorted(pareto(rs), key=lambda r: r[3])
+		ax.step([r[3] for r in front], [r[2] for r in front], where='post',
+			color=p[0].get_color(), alpha=0.5)
+		for r in rs:
+			ax.annotate(r[1], (r[3], r[2]), fontsize='x-small')
+	ax.set_xlabel('ns/elem')
+	ax.set_ylabel('max ULP error')
+	ax.grid()
+	ax.legend()
+	if path == '-':
+		plt.show()
+	else:
+		fig.savefig(path)
+
+def main():
+	p = argparse.ArgumentParser(description='Worst-case ULP error vs '
+				    'reciprocal throughput of math routines.')
+	p.add_argument('-f', '--filter', default='.',
+		       help='regex selecting routines (default: all)')
+	p.add_argument('-b', '--budget', type=float,
+		       help='report cheapest variant within this ULP budget')
+	p.add_argument('-n', type=int, default=0,
+		       help='ulp samples per interval (default: from TEST_INTERVAL)')
+	p.add_argument('-m', '--measure', type=int, default=10,
+		       help='mathbench measurements (default: 10)')
+	p.add_argument('-c', '--iter', type=int, default=25,
+		       help='mathbench iterations (default: 25)')
+	p.add_argument('--bin', default='build/bin',
+		       help='directory containing ulp and mathbench')
+	p.add_argument('--mathbench', default='mathbench',
+		       help='benchmark binary (e.g. mathbench_libc)')
+	p.add_argument('--itvs', nargs='+',
+		       help='interval files (default: build/math/test/inputs/**/itvs)')
+	p.add_argument('--emu', default='', help='emulator used to run the tools')
+	p.add_argument('--csv', help='write results to CSV file')
+	p.add_argument('--plot', nargs='?', const='-',
+		       help='plot ULP vs ns/elem (to file if given)')
+	args = p.parse_args()
+	args.emu = args.emu.split()
+	if not args.itvs:
+		base = 'build/math/test/inputs'
+		args.itvs = [os.path.join(base, 'itvs')] \
+			    + sorted(glob.glob(os.path.join(base, '*', 'itvs')))
+	args.itvs = [f for f in args.itvs if os.path.exists(f)]
+	if not args.itvs:
+		sys.exit('no interval files found, run make check-math-ulp first')
+
+	rows = explore(args, read_itvs(args.itvs, args.filter))
+	report(args, rows)
+	if args.csv:
+		write_csv(args.csv, rows)
+	if args.plot:
+		plot(args.plot, rows)
+
+main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+
+# Coefficient generator for the vector digamma and trigamma functions.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Fits, in the Chebyshev nodes of each interval, the approximations used by
+# aarch64/experimental/{advsimd,sve}/*polygamma*_common.h and the digamma and
+# trigamma routines, and prints them as C hex float literals:
+#
+#  - rational: digamma(1 + w) = (w - c0) N(w) / D(w) for w in [0, 1), with
+#    c0 = x0 - 1 and x0 the positive zero of digamma, D(0) = 1.
+#  - asym: digamma(t) = log(t) - 1/(2t) - z P(z) and
+#    trigamma(t) = r + r^2/2 + r^3 Q(r^2), with r = 1/t and z = r^2, for
+#    t >= A, where A is the lower bound of the asymptotic region.
+#  - sinpi: sin(pi r) / pi = r + r^3 S(r^2) for |r| <= 1/2, used by the
+#    reflection formulas.
+#
+# Requires mpmath.  Polynomials are least-squares fits in oversampled
+# Chebyshev nodes, the rational approximation is refined with
+# Sanathanan-Koerner iterations for relative error.  Degrees and region
+# bounds are those of the routines.
+#
+# example usage:
+# math/tools/polygamma.py -p d rational
+# math/tools/polygamma.py -p f asym
+
+import argparse
+import math
+import struct
+
+from mpmath import mp, mpf, cos, findroot, log, pi, psi, sin, sqrt
+from mpmath import matrix, qr_solve
+
+mp.dps = 50
+
+x0 = findroot(lambda x: psi(0, x), 1.46)
+
+def rnd(v, prec):
+	if prec == 'f':
+		return struct.unpack('f', struct.pack('f', float(v)))[0]
+	return float(v)
+
+def hexf(v, prec):
+	v = rnd(v, prec)
+	if v == 0:
+		return '0'
+	m, e = float.hex(v).split('p')
+	m = m.rstrip('0').rstrip('.')
+	return m + 'p' + e + ('f' if prec == 'f' else '')
+
+def nodes(a, b, n):
+	return [(a + b) / 2 + (b - a) / 2 * cos(pi * (k + mpf(1) / 2) / (n + 1))
+		for k in range(n + 1)]
+
+def horner(c, u):
+	p = mpf(0)
+	for cj in reversed(c):
+		p = p * u + cj
+	return p
+
+def maxrel(f, g, a, b, n=400):
+	m = 0
+	for k in range(n + 1):
+		u = a + (b - a) * mpf(k) / n
+		m = max(m, abs(g(u) / f(u) - 1))
+	return m
+
+def ratfit(f, a, b, p, q, prec, iters=8):
+	"""Degree (p, q) fit of f on [a, b] with D(0) = 1.  The first
+	iteration minimizes the absolute error, the following ones the
+	relative error."""
+	us = nodes(a, b, 4 * (p + q + 2))
+	vals = [f(u) for u in us]
+	w = [mpf(1)] * len(us)
+	for it in range(iters):
+		A = matrix(len(us), p + 1 + q)
+		y = matrix(len(us), 1)
+		for i, u in enumerate(us):
+			for j in range(p + 1):
+				A[i, j] = u ** j * w[i]
+			for j in range(q):
+				A[i, p + 1 + j] = -vals[i] * u ** (j + 1) * w[i]
+			y[i] = vals[i] * w[i]
+		c = qr_solve(A, y)[0]
+		N = [c[j] for j in range(p + 1)]
+		D = [mpf(1)] + [c[p + 1 + j] for j in range(q)]
+		w = [1 / (horner(D, u) * vals[i]) for i, u in enumerate(us)]
+	N = [mpf(rnd(v, prec)) for v in N]
+	D = [mpf(rnd(v, prec)) for v in D]
+	return N, D
+
+def poly(name, f, a, b, prec, n):
+	c = ratfit(f, a, b, n, 0, prec, iters=1)[0]
+	e = math.log2(maxrel(f, lambda u: horner(c, u), a, b))
+	print('/* %s: degree %d, max rel error 2^%.1f.  */' % (name, n, e))
+	return c
+
+def emit(name, c, prec):
+	print('%s = { %s }' % (name, ', '.join(hexf(x, prec) for x in c)))
+
+def gen_rational(prec):
+	c0 = x0 - 1
+	f = lambda w: psi(0, 1 + w) / (w - c0) if w != c0 else psi(1, x0)
+	p = 3 if prec == 'f' else 6
+	N, D = ratfit(f, mpf(0), mpf(1), p, p, prec)
+	e = maxrel(f, lambda w: horner(N, w) / horner(D, w), 0, 1)
+	print('/* degree (%d, %d), max rel error 2^%.1f.  */'
+	      % (len(N) - 1, len(D) - 1, math.log2(e)))
+	emit('num', N, prec)
+	# The leading 1 of D is implicit.
+	emit('den', D[1:], prec)
+	hi = rnd(c0, prec)
+	print('c0_hi = %s, c0_lo = %s' % (hexf(hi, prec),
+					  hexf(c0 - mpf(hi), prec)))
+
+def gen_asym(prec):
+	a, n = (mpf(2), 4) if prec == 'f' else (mpf(6), 6)
+	P = lambda z: (log(1 / sqrt(z)) - sqrt(z) / 2 - psi(0, 1 / sqrt(z))) / z \
+		if z > 0 else mpf(1) / 12
+	emit('asym_poly (digamma)', poly('P', P, 0, 1 / a ** 2, prec, n), prec)
+	a, n = (mpf(4), 3) if prec == 'f' else (mpf(10), 5)
+	Q = lambda z: (psi(1, 1 / sqrt(z)) - sqrt(z) - z / 2) / z ** 1.5 \
+		if z > 0 else mpf(1) / 6
+	emit('asym_poly (trigamma)', poly('Q', Q, 0, 1 / a ** 2, prec, n),
+	     prec)
+
+def gen_sinpi(prec):
+	S = lambda z: (sin(pi * sqrt(z)) / pi - sqrt(z)) / z ** 1.5 \
+		if z > 0 else -pi ** 2 / 6
+	n = 4 if prec == 'f' else 7
+	emit('sinpi_poly', poly('S', S, 0, mpf(1) / 4, prec, n), prec)
+	hi = rnd(pi, prec)
+	print('pi_hi = %s, pi_lo = %s' % (hexf(hi, prec),
+					  hexf(pi - mpf(hi), prec)))
+
+if __name__ == '__main__':
+	ap = argparse.ArgumentParser(
+		description='digamma and trigamma coefficient generator')
+	ap.add_argument('-p', '--prec', choices=('f', 'd'), default='d',
+			help='target precision')
+	ap.add_argument('region', choices=('rational', 'asym', 'sinpi'))
+	args = ap.parse_args()
+	if args.region == 'rational':
+		gen_rational(args.prec)
+	elif args.region == 'asym':
+		gen_asym(args.prec)
+	else:
+		gen_sinpi(args.prec)
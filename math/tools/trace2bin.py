@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+
+# Converter between text and binary mathbench traces.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Text traces have one record per line: an optional integer timestamp
+# (with -s) followed by one or two arguments in any format accepted by
+# strtod, including hex floats.  The binary format is described in
+# math/test/mathbench_trace.h, it is mapped by mathbench -f instead of being
+# parsed, which matters for traces of millions of values.
+#
+# example usage:
+# math/tools/trace2bin.py math/test/traces/exp.txt exp.bin
+# math/tools/trace2bin.py -t f math/test/traces/sincosf.txt sincosf.bin
+# math/tools/trace2bin.py -d exp.bin | head
+
+import argparse
+import array
+import struct
+import sys
+
+MAGIC = b'MBTRACE1'
+TIMESTAMP = 1
+# Has to match struct mathbench_trace_header.
+HEADER = struct.Struct('=8sBBHIQ')
+
+def parse_value(s):
+	try:
+		return float(s)
+	except ValueError:
+		return float.fromhex(s)
+
+def to_binary(args):
+	src = sys.stdin if args.input == '-' else open(args.input)
+	stamps = array.array('Q')
+	values = array.array(args.type)
+	arity = None
+	for n, line in enumerate(src, 1):
+		w = line.split()
+		if not w or w[0].startswith('#'):
+			continue
+		if args.timestamps:
+			stamps.append(int(w[0], 0))
+			w = w[1:]
+		if arity is None:
+			arity = len(w)
+			if arity not in (1, 2):
+				sys.exit('%s:%d: expected 1 or 2 arguments' % (args.input, n))
+		elif len(w) != arity:
+			sys.exit('%s:%d: expected %d arguments' % (args.input, n, arity))
+		values.extend(parse_value(v) for v in w)
+	if arity is None:
+		sys.exit('%s: empty trace' % args.input)
+	count = len(values) // arity
+	size = values.itemsize * arity
+	with open(args.output, 'wb') as out:
+		out.write(HEADER.pack(MAGIC, ord(args.type), arity,
+				      TIMESTAMP if args.timestamps else 0, 0,
+				      count))
+		if not args.timestamps:
+			values.tofile(out)
+			return
+		raw = values.tobytes()
+		for i in range(count):
+			out.write(struct.pack('=Q', stamps[i]))
+			out.write(raw[i * size:(i + 1) * size])
+
+def dump(args):
+	with open(args.input, 'rb') as f:
+		data = f.read()
+	magic, ty, arity, flags, _, count = HEADER.unpack_from(data)
+	if magic != MAGIC:
+		sys.exit('%s: not a binary trace' % args.input)
+	fmt = '=' + ('Q' if flags & TIMESTAMP else '') + chr(ty) * arity
+	rec = struct.Struct(fmt)
+	if count == 0:
+		count = (len(data) - HEADER.size) // rec.size
+	out = sys.stdout
+	for i in range(count):
+		r = rec.unpack_from(data, HEADER.size + i * rec.size)
+		w = [str(r[0])] if flags & TIMESTAMP else []
+		w += [float(v).hex() for v in r[len(r) - arity:]]
+		out.write(' '.join(w) + '\n')
+
+def main():
+	p = argparse.ArgumentParser(description='Convert a text mathbench '
+				    'trace to the binary format.')
+	p.add_argument('-t', '--type', choices='df', default='d',
+		       help='argument type: d for double, f for float '
+		       '(default: d)')
+	p.add_argument('-s', '--timestamps', action='store_true',
+		       help='lines start with an integer timestamp')
+	p.add_argument('-d', '--dump', action='store_true',
+		       help='print a binary trace as text instead')
+	p.add_argument('input', help='input trace, - for stdin')
+	p.add_argument('output', nargs='?', help='output binary trace')
+	args = p.parse_args()
+	if args.dump:
+		dump(args)
+	elif args.output:
+		to_binary(args)
+	else:
+		p.error('the output file is required')
+
+main()